@@ -0,0 +1,160 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* enable posix extensions for clock_gettime(). */
+#define _POSIX_C_SOURCE 200809L
+
+/* include the blas header. */
+#include <matte/blas.h>
+
+/* include the timing header. */
+#include <time.h>
+
+/* BENCH_SECONDS: minimum duration of each timed operation. */
+#define BENCH_SECONDS 0.25
+
+/* backends: names of the backends to compare. */
+static const char *backends[] = {
+  "generic", "reference", "atlas", "openblas", NULL
+};
+
+/* sizes: matrix sizes to benchmark. */
+static const long sizes[] = { 64, 256, 512, 0 };
+
+/* operands: shared inputs and outputs of the benchmarked operations. */
+static struct {
+  Matrix A, B, C;
+  ComplexMatrix ZA, ZB, ZC;
+  Vector x, y;
+}
+ops;
+
+/* now(): get the current time.
+ *
+ * returns:
+ *  monotonic time in seconds.
+ */
+static double now (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + 1.0e-9 * (double) ts.tv_nsec;
+}
+
+/* run_*(): execute one benchmarked operation. */
+
+static void run_daxpy (Zone z) {
+  matte_daxpy(1.0e-3, ops.x, ops.y);
+}
+
+static void run_dgemv (Zone z) {
+  matte_dgemv(CblasNoTrans, 1.0, ops.A, ops.x, 0.0, ops.y);
+}
+
+static void run_dgemm (Zone z) {
+  matte_dgemm(CblasNoTrans, CblasNoTrans, 1.0, ops.A, ops.B, 0.0, ops.C);
+}
+
+static void run_zgemm (Zone z) {
+  matte_zgemm(CblasNoTrans, CblasNoTrans, 1.0, ops.ZA, ops.ZB,
+              0.0, ops.ZC);
+}
+
+static void run_solve (Zone z) {
+  object_free(z, object_mldivide(z, (Object) ops.A, (Object) ops.B));
+}
+
+/* bench(): time an operation, repeating it until the total duration
+ * exceeds BENCH_SECONDS.
+ *
+ * arguments:
+ *  @z: zone allocator for temporary objects.
+ *  @fn: operation to time.
+ *  @flops: number of floating-point operations per call.
+ *
+ * returns:
+ *  achieved rate, in gigaflops per second.
+ */
+static double bench (Zone z, void (*fn) (Zone), double flops) {
+  /* warm up, then repeat until the minimum duration is reached. */
+  fn(z);
+  long reps = 0;
+  const double t0 = now();
+  double t;
+  do {
+    fn(z);
+    reps++;
+    t = now() - t0;
+  }
+  while (t < BENCH_SECONDS);
+
+  return 1.0e-9 * flops * (double) reps / t;
+}
+
+/* main(): compare the blas backends on level 1, 2 and 3 operations, and
+ * on the solution of linear systems.
+ */
+int main (int argc, char **argv) {
+  struct _Zone zs;
+  Zone z = &zs;
+  zone_init(z, 16);
+
+  /* print the table header. */
+  printf("%-10s %6s %10s %10s %10s %10s %10s\n", "backend", "n",
+         "daxpy", "dgemv", "dgemm", "zgemm", "solve");
+
+  for (long s = 0; sizes[s]; s++) {
+    /* allocate and fill the operands. */
+    const long n = sizes[s];
+    ops.A = matrix_new_with_size(z, n, n);
+    ops.B = matrix_new_with_size(z, n, n);
+    ops.C = matrix_new_with_size(z, n, n);
+    ops.ZA = complex_matrix_new_with_size(z, n, n);
+    ops.ZB = complex_matrix_new_with_size(z, n, n);
+    ops.ZC = complex_matrix_new_with_size(z, n, n);
+    ops.x = vector_new_with_length(z, n);
+    ops.y = vector_new_with_length(z, n);
+    if (!ops.A || !ops.B || !ops.C || !ops.ZA || !ops.ZB || !ops.ZC ||
+        !ops.x || !ops.y)
+      return 1;
+
+    srand(n);
+    for (long i = 0; i < n * n; i++) {
+      ops.A->data[i] = (double) rand() / RAND_MAX;
+      ops.B->data[i] = (double) rand() / RAND_MAX;
+      ops.ZA->data[i] = ops.A->data[i] + I * ops.B->data[i];
+      ops.ZB->data[i] = ops.B->data[i] - I * ops.A->data[i];
+    }
+
+    for (long i = 0; i < n; i++) {
+      ops.A->data[i + i * n] += (double) n;
+      ops.x->data[i] = ops.y->data[i] = 1.0;
+    }
+
+    /* time each backend that can be loaded. */
+    const double dn = (double) n;
+    for (int b = 0; backends[b]; b++) {
+      if (!blas_backend_load(backends[b]))
+        continue;
+
+      printf("%-10s %6ld", blas_backend_name(), n);
+      printf(" %10.3f", bench(z, run_daxpy, 2.0 * dn));
+      printf(" %10.3f", bench(z, run_dgemv, 2.0 * dn * dn));
+      printf(" %10.3f", bench(z, run_dgemm, 2.0 * dn * dn * dn));
+      printf(" %10.3f", bench(z, run_zgemm, 8.0 * dn * dn * dn));
+      printf(" %10.3f", bench(z, run_solve, 8.0 / 3.0 * dn * dn * dn));
+      printf("\n");
+      fflush(stdout);
+    }
+
+    /* free the operands. */
+    object_free_all(z);
+  }
+
+  /* print the units of the table. */
+  printf("\nrates in gigaflops per second.\n");
+  zone_destroy(z);
+  return 0;
+}
+
@@ -0,0 +1,139 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* enable posix extensions for clock_gettime(). */
+#define _POSIX_C_SOURCE 200809L
+
+/* include the transpose header. */
+#include <matte/transpose.h>
+
+/* include the standard io, string and timing headers. */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* BENCH_SECONDS: minimum duration of each timed operation. */
+#define BENCH_SECONDS 0.25
+
+/* sizes: matrix sizes to benchmark. */
+static const long sizes[] = { 256, 1024, 2048, 0 };
+
+/* operands: shared inputs and outputs of the benchmarked operations. */
+static struct {
+  double *a, *b;
+  complex double *za, *zb;
+  long n;
+}
+ops;
+
+/* now(): get the current time.
+ *
+ * returns:
+ *  monotonic time in seconds.
+ */
+static double now (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + 1.0e-9 * (double) ts.tv_nsec;
+}
+
+/* run_*(): execute one benchmarked operation. */
+
+static void run_memcpy (void) {
+  memcpy(ops.b, ops.a, ops.n * ops.n * sizeof(double));
+}
+
+static void run_naive (void) {
+  const long n = ops.n;
+  for (long j = 0; j < n; j++)
+    for (long i = 0; i < n; i++)
+      ops.b[j + i * n] = ops.a[i + j * n];
+}
+
+static void run_dtrans (void) {
+  transpose_d(ops.n, ops.n, ops.a, ops.b);
+}
+
+static void run_dinplace (void) {
+  transpose_d_inplace(ops.n, ops.b);
+}
+
+static void run_ztrans (void) {
+  transpose_z(ops.n, ops.n, ops.za, ops.zb, 1);
+}
+
+/* bench(): time an operation, repeating it until the total duration
+ * exceeds BENCH_SECONDS.
+ *
+ * arguments:
+ *  @fn: operation to time.
+ *  @bytes: number of bytes read and written per call.
+ *
+ * returns:
+ *  achieved bandwidth, in gigabytes per second.
+ */
+static double bench (void (*fn) (void), double bytes) {
+  /* warm up, then repeat until the minimum duration is reached. */
+  fn();
+  long reps = 0;
+  const double t0 = now();
+  double t;
+  do {
+    fn();
+    reps++;
+    t = now() - t0;
+  }
+  while (t < BENCH_SECONDS);
+
+  return 1.0e-9 * bytes * (double) reps / t;
+}
+
+/* main(): compare the transposition kernels against a naive loop and
+ * against a plain memory copy of the same size.
+ */
+int main (int argc, char **argv) {
+  /* print the table header. */
+  printf("%6s %10s %10s %10s %10s %10s\n", "n",
+         "memcpy", "naive", "dtrans", "dinplace", "ztrans");
+
+  for (long s = 0; sizes[s]; s++) {
+    /* allocate and fill the operands. */
+    const long n = sizes[s];
+    ops.n = n;
+    ops.a = malloc(n * n * sizeof(double));
+    ops.b = malloc(n * n * sizeof(double));
+    ops.za = malloc(n * n * sizeof(complex double));
+    ops.zb = malloc(n * n * sizeof(complex double));
+    if (!ops.a || !ops.b || !ops.za || !ops.zb)
+      return 1;
+
+    for (long i = 0; i < n * n; i++) {
+      ops.a[i] = ops.b[i] = (double) i;
+      ops.za[i] = (double) i - I * (double) i;
+    }
+
+    /* time each operation, counting the bytes read and written. */
+    const double bytes = 2.0 * (double) (n * n) * sizeof(double);
+    printf("%6ld", n);
+    printf(" %10.3f", bench(run_memcpy, bytes));
+    printf(" %10.3f", bench(run_naive, bytes));
+    printf(" %10.3f", bench(run_dtrans, bytes));
+    printf(" %10.3f", bench(run_dinplace, bytes));
+    printf(" %10.3f", bench(run_ztrans, 2.0 * bytes));
+    printf("\n");
+    fflush(stdout);
+
+    /* free the operands. */
+    free(ops.a);
+    free(ops.b);
+    free(ops.za);
+    free(ops.zb);
+  }
+
+  /* print the units of the table. */
+  printf("\nbandwidths in gigabytes per second.\n");
+  return 0;
+}
+
@@ -0,0 +1,317 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* enable posix extensions for dlopen(). */
+#define _POSIX_C_SOURCE 200809L
+
+/* include the blas header. */
+#include <matte/blas.h>
+
+/* include the dynamic loader header. */
+#include <dlfcn.h>
+
+/* matte_blas: currently selected backend. the portable kernels are used
+ * until blas_init() has loaded an optimized library.
+ */
+BlasBackend matte_blas = &blas_generic;
+
+/* backend: storage of the currently loaded backend, and the handles of
+ * the libraries that provide its routines.
+ */
+static struct _BlasBackend backend;
+static void *handle = NULL, *lapack_handle = NULL;
+
+/* symbols: table of cblas and clapack symbol names, along with the
+ * offsets of the backend members that they are loaded into.
+ */
+static const struct {
+  const char *name;
+  size_t off;
+}
+symbols[] = {
+#define SYM(pre, fn) { #pre "_" #fn, offsetof(struct _BlasBackend, fn) }
+  SYM(cblas, daxpy),  SYM(cblas, dscal),  SYM(cblas, dcopy),
+  SYM(cblas, dswap),  SYM(cblas, ddot),   SYM(cblas, dnrm2),
+  SYM(cblas, zaxpy),  SYM(cblas, zscal),  SYM(cblas, zcopy),
+  SYM(cblas, zswap),  SYM(cblas, zdotu_sub),
+  SYM(cblas, zdotc_sub),                  SYM(cblas, dznrm2),
+  SYM(cblas, saxpy),  SYM(cblas, sscal),  SYM(cblas, scopy),
+  SYM(cblas, sswap),  SYM(cblas, sdot),   SYM(cblas, snrm2),
+  SYM(cblas, dgemv),  SYM(cblas, dsymv),  SYM(cblas, dtrmv),
+  SYM(cblas, dtrsv),  SYM(cblas, dger),   SYM(cblas, dsyr),
+  SYM(cblas, dsyr2),
+  SYM(cblas, zgemv),  SYM(cblas, zhemv),  SYM(cblas, ztrmv),
+  SYM(cblas, ztrsv),  SYM(cblas, zgeru),  SYM(cblas, zgerc),
+  SYM(cblas, zher),   SYM(cblas, zher2),
+  SYM(cblas, sgemv),  SYM(cblas, ssymv),  SYM(cblas, strmv),
+  SYM(cblas, strsv),  SYM(cblas, sger),   SYM(cblas, ssyr),
+  SYM(cblas, ssyr2),
+  SYM(cblas, dgemm),  SYM(cblas, dsymm),  SYM(cblas, dsyrk),
+  SYM(cblas, dsyr2k), SYM(cblas, dtrmm),  SYM(cblas, dtrsm),
+  SYM(cblas, zgemm),  SYM(cblas, zsymm),  SYM(cblas, zhemm),
+  SYM(cblas, zsyrk),  SYM(cblas, zherk),  SYM(cblas, zsyr2k),
+  SYM(cblas, zher2k), SYM(cblas, ztrmm),  SYM(cblas, ztrsm),
+  SYM(cblas, sgemm),  SYM(cblas, ssymm),  SYM(cblas, ssyrk),
+  SYM(cblas, ssyr2k), SYM(cblas, strmm),  SYM(cblas, strsm),
+  SYM(clapack, dgetrf), SYM(clapack, dgetrs),
+  SYM(clapack, dpotrf), SYM(clapack, dpotrs),
+#undef SYM
+  { NULL, 0 }
+};
+
+/* libraries: table of known backend names, along with the shared
+ * libraries that are tried, in order, to load each backend.
+ */
+static const struct {
+  const char *name;
+  const char *libs[5];
+}
+libraries[] = {
+  { "openblas",  { "libopenblas.so.0", "libopenblas.so", NULL } },
+  { "atlas",     { "libtatlas.so.3", "libtatlas.so",
+                   "libsatlas.so.3", "libsatlas.so", NULL } },
+  { "reference", { "libcblas.so.3", "libcblas.so",
+                   "libblas.so.3", "libblas.so", NULL } },
+  { NULL, { NULL } }
+};
+
+/* lapack_libs: shared libraries that are searched for the fortran lapack
+ * interface, when the blas library does not provide it.
+ */
+static const char *lapack_libs[] = {
+  "liblapack.so.3", "liblapack.so", NULL
+};
+
+/* f77_*: fortran lapack routines used by the clapack adapters below. */
+static void (*f77_dgetrf) (const int*, const int*, double*, const int*,
+                           int*, int*);
+static void (*f77_dgetrs) (const char*, const int*, const int*,
+                           const double*, const int*, const int*,
+                           double*, const int*, int*);
+static void (*f77_dpotrf) (const char*, const int*, double*, const int*,
+                           int*);
+static void (*f77_dpotrs) (const char*, const int*, const int*,
+                           const double*, const int*, double*,
+                           const int*, int*);
+
+/* f77_dgetrf_adapter(): clapack-style adapter around dgetrf_(). */
+static int f77_dgetrf_adapter (const enum CBLAS_ORDER order,
+                               const int m, const int n,
+                               double *A, const int lda, int *ipiv) {
+  /* factorize and convert the pivot indices to be zero-based. */
+  int info;
+  f77_dgetrf(&m, &n, A, &lda, ipiv, &info);
+  for (int i = 0; i < (m < n ? m : n); i++)
+    ipiv[i]--;
+
+  return info;
+}
+
+/* f77_dgetrs_adapter(): clapack-style adapter around dgetrs_(). */
+static int f77_dgetrs_adapter (const enum CBLAS_ORDER order,
+                               const enum CBLAS_TRANSPOSE trans,
+                               const int n, const int nrhs,
+                               const double *A, const int lda,
+                               const int *ipiv, double *B, const int ldb) {
+  /* convert the pivot indices to be one-based. */
+  int *p = malloc((n > 0 ? n : 1) * sizeof(int));
+  if (!p)
+    return -1;
+
+  for (int i = 0; i < n; i++)
+    p[i] = ipiv[i] + 1;
+
+  /* solve the system. */
+  int info;
+  const char c = (trans == CblasNoTrans ? 'N' : 'T');
+  f77_dgetrs(&c, &n, &nrhs, A, &lda, p, B, &ldb, &info);
+
+  free(p);
+  return info;
+}
+
+/* f77_dpotrf_adapter(): clapack-style adapter around dpotrf_(). */
+static int f77_dpotrf_adapter (const enum CBLAS_ORDER order,
+                               const enum CBLAS_UPLO uplo, const int n,
+                               double *A, const int lda) {
+  int info;
+  const char c = (uplo == CblasUpper ? 'U' : 'L');
+  f77_dpotrf(&c, &n, A, &lda, &info);
+  return info;
+}
+
+/* f77_dpotrs_adapter(): clapack-style adapter around dpotrs_(). */
+static int f77_dpotrs_adapter (const enum CBLAS_ORDER order,
+                               const enum CBLAS_UPLO uplo,
+                               const int n, const int nrhs,
+                               const double *A, const int lda,
+                               double *B, const int ldb) {
+  int info;
+  const char c = (uplo == CblasUpper ? 'U' : 'L');
+  f77_dpotrs(&c, &n, &nrhs, A, &lda, B, &ldb, &info);
+  return info;
+}
+
+/* find_f77(): look up the fortran lapack routines in a library.
+ *
+ * arguments:
+ *  @lib: handle of the library to search.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) all routines were found.
+ */
+static int find_f77 (void *lib) {
+  /* look up each routine. */
+  void *getrf = dlsym(lib, "dgetrf_");
+  void *getrs = dlsym(lib, "dgetrs_");
+  void *potrf = dlsym(lib, "dpotrf_");
+  void *potrs = dlsym(lib, "dpotrs_");
+  if (!getrf || !getrs || !potrf || !potrs)
+    return 0;
+
+  /* store the routines. */
+  *(void**) &f77_dgetrf = getrf;
+  *(void**) &f77_dgetrs = getrs;
+  *(void**) &f77_dpotrf = potrf;
+  *(void**) &f77_dpotrs = potrs;
+  return 1;
+}
+
+/* load_library(): load the routines of a backend from a shared library.
+ * routines that are missing from the library are replaced by their
+ * portable counterparts, and lapack routines are taken from the system
+ * lapack library when the blas library does not export them.
+ *
+ * arguments:
+ *  @name: name of the backend.
+ *  @lib: path or soname of the shared library to load.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the library was loaded.
+ */
+static int load_library (const char *name, const char *lib) {
+  /* open the library, which must at least provide a matrix product. */
+  void *h = dlopen(lib, RTLD_NOW | RTLD_LOCAL);
+  if (!h)
+    return 0;
+
+  if (!dlsym(h, "cblas_dgemm")) {
+    dlclose(h);
+    return 0;
+  }
+
+  /* start from the portable kernels and overlay the library routines. */
+  struct _BlasBackend b = blas_generic;
+  b.name = name;
+  for (int i = 0; symbols[i].name; i++) {
+    void *sym = dlsym(h, symbols[i].name);
+    if (sym)
+      *(void**) ((char*) &b + symbols[i].off) = sym;
+  }
+
+  /* fall back to the fortran lapack interface, when available. */
+  void *hl = NULL;
+  if (b.dgetrf == blas_generic.dgetrf) {
+    int f77 = find_f77(h);
+    for (int i = 0; !f77 && lapack_libs[i]; i++) {
+      hl = dlopen(lapack_libs[i], RTLD_NOW | RTLD_LOCAL);
+      if (hl && !(f77 = find_f77(hl))) {
+        dlclose(hl);
+        hl = NULL;
+      }
+    }
+
+    if (f77) {
+      b.dgetrf = f77_dgetrf_adapter;
+      b.dgetrs = f77_dgetrs_adapter;
+      b.dpotrf = f77_dpotrf_adapter;
+      b.dpotrs = f77_dpotrs_adapter;
+    }
+  }
+
+  /* release the handles of the previously loaded backend. */
+  if (handle) dlclose(handle);
+  if (lapack_handle) dlclose(lapack_handle);
+
+  /* store the new backend. */
+  backend = b;
+  handle = h;
+  lapack_handle = hl;
+  matte_blas = &backend;
+  return 1;
+}
+
+/* blas_backend_load(): select the blas backend used by matte.
+ *
+ * arguments:
+ *  @name: name of a known backend, or the path of a shared library
+ *         that exports the cblas interface.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the backend was loaded.
+ *  on failure, the current backend remains selected.
+ */
+int blas_backend_load (const char *name) {
+  /* the portable kernels are always available. */
+  if (!name)
+    return 0;
+
+  if (strcmp(name, blas_generic.name) == 0) {
+    if (handle) dlclose(handle);
+    if (lapack_handle) dlclose(lapack_handle);
+
+    handle = lapack_handle = NULL;
+    matte_blas = &blas_generic;
+    return 1;
+  }
+
+  /* try each library of known backends. */
+  for (int i = 0; libraries[i].name; i++) {
+    if (strcmp(name, libraries[i].name))
+      continue;
+
+    for (int j = 0; libraries[i].libs[j]; j++) {
+      if (load_library(libraries[i].name, libraries[i].libs[j]))
+        return 1;
+    }
+
+    return 0;
+  }
+
+  /* try the name as a library. */
+  return load_library(name, name);
+}
+
+/* blas_backend_name(): get the name of the selected blas backend.
+ *
+ * returns:
+ *  name of the backend.
+ */
+const char *blas_backend_name (void) {
+  return matte_blas->name;
+}
+
+/* blas_init(): select the initial blas backend. when no backend is
+ * requested in the environment, the known optimized libraries are
+ * tried in order of preference.
+ */
+__attribute__((constructor))
+static void blas_init (void) {
+  /* load the requested backend, if any. */
+  const char *env = getenv(BLAS_ENV);
+  if (env && *env) {
+    if (!blas_backend_load(env))
+      fprintf(stderr, "matte: unable to load blas backend '%s'\n", env);
+
+    return;
+  }
+
+  /* otherwise, use the first available optimized library. */
+  for (int i = 0; libraries[i].name; i++) {
+    if (blas_backend_load(libraries[i].name))
+      return;
+  }
+}
+
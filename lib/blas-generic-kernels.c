@@ -0,0 +1,466 @@
+
+/* define macros for generating portable blas kernels. all matrices are
+ * stored in column-major order.
+ */
+#define CONCAT3(a,b,c)   a ## b ## c
+#define KNAME(p,name)    CONCAT3(generic_, p, name)
+#define NAME(name)       KNAME(P, name)
+
+/* START(): macro to compute the offset of the first element of a strided
+ * vector, following the blas convention for negative increments.
+ */
+#define START(n,inc) ((inc) < 0 ? (long) (1 - (n)) * (inc) : 0L)
+
+/* ELEM(): macro to access an element of a column-major matrix. */
+#define ELEM(A,lda,i,j) (A)[(i) + (long) (j) * (lda)]
+
+/* OPC(): macro to conditionally conjugate an element. */
+#define OPC(c,x) ((c) ? CONJ(x) : (x))
+
+/* === level 1 === */
+
+/* generic_*axpy(): compute y := alpha * x + y. */
+static void NAME(axpy) (const int n, const T alpha,
+                        const T *x, const int incx,
+                        T *y, const int incy) {
+  long ix = START(n, incx), iy = START(n, incy);
+  for (int i = 0; i < n; i++, ix += incx, iy += incy)
+    y[iy] += alpha * x[ix];
+}
+
+/* generic_*scal(): compute x := alpha * x. */
+static void NAME(scal) (const int n, const T alpha, T *x, const int incx) {
+  if (incx <= 0)
+    return;
+
+  for (long i = 0, ix = 0; i < n; i++, ix += incx)
+    x[ix] *= alpha;
+}
+
+/* generic_*copy(): compute y := x. */
+static void NAME(copy) (const int n, const T *x, const int incx,
+                        T *y, const int incy) {
+  long ix = START(n, incx), iy = START(n, incy);
+  for (int i = 0; i < n; i++, ix += incx, iy += incy)
+    y[iy] = x[ix];
+}
+
+/* generic_*swap(): exchange the elements of x and y. */
+static void NAME(swap) (const int n, T *x, const int incx,
+                        T *y, const int incy) {
+  long ix = START(n, incx), iy = START(n, incy);
+  for (int i = 0; i < n; i++, ix += incx, iy += incy) {
+    const T t = x[ix];
+    x[ix] = y[iy];
+    y[iy] = t;
+  }
+}
+
+/* generic_*dot(): compute x' * y, optionally conjugating x. */
+static T NAME(dot) (const int n, const T *x, const int incx,
+                    const T *y, const int incy, const int cx) {
+  T s = 0.0;
+  long ix = START(n, incx), iy = START(n, incy);
+  for (int i = 0; i < n; i++, ix += incx, iy += incy)
+    s += OPC(cx, x[ix]) * y[iy];
+
+  return s;
+}
+
+/* generic_*nrm2(): compute the euclidean norm of x, scaling the sum of
+ * squares to avoid overflow.
+ */
+static double NAME(nrm2) (const int n, const T *x, const int incx) {
+  if (n < 1 || incx <= 0)
+    return 0.0;
+
+  double scale = 0.0, ssq = 1.0;
+  for (long i = 0, ix = 0; i < n; i++, ix += incx) {
+    const double a = ABS(x[ix]);
+    if (a == 0.0)
+      continue;
+
+    if (scale < a) {
+      ssq = 1.0 + ssq * (scale / a) * (scale / a);
+      scale = a;
+    }
+    else
+      ssq += (a / scale) * (a / scale);
+  }
+
+  return scale * sqrt(ssq);
+}
+
+/* === structured matrix elements === */
+
+/* generic_*sym(): get an element of a symmetric or hermitian matrix that
+ * is stored in its upper or lower triangle.
+ */
+static inline T NAME(sym) (const int upper, const int herm,
+                           const T *A, const int lda,
+                           const int i, const int j) {
+  if (upper ? i <= j : i >= j) {
+    const T aij = ELEM(A, lda, i, j);
+    return (herm && i == j ? REAL(aij) : aij);
+  }
+
+  return OPC(herm, ELEM(A, lda, j, i));
+}
+
+/* generic_*tri(): get an element of a triangular matrix that is stored
+ * in its upper or lower triangle, after optional transposition (@tr) and
+ * conjugation (@cj).
+ */
+static inline T NAME(tri) (const int upper, const int tr, const int cj,
+                           const int unit, const T *A, const int lda,
+                           int i, int j) {
+  if (tr) {
+    const int k = i;
+    i = j;
+    j = k;
+  }
+
+  if (upper ? i > j : i < j)
+    return 0.0;
+
+  if (unit && i == j)
+    return 1.0;
+
+  return OPC(cj, ELEM(A, lda, i, j));
+}
+
+/* generic_*trmul(): compute x := op(A) * x for a triangular matrix. */
+static void NAME(trmul) (const int upper, const int tr, const int cj,
+                         const int unit, const int n,
+                         const T *A, const int lda,
+                         T *x, const int incx) {
+  /* determine whether op(A) is upper triangular. */
+  if (upper != tr) {
+    /* each element depends on the elements that follow it. */
+    for (int i = 0; i < n; i++) {
+      T s = 0.0;
+      for (int j = i; j < n; j++)
+        s += NAME(tri)(upper, tr, cj, unit, A, lda, i, j) * x[j * incx];
+
+      x[i * incx] = s;
+    }
+  }
+  else {
+    /* each element depends on the elements that precede it. */
+    for (int i = n - 1; i >= 0; i--) {
+      T s = 0.0;
+      for (int j = 0; j <= i; j++)
+        s += NAME(tri)(upper, tr, cj, unit, A, lda, i, j) * x[j * incx];
+
+      x[i * incx] = s;
+    }
+  }
+}
+
+/* generic_*trsolve(): solve op(A) * x = b in place for a triangular
+ * matrix.
+ */
+static void NAME(trsolve) (const int upper, const int tr, const int cj,
+                           const int unit, const int n,
+                           const T *A, const int lda,
+                           T *x, const int incx) {
+  /* determine whether op(A) is upper triangular. */
+  if (upper != tr) {
+    /* backward substitution. */
+    for (int i = n - 1; i >= 0; i--) {
+      T s = x[i * incx];
+      for (int j = i + 1; j < n; j++)
+        s -= NAME(tri)(upper, tr, cj, unit, A, lda, i, j) * x[j * incx];
+
+      x[i * incx] = (unit ? s : s / OPC(cj, ELEM(A, lda, i, i)));
+    }
+  }
+  else {
+    /* forward substitution. */
+    for (int i = 0; i < n; i++) {
+      T s = x[i * incx];
+      for (int j = 0; j < i; j++)
+        s -= NAME(tri)(upper, tr, cj, unit, A, lda, i, j) * x[j * incx];
+
+      x[i * incx] = (unit ? s : s / OPC(cj, ELEM(A, lda, i, i)));
+    }
+  }
+}
+
+/* === level 2 === */
+
+/* generic_*gemv(): compute y := alpha * op(A) * x + beta * y. */
+static void NAME(gemv) (const int tr, const int cj,
+                        const int m, const int n, const T alpha,
+                        const T *A, const int lda,
+                        const T *x, const int incx,
+                        const T beta, T *y, const int incy) {
+  const int lenx = (tr ? m : n);
+  const int leny = (tr ? n : m);
+  x += START(lenx, incx);
+  y += START(leny, incy);
+
+  for (int i = 0; i < leny; i++)
+    y[i * incy] = (beta == 0.0 ? 0.0 : beta * y[i * incy]);
+
+  if (!tr) {
+    /* accumulate the scaled columns of the matrix. */
+    for (int j = 0; j < n; j++) {
+      const T t = alpha * x[j * incx];
+      for (int i = 0; i < m; i++)
+        y[i * incy] += t * OPC(cj, ELEM(A, lda, i, j));
+    }
+  }
+  else {
+    /* compute the dot product of each column with the vector. */
+    for (int j = 0; j < n; j++) {
+      T s = 0.0;
+      for (int i = 0; i < m; i++)
+        s += OPC(cj, ELEM(A, lda, i, j)) * x[i * incx];
+
+      y[j * incy] += alpha * s;
+    }
+  }
+}
+
+/* generic_*symv(): compute y := alpha * A * x + beta * y for a symmetric
+ * or hermitian matrix.
+ */
+static void NAME(symv) (const int upper, const int herm, const int n,
+                        const T alpha, const T *A, const int lda,
+                        const T *x, const int incx,
+                        const T beta, T *y, const int incy) {
+  x += START(n, incx);
+  y += START(n, incy);
+
+  for (int i = 0; i < n; i++) {
+    T s = 0.0;
+    for (int j = 0; j < n; j++)
+      s += NAME(sym)(upper, herm, A, lda, i, j) * x[j * incx];
+
+    y[i * incy] = (beta == 0.0 ? 0.0 : beta * y[i * incy]) + alpha * s;
+  }
+}
+
+/* generic_*ger(): compute A := alpha * x * y' + A, optionally
+ * conjugating y.
+ */
+static void NAME(ger) (const int m, const int n, const T alpha,
+                       const T *x, const int incx,
+                       const T *y, const int incy, const int cy,
+                       T *A, const int lda) {
+  x += START(m, incx);
+  y += START(n, incy);
+
+  for (int j = 0; j < n; j++) {
+    const T t = alpha * OPC(cy, y[j * incy]);
+    for (int i = 0; i < m; i++)
+      ELEM(A, lda, i, j) += x[i * incx] * t;
+  }
+}
+
+/* generic_*syr2(): compute A := alpha * x * y' + alpha' * y * x' + A
+ * over one triangle of a symmetric or hermitian matrix. when @y is null,
+ * the rank-1 update A := alpha * x * x' + A is computed instead.
+ */
+static void NAME(syr2) (const int upper, const int herm, const int n,
+                        const T alpha, const T *x, const int incx,
+                        const T *y, const int incy,
+                        T *A, const int lda) {
+  /* use x in place of y for rank-1 updates. */
+  const T *w = (y ? y : x);
+  const int incw = (y ? incy : incx);
+  x += START(n, incx);
+  w += START(n, incw);
+
+  const T beta = OPC(herm, alpha);
+  for (int j = 0; j < n; j++) {
+    const int i0 = (upper ? 0 : j);
+    const int i1 = (upper ? j + 1 : n);
+    for (int i = i0; i < i1; i++) {
+      T t = alpha * x[i * incx] * OPC(herm, w[j * incw]);
+      if (y)
+        t += beta * w[i * incw] * OPC(herm, x[j * incx]);
+
+      ELEM(A, lda, i, j) += t;
+    }
+
+    if (herm)
+      ELEM(A, lda, j, j) = REAL(ELEM(A, lda, j, j));
+  }
+}
+
+/* === level 3 === */
+
+/* generic_*gemm(): compute C := alpha * op(A) * op(B) + beta * C. */
+static void NAME(gemm) (const int trA, const int cjA,
+                        const int trB, const int cjB,
+                        const int m, const int n, const int k,
+                        const T alpha, const T *A, const int lda,
+                        const T *B, const int ldb,
+                        const T beta, T *C, const int ldc) {
+  for (int j = 0; j < n; j++) {
+    T *c = C + (long) j * ldc;
+    for (int i = 0; i < m; i++)
+      c[i] = (beta == 0.0 ? 0.0 : beta * c[i]);
+
+    if (!trA) {
+      /* accumulate the scaled columns of op(A). */
+      for (int l = 0; l < k; l++) {
+        const T b = (trB ? OPC(cjB, ELEM(B, ldb, j, l)) :
+                           OPC(cjB, ELEM(B, ldb, l, j)));
+        if (b == 0.0)
+          continue;
+
+        const T t = alpha * b;
+        const T *a = A + (long) l * lda;
+        for (int i = 0; i < m; i++)
+          c[i] += t * OPC(cjA, a[i]);
+      }
+    }
+    else {
+      /* compute the dot product of each column of A with op(B). */
+      for (int i = 0; i < m; i++) {
+        const T *a = A + (long) i * lda;
+        T s = 0.0;
+        for (int l = 0; l < k; l++)
+          s += OPC(cjA, a[l]) * (trB ? OPC(cjB, ELEM(B, ldb, j, l)) :
+                                       OPC(cjB, ELEM(B, ldb, l, j)));
+
+        c[i] += alpha * s;
+      }
+    }
+  }
+}
+
+/* generic_*symm(): compute C := alpha * A * B + beta * C (left) or
+ * C := alpha * B * A + beta * C (right) for a symmetric or hermitian
+ * matrix A.
+ */
+static void NAME(symm) (const int left, const int upper, const int herm,
+                        const int m, const int n, const T alpha,
+                        const T *A, const int lda,
+                        const T *B, const int ldb,
+                        const T beta, T *C, const int ldc) {
+  const int k = (left ? m : n);
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < m; i++) {
+      T s = 0.0;
+      for (int l = 0; l < k; l++)
+        s += (left ? NAME(sym)(upper, herm, A, lda, i, l) *
+                     ELEM(B, ldb, l, j) :
+                     ELEM(B, ldb, i, l) *
+                     NAME(sym)(upper, herm, A, lda, l, j));
+
+      T *c = &ELEM(C, ldc, i, j);
+      *c = (beta == 0.0 ? 0.0 : beta * *c) + alpha * s;
+    }
+  }
+}
+
+/* generic_*syr2k(): compute C := alpha * op(A) * op(B)' +
+ * alpha' * op(B) * op(A)' + beta * C over one triangle of a symmetric
+ * or hermitian matrix. when @B is null, the rank-k update
+ * C := alpha * op(A) * op(A)' + beta * C is computed instead.
+ */
+static void NAME(syr2k) (const int upper, const int tr, const int herm,
+                         const int n, const int k, const T alpha,
+                         const T *A, const int lda,
+                         const T *B, const int ldb,
+                         const T beta, T *C, const int ldc) {
+  /* use A in place of B for rank-k updates. */
+  const T *W = (B ? B : A);
+  const int ldw = (B ? ldb : lda);
+
+  const T gamma = OPC(herm, alpha);
+  for (int j = 0; j < n; j++) {
+    const int i0 = (upper ? 0 : j);
+    const int i1 = (upper ? j + 1 : n);
+    for (int i = i0; i < i1; i++) {
+      /* compute the inner products of the rows or columns. */
+      T s = 0.0, t = 0.0;
+      for (int l = 0; l < k; l++) {
+        if (!tr) {
+          s += ELEM(A, lda, i, l) * OPC(herm, ELEM(W, ldw, j, l));
+          if (B)
+            t += ELEM(W, ldw, i, l) * OPC(herm, ELEM(A, lda, j, l));
+        }
+        else {
+          s += OPC(herm, ELEM(A, lda, l, i)) * ELEM(W, ldw, l, j);
+          if (B)
+            t += OPC(herm, ELEM(W, ldw, l, i)) * ELEM(A, lda, l, j);
+        }
+      }
+
+      /* update the output element. */
+      T *c = &ELEM(C, ldc, i, j);
+      *c = (beta == 0.0 ? 0.0 : beta * *c) + alpha * s + gamma * t;
+      if (herm && i == j)
+        *c = REAL(*c);
+    }
+  }
+}
+
+/* generic_*trmm(): compute B := alpha * op(A) * B (left) or
+ * B := alpha * B * op(A) (right) for a triangular matrix A.
+ */
+static void NAME(trmm) (const int left, const int upper,
+                        const int tr, const int cj, const int unit,
+                        const int m, const int n, const T alpha,
+                        const T *A, const int lda,
+                        T *B, const int ldb) {
+  /* multiply each column (left) or row (right) of B. the rows of B are
+   * multiplied by the transpose of op(A).
+   */
+  if (left) {
+    for (int j = 0; j < n; j++)
+      NAME(trmul)(upper, tr, cj, unit, m, A, lda, B + (long) j * ldb, 1);
+  }
+  else {
+    for (int i = 0; i < m; i++)
+      NAME(trmul)(upper, !tr, cj, unit, n, A, lda, B + i, ldb);
+  }
+
+  /* scale the result. */
+  for (int j = 0; j < n; j++)
+    for (int i = 0; i < m; i++)
+      ELEM(B, ldb, i, j) *= alpha;
+}
+
+/* generic_*trsm(): solve op(A) * X = alpha * B (left) or
+ * X * op(A) = alpha * B (right) in place for a triangular matrix A.
+ */
+static void NAME(trsm) (const int left, const int upper,
+                        const int tr, const int cj, const int unit,
+                        const int m, const int n, const T alpha,
+                        const T *A, const int lda,
+                        T *B, const int ldb) {
+  /* scale the right-hand sides. */
+  for (int j = 0; j < n; j++)
+    for (int i = 0; i < m; i++)
+      ELEM(B, ldb, i, j) *= alpha;
+
+  /* solve for each column (left) or row (right) of X. */
+  if (left) {
+    for (int j = 0; j < n; j++)
+      NAME(trsolve)(upper, tr, cj, unit, m, A, lda, B + (long) j * ldb, 1);
+  }
+  else {
+    for (int i = 0; i < m; i++)
+      NAME(trsolve)(upper, !tr, cj, unit, n, A, lda, B + i, ldb);
+  }
+}
+
+/* undefine the kernel generator macros.
+ */
+#undef CONCAT3
+#undef KNAME
+#undef NAME
+#undef START
+#undef ELEM
+#undef OPC
+#undef P
+#undef T
+#undef CONJ
+#undef REAL
+#undef ABS
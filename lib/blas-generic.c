@@ -0,0 +1,833 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the blas header. */
+#include <matte/blas.h>
+
+/* generic_d*(): portable real kernels. */
+#define P d
+#define T double
+#define CONJ(x) (x)
+#define REAL(x) (x)
+#define ABS(x) fabs(x)
+#include "blas-generic-kernels.c"
+
+/* generic_z*(): portable complex kernels. */
+#define P z
+#define T complex double
+#define CONJ(x) conj(x)
+#define REAL(x) creal(x)
+#define ABS(x) cabs(x)
+#include "blas-generic-kernels.c"
+
+/* generic_s*(): portable single-precision kernels. */
+#define P s
+#define T float
+#define CONJ(x) (x)
+#define REAL(x) (x)
+#define ABS(x) fabsf(x)
+#include "blas-generic-kernels.c"
+
+/* Z(), ZC(): macros to cast opaque pointers to complex elements. */
+#define Z(ptr)  ((complex double*) (ptr))
+#define ZC(ptr) ((const complex double*) (ptr))
+
+/* TR(), CJ(): macros to split transposition options into transposition
+ * and conjugation flags.
+ */
+#define TR(trans) ((trans) != CblasNoTrans)
+#define CJ(trans) ((trans) == CblasConjTrans)
+
+/* UP(), UNIT(), LEFT(): macros to convert triangle, diagonal and side
+ * options into flags.
+ */
+#define UP(uplo)    ((uplo) == CblasUpper)
+#define UNIT(diag)  ((diag) == CblasUnit)
+#define LEFT(side)  ((side) == CblasLeft)
+
+/* === level 1, double === */
+
+static double generic_ddot_cblas (const int n, const double *x,
+                                  const int incx, const double *y,
+                                  const int incy) {
+  return generic_ddot(n, x, incx, y, incy, 0);
+}
+
+/* === level 1, complex double === */
+
+static void generic_zaxpy_cblas (const int n, const void *alpha,
+                                 const void *x, const int incx,
+                                 void *y, const int incy) {
+  generic_zaxpy(n, *ZC(alpha), ZC(x), incx, Z(y), incy);
+}
+
+static void generic_zscal_cblas (const int n, const void *alpha,
+                                 void *x, const int incx) {
+  generic_zscal(n, *ZC(alpha), Z(x), incx);
+}
+
+static void generic_zcopy_cblas (const int n, const void *x,
+                                 const int incx, void *y,
+                                 const int incy) {
+  generic_zcopy(n, ZC(x), incx, Z(y), incy);
+}
+
+static void generic_zswap_cblas (const int n, void *x, const int incx,
+                                 void *y, const int incy) {
+  generic_zswap(n, Z(x), incx, Z(y), incy);
+}
+
+static void generic_zdotu_cblas (const int n, const void *x,
+                                 const int incx, const void *y,
+                                 const int incy, void *dotu) {
+  *Z(dotu) = generic_zdot(n, ZC(x), incx, ZC(y), incy, 0);
+}
+
+static void generic_zdotc_cblas (const int n, const void *x,
+                                 const int incx, const void *y,
+                                 const int incy, void *dotc) {
+  *Z(dotc) = generic_zdot(n, ZC(x), incx, ZC(y), incy, 1);
+}
+
+static double generic_znrm2_cblas (const int n, const void *x,
+                                   const int incx) {
+  return generic_znrm2(n, ZC(x), incx);
+}
+
+/* === level 1, single === */
+
+static float generic_sdot_cblas (const int n, const float *x,
+                                 const int incx, const float *y,
+                                 const int incy) {
+  return generic_sdot(n, x, incx, y, incy, 0);
+}
+
+static float generic_snrm2_cblas (const int n, const float *x,
+                                  const int incx) {
+  return generic_snrm2(n, x, incx);
+}
+
+/* === level 2, double === */
+
+static void generic_dgemv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int m, const int n,
+                                 const double alpha,
+                                 const double *A, const int lda,
+                                 const double *x, const int incx,
+                                 const double beta,
+                                 double *y, const int incy) {
+  generic_dgemv(TR(trans), 0, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+static void generic_dsymv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int n, const double alpha,
+                                 const double *A, const int lda,
+                                 const double *x, const int incx,
+                                 const double beta,
+                                 double *y, const int incy) {
+  generic_dsymv(UP(uplo), 0, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+static void generic_dtrmv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const enum CBLAS_DIAG diag,
+                                 const int n, const double *A,
+                                 const int lda, double *x,
+                                 const int incx) {
+  generic_dtrmul(UP(uplo), TR(trans), 0, UNIT(diag), n, A, lda,
+                 x + (incx < 0 ? (long) (1 - n) * incx : 0), incx);
+}
+
+static void generic_dtrsv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const enum CBLAS_DIAG diag,
+                                 const int n, const double *A,
+                                 const int lda, double *x,
+                                 const int incx) {
+  generic_dtrsolve(UP(uplo), TR(trans), 0, UNIT(diag), n, A, lda,
+                   x + (incx < 0 ? (long) (1 - n) * incx : 0), incx);
+}
+
+static void generic_dger_cblas (const enum CBLAS_ORDER order,
+                                const int m, const int n,
+                                const double alpha,
+                                const double *x, const int incx,
+                                const double *y, const int incy,
+                                double *A, const int lda) {
+  generic_dger(m, n, alpha, x, incx, y, incy, 0, A, lda);
+}
+
+static void generic_dsyr_cblas (const enum CBLAS_ORDER order,
+                                const enum CBLAS_UPLO uplo,
+                                const int n, const double alpha,
+                                const double *x, const int incx,
+                                double *A, const int lda) {
+  generic_dsyr2(UP(uplo), 0, n, alpha, x, incx, NULL, 0, A, lda);
+}
+
+static void generic_dsyr2_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int n, const double alpha,
+                                 const double *x, const int incx,
+                                 const double *y, const int incy,
+                                 double *A, const int lda) {
+  generic_dsyr2(UP(uplo), 0, n, alpha, x, incx, y, incy, A, lda);
+}
+
+/* === level 2, complex double === */
+
+static void generic_zgemv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 const void *x, const int incx,
+                                 const void *beta,
+                                 void *y, const int incy) {
+  generic_zgemv(TR(trans), CJ(trans), m, n, *ZC(alpha), ZC(A), lda,
+                ZC(x), incx, *ZC(beta), Z(y), incy);
+}
+
+static void generic_zhemv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int n, const void *alpha,
+                                 const void *A, const int lda,
+                                 const void *x, const int incx,
+                                 const void *beta,
+                                 void *y, const int incy) {
+  generic_zsymv(UP(uplo), 1, n, *ZC(alpha), ZC(A), lda,
+                ZC(x), incx, *ZC(beta), Z(y), incy);
+}
+
+static void generic_ztrmv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const enum CBLAS_DIAG diag,
+                                 const int n, const void *A,
+                                 const int lda, void *x,
+                                 const int incx) {
+  generic_ztrmul(UP(uplo), TR(trans), CJ(trans), UNIT(diag), n,
+                 ZC(A), lda,
+                 Z(x) + (incx < 0 ? (long) (1 - n) * incx : 0), incx);
+}
+
+static void generic_ztrsv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const enum CBLAS_DIAG diag,
+                                 const int n, const void *A,
+                                 const int lda, void *x,
+                                 const int incx) {
+  generic_ztrsolve(UP(uplo), TR(trans), CJ(trans), UNIT(diag), n,
+                   ZC(A), lda,
+                   Z(x) + (incx < 0 ? (long) (1 - n) * incx : 0), incx);
+}
+
+static void generic_zgeru_cblas (const enum CBLAS_ORDER order,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *x, const int incx,
+                                 const void *y, const int incy,
+                                 void *A, const int lda) {
+  generic_zger(m, n, *ZC(alpha), ZC(x), incx, ZC(y), incy, 0, Z(A), lda);
+}
+
+static void generic_zgerc_cblas (const enum CBLAS_ORDER order,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *x, const int incx,
+                                 const void *y, const int incy,
+                                 void *A, const int lda) {
+  generic_zger(m, n, *ZC(alpha), ZC(x), incx, ZC(y), incy, 1, Z(A), lda);
+}
+
+static void generic_zher_cblas (const enum CBLAS_ORDER order,
+                                const enum CBLAS_UPLO uplo,
+                                const int n, const double alpha,
+                                const void *x, const int incx,
+                                void *A, const int lda) {
+  generic_zsyr2(UP(uplo), 1, n, alpha, ZC(x), incx, NULL, 0, Z(A), lda);
+}
+
+static void generic_zher2_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int n, const void *alpha,
+                                 const void *x, const int incx,
+                                 const void *y, const int incy,
+                                 void *A, const int lda) {
+  generic_zsyr2(UP(uplo), 1, n, *ZC(alpha), ZC(x), incx,
+                ZC(y), incy, Z(A), lda);
+}
+
+/* === level 2, single === */
+
+static void generic_sgemv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int m, const int n,
+                                 const float alpha,
+                                 const float *A, const int lda,
+                                 const float *x, const int incx,
+                                 const float beta,
+                                 float *y, const int incy) {
+  generic_sgemv(TR(trans), 0, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+static void generic_ssymv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int n, const float alpha,
+                                 const float *A, const int lda,
+                                 const float *x, const int incx,
+                                 const float beta,
+                                 float *y, const int incy) {
+  generic_ssymv(UP(uplo), 0, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+static void generic_strmv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const enum CBLAS_DIAG diag,
+                                 const int n, const float *A,
+                                 const int lda, float *x,
+                                 const int incx) {
+  generic_strmul(UP(uplo), TR(trans), 0, UNIT(diag), n, A, lda,
+                 x + (incx < 0 ? (long) (1 - n) * incx : 0), incx);
+}
+
+static void generic_strsv_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const enum CBLAS_DIAG diag,
+                                 const int n, const float *A,
+                                 const int lda, float *x,
+                                 const int incx) {
+  generic_strsolve(UP(uplo), TR(trans), 0, UNIT(diag), n, A, lda,
+                   x + (incx < 0 ? (long) (1 - n) * incx : 0), incx);
+}
+
+static void generic_sger_cblas (const enum CBLAS_ORDER order,
+                                const int m, const int n,
+                                const float alpha,
+                                const float *x, const int incx,
+                                const float *y, const int incy,
+                                float *A, const int lda) {
+  generic_sger(m, n, alpha, x, incx, y, incy, 0, A, lda);
+}
+
+static void generic_ssyr_cblas (const enum CBLAS_ORDER order,
+                                const enum CBLAS_UPLO uplo,
+                                const int n, const float alpha,
+                                const float *x, const int incx,
+                                float *A, const int lda) {
+  generic_ssyr2(UP(uplo), 0, n, alpha, x, incx, NULL, 0, A, lda);
+}
+
+static void generic_ssyr2_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int n, const float alpha,
+                                 const float *x, const int incx,
+                                 const float *y, const int incy,
+                                 float *A, const int lda) {
+  generic_ssyr2(UP(uplo), 0, n, alpha, x, incx, y, incy, A, lda);
+}
+
+/* === level 3, double === */
+
+static void generic_dgemm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_TRANSPOSE transB,
+                                 const int m, const int n, const int k,
+                                 const double alpha,
+                                 const double *A, const int lda,
+                                 const double *B, const int ldb,
+                                 const double beta,
+                                 double *C, const int ldc) {
+  generic_dgemm(TR(transA), 0, TR(transB), 0, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static void generic_dsymm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int m, const int n,
+                                 const double alpha,
+                                 const double *A, const int lda,
+                                 const double *B, const int ldb,
+                                 const double beta,
+                                 double *C, const int ldc) {
+  generic_dsymm(LEFT(side), UP(uplo), 0, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static void generic_dsyrk_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int n, const int k,
+                                 const double alpha,
+                                 const double *A, const int lda,
+                                 const double beta,
+                                 double *C, const int ldc) {
+  generic_dsyr2k(UP(uplo), TR(trans), 0, n, k,
+                 alpha, A, lda, NULL, 0, beta, C, ldc);
+}
+
+static void generic_dsyr2k_cblas (const enum CBLAS_ORDER order,
+                                  const enum CBLAS_UPLO uplo,
+                                  const enum CBLAS_TRANSPOSE trans,
+                                  const int n, const int k,
+                                  const double alpha,
+                                  const double *A, const int lda,
+                                  const double *B, const int ldb,
+                                  const double beta,
+                                  double *C, const int ldc) {
+  generic_dsyr2k(UP(uplo), TR(trans), 0, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static void generic_dtrmm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_DIAG diag,
+                                 const int m, const int n,
+                                 const double alpha,
+                                 const double *A, const int lda,
+                                 double *B, const int ldb) {
+  generic_dtrmm(LEFT(side), UP(uplo), TR(transA), 0, UNIT(diag), m, n,
+                alpha, A, lda, B, ldb);
+}
+
+static void generic_dtrsm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_DIAG diag,
+                                 const int m, const int n,
+                                 const double alpha,
+                                 const double *A, const int lda,
+                                 double *B, const int ldb) {
+  generic_dtrsm(LEFT(side), UP(uplo), TR(transA), 0, UNIT(diag), m, n,
+                alpha, A, lda, B, ldb);
+}
+
+/* === level 3, complex double === */
+
+static void generic_zgemm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_TRANSPOSE transB,
+                                 const int m, const int n, const int k,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 const void *B, const int ldb,
+                                 const void *beta,
+                                 void *C, const int ldc) {
+  generic_zgemm(TR(transA), CJ(transA), TR(transB), CJ(transB), m, n, k,
+                *ZC(alpha), ZC(A), lda, ZC(B), ldb,
+                *ZC(beta), Z(C), ldc);
+}
+
+static void generic_zsymm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 const void *B, const int ldb,
+                                 const void *beta,
+                                 void *C, const int ldc) {
+  generic_zsymm(LEFT(side), UP(uplo), 0, m, n,
+                *ZC(alpha), ZC(A), lda, ZC(B), ldb,
+                *ZC(beta), Z(C), ldc);
+}
+
+static void generic_zhemm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 const void *B, const int ldb,
+                                 const void *beta,
+                                 void *C, const int ldc) {
+  generic_zsymm(LEFT(side), UP(uplo), 1, m, n,
+                *ZC(alpha), ZC(A), lda, ZC(B), ldb,
+                *ZC(beta), Z(C), ldc);
+}
+
+static void generic_zsyrk_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int n, const int k,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 const void *beta,
+                                 void *C, const int ldc) {
+  generic_zsyr2k(UP(uplo), TR(trans), 0, n, k,
+                 *ZC(alpha), ZC(A), lda, NULL, 0,
+                 *ZC(beta), Z(C), ldc);
+}
+
+static void generic_zherk_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int n, const int k,
+                                 const double alpha,
+                                 const void *A, const int lda,
+                                 const double beta,
+                                 void *C, const int ldc) {
+  generic_zsyr2k(UP(uplo), TR(trans), 1, n, k,
+                 alpha, ZC(A), lda, NULL, 0, beta, Z(C), ldc);
+}
+
+static void generic_zsyr2k_cblas (const enum CBLAS_ORDER order,
+                                  const enum CBLAS_UPLO uplo,
+                                  const enum CBLAS_TRANSPOSE trans,
+                                  const int n, const int k,
+                                  const void *alpha,
+                                  const void *A, const int lda,
+                                  const void *B, const int ldb,
+                                  const void *beta,
+                                  void *C, const int ldc) {
+  generic_zsyr2k(UP(uplo), TR(trans), 0, n, k,
+                 *ZC(alpha), ZC(A), lda, ZC(B), ldb,
+                 *ZC(beta), Z(C), ldc);
+}
+
+static void generic_zher2k_cblas (const enum CBLAS_ORDER order,
+                                  const enum CBLAS_UPLO uplo,
+                                  const enum CBLAS_TRANSPOSE trans,
+                                  const int n, const int k,
+                                  const void *alpha,
+                                  const void *A, const int lda,
+                                  const void *B, const int ldb,
+                                  const double beta,
+                                  void *C, const int ldc) {
+  generic_zsyr2k(UP(uplo), TR(trans), 1, n, k,
+                 *ZC(alpha), ZC(A), lda, ZC(B), ldb,
+                 beta, Z(C), ldc);
+}
+
+static void generic_ztrmm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_DIAG diag,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 void *B, const int ldb) {
+  generic_ztrmm(LEFT(side), UP(uplo), TR(transA), CJ(transA), UNIT(diag),
+                m, n, *ZC(alpha), ZC(A), lda, Z(B), ldb);
+}
+
+static void generic_ztrsm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_DIAG diag,
+                                 const int m, const int n,
+                                 const void *alpha,
+                                 const void *A, const int lda,
+                                 void *B, const int ldb) {
+  generic_ztrsm(LEFT(side), UP(uplo), TR(transA), CJ(transA), UNIT(diag),
+                m, n, *ZC(alpha), ZC(A), lda, Z(B), ldb);
+}
+
+/* === level 3, single === */
+
+static void generic_sgemm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_TRANSPOSE transB,
+                                 const int m, const int n, const int k,
+                                 const float alpha,
+                                 const float *A, const int lda,
+                                 const float *B, const int ldb,
+                                 const float beta,
+                                 float *C, const int ldc) {
+  generic_sgemm(TR(transA), 0, TR(transB), 0, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static void generic_ssymm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const int m, const int n,
+                                 const float alpha,
+                                 const float *A, const int lda,
+                                 const float *B, const int ldb,
+                                 const float beta,
+                                 float *C, const int ldc) {
+  generic_ssymm(LEFT(side), UP(uplo), 0, m, n,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static void generic_ssyrk_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE trans,
+                                 const int n, const int k,
+                                 const float alpha,
+                                 const float *A, const int lda,
+                                 const float beta,
+                                 float *C, const int ldc) {
+  generic_ssyr2k(UP(uplo), TR(trans), 0, n, k,
+                 alpha, A, lda, NULL, 0, beta, C, ldc);
+}
+
+static void generic_ssyr2k_cblas (const enum CBLAS_ORDER order,
+                                  const enum CBLAS_UPLO uplo,
+                                  const enum CBLAS_TRANSPOSE trans,
+                                  const int n, const int k,
+                                  const float alpha,
+                                  const float *A, const int lda,
+                                  const float *B, const int ldb,
+                                  const float beta,
+                                  float *C, const int ldc) {
+  generic_ssyr2k(UP(uplo), TR(trans), 0, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static void generic_strmm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_DIAG diag,
+                                 const int m, const int n,
+                                 const float alpha,
+                                 const float *A, const int lda,
+                                 float *B, const int ldb) {
+  generic_strmm(LEFT(side), UP(uplo), TR(transA), 0, UNIT(diag), m, n,
+                alpha, A, lda, B, ldb);
+}
+
+static void generic_strsm_cblas (const enum CBLAS_ORDER order,
+                                 const enum CBLAS_SIDE side,
+                                 const enum CBLAS_UPLO uplo,
+                                 const enum CBLAS_TRANSPOSE transA,
+                                 const enum CBLAS_DIAG diag,
+                                 const int m, const int n,
+                                 const float alpha,
+                                 const float *A, const int lda,
+                                 float *B, const int ldb) {
+  generic_strsm(LEFT(side), UP(uplo), TR(transA), 0, UNIT(diag), m, n,
+                alpha, A, lda, B, ldb);
+}
+
+/* === lapack, double === */
+
+/* generic_dgetrf(): compute the lu factorization of a general matrix
+ * using partial pivoting. pivot indices are zero-based.
+ */
+static int generic_dgetrf (const enum CBLAS_ORDER order,
+                           const int m, const int n,
+                           double *A, const int lda, int *ipiv) {
+  int info = 0;
+  const int mn = (m < n ? m : n);
+  for (int j = 0; j < mn; j++) {
+    /* find the pivot row of the current column. */
+    int p = j;
+    for (int i = j + 1; i < m; i++) {
+      if (fabs(A[i + (long) j * lda]) > fabs(A[p + (long) j * lda]))
+        p = i;
+    }
+
+    /* record singular columns and move on. */
+    ipiv[j] = p;
+    if (A[p + (long) j * lda] == 0.0) {
+      if (!info)
+        info = j + 1;
+
+      continue;
+    }
+
+    /* swap the pivot row into place. */
+    if (p != j)
+      generic_dswap(n, A + j, lda, A + p, lda);
+
+    /* compute the multipliers. */
+    const double r = 1.0 / A[j + (long) j * lda];
+    for (int i = j + 1; i < m; i++)
+      A[i + (long) j * lda] *= r;
+
+    /* update the trailing submatrix. */
+    for (int c = j + 1; c < n; c++) {
+      const double t = A[j + (long) c * lda];
+      if (t != 0.0)
+        generic_daxpy(m - j - 1, -t, A + (j + 1) + (long) j * lda, 1,
+                      A + (j + 1) + (long) c * lda, 1);
+    }
+  }
+
+  return info;
+}
+
+/* generic_dgetrs(): solve a general system of equations using the lu
+ * factorization computed by generic_dgetrf().
+ */
+static int generic_dgetrs (const enum CBLAS_ORDER order,
+                           const enum CBLAS_TRANSPOSE trans,
+                           const int n, const int nrhs,
+                           const double *A, const int lda,
+                           const int *ipiv, double *B, const int ldb) {
+  for (int r = 0; r < nrhs; r++) {
+    double *b = B + (long) r * ldb;
+    if (trans == CblasNoTrans) {
+      /* solve P L U x = b. */
+      for (int i = 0; i < n; i++)
+        generic_dswap(1, b + i, 1, b + ipiv[i], 1);
+
+      generic_dtrsolve(0, 0, 0, 1, n, A, lda, b, 1);
+      generic_dtrsolve(1, 0, 0, 0, n, A, lda, b, 1);
+    }
+    else {
+      /* solve U' L' P' x = b. */
+      generic_dtrsolve(1, 1, 0, 0, n, A, lda, b, 1);
+      generic_dtrsolve(0, 1, 0, 1, n, A, lda, b, 1);
+
+      for (int i = n - 1; i >= 0; i--)
+        generic_dswap(1, b + i, 1, b + ipiv[i], 1);
+    }
+  }
+
+  return 0;
+}
+
+/* generic_dpotrf(): compute the cholesky factorization of a symmetric
+ * positive definite matrix.
+ */
+static int generic_dpotrf (const enum CBLAS_ORDER order,
+                           const enum CBLAS_UPLO uplo, const int n,
+                           double *A, const int lda) {
+  /* the lower factor is stored with its rows and columns exchanged. */
+  const long si = (uplo == CblasUpper ? 1 : lda);
+  const long sj = (uplo == CblasUpper ? lda : 1);
+
+  for (int j = 0; j < n; j++) {
+    /* compute the diagonal element, failing if it is not positive. */
+    double *aj = A + j * sj;
+    const double s = aj[j * si] - generic_ddot(j, aj, si, aj, si, 0);
+    if (s <= 0.0)
+      return j + 1;
+
+    const double ujj = sqrt(s);
+    aj[j * si] = ujj;
+
+    /* compute the remaining elements of the row of the factor. */
+    for (int c = j + 1; c < n; c++) {
+      double *ac = A + c * sj;
+      ac[j * si] = (ac[j * si] - generic_ddot(j, aj, si, ac, si, 0)) / ujj;
+    }
+  }
+
+  return 0;
+}
+
+/* generic_dpotrs(): solve a symmetric positive definite system of
+ * equations using the cholesky factorization computed by
+ * generic_dpotrf().
+ */
+static int generic_dpotrs (const enum CBLAS_ORDER order,
+                           const enum CBLAS_UPLO uplo,
+                           const int n, const int nrhs,
+                           const double *A, const int lda,
+                           double *B, const int ldb) {
+  const int upper = UP(uplo);
+  for (int r = 0; r < nrhs; r++) {
+    double *b = B + (long) r * ldb;
+    generic_dtrsolve(upper, upper, 0, 0, n, A, lda, b, 1);
+    generic_dtrsolve(upper, !upper, 0, 0, n, A, lda, b, 1);
+  }
+
+  return 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* blas_generic: backend structure of the portable kernels. the kernels
+ * only support column-major storage, which is the only order used by
+ * matte.
+ */
+struct _BlasBackend blas_generic = {
+  "generic",                                     /* name */
+
+  generic_daxpy,                                 /* daxpy  */
+  generic_dscal,                                 /* dscal  */
+  generic_dcopy,                                 /* dcopy  */
+  generic_dswap,                                 /* dswap  */
+  generic_ddot_cblas,                            /* ddot   */
+  generic_dnrm2,                                 /* dnrm2  */
+
+  generic_zaxpy_cblas,                           /* zaxpy     */
+  generic_zscal_cblas,                           /* zscal     */
+  generic_zcopy_cblas,                           /* zcopy     */
+  generic_zswap_cblas,                           /* zswap     */
+  generic_zdotu_cblas,                           /* zdotu_sub */
+  generic_zdotc_cblas,                           /* zdotc_sub */
+  generic_znrm2_cblas,                           /* dznrm2    */
+
+  generic_saxpy,                                 /* saxpy  */
+  generic_sscal,                                 /* sscal  */
+  generic_scopy,                                 /* scopy  */
+  generic_sswap,                                 /* sswap  */
+  generic_sdot_cblas,                            /* sdot   */
+  generic_snrm2_cblas,                           /* snrm2  */
+
+  generic_dgemv_cblas,                           /* dgemv */
+  generic_dsymv_cblas,                           /* dsymv */
+  generic_dtrmv_cblas,                           /* dtrmv */
+  generic_dtrsv_cblas,                           /* dtrsv */
+  generic_dger_cblas,                            /* dger  */
+  generic_dsyr_cblas,                            /* dsyr  */
+  generic_dsyr2_cblas,                           /* dsyr2 */
+
+  generic_zgemv_cblas,                           /* zgemv */
+  generic_zhemv_cblas,                           /* zhemv */
+  generic_ztrmv_cblas,                           /* ztrmv */
+  generic_ztrsv_cblas,                           /* ztrsv */
+  generic_zgeru_cblas,                           /* zgeru */
+  generic_zgerc_cblas,                           /* zgerc */
+  generic_zher_cblas,                            /* zher  */
+  generic_zher2_cblas,                           /* zher2 */
+
+  generic_sgemv_cblas,                           /* sgemv */
+  generic_ssymv_cblas,                           /* ssymv */
+  generic_strmv_cblas,                           /* strmv */
+  generic_strsv_cblas,                           /* strsv */
+  generic_sger_cblas,                            /* sger  */
+  generic_ssyr_cblas,                            /* ssyr  */
+  generic_ssyr2_cblas,                           /* ssyr2 */
+
+  generic_dgemm_cblas,                           /* dgemm  */
+  generic_dsymm_cblas,                           /* dsymm  */
+  generic_dsyrk_cblas,                           /* dsyrk  */
+  generic_dsyr2k_cblas,                          /* dsyr2k */
+  generic_dtrmm_cblas,                           /* dtrmm  */
+  generic_dtrsm_cblas,                           /* dtrsm  */
+
+  generic_zgemm_cblas,                           /* zgemm  */
+  generic_zsymm_cblas,                           /* zsymm  */
+  generic_zhemm_cblas,                           /* zhemm  */
+  generic_zsyrk_cblas,                           /* zsyrk  */
+  generic_zherk_cblas,                           /* zherk  */
+  generic_zsyr2k_cblas,                          /* zsyr2k */
+  generic_zher2k_cblas,                          /* zher2k */
+  generic_ztrmm_cblas,                           /* ztrmm  */
+  generic_ztrsm_cblas,                           /* ztrsm  */
+
+  generic_sgemm_cblas,                           /* sgemm  */
+  generic_ssymm_cblas,                           /* ssymm  */
+  generic_ssyrk_cblas,                           /* ssyrk  */
+  generic_ssyr2k_cblas,                          /* ssyr2k */
+  generic_strmm_cblas,                           /* strmm  */
+  generic_strsm_cblas,                           /* strsm  */
+
+  generic_dgetrf,                                /* dgetrf */
+  generic_dgetrs,                                /* dgetrs */
+  generic_dpotrf,                                /* dpotrf */
+  generic_dpotrs                                 /* dpotrs */
+};
+
@@ -21,7 +21,7 @@ int matte_daxpy (double alpha, Vector x, Vector y) {
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
   /* execute the cblas function and return success. */
-  cblas_daxpy(x->n, alpha, x->data, 1, y->data, 1);
+  matte_blas->daxpy(x->n, alpha, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -33,7 +33,7 @@ int matte_dscal (double alpha, Vector x) {
     fail(ERR_INVALID_ARGIN);
 
   /* execute the cblas function and return success. */
-  cblas_dscal(x->n, alpha, x->data, 1);
+  matte_blas->dscal(x->n, alpha, x->data, 1);
   return 1;
 }
 
@@ -49,7 +49,7 @@ int matte_dcopy (Vector x, Vector y) {
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
   /* execute the cblas function and return success. */
-  cblas_dcopy(x->n, x->data, 1, y->data, 1);
+  matte_blas->dcopy(x->n, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -65,7 +65,7 @@ int matte_dswap (Vector x, Vector y) {
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
   /* execute the cblas function and return success. */
-  cblas_dswap(x->n, x->data, 1, y->data, 1);
+  matte_blas->dswap(x->n, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -81,7 +81,7 @@ int matte_ddot (Vector x, Vector y, double *out) {
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
   /* execute the cblas function and return success. */
-  *out = cblas_ddot(x->n, x->data, 1, y->data, 1);
+  *out = matte_blas->ddot(x->n, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -93,7 +93,7 @@ int matte_dnrm2 (Vector x, double *out) {
     fail(ERR_INVALID_ARGIN);
 
   /* execute the cblas function and return success. */
-  *out = cblas_dnrm2(x->n, x->data, 1);
+  *out = matte_blas->dnrm2(x->n, x->data, 1);
   return 1;
 }
 
@@ -110,8 +110,12 @@ int matte_zaxpy (complex double alpha, ComplexVector x, ComplexVector y) {
   if (x->n != y->n)
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) || !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function and return success. */
-  cblas_zaxpy(x->n, &alpha, x->data, 1, y->data, 1);
+  matte_blas->zaxpy(x->n, &alpha, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -122,8 +126,12 @@ int matte_zscal (complex double alpha, ComplexVector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x))
+    return 0;
+
   /* execute the cblas function and return success. */
-  cblas_zscal(x->n, &alpha, x->data, 1);
+  matte_blas->zscal(x->n, &alpha, x->data, 1);
   return 1;
 }
 
@@ -138,8 +146,12 @@ int matte_zcopy (ComplexVector x, ComplexVector y) {
   if (x->n != y->n)
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) || !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function and return success. */
-  cblas_zcopy(x->n, x->data, 1, y->data, 1);
+  matte_blas->zcopy(x->n, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -154,8 +166,12 @@ int matte_zswap (ComplexVector x, ComplexVector y) {
   if (x->n != y->n)
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) || !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function and return success. */
-  cblas_zswap(x->n, x->data, 1, y->data, 1);
+  matte_blas->zswap(x->n, x->data, 1, y->data, 1);
   return 1;
 }
 
@@ -170,8 +186,12 @@ int matte_zdotu (ComplexVector x, ComplexVector y, complex double *out) {
   if (x->n != y->n)
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) || !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function and return success. */
-  cblas_zdotu_sub(x->n, x->data, 1, y->data, 1, out);
+  matte_blas->zdotu_sub(x->n, x->data, 1, y->data, 1, out);
   return 1;
 }
 
@@ -186,8 +206,12 @@ int matte_zdotc (ComplexVector x, ComplexVector y, complex double *out) {
   if (x->n != y->n)
     fail(ERR_SIZE_MISMATCH_VV(x, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) || !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function and return success. */
-  cblas_zdotc_sub(x->n, x->data, 1, y->data, 1, out);
+  matte_blas->zdotc_sub(x->n, x->data, 1, y->data, 1, out);
   return 1;
 }
 
@@ -198,8 +222,102 @@ int matte_dznrm2 (ComplexVector x, double *out) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x))
+    return 0;
+
+  /* execute the cblas function and return success. */
+  *out = matte_blas->dznrm2(x->n, x->data, 1);
+  return 1;
+}
+
+/* === level 1, single === */
+
+/* matte_saxpy(): wrapper around cblas_saxpy().
+ */
+int matte_saxpy (float alpha, SingleVector x, SingleVector y) {
+  /* fail if either vector is null. */
+  if (!x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the vector lengths do not match. */
+  if (x->n != y->n)
+    fail(ERR_SIZE_MISMATCH_VV(x, y));
+
+  /* execute the cblas function and return success. */
+  matte_blas->saxpy(x->n, alpha, x->data, 1, y->data, 1);
+  return 1;
+}
+
+/* matte_sscal(): wrapper around cblas_sscal().
+ */
+int matte_sscal (float alpha, SingleVector x) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* execute the cblas function and return success. */
+  matte_blas->sscal(x->n, alpha, x->data, 1);
+  return 1;
+}
+
+/* matte_scopy(): wrapper around cblas_scopy().
+ */
+int matte_scopy (SingleVector x, SingleVector y) {
+  /* fail if either vector is null. */
+  if (!x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the vector lengths do not match. */
+  if (x->n != y->n)
+    fail(ERR_SIZE_MISMATCH_VV(x, y));
+
+  /* execute the cblas function and return success. */
+  matte_blas->scopy(x->n, x->data, 1, y->data, 1);
+  return 1;
+}
+
+/* matte_sswap(): wrapper around cblas_sswap().
+ */
+int matte_sswap (SingleVector x, SingleVector y) {
+  /* fail if either vector is null. */
+  if (!x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the vector lengths do not match. */
+  if (x->n != y->n)
+    fail(ERR_SIZE_MISMATCH_VV(x, y));
+
+  /* execute the cblas function and return success. */
+  matte_blas->sswap(x->n, x->data, 1, y->data, 1);
+  return 1;
+}
+
+/* matte_sdot(): wrapper around cblas_sdot().
+ */
+int matte_sdot (SingleVector x, SingleVector y, float *out) {
+  /* fail if either vector is null. */
+  if (!x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the vector lengths do not match. */
+  if (x->n != y->n)
+    fail(ERR_SIZE_MISMATCH_VV(x, y));
+
+  /* execute the cblas function and return success. */
+  *out = matte_blas->sdot(x->n, x->data, 1, y->data, 1);
+  return 1;
+}
+
+/* matte_snrm2(): wrapper around cblas_snrm2().
+ */
+int matte_snrm2 (SingleVector x, float *out) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
   /* execute the cblas function and return success. */
-  *out = cblas_dznrm2(x->n, x->data, 1);
+  *out = matte_blas->snrm2(x->n, x->data, 1);
   return 1;
 }
 
@@ -226,8 +344,8 @@ int matte_dgemv (MatteTranspose trans, double alpha, Matrix A, Vector x,
   }
 
   /* execute the cblas function. */
-  cblas_dgemv(CblasColMajor, trans, A->m, A->n, alpha, A->data, A->m,
-              x->data, 1, beta, y->data, 1);
+  matte_blas->dgemv(CblasColMajor, trans, A->m, A->n, alpha, A->data, A->m,
+                    x->data, 1, beta, y->data, 1);
 
   /* return success. */
   return 1;
@@ -254,8 +372,8 @@ int matte_dsymv (MatteTriangle uplo, double alpha, Matrix A, Vector x,
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
 
   /* execute the cblas function. */
-  cblas_dsymv(CblasColMajor, uplo, A->m, alpha, A->data, A->m,
-              x->data, 1, beta, y->data, 1);
+  matte_blas->dsymv(CblasColMajor, uplo, A->m, alpha, A->data, A->m,
+                    x->data, 1, beta, y->data, 1);
 
   /* return success. */
   return 1;
@@ -278,8 +396,8 @@ int matte_dtrmv (MatteTriangle uplo, MatteTranspose trans,
     fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
 
   /* execute the cblas function. */
-  cblas_dtrmv(CblasColMajor, uplo, trans, diag,
-              A->m, A->data, A->m, x->data, 1);
+  matte_blas->dtrmv(CblasColMajor, uplo, trans, diag,
+                    A->m, A->data, A->m, x->data, 1);
 
   /* return success. */
   return 1;
@@ -302,8 +420,8 @@ int matte_dtrsv (MatteTriangle uplo, MatteTranspose trans,
     fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
 
   /* execute the cblas function. */
-  cblas_dtrsv(CblasColMajor, uplo, trans, diag,
-              A->m, A->data, A->m, x->data, 1);
+  matte_blas->dtrsv(CblasColMajor, uplo, trans, diag,
+                    A->m, A->data, A->m, x->data, 1);
 
   /* return success. */
   return 1;
@@ -325,9 +443,9 @@ int matte_dger (double alpha, Vector x, Vector y, Matrix A) {
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
 
   /* execute the cblas function. */
-  cblas_dger(CblasColMajor, A->m, A->n, alpha,
-             x->data, 1, y->data, 1,
-             A->data, A->m);
+  matte_blas->dger(CblasColMajor, A->m, A->n, alpha,
+                   x->data, 1, y->data, 1,
+                   A->data, A->m);
 
   /* return success. */
   return 1;
@@ -349,8 +467,8 @@ int matte_dsyr (MatteTriangle uplo, double alpha, Vector x, Matrix A) {
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, x));
 
   /* execute the cblas function. */
-  cblas_dsyr(CblasColMajor, uplo, A->m, alpha,
-             x->data, 1, A->data, A->m);
+  matte_blas->dsyr(CblasColMajor, uplo, A->m, alpha,
+                   x->data, 1, A->data, A->m);
 
   /* return success. */
   return 1;
@@ -377,9 +495,9 @@ int matte_dsyr2 (MatteTriangle uplo, double alpha,
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
 
   /* execute the cblas function. */
-  cblas_dsyr2(CblasColMajor, uplo, A->m, alpha,
-              x->data, 1, y->data, 1,
-              A->data, A->m);
+  matte_blas->dsyr2(CblasColMajor, uplo, A->m, alpha,
+                    x->data, 1, y->data, 1,
+                    A->data, A->m);
 
   /* return success. */
   return 1;
@@ -408,9 +526,15 @@ int matte_zgemv (MatteTranspose trans, complex double alpha,
     if (A->n != y->n) fail(ERR_SIZE_MISMATCH_MV(trans, A, y));
   }
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_vector_interleave(x) ||
+      !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function. */
-  cblas_zgemv(CblasColMajor, trans, A->m, A->n, &alpha, A->data, A->m,
-              x->data, 1, &beta, y->data, 1);
+  matte_blas->zgemv(CblasColMajor, trans, A->m, A->n, &alpha, A->data, A->m,
+                    x->data, 1, &beta, y->data, 1);
 
   /* return success. */
   return 1;
@@ -436,9 +560,15 @@ int matte_zhemv (MatteTriangle uplo, complex double alpha, ComplexMatrix A,
   if (A->m != y->n)
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_vector_interleave(x) ||
+      !complex_vector_interleave(y))
+    return 0;
+
   /* execute the cblas function. */
-  cblas_zhemv(CblasColMajor, uplo, A->m, &alpha, A->data, A->m,
-              x->data, 1, &beta, y->data, 1);
+  matte_blas->zhemv(CblasColMajor, uplo, A->m, &alpha, A->data, A->m,
+                    x->data, 1, &beta, y->data, 1);
 
   /* return success. */
   return 1;
@@ -461,9 +591,13 @@ int matte_ztrmv (MatteTriangle uplo, MatteTranspose trans,
   if (A->m != x->n)
     fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) || !complex_vector_interleave(x))
+    return 0;
+
   /* execute the cblas function. */
-  cblas_ztrmv(CblasColMajor, uplo, trans, diag,
-              A->m, A->data, A->m, x->data, 1);
+  matte_blas->ztrmv(CblasColMajor, uplo, trans, diag,
+                    A->m, A->data, A->m, x->data, 1);
 
   /* return success. */
   return 1;
@@ -486,9 +620,13 @@ int matte_ztrsv (MatteTriangle uplo, MatteTranspose trans,
   if (A->m != x->n)
     fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) || !complex_vector_interleave(x))
+    return 0;
+
   /* execute the cblas function. */
-  cblas_ztrsv(CblasColMajor, uplo, trans, diag,
-              A->m, A->data, A->m, x->data, 1);
+  matte_blas->ztrsv(CblasColMajor, uplo, trans, diag,
+                    A->m, A->data, A->m, x->data, 1);
 
   /* return success. */
   return 1;
@@ -510,9 +648,13 @@ int matte_zher (MatteTriangle uplo, double alpha,
   if (A->m != x->n)
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, x));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) || !complex_matrix_interleave(A))
+    return 0;
+
   /* execute the cblas function. */
-  cblas_zher(CblasColMajor, uplo, A->m, alpha,
-             x->data, 1, A->data, A->m);
+  matte_blas->zher(CblasColMajor, uplo, A->m, alpha,
+                   x->data, 1, A->data, A->m);
 
   /* return success. */
   return 1;
@@ -539,69 +681,211 @@ int matte_zher2 (MatteTriangle uplo, complex double alpha,
   if (A->m != y->n)
     fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
 
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_vector_interleave(x) ||
+      !complex_vector_interleave(y) ||
+      !complex_matrix_interleave(A))
+    return 0;
+
   /* execute the cblas function. */
-  cblas_zher2(CblasColMajor, uplo, A->m, &alpha,
-              x->data, 1, y->data, 1,
-              A->data, A->m);
+  matte_blas->zher2(CblasColMajor, uplo, A->m, &alpha,
+                    x->data, 1, y->data, 1,
+                    A->data, A->m);
 
   /* return success. */
   return 1;
 }
 
-/* === level 3, double === */
+/* === level 2, single === */
 
-/* matte_dgemm(): wrapper around cblas_dgemm().
+/* matte_sgemv(): wrapper around cblas_sgemv().
  */
-int matte_dgemm (MatteTranspose transA, MatteTranspose transB,
-                 double alpha, Matrix A, Matrix B,
-                 double beta, Matrix C) {
+int matte_sgemv (MatteTranspose trans, float alpha, SingleMatrix A,
+                 SingleVector x, float beta, SingleVector y) {
   /* fail if any pointer is null. */
-  if (!A || !B || !C)
-    fail(ERR_INVALID_ARGIN);
-
-  /* store the output sizes. */
-  const int m = C->m;
-  const int n = C->n;
-  const int k = (transA == CblasNoTrans ? A->n : A->m);
+  if (!A || !x || !y)
+   fail(ERR_INVALID_ARGIN);
 
-  /* fail if any first operand sizes do not match. */
-  if (transA == CblasNoTrans) {
-    if (A->m != m)
-      fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, C));
+  /* fail if any sizes do not match. */
+  if (trans == CblasNoTrans) {
+    /* check the non-transposed sizes. */
+    if (A->n != x->n) fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
+    if (A->m != y->n) fail(ERR_SIZE_MISMATCH_MV(trans, A, y));
   }
   else {
-    if (A->n != m)
-      fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, C));
+    /* check the transposed sizes. */
+    if (A->m != x->n) fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
+    if (A->n != y->n) fail(ERR_SIZE_MISMATCH_MV(trans, A, y));
   }
 
-  /* fail if any second operand sizes do not match. */
-  if (transB == CblasNoTrans) {
-    if (B->m != k) fail(ERR_SIZE_MISMATCH_MM(transA, transB, A, B));
-    if (B->n != n) fail(ERR_SIZE_MISMATCH_MM(transB, CblasNoTrans, B, C));
-  }
-  else {
-    if (B->n != k) fail(ERR_SIZE_MISMATCH_MM(transA, transB, A, B));
-    if (B->m != n) fail(ERR_SIZE_MISMATCH_MM(transB, CblasNoTrans, B, C));
-  }
+  /* execute the cblas function. */
+  matte_blas->sgemv(CblasColMajor, trans, A->m, A->n, alpha, A->data, A->m,
+                    x->data, 1, beta, y->data, 1);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ssymv(): wrapper around cblas_ssymv().
+ */
+int matte_ssymv (MatteTriangle uplo, float alpha, SingleMatrix A,
+                 SingleVector x, float beta, SingleVector y) {
+  /* fail if any pointer is null. */
+  if (!A || !x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the input matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the input vector size does not match. */
+  if (A->m != x->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, x));
+
+  /* fail if the output vector size does not match. */
+  if (A->m != y->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
 
   /* execute the cblas function. */
-  cblas_dgemm(CblasColMajor, transA, transB, m, n, k,
-              alpha, A->data, A->m, B->data, B->m,
-              beta, C->data, C->m);
+  matte_blas->ssymv(CblasColMajor, uplo, A->m, alpha, A->data, A->m,
+                    x->data, 1, beta, y->data, 1);
 
   /* return success. */
   return 1;
 }
 
-/* FIXME: implement l3-d */
+/* matte_strmv(): wrapper around cblas_strmv().
+ */
+int matte_strmv (MatteTriangle uplo, MatteTranspose trans,
+                 MatteDiagonal diag, SingleMatrix A, SingleVector x) {
+  /* fail if either pointer is null. */
+  if (!A || !x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
 
-/* === level 3, complex double === */
+  /* fail if the operand sizes does not match. */
+  if (A->m != x->n)
+    fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
 
-/* matte_zgemm(): wrapper around cblas_zgemm().
+  /* execute the cblas function. */
+  matte_blas->strmv(CblasColMajor, uplo, trans, diag,
+                    A->m, A->data, A->m, x->data, 1);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_strsv(): wrapper around cblas_strsv().
  */
-int matte_zgemm (MatteTranspose transA, MatteTranspose transB,
-                 complex double alpha, ComplexMatrix A, ComplexMatrix B,
-                 complex double beta, ComplexMatrix C) {
+int matte_strsv (MatteTriangle uplo, MatteTranspose trans,
+                 MatteDiagonal diag, SingleMatrix A, SingleVector x) {
+  /* fail if either pointer is null. */
+  if (!A || !x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the operand sizes does not match. */
+  if (A->m != x->n)
+    fail(ERR_SIZE_MISMATCH_MV(trans, A, x));
+
+  /* execute the cblas function. */
+  matte_blas->strsv(CblasColMajor, uplo, trans, diag,
+                    A->m, A->data, A->m, x->data, 1);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_sger(): wrapper around cblas_sger().
+ */
+int matte_sger (float alpha, SingleVector x, SingleVector y, SingleMatrix A) {
+  /* fail if any pointer is null. */
+  if (!A || !x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the first vector size does not match. */
+  if (A->m != x->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, x));
+
+  /* fail if the second vector size does not match. */
+  if (A->n != y->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
+
+  /* execute the cblas function. */
+  matte_blas->sger(CblasColMajor, A->m, A->n, alpha,
+                   x->data, 1, y->data, 1,
+                   A->data, A->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ssyr(): wrapper around cblas_ssyr().
+ */
+int matte_ssyr (MatteTriangle uplo, float alpha, SingleVector x,
+                SingleMatrix A) {
+  /* fail if either pointer is null. */
+  if (!A || !x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the vector size does not match. */
+  if (A->m != x->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, x));
+
+  /* execute the cblas function. */
+  matte_blas->ssyr(CblasColMajor, uplo, A->m, alpha,
+                   x->data, 1, A->data, A->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ssyr2(): wrapper around cblas_ssyr2().
+ */
+int matte_ssyr2 (MatteTriangle uplo, float alpha,
+                 SingleVector x, SingleVector y, SingleMatrix A) {
+  /* fail if any pointer is null. */
+  if (!A || !x || !y)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the first vector size does not match. */
+  if (A->m != x->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, x));
+
+  /* fail if the second vector size does not match. */
+  if (A->m != y->n)
+    fail(ERR_SIZE_MISMATCH_MV(CblasNoTrans, A, y));
+
+  /* execute the cblas function. */
+  matte_blas->ssyr2(CblasColMajor, uplo, A->m, alpha,
+                    x->data, 1, y->data, 1,
+                    A->data, A->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* === level 3, double === */
+
+/* matte_dgemm(): wrapper around cblas_dgemm().
+ */
+int matte_dgemm (MatteTranspose transA, MatteTranspose transB,
+                 double alpha, Matrix A, Matrix B,
+                 double beta, Matrix C) {
   /* fail if any pointer is null. */
   if (!A || !B || !C)
     fail(ERR_INVALID_ARGIN);
@@ -632,13 +916,673 @@ int matte_zgemm (MatteTranspose transA, MatteTranspose transB,
   }
 
   /* execute the cblas function. */
-  cblas_zgemm(CblasColMajor, transA, transB, m, n, k,
-              &alpha, A->data, A->m, B->data, B->m,
-              &beta, C->data, C->m);
+  matte_blas->dgemm(CblasColMajor, transA, transB, m, n, k,
+                    alpha, A->data, A->m, B->data, B->m,
+                    beta, C->data, C->m);
 
   /* return success. */
   return 1;
 }
 
-/* FIXME: implement l3-z */
+/* matte_dsymm(): wrapper around cblas_dsymm().
+ */
+int matte_dsymm (MatteSide side, MatteTriangle uplo,
+                double alpha, Matrix A, Matrix B,
+                double beta, Matrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
 
+  /* fail if the symmetric matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the symmetric matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* fail if the output matrix size does not match. */
+  if (B->m != C->m || B->n != C->n)
+    fail(ERR_SIZE_MISMATCH);
+
+  /* execute the cblas function. */
+  matte_blas->dsymm(CblasColMajor, side, uplo, C->m, C->n,
+                    alpha, A->data, A->m, B->data, B->m,
+                    beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_dsyrk(): wrapper around cblas_dsyrk().
+ */
+int matte_dsyrk (MatteTriangle uplo, MatteTranspose trans,
+                double alpha, Matrix A,
+                double beta, Matrix C) {
+  /* fail if either pointer is null. */
+  if (!A || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* execute the cblas function. */
+  matte_blas->dsyrk(CblasColMajor, uplo, trans, n, k,
+                    alpha, A->data, A->m,
+                    beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_dsyr2k(): wrapper around cblas_dsyr2k().
+ */
+int matte_dsyr2k (MatteTriangle uplo, MatteTranspose trans,
+                 double alpha, Matrix A, Matrix B,
+                 double beta, Matrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* fail if the operand sizes do not match. */
+  if (A->m != B->m || A->n != B->n)
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* execute the cblas function. */
+  matte_blas->dsyr2k(CblasColMajor, uplo, trans, n, k,
+                     alpha, A->data, A->m, B->data, B->m,
+                     beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_dtrmm(): wrapper around cblas_dtrmm().
+ */
+int matte_dtrmm (MatteSide side, MatteTriangle uplo,
+                MatteTranspose transA, MatteDiagonal diag,
+                double alpha, Matrix A, Matrix B) {
+  /* fail if either pointer is null. */
+  if (!A || !B)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the triangular matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the triangular matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, B));
+
+  /* execute the cblas function. */
+  matte_blas->dtrmm(CblasColMajor, side, uplo, transA, diag, B->m, B->n,
+                    alpha, A->data, A->m, B->data, B->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_dtrsm(): wrapper around cblas_dtrsm().
+ */
+int matte_dtrsm (MatteSide side, MatteTriangle uplo,
+                MatteTranspose transA, MatteDiagonal diag,
+                double alpha, Matrix A, Matrix B) {
+  /* fail if either pointer is null. */
+  if (!A || !B)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the triangular matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the triangular matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, B));
+
+  /* execute the cblas function. */
+  matte_blas->dtrsm(CblasColMajor, side, uplo, transA, diag, B->m, B->n,
+                    alpha, A->data, A->m, B->data, B->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* === level 3, complex double === */
+
+/* matte_zgemm(): wrapper around cblas_zgemm().
+ */
+int matte_zgemm (MatteTranspose transA, MatteTranspose transB,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                 complex double beta, ComplexMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* store the output sizes. */
+  const int m = C->m;
+  const int n = C->n;
+  const int k = (transA == CblasNoTrans ? A->n : A->m);
+
+  /* fail if any first operand sizes do not match. */
+  if (transA == CblasNoTrans) {
+    if (A->m != m)
+      fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, C));
+  }
+  else {
+    if (A->n != m)
+      fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, C));
+  }
+
+  /* fail if any second operand sizes do not match. */
+  if (transB == CblasNoTrans) {
+    if (B->m != k) fail(ERR_SIZE_MISMATCH_MM(transA, transB, A, B));
+    if (B->n != n) fail(ERR_SIZE_MISMATCH_MM(transB, CblasNoTrans, B, C));
+  }
+  else {
+    if (B->n != k) fail(ERR_SIZE_MISMATCH_MM(transA, transB, A, B));
+    if (B->m != n) fail(ERR_SIZE_MISMATCH_MM(transB, CblasNoTrans, B, C));
+  }
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_matrix_interleave(B) ||
+      !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zgemm(CblasColMajor, transA, transB, m, n, k,
+                    &alpha, A->data, A->m, B->data, B->m,
+                    &beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_zsymm(): wrapper around cblas_zsymm().
+ */
+int matte_zsymm (MatteSide side, MatteTriangle uplo,
+                complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                complex double beta, ComplexMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the symmetric matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the symmetric matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* fail if the output matrix size does not match. */
+  if (B->m != C->m || B->n != C->n)
+    fail(ERR_SIZE_MISMATCH);
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_matrix_interleave(B) ||
+      !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zsymm(CblasColMajor, side, uplo, C->m, C->n,
+                    &alpha, A->data, A->m, B->data, B->m,
+                    &beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_zhemm(): wrapper around cblas_zhemm().
+ */
+int matte_zhemm (MatteSide side, MatteTriangle uplo,
+                complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                complex double beta, ComplexMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the symmetric matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the symmetric matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* fail if the output matrix size does not match. */
+  if (B->m != C->m || B->n != C->n)
+    fail(ERR_SIZE_MISMATCH);
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_matrix_interleave(B) ||
+      !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zhemm(CblasColMajor, side, uplo, C->m, C->n,
+                    &alpha, A->data, A->m, B->data, B->m,
+                    &beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_zsyrk(): wrapper around cblas_zsyrk().
+ */
+int matte_zsyrk (MatteTriangle uplo, MatteTranspose trans,
+                complex double alpha, ComplexMatrix A,
+                complex double beta, ComplexMatrix C) {
+  /* fail if either pointer is null. */
+  if (!A || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) || !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zsyrk(CblasColMajor, uplo, trans, n, k,
+                    &alpha, A->data, A->m,
+                    &beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_zherk(): wrapper around cblas_zherk().
+ */
+int matte_zherk (MatteTriangle uplo, MatteTranspose trans,
+                double alpha, ComplexMatrix A,
+                double beta, ComplexMatrix C) {
+  /* fail if either pointer is null. */
+  if (!A || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) || !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zherk(CblasColMajor, uplo, trans, n, k,
+                    alpha, A->data, A->m,
+                    beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_zsyr2k(): wrapper around cblas_zsyr2k().
+ */
+int matte_zsyr2k (MatteTriangle uplo, MatteTranspose trans,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                 complex double beta, ComplexMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* fail if the operand sizes do not match. */
+  if (A->m != B->m || A->n != B->n)
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_matrix_interleave(B) ||
+      !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zsyr2k(CblasColMajor, uplo, trans, n, k,
+                     &alpha, A->data, A->m, B->data, B->m,
+                     &beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_zher2k(): wrapper around cblas_zher2k().
+ */
+int matte_zher2k (MatteTriangle uplo, MatteTranspose trans,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                 double beta, ComplexMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* fail if the operand sizes do not match. */
+  if (A->m != B->m || A->n != B->n)
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) ||
+      !complex_matrix_interleave(B) ||
+      !complex_matrix_interleave(C))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->zher2k(CblasColMajor, uplo, trans, n, k,
+                     &alpha, A->data, A->m, B->data, B->m,
+                     beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ztrmm(): wrapper around cblas_ztrmm().
+ */
+int matte_ztrmm (MatteSide side, MatteTriangle uplo,
+                MatteTranspose transA, MatteDiagonal diag,
+                complex double alpha, ComplexMatrix A, ComplexMatrix B) {
+  /* fail if either pointer is null. */
+  if (!A || !B)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the triangular matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the triangular matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, B));
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) || !complex_matrix_interleave(B))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->ztrmm(CblasColMajor, side, uplo, transA, diag, B->m, B->n,
+                    &alpha, A->data, A->m, B->data, B->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ztrsm(): wrapper around cblas_ztrsm().
+ */
+int matte_ztrsm (MatteSide side, MatteTriangle uplo,
+                MatteTranspose transA, MatteDiagonal diag,
+                complex double alpha, ComplexMatrix A, ComplexMatrix B) {
+  /* fail if either pointer is null. */
+  if (!A || !B)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the triangular matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the triangular matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, B));
+
+  /* pass the elements to blas in interleaved storage. */
+  if (!complex_matrix_interleave(A) || !complex_matrix_interleave(B))
+    return 0;
+
+  /* execute the cblas function. */
+  matte_blas->ztrsm(CblasColMajor, side, uplo, transA, diag, B->m, B->n,
+                    &alpha, A->data, A->m, B->data, B->m);
+
+  /* return success. */
+  return 1;
+}
+
+
+/* === level 3, single === */
+
+/* matte_sgemm(): wrapper around cblas_sgemm().
+ */
+int matte_sgemm (MatteTranspose transA, MatteTranspose transB,
+                 float alpha, SingleMatrix A, SingleMatrix B,
+                 float beta, SingleMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* store the output sizes. */
+  const int m = C->m;
+  const int n = C->n;
+  const int k = (transA == CblasNoTrans ? A->n : A->m);
+
+  /* fail if any first operand sizes do not match. */
+  if (transA == CblasNoTrans) {
+    if (A->m != m)
+      fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, C));
+  }
+  else {
+    if (A->n != m)
+      fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, C));
+  }
+
+  /* fail if any second operand sizes do not match. */
+  if (transB == CblasNoTrans) {
+    if (B->m != k) fail(ERR_SIZE_MISMATCH_MM(transA, transB, A, B));
+    if (B->n != n) fail(ERR_SIZE_MISMATCH_MM(transB, CblasNoTrans, B, C));
+  }
+  else {
+    if (B->n != k) fail(ERR_SIZE_MISMATCH_MM(transA, transB, A, B));
+    if (B->m != n) fail(ERR_SIZE_MISMATCH_MM(transB, CblasNoTrans, B, C));
+  }
+
+  /* execute the cblas function. */
+  matte_blas->sgemm(CblasColMajor, transA, transB, m, n, k,
+                    alpha, A->data, A->m, B->data, B->m,
+                    beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ssymm(): wrapper around cblas_ssymm().
+ */
+int matte_ssymm (MatteSide side, MatteTriangle uplo,
+                float alpha, SingleMatrix A, SingleMatrix B,
+                float beta, SingleMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the symmetric matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the symmetric matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* fail if the output matrix size does not match. */
+  if (B->m != C->m || B->n != C->n)
+    fail(ERR_SIZE_MISMATCH);
+
+  /* execute the cblas function. */
+  matte_blas->ssymm(CblasColMajor, side, uplo, C->m, C->n,
+                    alpha, A->data, A->m, B->data, B->m,
+                    beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ssyrk(): wrapper around cblas_ssyrk().
+ */
+int matte_ssyrk (MatteTriangle uplo, MatteTranspose trans,
+                float alpha, SingleMatrix A,
+                float beta, SingleMatrix C) {
+  /* fail if either pointer is null. */
+  if (!A || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* execute the cblas function. */
+  matte_blas->ssyrk(CblasColMajor, uplo, trans, n, k,
+                    alpha, A->data, A->m,
+                    beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_ssyr2k(): wrapper around cblas_ssyr2k().
+ */
+int matte_ssyr2k (MatteTriangle uplo, MatteTranspose trans,
+                 float alpha, SingleMatrix A, SingleMatrix B,
+                 float beta, SingleMatrix C) {
+  /* fail if any pointer is null. */
+  if (!A || !B || !C)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the output matrix is not square. */
+  if (C->m != C->n)
+    fail(ERR_SIZE_NONSQUARE(C));
+
+  /* fail if the operand sizes do not match. */
+  if (A->m != B->m || A->n != B->n)
+    fail(ERR_SIZE_MISMATCH_MM(CblasNoTrans, CblasNoTrans, A, B));
+
+  /* store the output and inner sizes. */
+  const int n = C->m;
+  const int k = (trans == CblasNoTrans ? A->n : A->m);
+
+  /* fail if the operand size does not match. */
+  if ((trans == CblasNoTrans ? A->m : A->n) != n)
+    fail(ERR_SIZE_MISMATCH_MM(trans, CblasNoTrans, A, C));
+
+  /* execute the cblas function. */
+  matte_blas->ssyr2k(CblasColMajor, uplo, trans, n, k,
+                     alpha, A->data, A->m, B->data, B->m,
+                     beta, C->data, C->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_strmm(): wrapper around cblas_strmm().
+ */
+int matte_strmm (MatteSide side, MatteTriangle uplo,
+                MatteTranspose transA, MatteDiagonal diag,
+                float alpha, SingleMatrix A, SingleMatrix B) {
+  /* fail if either pointer is null. */
+  if (!A || !B)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the triangular matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the triangular matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, B));
+
+  /* execute the cblas function. */
+  matte_blas->strmm(CblasColMajor, side, uplo, transA, diag, B->m, B->n,
+                    alpha, A->data, A->m, B->data, B->m);
+
+  /* return success. */
+  return 1;
+}
+
+/* matte_strsm(): wrapper around cblas_strsm().
+ */
+int matte_strsm (MatteSide side, MatteTriangle uplo,
+                MatteTranspose transA, MatteDiagonal diag,
+                float alpha, SingleMatrix A, SingleMatrix B) {
+  /* fail if either pointer is null. */
+  if (!A || !B)
+    fail(ERR_INVALID_ARGIN);
+
+  /* fail if the triangular matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* fail if the triangular matrix size does not match. */
+  if (A->m != (side == CblasLeft ? B->m : B->n))
+    fail(ERR_SIZE_MISMATCH_MM(transA, CblasNoTrans, A, B));
+
+  /* execute the cblas function. */
+  matte_blas->strsm(CblasColMajor, side, uplo, transA, diag, B->m, B->n,
+                    alpha, A->data, A->m, B->data, B->m);
+
+  /* return success. */
+  return 1;
+}
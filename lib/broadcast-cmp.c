@@ -0,0 +1,125 @@
+
+/* define macros for generating a broadcasting comparison method.
+ */
+#define STR(a)           #a
+#define STRING(a)        STR(a)
+#define CONCAT(a,b)      a ## b
+#define CONCAT3(a,b,c)   a ## b ## c
+#define FUNCTION(name)   CONCAT(broadcast_, name)
+#define KNAME(name,ab)   CONCAT3(broadcast_, name, ab)
+
+/* complex operands are compared by magnitude, except in equality
+ * comparisons.
+ */
+#ifdef CMPEQ
+#define MAG(x) (x)
+#else
+#define MAG(x) cabs(x)
+#endif
+
+/* real <op> real => logical */
+static void KNAME(F,_dd) (long n, const void *a, long sa,
+                          const void *b, long sb, void *c) {
+  simd_compare(SOP, n, a, sa, b, sb, c);
+}
+
+/* real <op> complex => logical */
+#define KERNEL KNAME(F,_dz)
+#define KEXPR(x,y) CMP(x, MAG(y))
+#define TA double
+#define TB complex double
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* complex <op> real => logical */
+#define KERNEL KNAME(F,_zd)
+#define KEXPR(x,y) CMP(MAG(x), y)
+#define TA complex double
+#define TB double
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* complex <op> complex => logical */
+#define KERNEL KNAME(F,_zz)
+#define KEXPR(x,y) CMP(MAG(x), MAG(y))
+#define TA complex double
+#define TB complex double
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* real <op> single => logical */
+#define KERNEL KNAME(F,_ds)
+#define KEXPR(x,y) CMP((float) (x), y)
+#define TA double
+#define TB float
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* single <op> real => logical */
+#define KERNEL KNAME(F,_sd)
+#define KEXPR(x,y) CMP(x, (float) (y))
+#define TA float
+#define TB double
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* single <op> single => logical */
+#define KERNEL KNAME(F,_ss)
+#define KEXPR CMP
+#define TA float
+#define TB float
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* kernels of the operation, indexed by operand complexity. */
+static const broadcast_kernel KNAME(F,_kernels)[4] = {
+  KNAME(F,_dd), KNAME(F,_dz), KNAME(F,_zd), KNAME(F,_zz)
+};
+
+/* single-precision kernels of the operation, indexed by operand
+ * precision.
+ */
+static const broadcast_kernel KNAME(F,_single)[4] = {
+  NULL, KNAME(F,_ds), KNAME(F,_sd), KNAME(F,_ss)
+};
+
+/* int32 <op> int32 => logical */
+#define KERNEL KNAME(F,_i32)
+#define KEXPR CMP
+#define TA int32_t
+#define TB int32_t
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* int64 <op> int64 => logical */
+#define KERNEL KNAME(F,_i64)
+#define KEXPR CMP
+#define TA int64_t
+#define TB int64_t
+#define TC unsigned char
+#include "broadcast-kernel.c"
+
+/* integer kernels of the operation, indexed by operand width. */
+static const broadcast_kernel KNAME(F,_int)[2] = {
+  KNAME(F,_i32), KNAME(F,_i64)
+};
+
+Object FUNCTION(F) (Zone z, Object a, Object b) {
+  return broadcast_apply(z, a, b, STRING(F),
+                         KNAME(F,_kernels), KNAME(F,_single),
+                         KNAME(F,_int), NULL, 0);
+}
+
+/* undefine the method generator macros.
+ */
+#undef STR
+#undef STRING
+#undef CONCAT
+#undef CONCAT3
+#undef FUNCTION
+#undef KNAME
+#undef CMPEQ
+#undef MAG
+#undef CMP
+#undef SOP
+#undef F
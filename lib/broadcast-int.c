@@ -0,0 +1,142 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* define macros for generating saturating integer arithmetic.
+ */
+#define CONCAT4(a,b,c,d) a ## b ## c ## d
+#define SATNAME(b,name)  CONCAT4(broadcast_sat, b, _, name)
+#define SAT(name)        SATNAME(B, name)
+
+#ifdef W
+/* SAT(clamp): saturate a result computed exactly in the wider type.
+ */
+static inline T SAT(clamp) (W r) {
+  return (r > TMAX ? TMAX : r < TMIN ? TMIN : (T) r);
+}
+#endif
+
+/* SAT(plus): saturating integer addition.
+ */
+static inline T SAT(plus) (T x, T y) {
+#if defined(W)
+  return SAT(clamp)((W) x + (W) y);
+#elif defined(__GNUC__)
+  T r;
+  if (__builtin_add_overflow(x, y, &r))
+    return (y > 0 ? TMAX : TMIN);
+
+  return r;
+#else
+  if (y > 0 && x > TMAX - y) return TMAX;
+  if (y < 0 && x < TMIN - y) return TMIN;
+  return x + y;
+#endif
+}
+
+/* SAT(minus): saturating integer subtraction.
+ */
+static inline T SAT(minus) (T x, T y) {
+#if defined(W)
+  return SAT(clamp)((W) x - (W) y);
+#elif defined(__GNUC__)
+  T r;
+  if (__builtin_sub_overflow(x, y, &r))
+    return (y < 0 ? TMAX : TMIN);
+
+  return r;
+#else
+  if (y < 0 && x > TMAX + y) return TMAX;
+  if (y > 0 && x < TMIN + y) return TMIN;
+  return x - y;
+#endif
+}
+
+/* SAT(times): saturating integer multiplication.
+ */
+static inline T SAT(times) (T x, T y) {
+#if defined(W)
+  return SAT(clamp)((W) x * (W) y);
+#elif defined(__GNUC__)
+  T r;
+  if (__builtin_mul_overflow(x, y, &r))
+    return ((x < 0) != (y < 0) ? TMIN : TMAX);
+
+  return r;
+#else
+  if (x == 0 || y == 0)
+    return 0;
+
+  if (x > 0 ? (y > 0 ? x > TMAX / y : y < TMIN / x)
+            : (y > 0 ? x < TMIN / y : x < TMAX / y))
+    return ((x < 0) != (y < 0) ? TMIN : TMAX);
+
+  return x * y;
+#endif
+}
+
+/* SAT(rdivide): saturating integer division, which rounds to the nearest
+ * integer with ties away from zero, like the int32() and int64()
+ * conversions. division by zero saturates to the limit that holds the
+ * sign of the dividend.
+ */
+static inline T SAT(rdivide) (T x, T y) {
+  if (y == 0)
+    return (x > 0 ? TMAX : x < 0 ? TMIN : 0);
+
+  if (y == -1)
+    return (x == TMIN ? TMAX : -x);
+
+  /* round away from zero when twice the remainder reaches the divisor.
+   * the magnitudes are compared as negatives, which cannot overflow.
+   */
+  const T q = x / y, r = x % y;
+  const T nr = (r < 0 ? r : -r);
+  const T ny = (y < 0 ? y : -y);
+  if (nr <= ny - nr)
+    return q + ((x < 0) == (y < 0) ? 1 : -1);
+
+  return q;
+}
+
+/* SAT(ldivide): saturating integer left division.
+ */
+static inline T SAT(ldivide) (T x, T y) {
+  return SAT(rdivide)(y, x);
+}
+
+/* SAT(power): saturating integer exponentiation by squaring. negative
+ * exponents produce zero, like exponentiation of integer scalars.
+ */
+static inline T SAT(power) (T x, T y) {
+  if (y == 0)
+    return 1;
+
+  if (y < 0)
+    return 0;
+
+  T r = 1;
+  while (y) {
+    if (y & 1)
+      r = SAT(times)(r, x);
+
+    y >>= 1;
+    if (y)
+      x = SAT(times)(x, x);
+  }
+
+  return r;
+}
+
+/* undefine the saturating arithmetic generator macros.
+ */
+#undef CONCAT4
+#undef SATNAME
+#undef SAT
+#undef TMIN
+#undef TMAX
+#undef W
+#undef B
+#undef T
+
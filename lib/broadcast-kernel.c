@@ -0,0 +1,42 @@
+
+/* define a strided broadcasting kernel. the three loops over array and
+ * scalar operands are kept separate so that each may be vectorized.
+ */
+static void KERNEL (long n, const void *pa, long sa,
+                    const void *pb, long sb, void *pc) {
+  const TA *a = (const TA*) pa;
+  const TB *b = (const TB*) pb;
+  TC *c = (TC*) pc;
+
+  if (sa && sb) {
+    /* array <op> array */
+    for (long i = 0; i < n; i++)
+      c[i] = KEXPR(a[i], b[i]);
+  }
+  else if (sa) {
+    /* array <op> scalar */
+    const TB y = *b;
+    for (long i = 0; i < n; i++)
+      c[i] = KEXPR(a[i], y);
+  }
+  else if (sb) {
+    /* scalar <op> array */
+    const TA x = *a;
+    for (long i = 0; i < n; i++)
+      c[i] = KEXPR(x, b[i]);
+  }
+  else {
+    /* scalar <op> scalar */
+    const TC r = KEXPR(*a, *b);
+    for (long i = 0; i < n; i++)
+      c[i] = r;
+  }
+}
+
+/* undefine the kernel generator macros.
+ */
+#undef KERNEL
+#undef KEXPR
+#undef TA
+#undef TB
+#undef TC
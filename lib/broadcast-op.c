@@ -0,0 +1,158 @@
+
+/* define macros for generating a broadcasting arithmetic method.
+ */
+#define STR(a)           #a
+#define STRING(a)        STR(a)
+#define CONCAT(a,b)      a ## b
+#define CONCAT3(a,b,c)   a ## b ## c
+#define FUNCTION(name)   CONCAT(broadcast_, name)
+#define KNAME(name,ab)   CONCAT3(broadcast_, name, ab)
+
+/* single-precision operations default to their real counterparts. */
+#ifndef FOP
+#define FOP ROP
+#endif
+
+/* real <op> real => real */
+#define KERNEL KNAME(F,_dd)
+#define KEXPR ROP
+#define TA double
+#define TB double
+#define TC double
+#include "broadcast-kernel.c"
+
+/* real <op> complex => complex */
+#define KERNEL KNAME(F,_dz)
+#define KEXPR COP
+#define TA double
+#define TB complex double
+#define TC complex double
+#include "broadcast-kernel.c"
+
+/* complex <op> real => complex */
+#define KERNEL KNAME(F,_zd)
+#define KEXPR COP
+#define TA complex double
+#define TB double
+#define TC complex double
+#include "broadcast-kernel.c"
+
+/* complex <op> complex => complex */
+#define KERNEL KNAME(F,_zz)
+#define KEXPR COP
+#define TA complex double
+#define TB complex double
+#define TC complex double
+#include "broadcast-kernel.c"
+
+/* kernels of the operation, indexed by operand complexity. */
+static const broadcast_kernel KNAME(F,_kernels)[4] = {
+  KNAME(F,_dd), KNAME(F,_dz), KNAME(F,_zd), KNAME(F,_zz)
+};
+
+/* real <op> single => single */
+#define KERNEL KNAME(F,_ds)
+#define KEXPR(x,y) FOP((float) (x), y)
+#define TA double
+#define TB float
+#define TC float
+#include "broadcast-kernel.c"
+
+/* single <op> real => single */
+#define KERNEL KNAME(F,_sd)
+#define KEXPR(x,y) FOP(x, (float) (y))
+#define TA float
+#define TB double
+#define TC float
+#include "broadcast-kernel.c"
+
+/* single <op> single => single */
+#define KERNEL KNAME(F,_ss)
+#define KEXPR FOP
+#define TA float
+#define TB float
+#define TC float
+#include "broadcast-kernel.c"
+
+/* single-precision kernels of the operation, indexed by operand
+ * precision.
+ */
+static const broadcast_kernel KNAME(F,_single)[4] = {
+  NULL, KNAME(F,_ds), KNAME(F,_sd), KNAME(F,_ss)
+};
+
+#ifdef IOP
+/* int32 <op> int32 => int32 */
+#define KERNEL KNAME(F,_i32)
+#define KEXPR(x,y) IOP(32, x, y)
+#define TA int32_t
+#define TB int32_t
+#define TC int32_t
+#include "broadcast-kernel.c"
+
+/* int64 <op> int64 => int64 */
+#define KERNEL KNAME(F,_i64)
+#define KEXPR(x,y) IOP(64, x, y)
+#define TA int64_t
+#define TB int64_t
+#define TC int64_t
+#include "broadcast-kernel.c"
+
+/* integer kernels of the operation, indexed by operand width. */
+static const broadcast_kernel KNAME(F,_int)[2] = {
+  KNAME(F,_i32), KNAME(F,_i64)
+};
+#define INT_KERNELS KNAME(F,_int)
+#else
+#define INT_KERNELS NULL
+#endif
+
+#ifdef SZZ
+/* real <op> complex => complex, in split storage */
+#define KERNEL KNAME(F,_sdz)
+#define KEXPR(xr,xi,yr,yi,cr,ci) SDZ(xr, yr, yi, cr, ci)
+#include "broadcast-split.c"
+
+/* complex <op> real => complex, in split storage */
+#define KERNEL KNAME(F,_szd)
+#define KEXPR(xr,xi,yr,yi,cr,ci) SZD(xr, xi, yr, cr, ci)
+#include "broadcast-split.c"
+
+/* complex <op> complex => complex, in split storage */
+#define KERNEL KNAME(F,_szz)
+#define KEXPR(xr,xi,yr,yi,cr,ci) SZZ(xr, xi, yr, yi, cr, ci)
+#include "broadcast-split.c"
+
+/* split kernels of the operation, indexed by operand complexity. */
+static const broadcast_split_kernel KNAME(F,_split)[4] = {
+  NULL, KNAME(F,_sdz), KNAME(F,_szd), KNAME(F,_szz)
+};
+#define SPLIT_KERNELS KNAME(F,_split)
+#else
+#define SPLIT_KERNELS NULL
+#endif
+
+Object FUNCTION(F) (Zone z, Object a, Object b) {
+  return broadcast_apply(z, a, b, STRING(F),
+                         KNAME(F,_kernels), KNAME(F,_single),
+                         INT_KERNELS, SPLIT_KERNELS, 1);
+}
+
+/* undefine the method generator macros.
+ */
+#undef STR
+#undef STRING
+#undef CONCAT
+#undef CONCAT3
+#undef FUNCTION
+#undef KNAME
+#undef ROP
+#undef COP
+#undef FOP
+#undef IOP
+#undef SDZ
+#undef SZD
+#undef SZZ
+#undef INT_KERNELS
+#undef SPLIT_KERNELS
+#undef F
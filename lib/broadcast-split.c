@@ -0,0 +1,46 @@
+
+/* define a strided broadcasting kernel over split operands. the loops
+ * are arranged as in the interleaved kernels, and each part of the
+ * result is computed from the parts of the operands, which avoids the
+ * shuffling of interleaved elements.
+ */
+static void KERNEL (long n, const double *ar, const double *ai, long sa,
+                    const double *br, const double *bi, long sb,
+                    double *cr, double *ci) {
+  if (sa && sb) {
+    /* array <op> array */
+    for (long i = 0; i < n; i++)
+      KEXPR(ar[i], ai[i], br[i], bi[i], cr[i], ci[i]);
+  }
+  else if (sa) {
+    /* array <op> scalar */
+    const double yr = *br;
+    const double yi = (bi ? *bi : 0.0);
+    for (long i = 0; i < n; i++)
+      KEXPR(ar[i], ai[i], yr, yi, cr[i], ci[i]);
+  }
+  else if (sb) {
+    /* scalar <op> array */
+    const double xr = *ar;
+    const double xi = (ai ? *ai : 0.0);
+    for (long i = 0; i < n; i++)
+      KEXPR(xr, xi, br[i], bi[i], cr[i], ci[i]);
+  }
+  else {
+    /* scalar <op> scalar */
+    const double xr = *ar, xi = (ai ? *ai : 0.0);
+    const double yr = *br, yi = (bi ? *bi : 0.0);
+    double rr, ri;
+    KEXPR(xr, xi, yr, yi, rr, ri);
+    for (long i = 0; i < n; i++) {
+      cr[i] = rr;
+      ci[i] = ri;
+    }
+  }
+}
+
+/* undefine the kernel generator macros.
+ */
+#undef KERNEL
+#undef KEXPR
+
@@ -0,0 +1,848 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the broadcast, exception, simd, threads and split headers. */
+#include <matte/broadcast.h>
+#include <matte/except.h>
+#include <matte/simd.h>
+#include <matte/threads.h>
+#include <matte/split.h>
+
+/* include headers for all numeric types. */
+#include <matte/int.h>
+#include <matte/range.h>
+#include <matte/float.h>
+#include <matte/float-range.h>
+#include <matte/complex.h>
+#include <matte/vector.h>
+#include <matte/matrix.h>
+#include <matte/complex-vector.h>
+#include <matte/complex-matrix.h>
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+#include <matte/logical.h>
+#include <matte/int32-array.h>
+#include <matte/int64-array.h>
+
+/* BroadcastArg: a struct _BroadcastArg. */
+typedef struct _BroadcastArg BroadcastArg;
+
+/* _BroadcastArg: structure for holding the shape and elements of one
+ * operand of a broadcasting operation.
+ */
+struct _BroadcastArg {
+  /* @data: pointer to the first operand element.
+   * @cplx: whether the elements are complex.
+   * @sngl: whether the elements are held in single precision.
+   * @intg: bit width of integer elements, or zero.
+   * @mat: whether the operand is a matrix.
+   * @scal: whether the operand is a scalar.
+   */
+  const void *data;
+  int cplx, sngl, intg, mat, scal;
+
+  /* @m: number of operand rows.
+   * @n: number of operand columns.
+   * @tr: transposition status, for vector operands.
+   */
+  long m, n;
+  MatteTranspose tr;
+
+  /* @rval: storage for real scalar operands.
+   * @cval: storage for complex scalar operands.
+   * @ival, @ival32: storage for integer scalar operands.
+   */
+  double rval;
+  complex double cval;
+  int64_t ival;
+  int32_t ival32;
+};
+
+/* broadcast_arg(): describe an object as an operand of a broadcasting
+ * operation.
+ *
+ * arguments:
+ *  @obj: object to describe.
+ *  @x: operand structure to fill.
+ *
+ * returns:
+ *  integer indicating success (1), failure (0), or that the object is
+ *  not a supported operand type (-1).
+ */
+static int broadcast_arg (Object obj, BroadcastArg *x) {
+  /* initialize the operand as a real scalar. */
+  x->data = &x->rval;
+  x->cplx = x->sngl = x->intg = x->mat = 0;
+  x->scal = 1;
+  x->m = x->n = 1;
+  x->tr = CblasNoTrans;
+
+  if (IS_INT(obj)) {
+    x->ival = int_get_value((Int) obj);
+    x->rval = (double) x->ival;
+  }
+  else if (IS_FLOAT(obj)) {
+    x->rval = float_get_value((Float) obj);
+  }
+  else if (IS_COMPLEX(obj)) {
+    x->cval = complex_get_value((Complex) obj);
+    x->data = &x->cval;
+    x->cplx = 1;
+  }
+  else if (IS_VECTOR(obj)) {
+    Vector v = (Vector) obj;
+    x->scal = 0;
+    x->data = v->data;
+    x->tr = v->tr;
+    if (v->tr == CblasNoTrans) x->m = v->n;
+    else x->n = v->n;
+  }
+  else if (IS_COMPLEX_VECTOR(obj)) {
+    ComplexVector v = (ComplexVector) obj;
+    x->scal = 0;
+    x->data = v->data;
+    x->cplx = 1;
+    x->tr = v->tr;
+    if (v->tr == CblasNoTrans) x->m = v->n;
+    else x->n = v->n;
+  }
+  else if (IS_MATRIX(obj)) {
+    Matrix A = (Matrix) obj;
+    if (!matrix_untranspose(A))
+      return 0;
+
+    x->scal = 0;
+    x->data = A->data;
+    x->mat = 1;
+    x->m = A->m;
+    x->n = A->n;
+  }
+  else if (IS_COMPLEX_MATRIX(obj)) {
+    ComplexMatrix A = (ComplexMatrix) obj;
+    if (!complex_matrix_untranspose(A))
+      return 0;
+
+    x->scal = 0;
+    x->data = A->data;
+    x->cplx = x->mat = 1;
+    x->m = A->m;
+    x->n = A->n;
+  }
+  else if (IS_SINGLE_VECTOR(obj)) {
+    SingleVector v = (SingleVector) obj;
+    x->scal = 0;
+    x->data = v->data;
+    x->sngl = 1;
+    x->tr = v->tr;
+    if (v->tr == CblasNoTrans) x->m = v->n;
+    else x->n = v->n;
+  }
+  else if (IS_SINGLE_MATRIX(obj)) {
+    SingleMatrix A = (SingleMatrix) obj;
+    if (!single_matrix_untranspose(A))
+      return 0;
+
+    x->scal = 0;
+    x->data = A->data;
+    x->sngl = x->mat = 1;
+    x->m = A->m;
+    x->n = A->n;
+  }
+  else if (IS_INT32_ARRAY(obj)) {
+    Int32Array A = (Int32Array) obj;
+    x->scal = 0;
+    x->data = A->data;
+    x->intg = 32;
+    x->mat = A->mat;
+    x->m = A->m;
+    x->n = A->n;
+    x->tr = (A->n == 1 ? CblasNoTrans : CblasTrans);
+  }
+  else if (IS_INT64_ARRAY(obj)) {
+    Int64Array A = (Int64Array) obj;
+    x->scal = 0;
+    x->data = A->data;
+    x->intg = 64;
+    x->mat = A->mat;
+    x->m = A->m;
+    x->n = A->n;
+    x->tr = (A->n == 1 ? CblasNoTrans : CblasTrans);
+  }
+  else
+    return -1;
+
+  return 1;
+}
+
+/* broadcast_int_scalar(): convert an integer scalar operand of a
+ * broadcasting operation to the element type of an integer array, with
+ * saturation at the limits of its range.
+ *
+ * arguments:
+ *  @x: operand to modify.
+ *  @intg: bit width of the integer array elements.
+ */
+static void broadcast_int_scalar (BroadcastArg *x, int intg) {
+  if (intg == 32) {
+    x->ival32 = (x->ival > INT32_MAX ? INT32_MAX :
+                 x->ival < INT32_MIN ? INT32_MIN : (int32_t) x->ival);
+    x->data = &x->ival32;
+  }
+  else
+    x->data = &x->ival;
+
+  x->intg = intg;
+}
+
+/* broadcast_parts(): get the real and imaginary parts of an operand of
+ * a broadcasting operation in split storage. complex scalars are split
+ * by their interleaved parts, and real operands have no imaginary parts.
+ *
+ * arguments:
+ *  @x: operand to access.
+ *  @re: pointer to the real parts, on return.
+ *  @im: pointer to the imaginary parts, or null, on return.
+ */
+static void broadcast_parts (const BroadcastArg *x,
+                             const double **re, const double **im) {
+  *re = (const double*) x->data;
+  *im = (!x->cplx ? NULL : x->scal ? *re + 1 : *re + x->m * x->n);
+}
+
+/* broadcast_layout(): get the storage layout of an object.
+ *
+ * arguments:
+ *  @obj: object to access.
+ *
+ * returns:
+ *  one for complex arrays in split storage, zero for complex arrays in
+ *  interleaved storage, and minus one for all other objects.
+ */
+static int broadcast_layout (Object obj) {
+  if (IS_COMPLEX_VECTOR(obj))
+    return ((ComplexVector) obj)->split;
+  else if (IS_COMPLEX_MATRIX(obj))
+    return ((ComplexMatrix) obj)->split;
+
+  return -1;
+}
+
+/* broadcast_interleave(): ensure that the elements of an operand of a
+ * broadcasting operation are held in interleaved storage.
+ *
+ * arguments:
+ *  @obj: object to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int broadcast_interleave (Object obj) {
+  if (IS_COMPLEX_VECTOR(obj))
+    return complex_vector_interleave((ComplexVector) obj);
+  else if (IS_COMPLEX_MATRIX(obj))
+    return complex_matrix_interleave((ComplexMatrix) obj);
+
+  return 1;
+}
+
+/* broadcast_is_single(): check whether an object is an array held in
+ * single precision.
+ *
+ * arguments:
+ *  @obj: object to access.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the object is a single
+ *  vector or matrix.
+ */
+static int broadcast_is_single (Object obj) {
+  return (IS_SINGLE_VECTOR(obj) || IS_SINGLE_MATRIX(obj));
+}
+
+/* broadcast_int_width(): get the bit width of the elements of an
+ * integer array.
+ *
+ * arguments:
+ *  @obj: object to access.
+ *
+ * returns:
+ *  bit width of the elements of an integer array, or zero for all other
+ *  objects.
+ */
+static int broadcast_int_width (Object obj) {
+  if (IS_INT32_ARRAY(obj))
+    return 32;
+  else if (IS_INT64_ARRAY(obj))
+    return 64;
+
+  return 0;
+}
+
+/* broadcast_is_range(): check whether an object is an integer or float
+ * range.
+ *
+ * arguments:
+ *  @obj: object to access.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the object is a range.
+ */
+static int broadcast_is_range (Object obj) {
+  return (IS_RANGE(obj) || IS_FLOAT_RANGE(obj));
+}
+
+/* broadcast_widen(): convert a logical, single-precision or integer
+ * operand of a broadcasting operation to double precision, and expand
+ * ranges into double-precision vectors.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @obj: object to convert.
+ *  @sngl: whether to convert single-precision operands.
+ *  @intg: whether to convert integer arrays.
+ *
+ * returns:
+ *  newly allocated double-precision copy of a logical array or range
+ *  or, if requested, of a single or integer array. @obj itself is
+ *  returned for all other objects.
+ */
+static Object broadcast_widen (Zone z, Object obj, int sngl, int intg) {
+  if (IS_LOGICAL(obj))
+    return logical_to_double(z, (Logical) obj);
+  else if (IS_RANGE(obj))
+    return (Object) vector_new_from_range(z, (Range) obj);
+  else if (IS_FLOAT_RANGE(obj))
+    return (Object) vector_new_from_float_range(z, (FloatRange) obj);
+  else if (sngl && IS_SINGLE_VECTOR(obj))
+    return (Object) single_vector_to_double(z, (SingleVector) obj);
+  else if (sngl && IS_SINGLE_MATRIX(obj))
+    return (Object) single_matrix_to_double(z, (SingleMatrix) obj);
+  else if (intg && IS_INT32_ARRAY(obj))
+    return int32_array_to_double(z, (Int32Array) obj);
+  else if (intg && IS_INT64_ARRAY(obj))
+    return int64_array_to_double(z, (Int64Array) obj);
+
+  return obj;
+}
+
+/* broadcast_alloc(): allocate the result of a broadcasting operation.
+ * the result is a matrix if either operand is a matrix or if it has
+ * more than one row and column, and a vector otherwise. logical and
+ * integer results take the same shape.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x, @y: operands of the broadcasting operation.
+ *  @m: number of result rows.
+ *  @n: number of result columns.
+ *  @cplx: whether the result is complex.
+ *  @sngl: whether the result is held in single precision.
+ *  @intg: bit width of integer results, or zero.
+ *  @lgcl: whether the result is a logical array.
+ *  @split: whether complex results are held in split storage.
+ *  @data: pointer to the result elements, on return.
+ *
+ * returns:
+ *  newly allocated result object.
+ */
+static Object broadcast_alloc (Zone z, BroadcastArg *x, BroadcastArg *y,
+                               long m, long n, int cplx, int sngl,
+                               int intg, int lgcl, int split, void **data) {
+  const int mat = (x->mat || y->mat || (m != 1 && n != 1));
+  if (lgcl) {
+    /* allocate a logical result. */
+    Logical L = logical_new_with_size(z, m, n);
+    if (!L)
+      return NULL;
+
+    L->mat = mat;
+    *data = L->data;
+    return (Object) L;
+  }
+  else if (intg == 32) {
+    /* allocate a 32-bit integer result. */
+    Int32Array A = int32_array_new_with_size(z, m, n);
+    if (!A)
+      return NULL;
+
+    A->mat = mat;
+    *data = A->data;
+    return (Object) A;
+  }
+  else if (intg == 64) {
+    /* allocate a 64-bit integer result. */
+    Int64Array A = int64_array_new_with_size(z, m, n);
+    if (!A)
+      return NULL;
+
+    A->mat = mat;
+    *data = A->data;
+    return (Object) A;
+  }
+
+  if (mat) {
+    /* allocate a matrix result. */
+    if (cplx) {
+      ComplexMatrix A = complex_matrix_new_with_size(z, m, n);
+      if (!A)
+        return NULL;
+
+      A->split = split;
+      *data = A->data;
+      return (Object) A;
+    }
+    else if (sngl) {
+      SingleMatrix A = single_matrix_new_with_size(z, m, n);
+      if (!A)
+        return NULL;
+
+      *data = A->data;
+      return (Object) A;
+    }
+
+    Matrix A = matrix_new_with_size(z, m, n);
+    if (!A)
+      return NULL;
+
+    *data = A->data;
+    return (Object) A;
+  }
+
+  /* determine the orientation of the vector result. single-element
+   * results take the orientation of their first vector operand.
+   */
+  MatteTranspose tr = (n == 1 ? CblasNoTrans : CblasTrans);
+  if (m == 1 && n == 1)
+    tr = (x->m == 1 && x->n == 1 ? y->tr : x->tr);
+
+  /* allocate a vector result. */
+  const long len = (tr == CblasNoTrans ? m : n);
+  if (cplx) {
+    ComplexVector v = complex_vector_new_with_length(z, len);
+    if (!v)
+      return NULL;
+
+    v->tr = tr;
+    v->split = split;
+    *data = v->data;
+    return (Object) v;
+  }
+  else if (sngl) {
+    SingleVector v = single_vector_new_with_length(z, len);
+    if (!v)
+      return NULL;
+
+    v->tr = tr;
+    *data = v->data;
+    return (Object) v;
+  }
+
+  Vector v = vector_new_with_length(z, len);
+  if (!v)
+    return NULL;
+
+  v->tr = tr;
+  *data = v->data;
+  return (Object) v;
+}
+
+/* BroadcastLoop: a struct _BroadcastLoop. */
+typedef struct _BroadcastLoop BroadcastLoop;
+
+/* _BroadcastLoop: structure for holding the state of a broadcasting
+ * operation that is split across the thread pool.
+ */
+struct _BroadcastLoop {
+  /* @fn: kernel of the operation.
+   * @pa, @pb: first elements of the operands.
+   * @pc: first element of the result.
+   */
+  broadcast_kernel fn;
+  const char *pa, *pb;
+  char *pc;
+
+  /* @sza, @szb, @szc: element sizes of the operands and result.
+   * @m: number of result rows, or zero for flat loops.
+   * @xi, @xj: row and column increments of the first operand.
+   * @yi, @yj: row and column increments of the second operand.
+   */
+  size_t sza, szb, szc;
+  long m, xi, xj, yi, yj;
+
+  /* @sfn: kernel of the operation over split operands.
+   * @ar, @ai, @br, @bi: real and imaginary parts of split operands.
+   * @cr, @ci: real and imaginary parts of the split result.
+   */
+  broadcast_split_kernel sfn;
+  const double *ar, *ai, *br, *bi;
+  double *cr, *ci;
+};
+
+/* OFFSET(): macro to offset a pointer to the imaginary parts of a split
+ * operand, which is null for real operands.
+ */
+#define OFFSET(p,k) ((p) ? (p) + (k) : NULL)
+
+/* broadcast_flat(): compute a range of elements of a broadcasting
+ * operation whose operands are full-sized or single elements.
+ */
+static void broadcast_flat (void *arg, int id, long start, long end) {
+  const BroadcastLoop *L = (const BroadcastLoop*) arg;
+  L->fn(end - start,
+        L->pa + start * L->xi * L->sza, L->xi,
+        L->pb + start * L->yi * L->szb, L->yi,
+        L->pc + start * L->szc);
+}
+
+/* broadcast_cols(): compute a range of result columns of a broadcasting
+ * operation.
+ */
+static void broadcast_cols (void *arg, int id, long start, long end) {
+  const BroadcastLoop *L = (const BroadcastLoop*) arg;
+  for (long j = start; j < end; j++)
+    L->fn(L->m,
+          L->pa + j * L->xj * L->sza, L->xi,
+          L->pb + j * L->yj * L->szb, L->yi,
+          L->pc + j * L->m * L->szc);
+}
+
+/* broadcast_split_flat(): compute a range of elements of a broadcasting
+ * operation over split operands that are full-sized or single elements.
+ */
+static void broadcast_split_flat (void *arg, int id, long start, long end) {
+  const BroadcastLoop *L = (const BroadcastLoop*) arg;
+  const long ka = start * L->xi;
+  const long kb = start * L->yi;
+  L->sfn(end - start,
+         L->ar + ka, OFFSET(L->ai, ka), L->xi,
+         L->br + kb, OFFSET(L->bi, kb), L->yi,
+         L->cr + start, L->ci + start);
+}
+
+/* broadcast_split_cols(): compute a range of result columns of a
+ * broadcasting operation over split operands.
+ */
+static void broadcast_split_cols (void *arg, int id, long start, long end) {
+  const BroadcastLoop *L = (const BroadcastLoop*) arg;
+  for (long j = start; j < end; j++) {
+    const long ka = j * L->xj;
+    const long kb = j * L->yj;
+    L->sfn(L->m,
+           L->ar + ka, OFFSET(L->ai, ka), L->xi,
+           L->br + kb, OFFSET(L->bi, kb), L->yi,
+           L->cr + j * L->m, L->ci + j * L->m);
+  }
+}
+
+/* BROADCAST_SIZE(): macro to get the element size of an operand or
+ * result of a broadcasting operation.
+ */
+#define BROADCAST_SIZE(cplx,sngl,intg) \
+  ((cplx) ? sizeof(complex double) : (sngl) ? sizeof(float) : \
+   (intg) == 32 ? sizeof(int32_t) : (intg) == 64 ? sizeof(int64_t) : \
+   sizeof(double))
+
+/* BROADCAST_SIZE_LOGICAL: element size of logical results of
+ * broadcasting operations.
+ */
+#define BROADCAST_SIZE_LOGICAL sizeof(unsigned char)
+
+/* broadcast_apply(): compute an element-wise operation over two operands
+ * with implicit expansion of their singleton dimensions. the result is
+ * computed in a single pass over its elements in column-major order,
+ * split into contiguous ranges across the thread pool.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @name: name of the operation, for error messages.
+ *  @kernels: kernels of the operation, indexed by operand complexity.
+ *  @fkernels: kernels of the operation over single-precision operands,
+ *             indexed by operand precision.
+ *  @ikernels: kernels of the operation over integer operands, indexed
+ *             by operand width, or null.
+ *  @skernels: kernels of the operation over split operands, or null.
+ *  @cplx: whether complex, single-precision and integer operands produce
+ *         complex, single-precision and integer results. otherwise, the
+ *         operation is a comparison that produces logical results.
+ *
+ * returns:
+ *  result of the operation, or null on failure. operations between two
+ *  scalars, or with an operand that is not numeric, are failures.
+ */
+static Object broadcast_apply (Zone z, Object a, Object b, const char *name,
+                               const broadcast_kernel *kernels,
+                               const broadcast_kernel *fkernels,
+                               const broadcast_kernel *ikernels,
+                               const broadcast_split_kernel *skernels,
+                               int cplx) {
+  /* compute in split storage when no complex array operand is held in
+   * interleaved storage, and at least one is split, or when a real array
+   * is combined with a complex scalar. otherwise, convert any split
+   * operands to interleaved storage.
+   */
+  const int la = broadcast_layout(a);
+  const int lb = broadcast_layout(b);
+
+  /* logical operands are widened to double precision first. complex
+   * arrays are only held in double precision, so single operands of
+   * complex operations are also widened.
+   */
+  const int ws = ((broadcast_is_single(a) || broadcast_is_single(b)) &&
+                  (la >= 0 || lb >= 0 || IS_COMPLEX(a) || IS_COMPLEX(b)));
+
+  /* integer arrays combine with integer arrays of the same width and with
+   * integer scalars. combined with any other operand, they are promoted
+   * to double precision, and real results are converted back to the
+   * integer type of the array operand.
+   */
+  const int ia = broadcast_int_width(a);
+  const int ib = broadcast_int_width(b);
+  const int zi = (ia == ib || (ia && IS_INT(b)) || (ib && IS_INT(a)) ?
+                  (ia ? ia : ib) : 0);
+  const int wi = ((ia || ib) && (!zi || !ikernels));
+  const int ni = (wi && cplx && (!ia || !ib || ia == ib) ?
+                  (ia ? ia : ib) : 0);
+
+  if (ws || wi || IS_LOGICAL(a) || IS_LOGICAL(b) ||
+      broadcast_is_range(a) || broadcast_is_range(b)) {
+    Object wa = broadcast_widen(z, a, ws, wi);
+    Object wb = broadcast_widen(z, b, ws, wi);
+    Object c = (wa && wb ? broadcast_apply(z, wa, wb, name, kernels,
+                                           fkernels, ikernels, skernels,
+                                           cplx) : NULL);
+
+    if (wa && wa != a) object_free(z, wa);
+    if (wb && wb != b) object_free(z, wb);
+
+    /* round and saturate real results of integer array operations. */
+    if (c && ni && !IS_COMPLEX_VECTOR(c) && !IS_COMPLEX_MATRIX(c)) {
+      Object ci = (ni == 32 ?
+        (Object) int32_array_new_from_object(z, c) :
+        (Object) int64_array_new_from_object(z, c));
+
+      object_free(z, c);
+      c = ci;
+    }
+
+    return c;
+  }
+
+  const int split = (skernels && la && lb &&
+                     (la > 0 || lb > 0 ||
+                      (IS_COMPLEX(a) && (IS_VECTOR(b) || IS_MATRIX(b))) ||
+                      (IS_COMPLEX(b) && (IS_VECTOR(a) || IS_MATRIX(a)))));
+  if (!split && (!broadcast_interleave(a) || !broadcast_interleave(b)))
+    return NULL;
+
+  /* describe the operands. */
+  BroadcastArg x, y;
+  const int ra = broadcast_arg(a, &x);
+  const int rb = broadcast_arg(b, &y);
+  if (!ra || !rb)
+    return NULL;
+
+  /* reject operands that are not numeric, and leave operations between
+   * scalars to the scalar types.
+   */
+  if (ra < 0 || rb < 0 || (x.scal && y.scal))
+    fail(ERR_OBJ_BINARY, name, MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+
+  /* convert integer scalars to the element type of integer arrays. */
+  if (zi && x.scal) broadcast_int_scalar(&x, zi);
+  if (zi && y.scal) broadcast_int_scalar(&y, zi);
+
+  /* check that the operand dimensions conform. */
+  if ((x.m != y.m && x.m != 1 && y.m != 1) ||
+      (x.n != y.n && x.n != 1 && y.n != 1))
+    throw(z, ERR_SIZE_MISMATCH_BC(&x, &y));
+
+  /* determine the result size and type. */
+  const long m = (x.m == 1 ? y.m : x.m);
+  const long n = (x.n == 1 ? y.n : x.n);
+  const int zc = (cplx && (x.cplx || y.cplx));
+  const int zs = (cplx && (x.sngl || y.sngl));
+  const int zw = (cplx ? zi : 0);
+
+  /* allocate the result. */
+  void *data;
+  Object c = broadcast_alloc(z, &x, &y, m, n, zc, zs, zw, !cplx, split,
+                             &data);
+  if (!c)
+    return NULL;
+
+  /* select the kernel and element sizes. */
+  BroadcastLoop L;
+  L.fn = (zi ? ikernels[zi == 64] :
+          x.sngl || y.sngl ? fkernels[2 * x.sngl + y.sngl] :
+          kernels[2 * x.cplx + y.cplx]);
+  L.pa = (const char*) x.data;
+  L.pb = (const char*) y.data;
+  L.pc = (char*) data;
+  L.sza = BROADCAST_SIZE(x.cplx, x.sngl, x.intg);
+  L.szb = BROADCAST_SIZE(y.cplx, y.sngl, y.intg);
+  L.szc = (cplx ? BROADCAST_SIZE(zc, zs, zw) : BROADCAST_SIZE_LOGICAL);
+  L.m = m;
+
+  /* select the split kernel and the parts of the split operands. */
+  if (split) {
+    L.sfn = skernels[2 * x.cplx + y.cplx];
+    broadcast_parts(&x, &L.ar, &L.ai);
+    broadcast_parts(&y, &L.br, &L.bi);
+    L.cr = SPLIT_RE(data);
+    L.ci = SPLIT_IM(data, m * n);
+  }
+
+  /* determine whether the operands are either full-sized or single
+   * elements, in which case the result is computed in one flat loop.
+   */
+  const int xfull = (x.m == m && x.n == n);
+  const int yfull = (y.m == m && y.n == n);
+  if ((xfull || x.m * x.n == 1) && (yfull || y.m * y.n == 1)) {
+    L.xi = xfull;
+    L.yi = yfull;
+    threads_run(m * n, 1, split ? broadcast_split_flat : broadcast_flat, &L);
+    return c;
+  }
+
+  /* compute the row and column increments of each operand. */
+  L.xi = (x.m == 1 ? 0 : 1);
+  L.xj = (x.n == 1 ? 0 : x.m);
+  L.yi = (y.m == 1 ? 0 : 1);
+  L.yj = (y.n == 1 ? 0 : y.m);
+
+  /* compute the result one column at a time. */
+  threads_run(n, m, split ? broadcast_split_cols : broadcast_cols, &L);
+
+  /* return the result. */
+  return c;
+}
+
+/* saturating arithmetic over 32-bit integers, computed exactly in
+ * 64 bits and clamped.
+ */
+#define B 32
+#define T int32_t
+#define W int64_t
+#define TMIN INT32_MIN
+#define TMAX INT32_MAX
+#include "broadcast-int.c"
+
+/* saturating arithmetic over 64-bit integers. */
+#define B 64
+#define T int64_t
+#define TMIN INT64_MIN
+#define TMAX INT64_MAX
+#include "broadcast-int.c"
+
+/* IOPNAME(): macro to name the saturating kernel of an operation over
+ * integers of a given width.
+ */
+#define IOPCAT(b,name)  broadcast_sat ## b ## _ ## name
+#define IOPNAME(b,name) IOPCAT(b, name)
+
+/* broadcast_plus(): broadcasting addition. */
+#define F plus
+#define IOP(b,x,y) IOPNAME(b, plus)(x, y)
+#define ROP(x,y) ((x) + (y))
+#define COP(x,y) ((x) + (y))
+#define SDZ(x,yr,yi,cr,ci)       { cr = (x) + (yr);  ci = (yi); }
+#define SZD(xr,xi,y,cr,ci)       { cr = (xr) + (y);  ci = (xi); }
+#define SZZ(xr,xi,yr,yi,cr,ci)   { cr = (xr) + (yr); ci = (xi) + (yi); }
+#include "broadcast-op.c"
+
+/* broadcast_minus(): broadcasting subtraction. */
+#define F minus
+#define IOP(b,x,y) IOPNAME(b, minus)(x, y)
+#define ROP(x,y) ((x) - (y))
+#define COP(x,y) ((x) - (y))
+#define SDZ(x,yr,yi,cr,ci)       { cr = (x) - (yr);  ci = -(yi); }
+#define SZD(xr,xi,y,cr,ci)       { cr = (xr) - (y);  ci = (xi); }
+#define SZZ(xr,xi,yr,yi,cr,ci)   { cr = (xr) - (yr); ci = (xi) - (yi); }
+#include "broadcast-op.c"
+
+/* broadcast_times(): broadcasting element-wise multiplication. */
+#define F times
+#define IOP(b,x,y) IOPNAME(b, times)(x, y)
+#define ROP(x,y) ((x) * (y))
+#define COP(x,y) ((x) * (y))
+#define SDZ(x,yr,yi,cr,ci)       { cr = (x) * (yr);  ci = (x) * (yi); }
+#define SZD(xr,xi,y,cr,ci)       { cr = (xr) * (y);  ci = (xi) * (y); }
+#define SZZ(xr,xi,yr,yi,cr,ci) \
+  { cr = (xr) * (yr) - (xi) * (yi); ci = (xr) * (yi) + (xi) * (yr); }
+#include "broadcast-op.c"
+
+/* broadcast_rdivide(): broadcasting element-wise right division. */
+#define F rdivide
+#define IOP(b,x,y) IOPNAME(b, rdivide)(x, y)
+#define ROP(x,y) ((x) / (y))
+#define COP(x,y) ((x) / (y))
+#include "broadcast-op.c"
+
+/* broadcast_ldivide(): broadcasting element-wise left division. */
+#define F ldivide
+#define IOP(b,x,y) IOPNAME(b, ldivide)(x, y)
+#define ROP(x,y) ((y) / (x))
+#define COP(x,y) ((y) / (x))
+#include "broadcast-op.c"
+
+/* broadcast_power(): broadcasting element-wise exponentiation. */
+#define F power
+#define IOP(b,x,y) IOPNAME(b, power)(x, y)
+#define ROP(x,y) pow(x, y)
+#define COP(x,y) cpow(x, y)
+#define FOP(x,y) powf(x, y)
+#include "broadcast-op.c"
+
+/* broadcast_lt(): broadcasting less-than comparison. */
+#define F lt
+#define SOP SIMD_LT
+#define CMP(x,y) ((x) < (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_gt(): broadcasting greater-than comparison. */
+#define F gt
+#define SOP SIMD_GT
+#define CMP(x,y) ((x) > (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_le(): broadcasting less-than or equal-to comparison. */
+#define F le
+#define SOP SIMD_LE
+#define CMP(x,y) ((x) <= (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_ge(): broadcasting greater-than or equal-to comparison. */
+#define F ge
+#define SOP SIMD_GE
+#define CMP(x,y) ((x) >= (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_ne(): broadcasting inequality comparison. */
+#define CMPEQ
+#define F ne
+#define SOP SIMD_NE
+#define CMP(x,y) ((x) != (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_eq(): broadcasting equality comparison. */
+#define CMPEQ
+#define F eq
+#define SOP SIMD_EQ
+#define CMP(x,y) ((x) == (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_and(): broadcasting element-wise logical-and. */
+#define F and
+#define SOP SIMD_AND
+#define CMP(x,y) ((x) && (y))
+#include "broadcast-cmp.c"
+
+/* broadcast_or(): broadcasting element-wise logical-or. */
+#define F or
+#define SOP SIMD_OR
+#define CMP(x,y) ((x) || (y))
+#include "broadcast-cmp.c"
+
@@ -0,0 +1,178 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the buffer header. */
+#include <matte/buffer.h>
+
+/* buffer_refs(): get the number of holders of a buffer.
+ *
+ * arguments:
+ *  @buf: pointer to the buffer header.
+ *
+ * returns:
+ *  current reference count of the buffer.
+ */
+static inline long buffer_refs (Buffer buf) {
+  return __atomic_load_n(&buf->refs, __ATOMIC_ACQUIRE);
+}
+
+/* buffer_alloc(): allocate a new unshared buffer with enough space to
+ * hold a set number of elements.
+ *
+ * arguments:
+ *  @n: number of elements to allocate.
+ *  @sz: number of bytes per element.
+ *
+ * returns:
+ *  pointer to the first (uninitialized) element of the new buffer,
+ *  or null on failure.
+ */
+static void *buffer_alloc (long n, size_t sz) {
+  /* allocate the header and elements in a single chunk. */
+  Buffer buf = (Buffer) malloc(BUFFER_HEADER + n * sz);
+  if (!buf)
+    return NULL;
+
+  /* the new buffer is held only by its caller. */
+  buf->refs = 1;
+  return BUFFER_DATA(buf);
+}
+
+/* buffer_resize(): change the number of elements held by a buffer on
+ * behalf of one of its holders. unshared buffers are reallocated, and
+ * shared buffers are left intact for their other holders while the
+ * caller receives a private copy of the retained elements. any new
+ * trailing elements are zeroed.
+ *
+ * arguments:
+ *  @data: pointer to the first element of the buffer, or null.
+ *  @n: current number of elements in the buffer.
+ *  @nnew: new number of elements in the buffer.
+ *  @sz: number of bytes per element.
+ *
+ * returns:
+ *  pointer to the first element of the resized buffer. null is returned
+ *  for zero-length buffers, and on failure, in which case the original
+ *  buffer is left intact.
+ */
+void *buffer_resize (void *data, long n, long nnew, size_t sz) {
+  /* empty buffers are represented by null pointers. */
+  if (nnew <= 0) {
+    buffer_release(data);
+    return NULL;
+  }
+
+  /* determine the number of elements to retain. */
+  if (!data) n = 0;
+  const long nkeep = (n < nnew ? n : nnew);
+
+  void *dnew;
+  if (data && buffer_refs(BUFFER(data)) == 1) {
+    /* unshared: reallocate the buffer in place. */
+    Buffer buf = (Buffer) realloc(BUFFER(data), BUFFER_HEADER + nnew * sz);
+    if (!buf)
+      return NULL;
+
+    dnew = BUFFER_DATA(buf);
+  }
+  else {
+    /* shared or empty: allocate a private copy of the retained part. */
+    dnew = buffer_alloc(nnew, sz);
+    if (!dnew)
+      return NULL;
+
+    if (nkeep)
+      memcpy(dnew, data, nkeep * sz);
+
+    buffer_release(data);
+  }
+
+  /* fill the new trailing elements with zeros. */
+  if (nnew > nkeep)
+    memset(((char*) dnew) + nkeep * sz, 0, (nnew - nkeep) * sz);
+
+  /* return the resized buffer. */
+  return dnew;
+}
+
+/* buffer_share(): add a holder to a buffer.
+ *
+ * arguments:
+ *  @data: pointer to the first element of the buffer, or null.
+ *
+ * returns:
+ *  the input pointer, now held by one more object.
+ */
+void *buffer_share (void *data) {
+  /* increment the reference count of non-empty buffers. */
+  if (data)
+    __atomic_fetch_add(&BUFFER(data)->refs, 1, __ATOMIC_RELAXED);
+
+  return data;
+}
+
+/* buffer_unshare(): ensure that a buffer is held only by the caller,
+ * so that its elements may be modified. shared buffers are copied
+ * into a new private buffer, which replaces the caller's reference.
+ *
+ * arguments:
+ *  @data: pointer to the first element of the buffer, or null.
+ *  @n: number of elements in the buffer.
+ *  @sz: number of bytes per element.
+ *
+ * returns:
+ *  pointer to the first element of an unshared buffer holding the same
+ *  contents, or null on failure, in which case the original buffer is
+ *  left intact.
+ */
+void *buffer_unshare (void *data, long n, size_t sz) {
+  /* empty and unshared buffers may be modified in place. */
+  if (!data || buffer_refs(BUFFER(data)) == 1)
+    return data;
+
+  /* allocate and fill a private copy of the elements. */
+  void *dnew = buffer_alloc(n, sz);
+  if (!dnew)
+    return NULL;
+
+  memcpy(dnew, data, n * sz);
+
+  /* drop the caller's reference to the shared buffer, which may have
+   * lost its other holders in the meantime.
+   */
+  buffer_release(data);
+  return dnew;
+}
+
+/* buffer_release(): remove a holder from a buffer, freeing the buffer
+ * once it is no longer held by any object.
+ *
+ * arguments:
+ *  @data: pointer to the first element of the buffer, or null.
+ */
+void buffer_release (void *data) {
+  /* return if the buffer is empty. */
+  if (!data)
+    return;
+
+  /* decrement the reference count and free unheld buffers. */
+  Buffer buf = BUFFER(data);
+  if (__atomic_sub_fetch(&buf->refs, 1, __ATOMIC_ACQ_REL) == 0)
+    free(buf);
+}
+
+/* buffer_is_shared(): check whether a buffer has multiple holders.
+ *
+ * arguments:
+ *  @data: pointer to the first element of the buffer, or null.
+ *
+ * returns:
+ *  integer indicating whether the buffer is shared (1) or not (0).
+ */
+int buffer_is_shared (void *data) {
+  /* return the sharing status. */
+  return (data && buffer_refs(BUFFER(data)) > 1);
+}
+
@@ -3,8 +3,10 @@
  * Released under the MIT License
  */
 
-/* include the matte header. */
+/* include the matte, threads and simd headers. */
 #include <matte/matte.h>
+#include <matte/threads.h>
+#include <matte/simd.h>
 
 /* matte_builtins_init(): initialize built-in symbols with the global
  * compiler symbol table.
@@ -28,11 +30,18 @@ int matte_builtins_init (Symbols gs) {
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Int");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Range");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Float");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "FloatRange");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Complex");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Vector");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Matrix");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "ComplexVector");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "ComplexMatrix");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "SingleVector");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "SingleMatrix");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Logical");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Int32Array");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Int64Array");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "SparseMatrix");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "String");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Struct");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_CLASS, "Cell");
@@ -46,6 +55,23 @@ int matte_builtins_init (Symbols gs) {
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "sum");
   ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "prod");
 
+  /* register global functions: precision. */
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "single");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "double");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "int32");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "int64");
+
+  /* register global functions: logical. */
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "any");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "all");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "nnz");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "find");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "logical");
+
+  /* register global functions: sparse. */
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "sparse");
+  ret = ret && symbols_add(gs, SYMBOL_GLOBAL_FUNC, "full");
+
   /* return the result. */
   return ret;
 }
@@ -183,4 +209,7 @@ int string_append_objs (String s, char *format, int begin, ObjectList lst) {
 
 #include "builtins/io.c"
 #include "builtins/sums.c"
+#include "builtins/precision.c"
+#include "builtins/masks.c"
+#include "builtins/sparse.c"
 
@@ -12,7 +12,7 @@ Object matte_disp (Zone z, Object argin) {
   if (type->fn_disp)
     type->fn_disp(z, x);
 
-  return object_list_argout(z, 0);
+  return object_list_argout(z, z, 0);
 }
 
 Object matte_sprintf (Zone z, Object argin) {
@@ -28,6 +28,6 @@ Object matte_sprintf (Zone z, Object argin) {
   else
     throw(z, ERR_INVALID_ARGIN);
 
-  return object_list_argout(z, 1, (Object) str);
+  return object_list_argout(z, z, 1, (Object) str);
 }
 
@@ -0,0 +1,199 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* MasksOp: enumeration of the logical builtins. */
+typedef enum {
+  MASKS_ANY = 0,
+  MASKS_ALL,
+  MASKS_NNZ,
+  MASKS_FIND,
+  MASKS_LOGICAL
+}
+MasksOp;
+
+/* masks_names: names of the logical builtins. */
+static const char *masks_names[] = {
+  "any", "all", "nnz", "find", "logical"
+};
+
+/* masks_get(): get the logical mask of the nonzero elements of an array.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @x: array to access.
+ *
+ * returns:
+ *  logical array, which shares the data of @x if it is already a logical
+ *  array, or null if @x is not an array.
+ */
+static Logical masks_get (Zone z, Object x) {
+  if (IS_LOGICAL(x))
+    return logical_copy(z, (Logical) x);
+
+  /* expand ranges before comparing their elements. */
+  if (IS_RANGE(x) || IS_FLOAT_RANGE(x)) {
+    Vector v = (IS_RANGE(x) ?
+                vector_new_from_range(z, (Range) x) :
+                vector_new_from_float_range(z, (FloatRange) x));
+    if (!v)
+      return NULL;
+
+    Logical L = masks_get(z, (Object) v);
+    object_free(z, v);
+    return L;
+  }
+
+  /* expand sparse matrices into full matrices. */
+  if (IS_SPARSE_MATRIX(x)) {
+    Matrix A = sparse_matrix_to_matrix(z, (SparseMatrix) x);
+    if (!A)
+      return NULL;
+
+    Logical L = masks_get(z, (Object) A);
+    object_free(z, A);
+    return L;
+  }
+
+  if (!IS_VECTOR(x) && !IS_MATRIX(x) &&
+      !IS_COMPLEX_VECTOR(x) && !IS_COMPLEX_MATRIX(x) &&
+      !IS_SINGLE_VECTOR(x) && !IS_SINGLE_MATRIX(x) &&
+      !IS_INT32_ARRAY(x) && !IS_INT64_ARRAY(x))
+    return NULL;
+
+  Int zero = int_new_with_value(z, 0L);
+  if (!zero)
+    return NULL;
+
+  Object L = object_ne(z, x, (Object) zero);
+  object_free(z, zero);
+  return (Logical) L;
+}
+
+/* masks_scalar(): get the truth value of a scalar.
+ *
+ * arguments:
+ *  @x: scalar to access.
+ *  @t: truth value of the scalar, on return.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) @x is a scalar.
+ */
+static int masks_scalar (Object x, long *t) {
+  if (IS_INT(x))
+    *t = (int_get_value((Int) x) != 0);
+  else if (IS_FLOAT(x))
+    *t = (float_get_value((Float) x) != 0.0);
+  else if (IS_COMPLEX(x))
+    *t = (complex_get_abs((Complex) x) != 0.0);
+  else
+    return 0;
+
+  return 1;
+}
+
+/* masks_apply(): compute a logical reduction or conversion of an object.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @x: object to access.
+ *  @op: builtin to compute.
+ *
+ * returns:
+ *  result of the builtin, or null on failure.
+ */
+static Object masks_apply (Zone z, Object x, MasksOp op) {
+  /* scalars are reduced to their truth values. */
+  long t;
+  if (masks_scalar(x, &t)) {
+    if (op == MASKS_FIND && !t)
+      return (Object) vector_new_with_length(z, 0);
+    else if (op == MASKS_FIND)
+      return (Object) float_new_with_value(z, 1.0);
+
+    return (Object) int_new_with_value(z, t);
+  }
+
+  /* count the stored elements of sparse matrices. */
+  if (op == MASKS_NNZ && IS_SPARSE_MATRIX(x)) {
+    const long nnz = sparse_matrix_get_nnz((SparseMatrix) x);
+    return (Object) int_new_with_value(z, nnz);
+  }
+
+  /* convert arrays into logical masks. */
+  Logical L = masks_get(z, x);
+  if (!L)
+    fail(ERR_OBJ_UNARY, masks_names[op], MATTE_TYPE(x)->name);
+
+  Object y;
+  if (op == MASKS_LOGICAL) {
+    /* logical(): return the mask. */
+    return (Object) L;
+  }
+  else if (op == MASKS_NNZ) {
+    /* nnz(): count the true elements. */
+    y = (Object) int_new_with_value(z, logical_nnz(L));
+  }
+  else if (op == MASKS_FIND) {
+    /* find(): locate the true elements. */
+    y = logical_find(z, L);
+  }
+  else if (L->mat) {
+    /* any(), all(): reduce matrices along their columns. */
+    y = (Object) logical_reduce(z, L, op == MASKS_ALL);
+  }
+  else {
+    /* any(), all(): reduce vectors along their length. */
+    y = (Object) int_new_with_value(z,
+      op == MASKS_ALL ? logical_all(L) : logical_any(L));
+  }
+
+  object_free(z, L);
+  return y;
+}
+
+/* masks_main(): parse the arguments of a logical builtin and compute
+ * its result.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @argin: argument list of the builtin.
+ *  @op: builtin to compute.
+ *
+ * returns:
+ *  argument list holding the result.
+ */
+static Object masks_main (Zone z, Object argin, MasksOp op) {
+  const int nargin = object_list_get_length((ObjectList) argin);
+  if (nargin != 1)
+    throw(z, ERR_INVALID_ARGIN);
+
+  Object x = object_list_get((ObjectList) argin, 0);
+  Object y = masks_apply(z, x, op);
+  if (!y)
+    return exceptions_get(z);
+
+  return object_list_argout(z, z, 1, y);
+}
+
+Object matte_any (Zone z, Object argin) {
+  return masks_main(z, argin, MASKS_ANY);
+}
+
+Object matte_all (Zone z, Object argin) {
+  return masks_main(z, argin, MASKS_ALL);
+}
+
+Object matte_nnz (Zone z, Object argin) {
+  return masks_main(z, argin, MASKS_NNZ);
+}
+
+Object matte_find (Zone z, Object argin) {
+  return masks_main(z, argin, MASKS_FIND);
+}
+
+Object matte_logical (Zone z, Object argin) {
+  return masks_main(z, argin, MASKS_LOGICAL);
+}
+
@@ -0,0 +1,158 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* PrecisionOp: enumeration of the precision builtins. */
+typedef enum {
+  PRECISION_DOUBLE = 0,
+  PRECISION_SINGLE,
+  PRECISION_INT32,
+  PRECISION_INT64
+}
+PrecisionOp;
+
+/* precision_double(): convert an object to double precision.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @x: object to convert.
+ *
+ * returns:
+ *  converted object, or null on failure.
+ */
+static Object precision_double (Zone z, Object x) {
+  if (IS_SINGLE_VECTOR(x)) {
+    return (Object) single_vector_to_double(z, (SingleVector) x);
+  }
+  else if (IS_SINGLE_MATRIX(x)) {
+    return (Object) single_matrix_to_double(z, (SingleMatrix) x);
+  }
+  else if (IS_LOGICAL(x)) {
+    return logical_to_double(z, (Logical) x);
+  }
+  else if (IS_INT32_ARRAY(x)) {
+    return int32_array_to_double(z, (Int32Array) x);
+  }
+  else if (IS_INT64_ARRAY(x)) {
+    return int64_array_to_double(z, (Int64Array) x);
+  }
+  else if (IS_INT(x)) {
+    return (Object) float_new_with_value(z, (double) int_get_value((Int) x));
+  }
+  else if (IS_FLOAT(x) || IS_RANGE(x) || IS_FLOAT_RANGE(x) ||
+           IS_COMPLEX(x) || IS_VECTOR(x) || IS_MATRIX(x) ||
+           IS_COMPLEX_VECTOR(x) || IS_COMPLEX_MATRIX(x) ||
+           IS_SPARSE_MATRIX(x)) {
+    /* all other numeric types are held in double precision. */
+    return object_copy(z, x);
+  }
+
+  fail(ERR_OBJ_UNARY, "double", MATTE_TYPE(x)->name);
+}
+
+/* precision_single(): convert an object to single precision. arrays are
+ * rounded into single vectors and matrices, and real scalars are rounded
+ * but remain held by the scalar types.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @x: object to convert.
+ *
+ * returns:
+ *  converted object, or null on failure.
+ */
+static Object precision_single (Zone z, Object x) {
+  if (IS_SINGLE_VECTOR(x) || IS_SINGLE_MATRIX(x)) {
+    /* single arrays are shared with the result. */
+    return object_copy(z, x);
+  }
+  else if (IS_VECTOR(x)) {
+    return (Object) single_vector_new_from_vector(z, (Vector) x);
+  }
+  else if (IS_MATRIX(x)) {
+    return (Object) single_matrix_new_from_matrix(z, (Matrix) x);
+  }
+  else if (IS_LOGICAL(x) || IS_INT32_ARRAY(x) || IS_INT64_ARRAY(x)) {
+    /* widen logical and integer arrays before rounding their elements. */
+    Object w = precision_double(z, x);
+    if (!w)
+      return NULL;
+
+    Object xs = precision_single(z, w);
+    object_free(z, w);
+    return xs;
+  }
+  else if (IS_RANGE(x) || IS_FLOAT_RANGE(x)) {
+    /* expand ranges before rounding their elements. */
+    Vector v = (IS_RANGE(x) ?
+                vector_new_from_range(z, (Range) x) :
+                vector_new_from_float_range(z, (FloatRange) x));
+    if (!v)
+      return NULL;
+
+    SingleVector xs = single_vector_new_from_vector(z, v);
+    object_free(z, v);
+    return (Object) xs;
+  }
+  else if (IS_FLOAT(x)) {
+    const float f = (float) float_get_value((Float) x);
+    return (Object) float_new_with_value(z, f);
+  }
+  else if (IS_INT(x)) {
+    const float f = (float) int_get_value((Int) x);
+    return (Object) float_new_with_value(z, f);
+  }
+
+  fail(ERR_OBJ_UNARY, "single", MATTE_TYPE(x)->name);
+}
+
+/* precision_main(): parse the arguments of a precision builtin and
+ * compute the requested conversion.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @argin: argument list of the builtin.
+ *  @op: builtin to compute.
+ *
+ * returns:
+ *  argument list holding the result.
+ */
+static Object precision_main (Zone z, Object argin, PrecisionOp op) {
+  const int nargin = object_list_get_length((ObjectList) argin);
+  if (nargin != 1)
+    throw(z, ERR_INVALID_ARGIN);
+
+  Object x = object_list_get((ObjectList) argin, 0);
+  Object y;
+  if (op == PRECISION_SINGLE)
+    y = precision_single(z, x);
+  else if (op == PRECISION_INT32)
+    y = (Object) int32_array_new_from_object(z, x);
+  else if (op == PRECISION_INT64)
+    y = (Object) int64_array_new_from_object(z, x);
+  else
+    y = precision_double(z, x);
+
+  if (!y)
+    return exceptions_get(z);
+
+  return object_list_argout(z, z, 1, y);
+}
+
+Object matte_single (Zone z, Object argin) {
+  return precision_main(z, argin, PRECISION_SINGLE);
+}
+
+Object matte_double (Zone z, Object argin) {
+  return precision_main(z, argin, PRECISION_DOUBLE);
+}
+
+Object matte_int32 (Zone z, Object argin) {
+  return precision_main(z, argin, PRECISION_INT32);
+}
+
+Object matte_int64 (Zone z, Object argin) {
+  return precision_main(z, argin, PRECISION_INT64);
+}
+
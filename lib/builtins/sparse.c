@@ -0,0 +1,323 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* sparse_elements(): get a copy of the elements of a real array or
+ * scalar in double precision.
+ *
+ * arguments:
+ *  @z: zone allocator for temporaries.
+ *  @x: object to access.
+ *  @len: number of elements, on return.
+ *
+ * returns:
+ *  newly allocated array of elements, which must be freed, or null on
+ *  failure.
+ */
+static double *sparse_elements (Zone z, Object x, long *len) {
+  /* convert the object to a double precision scalar or array. */
+  Object w;
+  if (IS_RANGE(x))
+    w = (Object) vector_new_from_range(z, (Range) x);
+  else if (IS_FLOAT_RANGE(x))
+    w = (Object) vector_new_from_float_range(z, (FloatRange) x);
+  else
+    w = precision_double(z, x);
+
+  if (!w)
+    return NULL;
+
+  /* locate the elements of the converted object. */
+  double f = 0.0;
+  const double *src = NULL;
+  if (IS_FLOAT(w)) {
+    f = float_get_value((Float) w);
+    src = &f;
+    *len = 1;
+  }
+  else if (IS_VECTOR(w)) {
+    src = ((Vector) w)->data;
+    *len = ((Vector) w)->n;
+  }
+  else if (IS_MATRIX(w) && matrix_untranspose((Matrix) w)) {
+    src = ((Matrix) w)->data;
+    *len = ((Matrix) w)->m * ((Matrix) w)->n;
+  }
+
+  if (!src) {
+    object_free(z, w);
+    fail(ERR_OBJ_UNARY, "sparse", MATTE_TYPE(x)->name);
+  }
+
+  /* copy the elements. */
+  double *v = (double*) malloc((*len > 0 ? *len : 1) * sizeof(double));
+  if (v) {
+    for (long k = 0; k < *len; k++)
+      v[k] = src[k];
+  }
+
+  object_free(z, w);
+  if (!v)
+    fail(ERR_BAD_ALLOC);
+
+  return v;
+}
+
+/* sparse_indices(): convert the one-based subscripts of a sparse matrix
+ * into zero-based indices.
+ *
+ * arguments:
+ *  @v: subscripts to convert.
+ *  @len: number of subscripts.
+ *  @idx: converted indices, on return.
+ *  @max: largest one-based subscript, on return.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int sparse_indices (const double *v, long len, long *idx,
+                           long *max) {
+  *max = 0;
+  for (long k = 0; k < len; k++) {
+    if (!(v[k] >= 1.0) || v[k] != floor(v[k]))
+      fail(ERR_INDEX_INVALID);
+
+    idx[k] = (long) v[k] - 1;
+    if (idx[k] + 1 > *max)
+      *max = idx[k] + 1;
+  }
+
+  return 1;
+}
+
+/* sparse_size(): get a nonnegative integer size argument.
+ *
+ * arguments:
+ *  @x: object to access.
+ *  @sz: size value, on return.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int sparse_size (Object x, long *sz) {
+  if (IS_INT(x)) {
+    *sz = int_get_value((Int) x);
+  }
+  else if (IS_FLOAT(x)) {
+    const double f = float_get_value((Float) x);
+    if (f != floor(f))
+      fail(ERR_INVALID_ARGIN);
+
+    *sz = (long) f;
+  }
+  else
+    fail(ERR_INVALID_ARGIN);
+
+  if (*sz < 0)
+    fail(ERR_INVALID_ARGIN);
+
+  return 1;
+}
+
+/* sparse_triplets(): construct a sparse matrix from arrays of subscripts
+ * and values. scalar arguments are expanded to the common length of the
+ * other arguments.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @nargin: number of arguments.
+ *  @args: argument array.
+ *
+ * returns:
+ *  newly allocated sparse matrix, or null on failure.
+ */
+static SparseMatrix sparse_triplets (Zone z, int nargin, Object *args) {
+  /* get the elements of the subscripts and values. */
+  double *v[3] = { NULL, NULL, NULL };
+  long len[3], nnz = 0;
+  for (int a = 0; a < 3; a++) {
+    v[a] = sparse_elements(z, args[a], &len[a]);
+    if (!v[a])
+      goto fail;
+
+    if (len[a] != 1)
+      nnz = len[a];
+  }
+
+  if (len[0] == 1 && len[1] == 1 && len[2] == 1)
+    nnz = 1;
+
+  /* expand scalars and check that the lengths agree. */
+  for (int a = 0; a < 3; a++) {
+    if (len[a] == nnz)
+      continue;
+
+    if (len[a] != 1) {
+      error(ERR_SIZE_MISMATCH);
+      goto fail;
+    }
+
+    double *w = (double*) realloc(v[a], (nnz > 0 ? nnz : 1) *
+                                        sizeof(double));
+    if (!w) {
+      error(ERR_BAD_ALLOC);
+      goto fail;
+    }
+
+    for (long k = 1; k < nnz; k++)
+      w[k] = w[0];
+
+    v[a] = w;
+  }
+
+  /* convert the subscripts into indices. */
+  long *idx = (long*) malloc((nnz > 0 ? 2 * nnz : 1) * sizeof(long));
+  if (!idx) {
+    error(ERR_BAD_ALLOC);
+    goto fail;
+  }
+
+  long m, n;
+  SparseMatrix S = NULL;
+  if (sparse_indices(v[0], nnz, idx, &m) &&
+      sparse_indices(v[1], nnz, idx + nnz, &n) &&
+      (nargin < 5 || (sparse_size(args[3], &m) &&
+                      sparse_size(args[4], &n))))
+    S = sparse_matrix_new_from_triplets(z, m, n, nnz, idx, idx + nnz, v[2]);
+
+  free(idx);
+  for (int a = 0; a < 3; a++)
+    free(v[a]);
+
+  return S;
+
+fail:
+  for (int a = 0; a < 3; a++)
+    free(v[a]);
+
+  return NULL;
+}
+
+/* sparse_compress(): construct a sparse matrix that holds the nonzero
+ * elements of a full array or scalar.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @x: object to compress.
+ *
+ * returns:
+ *  newly allocated sparse matrix, or null on failure.
+ */
+static SparseMatrix sparse_compress (Zone z, Object x) {
+  if (IS_SPARSE_MATRIX(x))
+    return sparse_matrix_copy(z, (SparseMatrix) x);
+
+  if (IS_MATRIX(x))
+    return sparse_matrix_new_from_matrix(z, (Matrix) x);
+
+  if (!IS_RANGE(x) && !IS_FLOAT_RANGE(x) && !IS_VECTOR(x) &&
+      !IS_INT(x) && !IS_FLOAT(x)) {
+    /* widen logical and integer arrays before compressing them. */
+    Object w = precision_double(z, x);
+    if (!w)
+      return NULL;
+
+    SparseMatrix S = NULL;
+    if (IS_MATRIX(w) || IS_VECTOR(w))
+      S = sparse_compress(z, w);
+    else
+      error(ERR_OBJ_UNARY, "sparse", MATTE_TYPE(x)->name);
+
+    object_free(z, w);
+    return S;
+  }
+
+  /* compress other arrays and scalars by their elements, which lie
+   * along a single row or column.
+   */
+  long len;
+  double *v = sparse_elements(z, x, &len);
+  if (!v)
+    return NULL;
+
+  long *idx = (long*) calloc(len > 0 ? 2 * len : 1, sizeof(long));
+  if (!idx) {
+    free(v);
+    fail(ERR_BAD_ALLOC);
+  }
+
+  for (long k = 0; k < len; k++)
+    idx[len + k] = k;
+
+  const int row = (IS_VECTOR(x) && ((Vector) x)->tr == CblasTrans) ||
+                  IS_RANGE(x) || IS_FLOAT_RANGE(x);
+
+  SparseMatrix S = (row ?
+    sparse_matrix_new_from_triplets(z, 1, len, len, idx, idx + len, v) :
+    sparse_matrix_new_from_triplets(z, len, 1, len, idx + len, idx, v));
+
+  free(idx);
+  free(v);
+  return S;
+}
+
+/* sparse_apply(): construct a sparse matrix from the arguments of the
+ * sparse builtin.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @argin: argument list of the builtin.
+ *
+ * returns:
+ *  newly allocated sparse matrix, or null on failure.
+ */
+static SparseMatrix sparse_apply (Zone z, Object argin) {
+  Object args[5];
+  const int nargin = object_list_get_length((ObjectList) argin);
+  if (nargin < 1 || nargin == 4 || nargin > 5)
+    fail(ERR_INVALID_ARGIN);
+
+  for (int a = 0; a < nargin; a++)
+    args[a] = object_list_get((ObjectList) argin, a);
+
+  if (nargin == 1) {
+    /* sparse(A): compress a full matrix. */
+    return sparse_compress(z, args[0]);
+  }
+  else if (nargin == 2) {
+    /* sparse(m,n): construct an all-zero matrix. */
+    long m, n;
+    if (!sparse_size(args[0], &m) || !sparse_size(args[1], &n))
+      return NULL;
+
+    return sparse_matrix_new_with_size(z, m, n, 0);
+  }
+
+  /* sparse(i,j,v) and sparse(i,j,v,m,n): construct from triplets. */
+  return sparse_triplets(z, nargin, args);
+}
+
+Object matte_sparse (Zone z, Object argin) {
+  SparseMatrix S = sparse_apply(z, argin);
+  if (!S)
+    return exceptions_get(z);
+
+  return object_list_argout(z, z, 1, S);
+}
+
+Object matte_full (Zone z, Object argin) {
+  const int nargin = object_list_get_length((ObjectList) argin);
+  if (nargin != 1)
+    throw(z, ERR_INVALID_ARGIN);
+
+  Object x = object_list_get((ObjectList) argin, 0);
+  Object y = (IS_SPARSE_MATRIX(x) ?
+              (Object) sparse_matrix_to_matrix(z, (SparseMatrix) x) :
+              object_copy(z, x));
+  if (!y)
+    return exceptions_get(z);
+
+  return object_list_argout(z, z, 1, y);
+}
+
@@ -3,103 +3,695 @@
  * Released under the MIT License
  */
 
-Object matte_sum (Zone z, Object argin) {
-  const int nargin = object_list_get_length((ObjectList) argin);
-  Object x = object_list_get((ObjectList) argin, 0);
-  Object dim = object_list_get((ObjectList) argin, 1);
+/* SUMS_TILE: number of rows of a matrix that are reduced together when
+ * summing or multiplying along its rows.
+ */
+#define SUMS_TILE 512
 
-  Object y = NULL;
+/* SUMS_BLOCK: number of columns of a row tile that are summed directly.
+ * wider tiles are summed pairwise, by halves.
+ */
+#define SUMS_BLOCK 16
 
-  if (nargin == 1) {
-    if (IS_INT(x))
-      y = (Object) int_copy(z, (Int) x);
-    else if (IS_FLOAT(x))
-      y = (Object) float_copy(z, (Float) x);
-    else if (IS_COMPLEX(x))
-      y = (Object) complex_copy(z, (Complex) x);
-    else if (IS_RANGE(x)) {
-      Range r = (Range) x;
-      long sum = 0;
+/* SumsLoop: structure for holding the operands and partial results of
+ * a sum or product that is split across the thread pool.
+ */
+typedef struct {
+  /* @x: input array of elements.
+   * @out: output array of dimensional reductions.
+   * @m, @n: physical rows and columns of the input matrix.
+   */
+  const void *x;
+  void *out;
+  long m, n;
 
-      for (long elem = r->begin; elem <= r->end; elem += r->step)
-        sum += elem;
+  /* @y, @cy: partial results of each chunk of full reductions. */
+  double y[THREADS_MAX];
+  complex double cy[THREADS_MAX];
+}
+SumsLoop;
 
-      y = (Object) int_new_with_value(z, sum);
-    }
-    else if (IS_VECTOR(x)) {
-      Vector v = (Vector) x;
-      double sum = 0.0;
+/* sums_dprod(): compute the product of a real array, using four
+ * independent accumulators.
+ */
+static inline double sums_dprod (long n, const double *x) {
+  double p0 = 1.0, p1 = 1.0, p2 = 1.0, p3 = 1.0;
+  long i = 0;
+
+  for (; i + 4 <= n; i += 4) {
+    p0 *= x[i];
+    p1 *= x[i + 1];
+    p2 *= x[i + 2];
+    p3 *= x[i + 3];
+  }
 
-      for (long i = 0; i < v->n; i++)
-        sum += v->data[i];
+  for (; i < n; i++)
+    p0 *= x[i];
 
-      y = (Object) float_new_with_value(z, sum);
-    }
-    else if (IS_COMPLEX_VECTOR(x)) {
-      ComplexVector cv = (ComplexVector) x;
-      complex double sum = 0.0;
+  return (p0 * p1) * (p2 * p3);
+}
 
-      for (long i = 0; i < cv->n; i++)
-        sum += cv->data[i];
+/* sums_zprod(): compute the product of a complex array, using two
+ * independent accumulators.
+ */
+static inline complex double sums_zprod (long n, const complex double *x) {
+  complex double p0 = 1.0, p1 = 1.0;
+  long i = 0;
+
+  for (; i + 2 <= n; i += 2) {
+    p0 *= x[i];
+    p1 *= x[i + 1];
+  }
+
+  if (i < n)
+    p0 *= x[i];
+
+  return p0 * p1;
+}
+
+/* sums_rows(): sum the columns of a tile of rows pairwise, by halves.
+ *
+ * arguments:
+ *  @x: first element of the tile.
+ *  @ld: leading dimension of the matrix holding the tile.
+ *  @m: number of rows in the tile, at most SUMS_TILE.
+ *  @n: number of columns in the tile.
+ *  @y: output array of row sums.
+ */
+static void sums_rows (const double *x, long ld, long m, long n,
+                       double *y) {
+  /* sum narrow tiles directly. */
+  if (n <= SUMS_BLOCK) {
+    for (long i = 0; i < m; i++)
+      y[i] = 0.0;
 
-      y = (Object) complex_new_with_value(z, sum);
+    for (long j = 0; j < n; j++) {
+      const double *xj = x + j * ld;
+      for (long i = 0; i < m; i++)
+        y[i] += xj[i];
     }
+
+    return;
   }
-  else if (nargin == 2) {
+
+  /* sum each half of wider tiles. */
+  double t[SUMS_TILE];
+  const long h = n / 2;
+  sums_rows(x, ld, m, h, y);
+  sums_rows(x + h * ld, ld, m, n - h, t);
+
+  for (long i = 0; i < m; i++)
+    y[i] += t[i];
+}
+
+/* sums_*(): partial sums and products over real and complex arrays. */
+static void sums_sum (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const double *x = (const double*) L->x;
+  double s[2];
+
+  simd_sum(end - start, x + start, s);
+  L->y[id] = s[0] + s[1];
+}
+
+static void sums_prod (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const double *x = (const double*) L->x;
+
+  L->y[id] = sums_dprod(end - start, x + start);
+}
+
+static void sums_csum (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const complex double *x = (const complex double*) L->x;
+  double s[2];
+
+  simd_sum(2 * (end - start), (const double*) (x + start), s);
+  L->cy[id] = s[0] + s[1] * I;
+}
+
+static void sums_cprod (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const complex double *x = (const complex double*) L->x;
+
+  L->cy[id] = sums_zprod(end - start, x + start);
+}
+
+/* sums_*_cols(): sums and products over each column of a matrix. */
+static void sums_sum_cols (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const double *x = (const double*) L->x;
+  double *y = (double*) L->out;
+  double s[2];
+
+  for (long j = start; j < end; j++) {
+    simd_sum(L->m, x + j * L->m, s);
+    y[j] = s[0] + s[1];
+  }
+}
+
+static void sums_prod_cols (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const double *x = (const double*) L->x;
+  double *y = (double*) L->out;
+
+  for (long j = start; j < end; j++)
+    y[j] = sums_dprod(L->m, x + j * L->m);
+}
+
+static void sums_csum_cols (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const complex double *x = (const complex double*) L->x;
+  complex double *y = (complex double*) L->out;
+  double s[2];
+
+  for (long j = start; j < end; j++) {
+    simd_sum(2 * L->m, (const double*) (x + j * L->m), s);
+    y[j] = s[0] + s[1] * I;
+  }
+}
+
+static void sums_cprod_cols (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const complex double *x = (const complex double*) L->x;
+  complex double *y = (complex double*) L->out;
+
+  for (long j = start; j < end; j++)
+    y[j] = sums_zprod(L->m, x + j * L->m);
+}
+
+/* sums_*_rows(): sums and products over each row of a matrix, computed
+ * over tiles of rows. complex sums are computed as real sums over twice
+ * as many rows.
+ */
+static void sums_sum_rows (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const double *x = (const double*) L->x;
+  double *y = (double*) L->out;
+
+  for (long t = start; t < end; t++) {
+    const long i = t * SUMS_TILE;
+    const long m = (L->m - i < SUMS_TILE ? L->m - i : SUMS_TILE);
+    sums_rows(x + i, L->m, m, L->n, y + i);
+  }
+}
+
+static void sums_prod_rows (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const double *x = (const double*) L->x;
+  double *y = (double*) L->out;
+
+  const long i0 = start * SUMS_TILE;
+  const long i1 = (end * SUMS_TILE < L->m ? end * SUMS_TILE : L->m);
+
+  for (long i = i0; i < i1; i++)
+    y[i] = 1.0;
+
+  for (long j = 0; j < L->n; j++) {
+    const double *xj = x + j * L->m;
+    for (long i = i0; i < i1; i++)
+      y[i] *= xj[i];
+  }
+}
+
+static void sums_cprod_rows (void *arg, int id, long start, long end) {
+  SumsLoop *L = (SumsLoop*) arg;
+  const complex double *x = (const complex double*) L->x;
+  complex double *y = (complex double*) L->out;
+
+  const long i0 = start * SUMS_TILE;
+  const long i1 = (end * SUMS_TILE < L->m ? end * SUMS_TILE : L->m);
+
+  for (long i = i0; i < i1; i++)
+    y[i] = 1.0;
+
+  for (long j = 0; j < L->n; j++) {
+    const complex double *xj = x + j * L->m;
+    for (long i = i0; i < i1; i++)
+      y[i] *= xj[i];
+  }
+}
+
+/* sums_reduce(): execute a reduction along one physical dimension of a
+ * matrix over the thread pool.
+ *
+ * arguments:
+ *  @L: loop structure holding the input and output arrays.
+ *  @dim: physical dimension to reduce along, one or two.
+ *  @fcols: loop function that reduces columns.
+ *  @frows: loop function that reduces tiles of rows.
+ */
+static void sums_reduce (SumsLoop *L, long dim,
+                         thread_fn fcols, thread_fn frows) {
+  if (dim == 1) {
+    threads_run(L->n, L->m, fcols, L);
+  }
+  else {
+    const long tiles = (L->m + SUMS_TILE - 1) / SUMS_TILE;
+    threads_run(tiles, SUMS_TILE * L->n, frows, L);
+  }
+}
+
+/* sums_vector(): compute the sum or product of all elements of a real
+ * array.
+ *
+ * arguments:
+ *  @n: number of array elements.
+ *  @x: array of elements.
+ *  @prod: whether to compute the product (1) or the sum (0).
+ *
+ * returns:
+ *  sum or product of the array elements.
+ */
+static double sums_vector (long n, const double *x, int prod) {
+  SumsLoop L;
+  L.x = x;
+
+  double y = (prod ? 1.0 : 0.0);
+  const int chunks = threads_run(n, 1, prod ? sums_prod : sums_sum, &L);
+  for (int k = 0; k < chunks && n; k++)
+    y = (prod ? y * L.y[k] : y + L.y[k]);
+
+  return y;
+}
+
+/* sums_complex_vector(): compute the sum or product of all elements of
+ * a complex array.
+ *
+ * arguments:
+ *  @n: number of array elements.
+ *  @x: array of elements.
+ *  @prod: whether to compute the product (1) or the sum (0).
+ *
+ * returns:
+ *  sum or product of the array elements.
+ */
+static complex double sums_complex_vector (long n, const complex double *x,
+                                           int prod) {
+  SumsLoop L;
+  L.x = x;
+
+  complex double y = (prod ? 1.0 : 0.0);
+  const int chunks = threads_run(n, 1, prod ? sums_cprod : sums_csum, &L);
+  for (int k = 0; k < chunks && n; k++)
+    y = (prod ? y * L.cy[k] : y + L.cy[k]);
+
+  return y;
+}
+
+/* sums_matrix(): compute the sums or products along one dimension of
+ * a real matrix.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @A: matrix to reduce.
+ *  @dim: logical dimension to reduce along, one or two.
+ *  @prod: whether to compute products (1) or sums (0).
+ *
+ * returns:
+ *  row vector of column reductions, column vector of row reductions,
+ *  or scalar for single-element results.
+ */
+static Object sums_matrix (Zone z, Matrix A, long dim, int prod) {
+  /* determine the result length and the physical dimension. */
+  const long len = ((dim == 1) == (A->tr == CblasNoTrans) ? A->n : A->m);
+  const long pdim = (A->tr == CblasNoTrans ? dim : 3 - dim);
+
+  /* allocate the result, unless it is a scalar. */
+  Vector y = NULL;
+  double value;
+  if (len != 1) {
+    y = vector_new_with_length(z, len);
+    if (!y)
+      return NULL;
+
+    y->tr = (dim == 1 ? CblasTrans : CblasNoTrans);
   }
+
+  /* compute the reduction. */
+  SumsLoop L;
+  L.x = A->data;
+  L.out = (y ? y->data : &value);
+  L.m = A->m;
+  L.n = A->n;
+
+  if (prod)
+    sums_reduce(&L, pdim, sums_prod_cols, sums_prod_rows);
   else
-    throw(z, ERR_INVALID_ARGIN);
+    sums_reduce(&L, pdim, sums_sum_cols, sums_sum_rows);
 
-  return object_list_argout(z, 1, y);
+  return (y ? (Object) y : (Object) float_new_with_value(z, value));
 }
 
-Object matte_prod (Zone z, Object argin) {
-  const int nargin = object_list_get_length((ObjectList) argin);
-  Object x = object_list_get((ObjectList) argin, 0);
-  Object dim = object_list_get((ObjectList) argin, 1);
+/* sums_complex_matrix(): compute the sums or products along one
+ * dimension of a complex matrix.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @A: matrix to reduce.
+ *  @dim: logical dimension to reduce along, one or two.
+ *  @prod: whether to compute products (1) or sums (0).
+ *
+ * returns:
+ *  row vector of column reductions, column vector of row reductions,
+ *  or scalar for single-element results.
+ */
+static Object sums_complex_matrix (Zone z, ComplexMatrix A, long dim,
+                                   int prod) {
+  /* determine the result length and the physical dimension. */
+  const long len = ((dim == 1) == (A->tr == CblasNoTrans) ? A->n : A->m);
+  const long pdim = (A->tr == CblasNoTrans ? dim : 3 - dim);
 
-  Object y = NULL;
+  /* allocate the result, unless it is a scalar. */
+  ComplexVector y = NULL;
+  complex double value;
+  if (len != 1) {
+    y = complex_vector_new_with_length(z, len);
+    if (!y)
+      return NULL;
 
-  if (nargin == 1) {
-    if (IS_INT(x))
-      y = (Object) int_copy(z, (Int) x);
-    else if (IS_FLOAT(x))
-      y = (Object) float_copy(z, (Float) x);
-    else if (IS_COMPLEX(x))
-      y = (Object) complex_copy(z, (Complex) x);
-    else if (IS_RANGE(x)) {
-      Range r = (Range) x;
-      long prod = 1;
+    y->tr = (dim == 1 ? CblasTrans : CblasNoTrans);
+  }
 
-      for (long elem = r->begin; elem <= r->end; elem += r->step)
-        prod *= elem;
+  /* compute the reduction. complex row sums are real row sums over
+   * the interleaved real and imaginary parts.
+   */
+  complex double *out = (y ? y->data : &value);
+  SumsLoop L;
+  L.x = A->data;
+  L.out = out;
+  L.m = A->m;
+  L.n = A->n;
 
-      y = (Object) int_new_with_value(z, prod);
-    }
-    else if (IS_VECTOR(x)) {
-      Vector v = (Vector) x;
-      double prod = 1.0;
+  if (prod) {
+    sums_reduce(&L, pdim, sums_cprod_cols, sums_cprod_rows);
+  }
+  else {
+    if (pdim == 2)
+      L.m *= 2;
+
+    sums_reduce(&L, pdim, sums_csum_cols, sums_sum_rows);
+  }
+
+  /* conjugate the results of conjugate-transposed matrices. */
+  if (A->tr == CblasConjTrans) {
+    for (long i = 0; i < len; i++)
+      out[i] = conj(out[i]);
+  }
+
+  return (y ? (Object) y : (Object) complex_new_with_value(z, value));
+}
+
+/* sums_sparse(): compute the sums or products along one dimension of
+ * a sparse matrix. sums are accumulated over the stored elements of each
+ * column or row, and products of columns or rows that hold fewer stored
+ * elements than their length are zero.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @S: sparse matrix to reduce.
+ *  @dim: dimension to reduce along, one or two.
+ *  @prod: whether to compute products (1) or sums (0).
+ *
+ * returns:
+ *  row vector of column reductions, column vector of row reductions,
+ *  or scalar for single-element results.
+ */
+static Object sums_sparse (Zone z, SparseMatrix S, long dim, int prod) {
+  /* allocate the result. */
+  const long len = (dim == 1 ? S->n : S->m);
+  const long full = (dim == 1 ? S->m : S->n);
+  Vector y = vector_new_with_length(z, len);
+  if (!y)
+    return NULL;
 
-      for (long i = 0; i < v->n; i++)
-        prod *= v->data[i];
+  y->tr = (dim == 1 ? CblasTrans : CblasNoTrans);
 
-      y = (Object) float_new_with_value(z, prod);
+  if (dim == 1) {
+    /* reduce each column over its range of stored elements. */
+    for (long j = 0; j < S->n; j++) {
+      const long k0 = S->colptr[j];
+      const long k1 = S->colptr[j + 1];
+      if (prod && k1 - k0 < full) {
+        y->data[j] = 0.0;
+        continue;
+      }
+
+      double v = (prod ? 1.0 : 0.0);
+      for (long k = k0; k < k1; k++)
+        v = (prod ? v * S->data[k] : v + S->data[k]);
+
+      y->data[j] = v;
+    }
+  }
+  else if (!prod) {
+    /* scatter the stored elements into their row sums. */
+    for (long k = 0; k < S->nnz; k++)
+      y->data[S->rowidx[k]] += S->data[k];
+  }
+  else {
+    /* scatter the stored elements into their row products, counting
+     * the stored elements of each row.
+     */
+    long *cnt = (long*) calloc(len > 0 ? len : 1, sizeof(long));
+    if (!cnt) {
+      object_free(z, y);
+      fail(ERR_BAD_ALLOC);
     }
-    else if (IS_COMPLEX_VECTOR(x)) {
-      ComplexVector cv = (ComplexVector) x;
-      complex double prod = 1.0;
 
-      for (long i = 0; i < cv->n; i++)
-        prod *= cv->data[i];
+    for (long i = 0; i < len; i++)
+      y->data[i] = 1.0;
 
-      y = (Object) complex_new_with_value(z, prod);
+    for (long k = 0; k < S->nnz; k++) {
+      y->data[S->rowidx[k]] *= S->data[k];
+      cnt[S->rowidx[k]]++;
     }
+
+    for (long i = 0; i < len; i++) {
+      if (cnt[i] < full)
+        y->data[i] = 0.0;
+    }
+
+    free(cnt);
   }
-  else if (nargin == 2) {
+
+  /* return single-element results as scalars. */
+  if (len == 1) {
+    const double v = y->data[0];
+    object_free(z, y);
+    return (Object) float_new_with_value(z, v);
   }
-  else
+
+  return (Object) y;
+}
+
+/* sums_get_dim(): get the value of a dimension argument.
+ *
+ * arguments:
+ *  @dim: dimension argument object.
+ *
+ * returns:
+ *  positive dimension, or zero if the argument is invalid.
+ */
+static long sums_get_dim (Object dim) {
+  long d = 0;
+  if (IS_INT(dim))
+    d = int_get_value((Int) dim);
+  else if (IS_FLOAT(dim) && float_get_value((Float) dim) ==
+           floor(float_get_value((Float) dim)))
+    d = (long) float_get_value((Float) dim);
+
+  return (d > 0 ? d : 0);
+}
+
+/* sums_apply(): compute the sum or product of an object along one of
+ * its dimensions.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @x: object to reduce.
+ *  @dim: dimension to reduce along, or zero to reduce along the first
+ *        non-singleton dimension.
+ *  @prod: whether to compute products (1) or sums (0).
+ *
+ * returns:
+ *  result of the reduction, or null on failure.
+ */
+static Object sums_apply (Zone z, Object x, long dim, int prod) {
+  if (IS_INT(x))
+    return (Object) int_copy(z, (Int) x);
+  else if (IS_FLOAT(x))
+    return (Object) float_copy(z, (Float) x);
+  else if (IS_COMPLEX(x))
+    return (Object) complex_copy(z, (Complex) x);
+  else if (IS_RANGE(x)) {
+    /* ranges are row vectors, reduced in closed form. */
+    Range r = (Range) x;
+    if (dim == 1 || dim > 2)
+      return (Object) range_copy(z, r);
+
+    return (Object) int_new_with_value(z,
+      prod ? range_prod(r) : range_sum(r));
+  }
+  else if (IS_FLOAT_RANGE(x)) {
+    FloatRange r = (FloatRange) x;
+    if (dim == 1 || dim > 2)
+      return (Object) float_range_copy(z, r);
+
+    return (Object) float_new_with_value(z,
+      prod ? float_range_prod(r) : float_range_sum(r));
+  }
+  else if (IS_VECTOR(x)) {
+    /* reduce vectors along their length. */
+    Vector v = (Vector) x;
+    if (dim && (dim == 1) != (v->tr == CblasNoTrans))
+      return (Object) vector_copy(z, v);
+
+    return (Object) float_new_with_value(z, sums_vector(v->n, v->data,
+                                                       prod));
+  }
+  else if (IS_COMPLEX_VECTOR(x)) {
+    ComplexVector cv = (ComplexVector) x;
+    if (dim && (dim == 1) != (cv->tr == CblasNoTrans))
+      return (Object) complex_vector_copy(z, cv);
+
+    if (!complex_vector_interleave(cv))
+      return NULL;
+
+    return (Object) complex_new_with_value(z,
+      sums_complex_vector(cv->n, cv->data, prod));
+  }
+  else if (IS_MATRIX(x)) {
+    /* reduce matrices along the first non-singleton dimension. */
+    Matrix A = (Matrix) x;
+    const long rows = (A->tr == CblasNoTrans ? A->m : A->n);
+    if (!dim)
+      dim = (rows == 1 ? 2 : 1);
+
+    if (dim > 2)
+      return (Object) matrix_copy(z, A);
+
+    return sums_matrix(z, A, dim, prod);
+  }
+  else if (IS_COMPLEX_MATRIX(x)) {
+    ComplexMatrix A = (ComplexMatrix) x;
+    const long rows = (A->tr == CblasNoTrans ? A->m : A->n);
+    if (!dim)
+      dim = (rows == 1 ? 2 : 1);
+
+    if (dim > 2)
+      return (Object) complex_matrix_copy(z, A);
+
+    if (!complex_matrix_interleave(A))
+      return NULL;
+
+    return sums_complex_matrix(z, A, dim, prod);
+  }
+  else if (IS_LOGICAL(x)) {
+    /* sums of vector-shaped logical arrays count their true elements. */
+    Logical L = (Logical) x;
+    if (!prod && !L->mat && (!dim || (dim == 1) == (L->n == 1)))
+      return (Object) float_new_with_value(z, (double) logical_nnz(L));
+
+    /* otherwise, reduce the widened array. */
+    Object w = logical_to_double(z, L);
+    if (!w)
+      return NULL;
+
+    Object y = sums_apply(z, w, dim, prod);
+    object_free(z, w);
+    return y;
+  }
+  else if (IS_SPARSE_MATRIX(x)) {
+    SparseMatrix S = (SparseMatrix) x;
+    if (!dim)
+      dim = (S->m == 1 ? 2 : 1);
+
+    if (dim > 2)
+      return (Object) sparse_matrix_copy(z, S);
+
+    return sums_sparse(z, S, dim, prod);
+  }
+  else if (IS_SINGLE_VECTOR(x) || IS_SINGLE_MATRIX(x)) {
+    /* reduce single arrays in double precision, and round the result
+     * back to single precision.
+     */
+    Object w = (IS_SINGLE_VECTOR(x) ?
+                (Object) single_vector_to_double(z, (SingleVector) x) :
+                (Object) single_matrix_to_double(z, (SingleMatrix) x));
+    if (!w)
+      return NULL;
+
+    Object y = sums_apply(z, w, dim, prod);
+    object_free(z, w);
+
+    Object ys = y;
+    if (y && IS_FLOAT(y))
+      ys = (Object) float_new_with_value(z,
+        (double) (float) float_get_value((Float) y));
+    else if (y && IS_VECTOR(y))
+      ys = (Object) single_vector_new_from_vector(z, (Vector) y);
+    else if (y && IS_MATRIX(y))
+      ys = (Object) single_matrix_new_from_matrix(z, (Matrix) y);
+
+    if (ys != y)
+      object_free(z, y);
+
+    return ys;
+  }
+  else if (IS_INT32_ARRAY(x) || IS_INT64_ARRAY(x)) {
+    /* reduce integer arrays in double precision. */
+    Object w = (IS_INT32_ARRAY(x) ?
+                int32_array_to_double(z, (Int32Array) x) :
+                int64_array_to_double(z, (Int64Array) x));
+    if (!w)
+      return NULL;
+
+    Object y = sums_apply(z, w, dim, prod);
+    object_free(z, w);
+    return y;
+  }
+
+  fail(ERR_OBJ_UNARY, prod ? "prod" : "sum", MATTE_TYPE(x)->name);
+}
+
+/* sums_main(): parse the arguments of sum() and prod() and compute
+ * the requested reduction.
+ *
+ * arguments:
+ *  @z: zone allocator for the result.
+ *  @argin: argument list of the builtin.
+ *  @prod: whether to compute products (1) or sums (0).
+ *
+ * returns:
+ *  argument list holding the result.
+ */
+static Object sums_main (Zone z, Object argin, int prod) {
+  const int nargin = object_list_get_length((ObjectList) argin);
+  Object x = object_list_get((ObjectList) argin, 0);
+  Object dim = object_list_get((ObjectList) argin, 1);
+
+  long d = 0;
+  if (nargin == 2) {
+    d = sums_get_dim(dim);
+    if (!d)
+      throw(z, ERR_INVALID_DIM);
+  }
+  else if (nargin != 1)
     throw(z, ERR_INVALID_ARGIN);
 
-  return object_list_argout(z, 1, y);
+  Object y = sums_apply(z, x, d, prod);
+  if (!y)
+    return exceptions_get(z);
+
+  return object_list_argout(z, z, 1, y);
+}
+
+Object matte_sum (Zone z, Object argin) {
+  return sums_main(z, argin, 0);
+}
+
+Object matte_prod (Zone z, Object argin) {
+  return sums_main(z, argin, 1);
 }
 
@@ -100,6 +100,11 @@ struct _ObjectType Cell_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
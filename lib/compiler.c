@@ -48,40 +48,104 @@ static const struct {
   /* @tok: node type (token) of the matte ast-node containing the operation.
    * @noper: number of downfield operands in the operation.
    * @fstr: function name of the overloadable operation.
+   * @cstr: c operator of the operation on unboxed scalars, or null. the
+   *        special operators '\\' and '^' are written as swapped division
+   *        and calls to pow(), respectively.
    */
   ScannerToken tok;
   const int noper;
   const char *fstr;
+  const char *cstr;
 }
 operators[] = {
-  { T_PLUS,          2, "object_plus"       },
-  { T_MINUS,         2, "object_minus"      },
-  { T_MINUS,         1, "object_uminus"     },
-  { T_ELEM_MUL,      2, "object_times"      },
-  { T_MUL,           2, "object_mtimes"     },
-  { T_ELEM_DIV,      2, "object_rdivide"    },
-  { T_ELEM_LDIV,     2, "object_ldivide"    },
-  { T_DIV,           2, "object_mrdivide"   },
-  { T_LDIV,          2, "object_mldivide"   },
-  { T_ELEM_POW,      2, "object_power"      },
-  { T_POW,           2, "object_mpower"     },
-  { T_LT,            2, "object_lt"         },
-  { T_GT,            2, "object_gt"         },
-  { T_LE,            2, "object_le"         },
-  { T_GE,            2, "object_ge"         },
-  { T_NE,            2, "object_ne"         },
-  { T_EQ,            2, "object_eq"         },
-  { T_ELEM_AND,      2, "object_and"        },
-  { T_ELEM_OR,       2, "object_or"         },
-  { T_AND,           2, "object_mand"       },
-  { T_OR,            2, "object_mor"        },
-  { T_NOT,           1, "object_not"        },
-  { T_COLON,         3, "object_colon"      },
-  { T_HTR,           1, "object_ctranspose" },
-  { T_TR,            1, "object_transpose"  },
-  { T_ERR,           0, NULL                }
+  { T_PLUS,          2, "object_plus",       "+"  },
+  { T_MINUS,         2, "object_minus",      "-"  },
+  { T_MINUS,         1, "object_uminus",     "-"  },
+  { T_ELEM_MUL,      2, "object_times",      "*"  },
+  { T_MUL,           2, "object_mtimes",     "*"  },
+  { T_ELEM_DIV,      2, "object_rdivide",    "/"  },
+  { T_ELEM_LDIV,     2, "object_ldivide",    "\\" },
+  { T_DIV,           2, "object_mrdivide",   "/"  },
+  { T_LDIV,          2, "object_mldivide",   "\\" },
+  { T_ELEM_POW,      2, "object_power",      "^"  },
+  { T_POW,           2, "object_mpower",     "^"  },
+  { T_LT,            2, "object_lt",         "<"  },
+  { T_GT,            2, "object_gt",         ">"  },
+  { T_LE,            2, "object_le",         "<=" },
+  { T_GE,            2, "object_ge",         ">=" },
+  { T_NE,            2, "object_ne",         "!=" },
+  { T_EQ,            2, "object_eq",         "==" },
+  { T_ELEM_AND,      2, "object_and",        "&&" },
+  { T_ELEM_OR,       2, "object_or",         "||" },
+  { T_AND,           2, "object_mand",       "&&" },
+  { T_OR,            2, "object_mor",        "||" },
+  { T_NOT,           1, "object_not",        "!"  },
+  { T_COLON,         3, "object_colon",      NULL },
+  { T_HTR,           1, "object_ctranspose", NULL },
+  { T_TR,            1, "object_transpose",  NULL },
+  { T_ERR,           0, NULL,                NULL }
 };
 
+/* find_operator(): look up the operator definition of a matte ast-node.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  index of the node's entry in the operator definition array, or -1
+ *  if the node is not a supported operation.
+ */
+static int find_operator (AST node) {
+  /* get the current node type. */
+  const ASTNodeType ntype = ast_get_type(node);
+
+  /* search the operator definition array for the current node type. */
+  for (int i = 0; operators[i].fstr; i++) {
+    if (ntype == (ASTNodeType) operators[i].tok &&
+        node->n_down == operators[i].noper)
+      return i;
+  }
+
+  /* not an operation. */
+  return -1;
+}
+
+/* unboxed(): check whether the symbol registered with a matte ast-node
+ * has been inferred to hold an unboxed (native c) real scalar.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  SYMBOL_LONG or SYMBOL_DOUBLE for unboxed scalars, SYMBOL_ANY (zero)
+ *  for all other symbols.
+ */
+static SymbolType unboxed (AST node) {
+  /* return the unboxed scalar type bits of the symbol. */
+  return (node ? ast_get_symbol_type(node) & SYMBOL_SCALAR : SYMBOL_ANY);
+}
+
+/* is_variable(): check whether a matte ast-node holds an unindexed
+ * reference to a variable or function argument.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  integer indicating whether the node is a variable reference.
+ */
+static int is_variable (AST node) {
+  /* accept only unindexed identifiers. */
+  if (ast_get_type(node) != (ASTNodeType) T_IDENT || node->n_down ||
+      !node->sym_table || !node->sym_index)
+    return 0;
+
+  /* accept only variable and argument symbols. */
+  const SymbolType stype = ast_get_symbol_type(node);
+  return ((stype & (SYMBOL_VAR | SYMBOL_ARGIN | SYMBOL_ARGOUT)) &&
+          !(stype & (SYMBOL_FUNC | SYMBOL_CLASS)));
+}
+
 /* simplify_concats(): simplify concatenation operations by compressing
  * trivial operation groups.
  *
@@ -329,6 +393,76 @@ static int init_symbols (Compiler c, AST node) {
   return 1;
 }
 
+/* subsref_context(): check whether a subscript depends on the indexed
+ * array, through an end keyword or a bare colon.
+ *
+ * arguments:
+ *  @node: matte ast-node of the subscript.
+ *
+ * returns:
+ *  integer indicating whether the subscript depends on the array.
+ */
+static int subsref_context (AST node) {
+  /* do not traverse null nodes. */
+  if (!node) return 0;
+
+  /* check the node itself. */
+  const ScannerToken ntok = (ScannerToken) ast_get_type(node);
+  if (ntok == T_END || (ntok == T_COLON && !node->n_down))
+    return 1;
+
+  /* traverse further into the tree. */
+  for (int i = 0; i < node->n_down; i++) {
+    if (subsref_context(node->down[i]))
+      return 1;
+  }
+
+  return 0;
+}
+
+/* lower_subsref(): replace an indexed reference to a variable by a
+ * subscripted reference node, which holds the unindexed variable and
+ * its subscript. references with more than one subscript, or with
+ * subscripts that depend on the indexed array, are left unchanged.
+ *
+ * arguments:
+ *  @node: matte ast-node of the indexed variable.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int lower_subsref (AST node) {
+  /* accept only a single subscript that is a value. */
+  AST paren = node->down[0];
+  if (paren->n_down != 1 || !paren->down[0])
+    return 1;
+
+  AST sub = paren->down[0];
+  if (subsref_context(sub))
+    return 1;
+
+  /* detach the subscript from the variable. */
+  paren->n_down = 0;
+  node->n_down = 0;
+  object_free(NULL, paren);
+
+  /* slip the reference node above the variable, and move the subscript
+   * and the display flag into it.
+   */
+  AST ref = ast_new_with_type(AST_TYPE_SUBSREF);
+  if (!ref || !ast_slip(node, ref) || !ast_add_down(ref, sub))
+    return 0;
+
+  if (node->fname)
+    ast_set_source(ref, node->fname, node->line, node->pos);
+
+  ast_set_disp(ref, node->node_disp);
+  ast_set_disp(node, false);
+
+  /* register a temporary symbol for the referenced value. */
+  return ast_add_symbol(ref, ref, SYMBOL_TEMP_VAR);
+}
+
 /* resolve_symbols(): resolve all symbols that are accessed by
  * operations within an abstract syntax tree.
  *
@@ -405,6 +539,18 @@ static int resolve_symbols (Compiler c, AST node) {
             super->sym_index = super->down[0]->sym_index;
           }
         }
+        else if (node->n_down == 1 && node->down[0] &&
+                 ast_get_type(node->down[0]) == (ASTNodeType) T_PAREN_OPEN &&
+                 !(ast_get_type(node->up) == (ASTNodeType) T_ASSIGN &&
+                   node->up->down[0] == node)) {
+          /* lower indexed references to variables, and resolve the
+           * symbols of the moved subscript.
+           */
+          if (!lower_subsref(node) ||
+              (ast_get_type(node->up) == AST_TYPE_SUBSREF &&
+               !resolve_symbols(c, node->up->down[1])))
+            return 0;
+        }
 
         /* discontinue the search. */
         break;
@@ -439,10 +585,747 @@ static int resolve_symbols (Compiler c, AST node) {
   return 1;
 }
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* infer_kind(): return the scalar kind inferred so far for the value
+ * held by a matte ast-node.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  SYMBOL_LONG or SYMBOL_DOUBLE for real scalars, SYMBOL_ANY for values
+ *  that have not yet been inferred, or SYMBOL_SCALAR for values that
+ *  must remain boxed.
+ */
+static SymbolType infer_kind (AST node) {
+  /* values without symbols, and indexed values, remain boxed. */
+  if (!node || !node->sym_table || !node->sym_index ||
+      (ast_get_type(node) == (ASTNodeType) T_IDENT && node->n_down))
+    return SYMBOL_SCALAR;
+
+  /* integer and float literals have fixed kinds. */
+  const SymbolType stype = ast_get_symbol_type(node);
+  if (stype & SYMBOL_INT)
+    return SYMBOL_LONG;
+  else if (stype & SYMBOL_FLOAT)
+    return SYMBOL_DOUBLE;
+
+  /* variables and temporaries hold the kinds of their values. */
+  if ((stype & SYMBOL_VAR) && !(stype & (SYMBOL_FUNC | SYMBOL_CLASS)))
+    return stype & SYMBOL_SCALAR;
+
+  /* all other symbols remain boxed. */
+  return SYMBOL_SCALAR;
+}
+
+/* infer_join(): merge a scalar kind into the symbol registered with a
+ * matte ast-node. merging two different kinds yields SYMBOL_SCALAR,
+ * which marks the symbol as boxed.
+ *
+ * arguments:
+ *  @node: matte ast-node to modify.
+ *  @kind: scalar kind to merge into the symbol.
+ *
+ * returns:
+ *  integer indicating whether the symbol type was changed.
+ */
+static int infer_join (AST node, SymbolType kind) {
+  /* only variables and temporaries are inferred. */
+  if (!node || !node->sym_table || !node->sym_index)
+    return 0;
+
+  const long sid = node->sym_index - 1;
+  const SymbolType stype = symbol_type(node->sym_table, sid);
+  if (!(stype & SYMBOL_VAR) || (stype & (SYMBOL_FUNC | SYMBOL_CLASS)))
+    return 0;
+
+  /* return if the kind is already merged. */
+  if ((stype | kind) == stype)
+    return 0;
+
+  /* store the merged kind. */
+  symbol_set_type(node->sym_table, sid, stype | kind);
+  return 1;
+}
+
+/* infer_operation(): return the scalar kind of the result of an
+ * operation, following the int/float promotion rules of the object
+ * types that implement it.
+ *
+ * arguments:
+ *  @node: matte ast-node of the operation.
+ *  @cstr: c operator of the operation.
+ *
+ * returns:
+ *  scalar kind of the operation result.
+ */
+static SymbolType infer_operation (AST node, const char *cstr) {
+  /* operations without c operators remain boxed. */
+  if (!cstr)
+    return SYMBOL_SCALAR;
+
+  /* get the kinds of the operands. */
+  const SymbolType a = infer_kind(node->down[0]);
+  const SymbolType b = infer_kind(node->down[node->n_down - 1]);
+
+  /* boxed operands yield boxed results, and operands of unknown kind
+   * leave the result undetermined.
+   */
+  if (a == SYMBOL_SCALAR || b == SYMBOL_SCALAR)
+    return SYMBOL_SCALAR;
+  else if (a == SYMBOL_ANY || b == SYMBOL_ANY)
+    return SYMBOL_ANY;
+
+  /* determine whether the operation is on two integers. */
+  const int ints = (a == SYMBOL_LONG && b == SYMBOL_LONG);
+
+  /* unary operations: negation keeps its kind, not yields an int. */
+  if (node->n_down == 1)
+    return (cstr[0] == '!' ? SYMBOL_LONG : a);
+
+  /* int ^ int => int is left to the boxed implementation. */
+  if (cstr[0] == '^')
+    return (ints ? SYMBOL_SCALAR : SYMBOL_DOUBLE);
+
+  /* int <op> int => int, otherwise float. */
+  if (strchr("+-*/\\", cstr[0]))
+    return (ints ? SYMBOL_LONG : SYMBOL_DOUBLE);
+
+  /* comparisons and logicals always yield ints. */
+  return SYMBOL_LONG;
+}
+
+/* infer_seed(): mark variables that can never be unboxed, because they
+ * are shared between scopes, persistent, or function arguments.
+ *
+ * arguments:
+ *  @root: root matte ast-node of the syntax tree.
+ *  @node: matte ast-node to process.
+ */
+static void infer_seed (AST root, AST node) {
+  /* do not traverse null nodes. */
+  if (!node) return;
+
+  /* check the symbol table held by the node, if any. */
+  Symbols syms = node->syms;
+  for (long i = 0; syms && i < syms->n; i++) {
+    /* only check variables. */
+    if (!symbol_has_type(syms, i, SYMBOL_VAR))
+      continue;
+
+    /* get the symbol name and type. */
+    const char *name = symbol_name(syms, i);
+    const SymbolType stype = symbol_type(syms, i);
+
+    /* persistent variables, variables that share their names with
+     * function arguments, and globals outside the root remain boxed.
+     */
+    if ((stype & SYMBOL_STATIC) ||
+        (syms != root->syms &&
+         ((stype & SYMBOL_GLOBAL) ||
+          symbols_find(syms, SYMBOL_ARGIN | SYMBOL_ARGOUT, name))))
+      symbol_set_type(syms, i, stype | SYMBOL_SCALAR);
+
+    /* globals declared outside the root keep their root symbols boxed. */
+    if (syms != root->syms && (stype & SYMBOL_GLOBAL)) {
+      const long gid = symbols_find(root->syms, SYMBOL_VAR, name);
+      if (gid)
+        symbol_set_type(root->syms, gid - 1,
+                        symbol_type(root->syms, gid - 1) | SYMBOL_SCALAR);
+    }
+  }
+
+  /* traverse further into the tree. */
+  for (int i = 0; i < node->n_down; i++)
+    infer_seed(root, node->down[i]);
+}
+
+/* infer_scalars(): perform a single pass of scalar kind inference
+ * over an abstract syntax tree, merging the kinds of all assigned
+ * values into their variables.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  number of symbols whose kinds were changed during the pass.
+ */
+static int infer_scalars (AST node) {
+  /* declare required variables:
+   *  @changed: number of changed symbols.
+   *  @down: general-purpose downstream node.
+   *  @i: general-purpose loop counter.
+   */
+  int changed = 0;
+  AST down;
+  int i;
+
+  /* do not traverse null nodes. */
+  if (!node) return 0;
+
+  /* infer the kinds of the child nodes first. */
+  for (i = 0; i < node->n_down; i++)
+    changed += infer_scalars(node->down[i]);
+
+  /* get the current node type. */
+  const ASTNodeType ntype = ast_get_type(node);
+  const ScannerToken ntok = (ScannerToken) ntype;
+
+  /* values accessed outside of their own scope, or through indexing,
+   * remain boxed.
+   */
+  if (node->sym_table && node->sym_table != ast_get_symbols(node))
+    changed += infer_join(node, SYMBOL_SCALAR);
+
+  if (ntok == T_IDENT && node->n_down)
+    changed += infer_join(node, SYMBOL_SCALAR);
+
+  /* infer based on node type. */
+  if (ntok == T_ASSIGN) {
+    /* assignments merge the kind of their right-hand side. */
+    down = node->down[0];
+    if (ast_get_type(down) == AST_TYPE_ROW) {
+      for (i = 0; i < down->n_down; i++)
+        changed += infer_join(down->down[i], SYMBOL_SCALAR);
+
+      changed += infer_join(node, SYMBOL_SCALAR);
+    }
+    else
+      changed += infer_join(node, infer_kind(node->down[1]));
+  }
+  else if (ntok == T_FOR) {
+    /* iteration over integer ranges yields integers. */
+    SymbolType kind = SYMBOL_SCALAR;
+    down = node->down[1];
+    if (ast_get_type(down) == (ASTNodeType) T_COLON && down->n_down == 3) {
+      kind = SYMBOL_LONG;
+      for (i = 0; i < down->n_down; i++) {
+        const SymbolType k = infer_kind(down->down[i]);
+        if (k == SYMBOL_ANY && kind == SYMBOL_LONG)
+          kind = SYMBOL_ANY;
+        else if (k != SYMBOL_ANY && k != SYMBOL_LONG)
+          kind = SYMBOL_SCALAR;
+      }
+    }
+
+    changed += infer_join(node->down[0], kind);
+  }
+  else if (ntype == AST_TYPE_FN_CALL) {
+    /* function call results remain boxed. */
+    down = node->down[0];
+    if (ast_get_type(down) == AST_TYPE_ROW) {
+      for (i = 0; i < down->n_down; i++)
+        changed += infer_join(down->down[i], SYMBOL_SCALAR);
+    }
+    else
+      changed += infer_join(down, SYMBOL_SCALAR);
+
+    changed += infer_join(node, SYMBOL_SCALAR);
+  }
+  else if (ntype == AST_TYPE_SUBSREF) {
+    /* subscripted references remain boxed. */
+    changed += infer_join(node, SYMBOL_SCALAR);
+  }
+  else if (ntok == T_TRY) {
+    /* caught exceptions remain boxed. */
+    changed += infer_join(node->down[1], SYMBOL_SCALAR);
+  }
+  else if (ntok == T_GLOBAL || ntok == T_PERSISTENT) {
+    /* declared globals and persistents remain boxed. */
+    for (i = 0; i < node->n_down; i++)
+      changed += infer_join(node->down[i], SYMBOL_SCALAR);
+
+    changed += infer_join(node, SYMBOL_SCALAR);
+  }
+  else if ((i = find_operator(node)) >= 0) {
+    /* operations yield the kinds of their results. */
+    changed += infer_join(node, infer_operation(node, operators[i].cstr));
+  }
+
+  /* return the number of changes. */
+  return changed;
+}
+
+/* infer_finish(): finalize the scalar kinds of all variables in the
+ * symbol tables of an abstract syntax tree.
+ *
+ * in the first stage, variables whose kinds remain undetermined are
+ * marked as boxed. in the second stage, the boxed marks are cleared,
+ * leaving only the unboxed scalar kinds. unboxed root variables are
+ * no longer shared with other scopes, and become locals of the main
+ * function.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *  @stage: finalization stage, either zero or one.
+ */
+static void infer_finish (AST node, int stage) {
+  /* do not traverse null nodes. */
+  if (!node) return;
+
+  /* finalize the symbol table held by the node, if any. */
+  Symbols syms = node->syms;
+  for (long i = 0; syms && i < syms->n; i++) {
+    /* only finalize variables. */
+    const SymbolType stype = symbol_type(syms, i);
+    if (!(stype & SYMBOL_VAR))
+      continue;
+
+    /* get the scalar kind of the variable. */
+    const SymbolType kind = stype & SYMBOL_SCALAR;
+
+    if (stage == 0 && kind == SYMBOL_ANY) {
+      /* undetermined: mark as boxed. */
+      symbol_set_type(syms, i, stype | SYMBOL_SCALAR);
+    }
+    else if (stage == 1 && kind == SYMBOL_SCALAR) {
+      /* boxed: clear the mark. */
+      symbol_set_type(syms, i, stype & ~SYMBOL_SCALAR);
+    }
+    else if (stage == 1 && kind) {
+      /* unboxed: localize the variable. */
+      symbol_set_type(syms, i, stype & ~SYMBOL_GLOBAL);
+    }
+  }
+
+  /* traverse further into the tree. */
+  for (int i = 0; i < node->n_down; i++)
+    infer_finish(node->down[i], stage);
+}
+
+/* scalar_use(): check whether a child of a matte ast-node may directly
+ * use the unboxed value of its symbol.
+ *
+ * arguments:
+ *  @up: matte ast-node that uses the value.
+ *  @i: index of the child node that holds the value.
+ *
+ * returns:
+ *  integer indicating whether the value may remain unboxed.
+ */
+static int scalar_use (AST up, int i) {
+  /* get the node type. */
+  const ASTNodeType utype = ast_get_type(up);
+  const ScannerToken utok = (ScannerToken) utype;
+
+  /* statements display their own values, and boxes box them. */
+  if (utype == AST_TYPE_ROOT || utype == AST_TYPE_STATEMENTS ||
+      utype == AST_TYPE_FUNCTION || utype == AST_TYPE_BOX)
+    return 1;
+
+  /* assignments into unboxed variables. */
+  if (utok == T_ASSIGN)
+    return (i == 0 || unboxed(up));
+
+  /* conditions and statements of if-statements and loops, and loop
+   * variables. only the iteration expression of for loops, and the
+   * compared values of switch blocks, require boxing.
+   */
+  if (utok == T_IF || utok == T_WHILE || utok == T_UNTIL || utok == T_TRY)
+    return 1;
+  else if (utok == T_FOR)
+    return (i != 1);
+  else if (utok == T_SWITCH)
+    return (i > 0 && i % 2 == 0);
+
+  /* bounds of counted loops with unboxed iteration variables. */
+  if (utok == T_COLON && up->up &&
+      ast_get_type(up->up) == (ASTNodeType) T_FOR &&
+      up->up->down[1] == up && unboxed(up->up->down[0]))
+    return 1;
+
+  /* operands of unboxed operations. */
+  if (find_operator(up) >= 0)
+    return (unboxed(up) != SYMBOL_ANY);
+
+  /* all other uses require boxed values. */
+  return 0;
+}
+
+/* box_scalars(): insert boxing nodes into an abstract syntax tree
+ * wherever an unboxed value is used by an operation that requires
+ * a matte object.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int box_scalars (AST node) {
+  /* do not traverse null nodes. */
+  if (!node) return 1;
+
+  /* loop over the child nodes. */
+  for (int i = 0; i < node->n_down; i++) {
+    /* check if the child value requires boxing. */
+    AST down = node->down[i];
+    if (down && unboxed(down) && !scalar_use(node, i)) {
+      /* slip a boxing node above the child, and register a temporary
+       * symbol for the boxed value.
+       */
+      AST box = ast_new_with_type(AST_TYPE_BOX);
+      if (!box || !ast_slip(down, box) ||
+          !ast_add_symbol(box, box, SYMBOL_TEMP_VAR))
+        return 0;
+    }
+
+    /* traverse further into the tree. */
+    if (!box_scalars(down))
+      return 0;
+  }
+
+  /* return success. */
+  return 1;
+}
+
+/* infer_symbols(): infer which variables of an abstract syntax tree
+ * provably hold real scalars, so that they may be written as native
+ * c doubles and longs. values are boxed only where they escape into
+ * operations that require matte objects.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: root matte ast-node of the syntax tree.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int infer_symbols (Compiler c, AST node) {
+  /* mark variables that must remain boxed. */
+  infer_seed(node, node);
+
+  /* infer kinds until no further changes occur, once with the
+   * undetermined kinds left open, and once with them boxed.
+   */
+  while (infer_scalars(node));
+  infer_finish(node, 0);
+  while (infer_scalars(node));
+  infer_finish(node, 1);
+
+  /* box the unboxed values that escape. */
+  return box_scalars(node);
+}
+
+/* TempUse: structure for holding the ast-node that holds a temporary
+ * symbol.
+ */
+typedef struct {
+  /* @tab: symbol table of the temporary.
+   * @idx: index of the temporary in its symbol table.
+   * @node: matte ast-node that holds the temporary.
+   */
+  Symbols tab;
+  long idx;
+  AST node;
+}
+TempUse;
+
+/* temps_compare(): comparison function for sorting temporary symbols
+ * by symbol table and index.
+ */
+static int temps_compare (const void *a, const void *b) {
+  const TempUse *ua = (const TempUse*) a;
+  const TempUse *ub = (const TempUse*) b;
+  const uintptr_t ta = (uintptr_t) ua->tab;
+  const uintptr_t tb = (uintptr_t) ub->tab;
+
+  if (ta != tb)
+    return (ta > tb) - (ta < tb);
+
+  return (ua->idx > ub->idx) - (ua->idx < ub->idx);
+}
+
+/* temps_find(): find every ast-node of an abstract syntax tree that
+ * holds a boxed temporary symbol.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *  @uses: pointer to the array of found nodes.
+ *  @n: pointer to the number of found nodes.
+ *  @nmax: pointer to the allocated length of the array.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int temps_find (AST node, TempUse **uses, long *n, long *nmax) {
+  if (!node)
+    return 1;
+
+  /* store nodes holding temporaries that are freed by their parents.
+   * nodes that share the temporary of their own parent, such as the
+   * outputs of function calls, name the value of the parent and are
+   * not consumed separately.
+   */
+  AST up = node->up;
+  if ((ast_get_symbol_type(node) & SYMBOL_TEMP) && !unboxed(node) &&
+      !(up && up->sym_table == node->sym_table &&
+        up->sym_index == node->sym_index)) {
+    if (*n == *nmax) {
+      const long len = (*nmax ? 2 * *nmax : 64);
+      TempUse *u = (TempUse*) realloc(*uses, len * sizeof(TempUse));
+      if (!u)
+        fail(ERR_BAD_ALLOC);
+
+      *uses = u;
+      *nmax = len;
+    }
+
+    (*uses)[*n].tab = node->sym_table;
+    (*uses)[*n].idx = node->sym_index;
+    (*uses)[*n].node = node;
+    (*n)++;
+  }
+
+  /* traverse further into the tree. */
+  for (int i = 0; i < node->n_down; i++) {
+    if (!temps_find(node->down[i], uses, n, nmax))
+      return 0;
+  }
+
+  return 1;
+}
+
+/* check_temps(): check the invariant that write_free() relies upon to
+ * free each temporary after its last use: every boxed temporary symbol
+ * is held by exactly one ast-node, so the parent of that node is its
+ * only consumer, and its last use is the use by its parent.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: root matte ast-node of the syntax tree.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int check_temps (Compiler c, AST node) {
+  /* find the nodes holding temporaries. */
+  TempUse *uses = NULL;
+  long n = 0, nmax = 0;
+  if (!temps_find(node, &uses, &n, &nmax)) {
+    free(uses);
+    return 0;
+  }
+
+  /* sort the nodes by symbol, and check for repeated symbols. */
+  qsort(uses, n, sizeof(TempUse), temps_compare);
+  for (long i = 1; i < n; i++) {
+    if (temps_compare(uses + i - 1, uses + i) == 0) {
+      const char *name = S(uses[i].node);
+      free(uses);
+      fail(ERR_COMPILER_TEMP, name);
+    }
+  }
+
+  /* return success. */
+  free(uses);
+  return 1;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* forward declarations: */
+static void write_statements (Compiler c, AST node);
+
+/* write_free(): write code that frees the value of a temporary symbol
+ * after its last use, or nothing if the specified ast-node does not
+ * hold a temporary. each temporary is consumed by exactly one parent
+ * node, which is checked by check_temps(), so the parent frees it once
+ * the value has been used.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  integer indicating whether the write was performed.
+ */
+static int write_free (Compiler c, AST node) {
+  /* only free the values of boxed temporary symbols. */
+  if (!node || !(ast_get_symbol_type(node) & SYMBOL_TEMP) || unboxed(node))
+    return 0;
+
+  /* write the free statement. */
+  W("  object_free(&_z1, %s);\n", S(node));
+  return 1;
+}
+
+/* write_scalar(): write the unboxed value of a matte ast-node as a c
+ * expression, which is either a literal or the name of a variable.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ */
+static void write_scalar (Compiler c, AST node) {
+  /* write based on symbol type. */
+  const SymbolType stype = ast_get_symbol_type(node);
+  if (stype & SYMBOL_INT)
+    W("%ldL", symbol_int(node->sym_table, node->sym_index - 1));
+  else if (stype & SYMBOL_FLOAT)
+    W("%le", symbol_float(node->sym_table, node->sym_index - 1));
+  else
+    W("%s", S(node));
+}
+
+/* write_box(): write the boxing of an unboxed value into a new matte
+ * object, or nothing if the specified ast-node is not a box.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  integer indicating whether the write was performed.
+ */
+static int write_box (Compiler c, AST node) {
+  /* accept only boxing nodes. */
+  if (ast_get_type(node) != AST_TYPE_BOX)
+    return 0;
+
+  /* write the new object. */
+  AST down = node->down[0];
+  W("  Object %s = (Object) %s(&_z1, %s);\n", S(node),
+    unboxed(down) == SYMBOL_LONG ? "int_new_with_value" :
+                                   "float_new_with_value",
+    S(down));
+
+  /* return true. */
+  return 1;
+}
+
+/* alias_use(): check whether a use of a variable may leave its value
+ * held by another variable, container or iterator, or may store the
+ * value of another variable into it.
+ *
+ * arguments:
+ *  @node: matte ast-node that references the variable.
+ *
+ * returns:
+ *  integer indicating whether the value of the variable may be aliased.
+ */
+static int alias_use (AST node) {
+  /* get the type of the parent node. */
+  AST up = node->up;
+  const ASTNodeType utype = ast_get_type(up);
+  const ScannerToken utok = (ScannerToken) utype;
+
+  /* indexing and operations compute new values. */
+  if (node->n_down || utype == AST_TYPE_SUBSREF || find_operator(up) >= 0)
+    return 0;
+
+  /* assignments alias variables assigned from other variables. */
+  if (utok == T_ASSIGN)
+    return (up->down[1] == node || is_variable(up->down[1]));
+
+  /* function arguments and indices are only read, and function outputs
+   * are moved or copied out of the called function. outputs that alias
+   * an argument held by the caller are copied by object_list_argout().
+   */
+  if (utype == AST_TYPE_FN_CALL ||
+      ast_get_type(up->up) == AST_TYPE_FN_CALL)
+    return 0;
+  else if (utok == T_PAREN_OPEN && up->up &&
+           (ast_get_type(up->up->up) == AST_TYPE_FN_CALL ||
+            (ast_get_symbol_type(up->up) & SYMBOL_VAR)))
+    return 0;
+
+  /* conditions, declarations and statements only read the value. */
+  if (utype == AST_TYPE_ROOT || utype == AST_TYPE_STATEMENTS ||
+      utype == AST_TYPE_FUNCTION || utok == T_IF || utok == T_WHILE ||
+      utok == T_UNTIL || ast_get_type(up->up) == AST_TYPE_FUNCTION)
+    return 0;
+
+  /* all other uses may alias the value. */
+  return 1;
+}
+
+/* inplace_scan(): check that a variable is never aliased within an
+ * abstract syntax tree.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *  @var: matte ast-node that references the variable.
+ *
+ * returns:
+ *  integer indicating whether the variable is free of aliases.
+ */
+static int inplace_scan (AST node, AST var) {
+  /* do not traverse null nodes. */
+  if (!node) return 1;
+
+  /* check uses of the variable. */
+  if (node->sym_table == var->sym_table &&
+      node->sym_index == var->sym_index && alias_use(node))
+    return 0;
+
+  /* check global declarations that share the variable. */
+  if (ast_get_type(node) == (ASTNodeType) T_GLOBAL) {
+    for (int i = 0; i < node->n_down; i++) {
+      if (strcmp(S(node->down[i]), S(var)) == 0)
+        return 0;
+    }
+  }
+
+  /* traverse further into the tree. */
+  for (int i = 0; i < node->n_down; i++) {
+    if (!inplace_scan(node->down[i], var))
+      return 0;
+  }
+
+  /* no aliases were found. */
+  return 1;
+}
+
+/* inplace_target(): determine whether the value of a matte ast-node is
+ * assigned into a variable whose current value may be overwritten by
+ * the assigned value. only unaliased local variables, and variables of
+ * the root that are not declared global elsewhere, are overwritten.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  matte ast-node of the assigned variable, or null if the current value
+ *  of the variable may not be overwritten.
+ */
+static AST inplace_target (AST node) {
+  /* require an assignment into an unindexed variable. */
+  AST up = node->up;
+  if (ast_get_type(up) != (ASTNodeType) T_ASSIGN || up->down[1] != node ||
+      !is_variable(up->down[0]))
+    return NULL;
+
+  /* require a boxed variable that is owned by the current scope. */
+  AST var = up->down[0];
+  const SymbolType stype = ast_get_symbol_type(var);
+  if (stype & (SYMBOL_ARGIN | SYMBOL_STATIC | SYMBOL_TEMP | SYMBOL_SCALAR) ||
+      ((stype & SYMBOL_GLOBAL) && var->sym_table != ast_get_globals(var)))
+    return NULL;
+
+  /* require that the variable is never aliased. */
+  AST root = var;
+  while (root->up)
+    root = root->up;
 
-/* forward declarations: */
-static void write_statements (Compiler c, AST node);
+  return (inplace_scan(root, var) ? var : NULL);
+}
+
+/* same_variable(): check whether two matte ast-nodes reference the same
+ * unindexed variable.
+ *
+ * arguments:
+ *  @a: first matte ast-node to access.
+ *  @b: second matte ast-node to access.
+ *
+ * returns:
+ *  integer indicating whether the nodes reference the same variable.
+ */
+static int same_variable (AST a, AST b) {
+  /* compare the registered symbols of both variables. */
+  return (is_variable(a) && is_variable(b) &&
+          a->sym_table == b->sym_table &&
+          a->sym_index == b->sym_index);
+}
 
 /* write_operation(): write a single operation, or nothing if the specified
  * ast-node is not a supported operation.
@@ -463,8 +1346,65 @@ static int write_operation (Compiler c, AST node) {
     /* check if a match was found. */
     if (ntype == (ASTNodeType) operators[i].tok &&
         node->n_down == operators[i].noper) {
+      /* write operations on unboxed scalars as c expressions. */
+      const char *cstr = operators[i].cstr;
+      if (unboxed(node)) {
+        W("  %s %s = ", unboxed(node) == SYMBOL_LONG ? "long" : "double",
+          S(node));
+
+        if (node->n_down == 1) {
+          /* unary operators. */
+          W("%s", cstr);
+          write_scalar(c, node->down[0]);
+        }
+        else if (cstr[0] == '^') {
+          /* exponentiation. */
+          W("pow(");
+          write_scalar(c, node->down[0]);
+          W(", ");
+          write_scalar(c, node->down[1]);
+          W(")");
+        }
+        else if (cstr[0] == '\\') {
+          /* left division. */
+          write_scalar(c, node->down[1]);
+          W(" / ");
+          write_scalar(c, node->down[0]);
+        }
+        else {
+          /* binary operators. */
+          write_scalar(c, node->down[0]);
+          W(" %s ", cstr);
+          write_scalar(c, node->down[1]);
+        }
+
+        W(";\n");
+        return 1;
+      }
+
+      /* write in-place updates of unaliased variables, which are
+       * either the first operand or a commuting second operand.
+       */
+      const ScannerToken tok = operators[i].tok;
+      AST var = (node->n_down == 2 &&
+                 (tok == T_PLUS || tok == T_MINUS || tok == T_ELEM_MUL) ?
+                 inplace_target(node) : NULL);
+
+      int j = -1;
+      if (var && same_variable(var, node->down[0]))
+        j = 0;
+      else if (var && tok != T_MINUS && same_variable(var, node->down[1]))
+        j = 1;
+
       /* write the operation based on argument count. */
-      if (node->n_down == 1) {
+      if (j >= 0) {
+        /* write an in-place binary operation. */
+        W("  Object %s = %s_inplace(&_z1, %s, %s);\n",
+          S(node), operators[i].fstr,
+          S(node->down[j]),
+          S(node->down[1 - j]));
+      }
+      else if (node->n_down == 1) {
         /* write a unary operation. */
         W("  Object %s = %s(&_z1, %s);\n",
           S(node), operators[i].fstr,
@@ -486,8 +1426,12 @@ static int write_operation (Compiler c, AST node) {
           S(node->down[2]));
       }
 
-      /* write the error handler and return valid. */
+      /* write the error handler and free the operands. */
       E(S(node), node);
+      for (int j = 0; j < node->n_down; j++)
+        write_free(c, node->down[j]);
+
+      /* return valid. */
       return 1;
     }
   }
@@ -496,6 +1440,293 @@ static int write_operation (Compiler c, AST node) {
   return 0;
 }
 
+/* fuse_op(): check whether a matte ast-node holds a boxed element-wise
+ * operation that may be fused with its neighbours into a single loop
+ * over real or complex vector elements.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  integer indicating whether the node is a fusable operation.
+ */
+static int fuse_op (AST node) {
+  /* only boxed operations on temporaries are fused. */
+  const int i = find_operator(node);
+  if (i < 0 || unboxed(node) ||
+      !(ast_get_symbol_type(node) & SYMBOL_TEMP))
+    return 0;
+
+  /* accept addition, subtraction, negation and multiplication. */
+  const ScannerToken tok = operators[i].tok;
+  return (tok == T_PLUS || tok == T_MINUS || tok == T_ELEM_MUL);
+}
+
+/* fuse_leaves(): count the operands of a fusable expression tree, which
+ * are the values consumed by its fusable operations. operands must be
+ * variables, literals or boxed scalars, so that evaluating all of them
+ * before the operations has no observable effect.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  number of operands in the expression tree, or zero if any operand
+ *  cannot be evaluated ahead of the operations.
+ */
+static int fuse_leaves (AST node) {
+  /* sum the operand counts of fusable operations. */
+  if (fuse_op(node)) {
+    int n = 0;
+    for (int i = 0; i < node->n_down; i++) {
+      const int ni = fuse_leaves(node->down[i]);
+      if (!ni)
+        return 0;
+
+      n += ni;
+    }
+
+    return n;
+  }
+
+  /* accept boxed scalars. */
+  if (!node || !node->sym_table || !node->sym_index)
+    return 0;
+  else if (ast_get_type(node) == AST_TYPE_BOX)
+    return 1;
+
+  /* accept literals and unindexed variables. */
+  if ((ast_get_symbol_type(node) & SYMBOL_LITERAL) || is_variable(node))
+    return 1;
+
+  /* all other operands may have side effects. */
+  return 0;
+}
+
+/* fuse_chain(): check whether a matte ast-node holds a chain of at least
+ * two fusable operations over operands that may be evaluated ahead.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  integer indicating whether the node heads a fusable chain.
+ */
+static int fuse_chain (AST node) {
+  /* require a fusable operation. */
+  if (!fuse_op(node))
+    return 0;
+
+  /* require at least one fusable operand. */
+  int nops = 0;
+  for (int i = 0; i < node->n_down; i++)
+    nops += fuse_op(node->down[i]);
+
+  /* require that every operand be fusable. */
+  return (nops && fuse_leaves(node));
+}
+
+/* fuse_root(): check whether a matte ast-node is the outermost operation
+ * of a fusable chain.
+ *
+ * arguments:
+ *  @node: matte ast-node to access.
+ *
+ * returns:
+ *  integer indicating whether the node is the root of a fused loop.
+ */
+static int fuse_root (AST node) {
+  /* require a chain that is not itself part of a larger chain. */
+  return (fuse_chain(node) && !fuse_chain(node->up));
+}
+
+/* write_fused_leaves(): write the operands of a fused expression tree,
+ * in the order in which they appear.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ */
+static void write_fused_leaves (Compiler c, AST node) {
+  /* write operands, and traverse into fusable operations. */
+  if (fuse_op(node)) {
+    for (int i = 0; i < node->n_down; i++)
+      write_fused_leaves(c, node->down[i]);
+  }
+  else
+    write_statements(c, node);
+}
+
+/* write_fused_names(): write the comma-separated list of operand symbol
+ * names of a fused expression tree, or free each operand.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *  @k: pointer to the number of operands written so far.
+ *  @free: whether to free the operands instead of listing them.
+ */
+static void write_fused_names (Compiler c, AST node, int *k, int free) {
+  /* traverse into fusable operations. */
+  if (fuse_op(node)) {
+    for (int i = 0; i < node->n_down; i++)
+      write_fused_names(c, node->down[i], k, free);
+
+    return;
+  }
+
+  /* write or free the operand. */
+  if (free)
+    write_free(c, node);
+  else
+    W("%s%s", (*k)++ ? ", " : "", S(node));
+}
+
+/* write_fused_expr(): write the c expression that computes a single
+ * element of a fused expression tree.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *  @k: pointer to the number of operands written so far.
+ *  @cplx: whether operands may be accessed as complex elements.
+ */
+static void write_fused_expr (Compiler c, AST node, int *k, int cplx) {
+  /* write operands as strided element accesses. */
+  if (!fuse_op(node)) {
+    if (cplx)
+      W("(_g%d ? _g%d[_i * _s%d] : _f%d[_i * _s%d])",
+        *k, *k, *k, *k, *k);
+    else
+      W("_f%d[_i * _s%d]", *k, *k);
+
+    (*k)++;
+    return;
+  }
+
+  /* write operations in fully parenthesized form. */
+  const char *cstr = operators[find_operator(node)].cstr;
+  if (node->n_down == 1) {
+    W("(%s", cstr);
+    write_fused_expr(c, node->down[0], k, cplx);
+    W(")");
+  }
+  else {
+    W("(");
+    write_fused_expr(c, node->down[0], k, cplx);
+    W(" %s ", cstr);
+    write_fused_expr(c, node->down[1], k, cplx);
+    W(")");
+  }
+}
+
+/* write_fused_ops(): write the fallback chain of individual operations
+ * of a fused expression tree, for operands that cannot be fused.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *  @root: root matte ast-node of the fused expression tree.
+ */
+static void write_fused_ops (Compiler c, AST node, AST root) {
+  /* only write operations. */
+  if (!fuse_op(node))
+    return;
+
+  /* write the operations of the operands first. */
+  for (int i = 0; i < node->n_down; i++)
+    write_fused_ops(c, node->down[i], root);
+
+  /* write the operation, declaring all but the root result. */
+  const char *fstr = operators[find_operator(node)].fstr;
+  W("  %s%s = %s(&_z1, %s", node == root ? "" : "Object ",
+    S(node), fstr, S(node->down[0]));
+
+  if (node->n_down == 2)
+    W(", %s", S(node->down[1]));
+
+  W(");\n");
+
+  /* write the error handler and free the operands. */
+  E(S(node), node);
+  for (int i = 0; i < node->n_down; i++)
+    write_free(c, node->down[i]);
+}
+
+/* write_fusion(): write a chain of element-wise operations as a single
+ * loop over vector elements, or nothing if the specified ast-node is not
+ * the root of a fusable chain. a real loop is taken at run-time when
+ * every operand is a real scalar or a real vector of matching size, and
+ * a complex loop when some operands are complex. the individual
+ * operations are written as a fallback for all other operands.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  integer indicating whether the write was performed.
+ */
+static int write_fusion (Compiler c, AST node) {
+  /* accept only the roots of fusable chains. */
+  if (!fuse_root(node))
+    return 0;
+
+  /* write the operand arrays. the result is written over the value of
+   * its assigned variable, when possible.
+   */
+  AST var = inplace_target(node);
+  const int n = fuse_leaves(node);
+  int k = 0;
+  W("  Object %s = NULL;\n  {\n  Object _fa[] = { ", S(node));
+  write_fused_names(c, node, &k, 0);
+  W(" };\n"
+    "  const double *_fp[%d]; long _fi[%d]; double _fv[%d];\n"
+    "  Vector _fr = vector_fuse(&_z1, %s, %d, _fa, _fp, _fi, _fv);\n"
+    "  if (_fr) {\n", n, n, n, var ? S(var) : "NULL", n);
+
+  /* write the fused loop. */
+  for (k = 0; k < n; k++)
+    W("  const double *_f%d = _fp[%d]; const long _s%d = _fi[%d];\n",
+      k, k, k, k);
+
+  k = 0;
+  W("  double *_r = _fr->data;\n"
+    "  for (long _i = 0; _i < _fr->n; _i++)\n"
+    "    _r[_i] = ");
+  write_fused_expr(c, node, &k, 0);
+  W(";\n  %s = (Object) _fr;\n", S(node));
+  write_fused_names(c, node, &k, 1);
+
+  /* write the fused complex loop. */
+  W("  }\n  else {\n"
+    "  const complex double *_fq[%d]; complex double _fw[%d];\n"
+    "  ComplexVector _fc = complex_vector_fuse(&_z1, %s, %d, _fa,"
+    " _fp, _fq, _fi, _fv, _fw);\n"
+    "  if (_fc) {\n", n, n, var ? S(var) : "NULL", n);
+
+  for (k = 0; k < n; k++)
+    W("  const double *_f%d = _fp[%d]; const complex double *_g%d = _fq[%d];"
+      " const long _s%d = _fi[%d];\n", k, k, k, k, k, k);
+
+  k = 0;
+  W("  complex double *_r = _fc->data;\n"
+    "  for (long _i = 0; _i < _fc->n; _i++)\n"
+    "    _r[_i] = ");
+  write_fused_expr(c, node, &k, 1);
+  W(";\n  %s = (Object) _fc;\n", S(node));
+  k = 0;
+  write_fused_names(c, node, &k, 1);
+
+  /* write the fallback operations. */
+  W("  }\n  else {\n");
+  write_fused_ops(c, node, node);
+  W("  }\n  }\n  }\n");
+
+  /* return true. */
+  return 1;
+}
+
 /* write_concat(): write a single concatenation, or nothing if the
  * specified ast-node is not a horzcat() or vertcat().
  *
@@ -518,8 +1749,12 @@ static int write_concat (Compiler c, AST node) {
       W(", %s", S(node->down[i]));
     W(");\n");
 
-    /* write the error handler and return valid. */
+    /* write the error handler and free the operands. */
     E(S(node), node);
+    for (int i = 0; i < node->n_down; i++)
+      write_free(c, node->down[i]);
+
+    /* return valid. */
     return 1;
   }
   else if (ntype == AST_TYPE_COLUMN) {
@@ -529,8 +1764,12 @@ static int write_concat (Compiler c, AST node) {
       W(", %s", S(node->down[i]));
     W(");\n");
 
-    /* write the error handler and return valid. */
+    /* write the error handler and free the operands. */
     E(S(node), node);
+    for (int i = 0; i < node->n_down; i++)
+      write_free(c, node->down[i]);
+
+    /* return valid. */
     return 1;
   }
 
@@ -538,6 +1777,34 @@ static int write_concat (Compiler c, AST node) {
   return 0;
 }
 
+/* write_subsref(): write a single subscripted reference, or nothing if
+ * the specified ast-node is not a reference.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  integer indicating whether the write was performed.
+ */
+static int write_subsref (Compiler c, AST node) {
+  /* accept only subscripted reference nodes. */
+  if (ast_get_type(node) != AST_TYPE_SUBSREF)
+    return 0;
+
+  /* write the reference. */
+  W("  Object %s = object_subsref(&_z1, %s, %s);\n", S(node),
+    S(node->down[0]), S(node->down[1]));
+
+  /* write the error handler and free the operands. */
+  E(S(node), node);
+  write_free(c, node->down[0]);
+  write_free(c, node->down[1]);
+
+  /* return valid. */
+  return 1;
+}
+
 /* write_assign(): write a single assignment, or nothing if the
  * specified ast-node is not an assignment statement.
  *
@@ -557,7 +1824,15 @@ static int write_assign (Compiler c, AST node) {
     return 0;
 
   /* assign based on scope. */
-  if (ast_has_global_symbol(node))
+  if (unboxed(node)) {
+    W("  %s = ", S(node));
+    write_scalar(c, node->down[1]);
+    W(";\n");
+  }
+  else if (ast_has_global_symbol(node) && inplace_target(node->down[1]))
+    W("  if (%s != %s) %s = object_copy(&_zg, %s);\n",
+      S(node), S(node->down[1]), S(node), S(node->down[1]));
+  else if (ast_has_global_symbol(node))
     W("  %s = object_copy(&_zg, %s);\n", S(node), S(node->down[1]));
   else
     W("  %s = %s;\n", S(node), S(node->down[1]));
@@ -635,6 +1910,17 @@ static int write_call (Compiler c, AST node) {
   W("  object_free(&_z1, _ai);\n");
   W("  object_free(&_z1, _ao);\n");
 
+  /* write code to free any temporary arguments. */
+  if (ntype == AST_TYPE_FN_CALL) {
+    down = node->down[1];
+    if (down->n_down == 1 &&
+        ast_get_type(down->down[0]) == (ASTNodeType) T_PAREN_OPEN) {
+      down = down->down[0];
+      for (i = 0; i < down->n_down; i++)
+        write_free(c, down->down[i]);
+    }
+  }
+
   /* return true. */
   return 1;
 }
@@ -722,16 +2008,22 @@ static int write_if (Compiler c, AST node, int i) {
   if (expr) {
     /* write the current condition evaluation. */
     write_statements(c, expr);
-    W("  if (object_true(%s)) {\n", S(expr));
+    W(unboxed(expr) ? "  if (%s) {\n" : "  if (object_true(%s)) {\n",
+      S(expr));
+    write_free(c, expr);
     write_statements(c, stmts);
     W("  }\n");
 
-    /* return if no further conditions exist. */
-    if (node->n_down == i + 2)
+    /* return if no further conditions exist, and the condition
+     * requires no freeing.
+     */
+    if (node->n_down == i + 2 &&
+        (!(ast_get_symbol_type(expr) & SYMBOL_TEMP) || unboxed(expr)))
       return 1;
 
     /* write the next condition evaluations. */
     W("  else {\n");
+    write_free(c, expr);
     write_if(c, node, i + 2);
     W("  }\n");
   }
@@ -770,7 +2062,9 @@ static int write_switch (Compiler c, AST node, int i) {
   /* upon entering the switch, evaluate its expression. */
   if (i == 0) {
     write_statements(c, expr);
-    return write_switch(c, node, 1);
+    write_switch(c, node, 1);
+    write_free(c, expr);
+    return 1;
   }
 
   /* check what type of node we're processing. */
@@ -779,6 +2073,7 @@ static int write_switch (Compiler c, AST node, int i) {
     write_statements(c, value);
     W("  _sw = object_eq(&_z1, %s, %s);\n", S(expr), S(value));
     E("_sw", value);
+    write_free(c, value);
     W("  if (object_true(_sw)) {\n"
       "  object_free(&_z1, _sw);\n");
     write_statements(c, stmts);
@@ -799,6 +2094,153 @@ static int write_switch (Compiler c, AST node, int i) {
   return 1;
 }
 
+/* loop_depth(): return the number of loops that enclose a matte ast-node,
+ * including the node itself. this is used to name the zone mark of each
+ * loop body.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *
+ * returns:
+ *  nesting depth of the loop node.
+ */
+static int loop_depth (AST node) {
+  /* count the loop nodes up the tree. */
+  int depth = 0;
+  for (AST up = node; up; up = up->up) {
+    if (ast_get_type(up) == (ASTNodeType) T_FOR ||
+        ast_get_type(up) == (ASTNodeType) T_WHILE ||
+        ast_get_type(up) == (ASTNodeType) T_UNTIL)
+      depth++;
+  }
+
+  /* return the depth. */
+  return depth;
+}
+
+/* loop_add_var(): add the variable of a matte ast-node into an array of
+ * variable names, if it is a local variable and not yet in the array.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *  @vars: pointer to the array of variable names.
+ *  @n: pointer to the number of variable names.
+ */
+static void loop_add_var (AST node, const char ***vars, int *n) {
+  /* skip nodes without symbols, temporaries, globals and unboxed
+   * scalars, which do not live in the zone.
+   */
+  const char *name = S(node);
+  if (!name || name[0] == '_' || ast_has_global_symbol(node) ||
+      unboxed(node))
+    return;
+
+  /* skip variables that are already in the array. */
+  for (int i = 0; i < *n; i++) {
+    if (strcmp((*vars)[i], name) == 0)
+      return;
+  }
+
+  /* append the variable name. */
+  const char **vnew = (const char**)
+    realloc(*vars, (*n + 1) * sizeof(const char*));
+
+  if (!vnew)
+    return;
+
+  vnew[(*n)++] = name;
+  *vars = vnew;
+}
+
+/* loop_find_vars(): find all local variables that are assigned within
+ * a matte ast-node sub-tree.
+ *
+ * arguments:
+ *  @node: matte ast-node to process.
+ *  @vars: pointer to the array of variable names.
+ *  @n: pointer to the number of variable names.
+ */
+static void loop_find_vars (AST node, const char ***vars, int *n) {
+  /* get the current node type. */
+  const ASTNodeType ntype = ast_get_type(node);
+
+  /* add the variables assigned by the current node. */
+  if (ntype == (ASTNodeType) T_ASSIGN) {
+    /* assignments. */
+    loop_add_var(node, vars, n);
+  }
+  else if (ntype == (ASTNodeType) T_FOR) {
+    /* iteration variables of nested loops. */
+    loop_add_var(node->down[0], vars, n);
+  }
+  else if (ntype == (ASTNodeType) T_TRY) {
+    /* catch variables. */
+    loop_add_var(node->down[1], vars, n);
+  }
+  else if (ntype == AST_TYPE_FN_CALL) {
+    /* function call outputs. */
+    AST down = node->down[0];
+    if (ast_get_type(down) == (ASTNodeType) T_IDENT)
+      loop_add_var(down, vars, n);
+    else if (ast_get_type(down) == AST_TYPE_ROW) {
+      for (int i = 0; i < down->n_down; i++)
+        loop_add_var(down->down[i], vars, n);
+    }
+  }
+
+  /* recurse into the child nodes. */
+  for (int i = 0; i < node->n_down; i++)
+    loop_find_vars(node->down[i], vars, n);
+}
+
+/* write_mark(): write a zone mark ahead of a loop body. all temporaries
+ * allocated after the mark are released at the end of each iteration.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @loop: matte ast-node of the loop.
+ */
+static void write_mark (Compiler c, AST loop) {
+  /* write the mark. */
+  W("  ZoneMark _zm%d = zone_mark(&_z1);\n", loop_depth(loop));
+}
+
+/* write_release(): write code that releases the temporaries of a loop
+ * body back to its zone mark. the values of all variables assigned in
+ * the loop body are first promoted past the mark, so they survive.
+ *
+ * arguments:
+ *  @c: matte compiler to utilize.
+ *  @loop: matte ast-node of the loop.
+ */
+static void write_release (Compiler c, AST loop) {
+  /* get the mark index and the loop body. */
+  const int depth = loop_depth(loop);
+  const ScannerToken ntok = (ScannerToken) ast_get_type(loop);
+  AST stmts = (ntok == T_FOR ? loop->down[2] :
+               ntok == T_WHILE ? loop->down[1] : loop->down[0]);
+
+  /* find every variable assigned in the loop body. */
+  const char **vars = NULL;
+  int n = 0;
+  loop_find_vars(stmts, &vars, &n);
+
+  /* write the promotions, which are performed together so that each
+   * object shared by several variables is only promoted once.
+   */
+  if (n) {
+    W("  {\n  void *_zv[] = { ");
+    for (int i = 0; i < n; i++)
+      W("%s&%s", i ? ", " : "", vars[i]);
+
+    W(" };\n  zone_promote_vars(&_z1, _zm%d, %d, _zv);\n  }\n", depth, n);
+  }
+
+  /* write the release. */
+  W("  zone_release(&_z1, _zm%d);\n", depth);
+  free(vars);
+}
+
 /* write_for(): write a for-statement block, or nothing if the specified
  * ast-node is not a for loop.
  *
@@ -822,24 +2264,67 @@ static int write_for (Compiler c, AST node) {
   AST expr = node->down[1];
   AST stmts = node->down[2];
 
+  /* check if the iteration variable is unboxed. */
+  if (unboxed(var)) {
+    /* evaluate the range bounds, which are held fixed. */
+    W("  {\n");
+    for (int i = 0; i < expr->n_down; i++)
+      write_statements(c, expr->down[i]);
+
+    W("  const long _rb = ");
+    write_scalar(c, expr->down[0]);
+    W(", _rs = ");
+    write_scalar(c, expr->down[1]);
+    W(", _re = ");
+    write_scalar(c, expr->down[2]);
+    W(";\n");
+
+    /* count the iterations, so that negative steps are supported. */
+    W("  const long _rd = _re - _rb;\n");
+    W("  const long _rn = (!_rs || (_rd > 0 && _rs < 0) ||"
+      " (_rd < 0 && _rs > 0) ? 0 : _rd / _rs + 1);\n");
+
+    /* write a counted c loop, releasing its temporaries. */
+    write_mark(c, node);
+    W("  for (long _rk = 0, _ri = _rb; _rk < _rn; _rk++, _ri += _rs) {\n");
+    W("  %s = _ri;\n", S(var));
+    write_statements(c, stmts);
+    write_release(c, node);
+    W("  }\n  }\n");
+
+    /* return true. */
+    return 1;
+  }
+
   /* evaluate the iteration expression. */
   write_statements(c, expr);
 
-  /* create an iterator from the evaluated expression. */
-  W("  _it = (Object) iter_new(&_z1, %s);\n", S(expr));
+  /* create an iterator from the evaluated expression. the iterator
+   * is scoped to the loop, so that nested loops do not clobber it.
+   */
+  W("  {\n");
+  W("  Object _it = (Object) iter_new(&_z1, %s);\n", S(expr));
   E("_it", var);
 
   /* write the loop head and variable assignment. */
+  W("  ZoneMark _zm%d = 0;\n", loop_depth(node));
   W("  while (iter_next(%s, (Iter) _it)) {\n", itzone);
   W("  %s = iter_get_value((Iter) _it);\n", S(var));
   E(S(var), var);
 
-  /* write the body of the loop. */
+  /* place the mark once the iteration value has been allocated. */
+  W("  if (!_zm%d) _zm%d = zone_mark(&_z1);\n",
+    loop_depth(node), loop_depth(node));
+
+  /* write the body of the loop, releasing its temporaries. */
   write_statements(c, stmts);
+  write_release(c, node);
   W("  }\n");
 
-  /* write code to free the iterator. */
+  /* write code to free the iterator and its expression. */
   W("  object_free(&_z1, _it);\n");
+  write_free(c, expr);
+  W("  }\n");
 
   /* return true. */
   return 1;
@@ -863,12 +2348,19 @@ static int write_while (Compiler c, AST node) {
   AST expr = node->down[0];
   AST stmts = node->down[1];
 
-  /* write the while block. */
+  /* write the while block, releasing its temporaries. the block
+   * is enclosed in a scope of its own, which holds the zone mark.
+   */
+  W("  {\n");
+  write_mark(c, node);
   W("  while (1) {\n");
   write_statements(c, expr);
-  W("  if (!object_true(%s)) break;\n", S(expr));
+  W(unboxed(expr) ? "  if (!(%s)) break;\n" :
+                    "  if (!object_true(%s)) break;\n", S(expr));
+  write_free(c, expr);
   write_statements(c, stmts);
-  W("  }\n");
+  write_release(c, node);
+  W("  }\n  }\n");
 
   /* return true. */
   return 1;
@@ -892,12 +2384,19 @@ static int write_until (Compiler c, AST node) {
   AST stmts = node->down[0];
   AST expr = node->down[1];
 
-  /* write the do-until block. */
+  /* write the do-until block, releasing its temporaries. the block
+   * is enclosed in a scope of its own, which holds the zone mark.
+   */
+  W("  {\n");
+  write_mark(c, node);
   W("  while (1) {\n");
   write_statements(c, stmts);
   write_statements(c, expr);
-  W("  if (object_true(%s)) break;\n", S(expr));
-  W("  }\n");
+  W(unboxed(expr) ? "  if (%s) break;\n" :
+                    "  if (object_true(%s)) break;\n", S(expr));
+  write_free(c, expr);
+  write_release(c, node);
+  W("  }\n  }\n");
 
   /* return true. */
   return 1;
@@ -933,7 +2432,8 @@ static int write_flow (Compiler c, AST node) {
     if (!loop)
       asterr(node, ERR_OUTSIDE_LOOP, scanner_token_get_name(ntok));
 
-    /* write a simple break and return. */
+    /* release the loop temporaries and break. */
+    write_release(c, loop);
     W("  break;\n");
   }
   else if (ntok == T_CONTINUE) {
@@ -941,7 +2441,8 @@ static int write_flow (Compiler c, AST node) {
     if (!loop)
       asterr(node, ERR_OUTSIDE_LOOP, scanner_token_get_name(ntok));
 
-    /* write a simple continue and return. */
+    /* release the loop temporaries and continue. */
+    write_release(c, loop);
     W("  continue;\n");
   }
   else if (ntok == T_RETURN) {
@@ -964,14 +2465,27 @@ static void write_display (Compiler c, AST node) {
   /* return if the node should not be displayed. */
   if (!node->node_disp) return;
 
-  /* otherwise, write the display method. */
+  /* box unboxed values into a scoped object for display. */
+  const char *obj = S(node);
+  if (unboxed(node)) {
+    W("  {\n  Object _d = (Object) %s(&_z1, %s);\n",
+      unboxed(node) == SYMBOL_LONG ? "int_new_with_value" :
+                                     "float_new_with_value", obj);
+    obj = "_d";
+  }
+
+  /* write the display method. */
   W("  if (!object_display(&_z1, %s, \"%s\")) {\n"
     "    Exception _e = (Exception) exceptions_get(_z0);\n"
     "    except_add_call(_z0, _e, \"%s\", \"%s\", %ld);\n"
     "    return (Object) _e;\n"
-    "  }\n", S(node),
+    "  }\n", obj,
     ast_get_symbol_type(node) & SYMBOL_TEMP ? "ans" : S(node),
     node->fname, ast_get_func(node), node->line);
+
+  /* free the boxed value. */
+  if (unboxed(node))
+    W("  object_free(&_z1, _d);\n  }\n");
 }
 
 /* write_statements(): write a statement or statement list.
@@ -1006,6 +2520,10 @@ static void write_statements (Compiler c, AST node) {
     /* functions and class definitions: do not traverse. */
     return;
   }
+  else if (fuse_root(node)) {
+    /* fused operations: traverse only the operands. */
+    write_fused_leaves(c, node);
+  }
   else if (write_try(c, node) ||
            write_if(c, node, 0) ||
            write_switch(c, node, 0) ||
@@ -1022,13 +2540,20 @@ static void write_statements (Compiler c, AST node) {
   }
 
   /* write the statement based on its node type. */
-  if (write_operation(c, node) ||
+  if (write_fusion(c, node) ||
+      write_operation(c, node) ||
+      write_box(c, node) ||
       write_concat(c, node) ||
+      write_subsref(c, node) ||
       write_assign(c, node) ||
       write_call(c, node) ||
       write_flow(c, node)) {
     /* write a display handler, if necessary. */
     write_display(c, node);
+
+    /* free the values of expression statements. */
+    if (node->up && ast_get_type(node->up) == AST_TYPE_STATEMENTS)
+      write_free(c, node);
   }
 }
 
@@ -1058,12 +2583,41 @@ static void write_symbols (Compiler c, Symbols syms) {
          symbol_has_type(syms, i, SYMBOL_GLOBAL | SYMBOL_TEMP))
      continue;
 
-    /* write the variable symbol. */
-    W("  Object %s = NULL;\n", symbol_name(syms, i));
+    /* write the variable symbol, unboxed or not. */
+    if (symbol_has_type(syms, i, SYMBOL_LONG))
+      W("  long %s = 0L;\n", symbol_name(syms, i));
+    else if (symbol_has_type(syms, i, SYMBOL_DOUBLE))
+      W("  double %s = 0.0;\n", symbol_name(syms, i));
+    else
+      W("  Object %s = NULL;\n", symbol_name(syms, i));
   }
 
-  /* loop again to write all literals. */
+  /* loop again to declare all literals. the literals are held in static
+   * storage, so that they are only constructed once per program.
+   */
   W("\n");
+  long n_lit = 0;
+  for (long i = 0; i < syms->n; i++) {
+    /* do not write global symbols. */
+    if (symbol_has_type(syms, i, SYMBOL_GLOBAL) ||
+        !symbol_has_type(syms, i, SYMBOL_LITERAL))
+      continue;
+
+    /* write the literal declaration. */
+    W("  static Object %s = NULL;\n", symbol_name(syms, i));
+    n_lit++;
+  }
+
+  /* return if no literals require construction. */
+  if (!n_lit)
+    return;
+
+  /* construct the literals into the locked literal zone on first use. */
+  W("  static bool _lit = false;\n"
+    "  if (!_lit) {\n"
+    "  initialize();\n");
+
+  /* loop again to write all literals. */
   for (long i = 0; i < syms->n; i++) {
     /* do not write global symbols. */
     if (symbol_has_type(syms, i, SYMBOL_GLOBAL)) continue;
@@ -1071,31 +2625,34 @@ static void write_symbols (Compiler c, Symbols syms) {
     /* write based on type. */
     if (symbol_has_type(syms, i, SYMBOL_INT)) {
       /* integer literal. */
-      W("  Object %s = (Object) int_new_with_value(&_z1, %ldL);\n",
+      W("  %s = (Object) int_new_with_value(&_zl, %ldL);\n",
         symbol_name(syms, i),
         symbol_int(syms, i));
     }
     else if (symbol_has_type(syms, i, SYMBOL_FLOAT)) {
       /* float literal. */
-      W("  Object %s = (Object) float_new_with_value(&_z1, %le);\n",
+      W("  %s = (Object) float_new_with_value(&_zl, %le);\n",
         symbol_name(syms, i),
         symbol_float(syms, i));
     }
     else if (symbol_has_type(syms, i, SYMBOL_COMPLEX)) {
       /* complex literal. */
-      W("  Object %s = (Object) \n"
-        "    complex_new_with_value(&_z1, %le + %le * I);\n",
+      W("  %s = (Object) \n"
+        "    complex_new_with_value(&_zl, %le + %le * I);\n",
         symbol_name(syms, i),
         creal(symbol_complex(syms, i)),
         cimag(symbol_complex(syms, i)));
     }
     else if (symbol_has_type(syms, i, SYMBOL_STRING)) {
       /* string literal. */
-      W("  Object %s = (Object) string_new_with_value(&_z1, %s);\n",
+      W("  %s = (Object) string_new_with_value(&_zl, %s);\n",
         symbol_name(syms, i),
         symbol_string(syms, i));
     }
   }
+
+  W("  _lit = true;\n"
+    "  }\n");
 }
 
 /* write_globals(): write all global declarations.
@@ -1126,11 +2683,11 @@ static void write_globals (Compiler c) {
 
   /* write the variable declarations. */
   W("\n"
-    "ZoneData _zg;\n"
+    "ZoneData _zg, _zl;\n"
     "bool _zg_init = false;\n\n");
   for (i = 0; i < gs->n; i++) {
     if (!symbol_has_type(gs, i, SYMBOL_VAR) ||
-         symbol_has_type(gs, i, SYMBOL_TEMP))
+         symbol_has_type(gs, i, SYMBOL_TEMP | SYMBOL_SCALAR))
       continue;
 
     /* write the global variable declaration. */
@@ -1142,9 +2699,11 @@ static void write_globals (Compiler c) {
     "void initialize (void) {\n"
     "  if (_zg_init) return;\n"
     "  zone_init(&_zg, %ld);\n"
+    "  zone_init(&_zl, %ld);\n"
+    "  zone_lock(&_zl);\n"
     "  _zg_init = true;\n"
     "}\n\n",
-    gs->n);
+    gs->n, gs->n);
 }
 
 /* write_functions(): write all user-defined functions.
@@ -1181,16 +2740,16 @@ static void write_functions (Compiler c) {
       "wrap:\n");
     down = node->down[0];
     if (!down) {
-      W("  argout = object_list_argout(_z0, 0);\n");
+      W("  argout = object_list_argout(_z0, &_z1, 0);\n");
     }
     else if (down->n_down) {
-      W("  argout = object_list_argout(_z0, %d", down->n_down);
+      W("  argout = object_list_argout(_z0, &_z1, %d", down->n_down);
       for (j = 0; j < down->n_down; j++)
         W(", %s", ast_get_string(down->down[j]));
       W(");\n");
     }
     else {
-      W("  argout = object_list_argout(_z0, 1, %s);\n", S(down));
+      W("  argout = object_list_argout(_z0, &_z1, 1, %s);\n", S(down));
     }
 
     W("  object_free_all(&_z1);\n"
@@ -1354,7 +2913,7 @@ static int compile_to_exe (Compiler c) {
   close(fd);
 
   /* build the compilation command string. */
-  string_appendf(cc, "gcc %s %s -o %s -lmatte\n",
+  string_appendf(cc, "gcc %s %s -o %s -lmatte -lm\n",
                  string_get_value(c->cflags), ftmp,
                  string_get_value(c->fout));
 
@@ -1413,7 +2972,7 @@ static int compile_to_mem (Compiler c) {
   close(fdc);
 
   /* build the compilation command string. */
-  string_appendf(cc, "gcc %s -fPIC -shared -o %s %s -lmatte\n",
+  string_appendf(cc, "gcc %s -fPIC -shared -o %s %s -lmatte -lm\n",
                  string_get_value(c->cflags), ftmpx, ftmpc);
 
   /* execute the system command. */
@@ -1737,6 +3296,14 @@ int compiler_execute (Compiler c) {
   if (!resolve_symbols(c, c->tree))
     return 0;
 
+  /* infer which variables may be held as unboxed scalars. */
+  if (!infer_symbols(c, c->tree))
+    return 0;
+
+  /* check that each temporary has a single consumer. */
+  if (!check_temps(c, c->tree))
+    return 0;
+
   /* write global symbols and functions. */
   write_globals(c);
   write_functions(c);
@@ -1807,6 +3374,11 @@ struct _ObjectType Compiler_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
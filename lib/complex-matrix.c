@@ -3,9 +3,16 @@
  * Released under the MIT License
  */
 
-/* include the complex matrix and exception headers. */
+/* include the complex matrix, exception, blas, broadcast, subscript,
+ * transpose and split headers.
+ */
 #include <matte/complex-matrix.h>
 #include <matte/except.h>
+#include <matte/blas.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+#include <matte/transpose.h>
+#include <matte/split.h>
 
 /* include headers for inferior types. */
 #include <matte/int.h>
@@ -15,6 +22,25 @@
 #include <matte/vector.h>
 #include <matte/matrix.h>
 #include <matte/complex-vector.h>
+#include <matte/logical.h>
+
+/* ROWS(), COLS(): macros to get the row and column counts of a complex
+ * matrix, accounting for its transposition status.
+ */
+#define ROWS(A) ((A)->tr == CblasNoTrans ? (A)->m : (A)->n)
+#define COLS(A) ((A)->tr == CblasNoTrans ? (A)->n : (A)->m)
+
+/* RE(), IM(): macros to get the real and imaginary parts of the elements
+ * of a complex matrix in split storage.
+ */
+#define RE(A) SPLIT_RE((A)->data)
+#define IM(A) SPLIT_IM((A)->data, (A)->m * (A)->n)
+
+/* ELEM(): macro to get an element of a complex matrix by its index into
+ * the matrix data, in either storage layout.
+ */
+#define ELEM(A,k) ((A)->split ? \
+  split_get((A)->data, (A)->m * (A)->n, k) : (A)->data[k])
 
 /* complex_matrix_type(): return a pointer to the complex matrix object type.
  */
@@ -42,6 +68,8 @@ ComplexMatrix complex_matrix_new (Zone z, Object args) {
   A->data = NULL;
   A->m = 0;
   A->n = 0;
+  A->tr = CblasNoTrans;
+  A->split = 0;
 
   /* return the new matrix. */
   return A;
@@ -83,12 +111,16 @@ ComplexMatrix complex_matrix_new_from_matrix (Zone z, Matrix A) {
   for (long i = 0; i < len; i++)
     B->data[i] = (complex double) A->data[i];
 
+  /* copy the transposition status. */
+  B->tr = A->tr;
+
   /* return the new complex matrix. */
   return B;
 }
 
 /* complex_matrix_copy(): allocate a new matte complex matrix from
- * another matte complex matrix.
+ * another matte complex matrix. the duplicate shares the data buffer
+ * of the input matrix until either of them is modified.
  *
  * arguments:
  *  @z: zone allocator to utilize.
@@ -104,13 +136,15 @@ ComplexMatrix complex_matrix_copy (Zone z, ComplexMatrix A) {
 
   /* allocate a new complex matrix. */
   ComplexMatrix Anew = complex_matrix_new(z, NULL);
-  if (!Anew || complex_matrix_set_size(Anew, A->m, A->n))
+  if (!Anew)
     return NULL;
 
-  /* copy the memory contents of the input matrix into the duplicate. */
-  const long bytes = Anew->m * Anew->n * sizeof(complex double);
-  if (bytes)
-    memcpy(Anew->data, A->data, bytes);
+  /* share the data buffer of the input matrix with the duplicate. */
+  Anew->data = (complex double*) buffer_share(A->data);
+  Anew->m = A->m;
+  Anew->n = A->n;
+  Anew->tr = A->tr;
+  Anew->split = A->split;
 
   /* return the new matrix. */
   return Anew;
@@ -131,15 +165,38 @@ ComplexMatrix complex_matrix_copy_trans (Zone z, ComplexMatrix A) {
   if (!A)
     return NULL;
 
-  /* allocate a new matrix of the same size. */
+  /* transposed matrices already store the elements of their transpose,
+   * which may be shared with the duplicate unless they are conjugated.
+   */
+  if (A->tr != CblasNoTrans) {
+    ComplexMatrix Anew = complex_matrix_copy(z, A);
+    if (!Anew)
+      return NULL;
+
+    Anew->tr = CblasNoTrans;
+    if (A->tr == CblasConjTrans && !complex_matrix_conj(Anew)) {
+      object_free(z, Anew);
+      return NULL;
+    }
+
+    return Anew;
+  }
+
+  /* allocate a new matrix of the transposed size. */
   ComplexMatrix Anew = complex_matrix_new_with_size(z, A->n, A->m);
   if (!Anew)
     return NULL;
 
-  /* copy the memory contents of the input matrix into the duplicate. */
-  for (long i = 0; i < A->m; i++)
-    for (long j = 0; j < A->n; j++)
-      complex_matrix_set(Anew, j, i, complex_matrix_get(A, i, j));
+  /* store the transposed elements of the input matrix, transposing
+   * each part of split matrices as a real matrix.
+   */
+  if (A->split) {
+    transpose_d(A->m, A->n, RE(A), RE(Anew));
+    transpose_d(A->m, A->n, IM(A), IM(Anew));
+    Anew->split = 1;
+  }
+  else
+    transpose_z(A->m, A->n, A->data, Anew->data, 0);
 
   /* return the new complex matrix. */
   return Anew;
@@ -157,8 +214,8 @@ void complex_matrix_delete (Zone z, ComplexMatrix A) {
   if (!A)
     return;
 
-  /* free the matrix data. */
-  free(A->data);
+  /* release the matrix data. */
+  buffer_release(A->data);
 }
 
 /* complex_matrix_get_rows(): get the row count of a matte complex matrix.
@@ -212,9 +269,21 @@ long complex_matrix_get_length (ComplexMatrix A) {
  *  requested matrix element.
  */
 inline complex double complex_matrix_get (ComplexMatrix A, long i, long j) {
-  /* if the pointer and indices are valid, return the element. */
-  if (A && i < A->m && j < A->n)
-    return A->data[i + j * A->m];
+  /* return null if the pointer is invalid. */
+  if (!A)
+    return 0.0;
+
+  /* swap the indices of transposed matrices, and conjugate the
+   * elements of conjugate-transposed matrices.
+   */
+  if (A->tr != CblasNoTrans) {
+    if (j < A->m && i < A->n) {
+      const complex double aji = ELEM(A, j + i * A->m);
+      return (A->tr == CblasConjTrans ? conj(aji) : aji);
+    }
+  }
+  else if (i < A->m && j < A->n)
+    return ELEM(A, i + j * A->m);
 
   /* return zero. */
   return 0.0;
@@ -231,9 +300,13 @@ inline complex double complex_matrix_get (ComplexMatrix A, long i, long j) {
  *  requested matrix element.
  */
 inline complex double complex_matrix_get_element (ComplexMatrix A, long i) {
+  /* access transposed matrices by their row and column indices. */
+  if (A && A->tr != CblasNoTrans && A->n)
+    return complex_matrix_get(A, i % A->n, i / A->n);
+
   /* if the pointer and index are valid, return the element. */
   if (A && i < A->m * A->n)
-    return A->data[i];
+    return ELEM(A, i);
 
   /* return zero. */
   return 0.0;
@@ -295,20 +368,23 @@ int complex_matrix_set_size (ComplexMatrix A, long m, long n) {
   if (A->m == m && A->n == n)
     return 1;
 
-  /* compute the current and new allocation requirements. */
-  const long bytes = A->m * A->n * sizeof(complex double);
-  const long newbytes = m * n * sizeof(complex double);
+  /* resize split matrices in interleaved storage. */
+  if (!complex_matrix_interleave(A))
+    return 0;
 
-  /* reallocate the complex matrix data. */
-  A->data = (complex double*) realloc(A->data, newbytes);
-  if (!A->data)
-    fail(ERR_BAD_ALLOC);
+  /* compute the new number of matrix elements. */
+  const long len = m * n;
+
+  /* reallocate the complex matrix data, zeroing any new elements. */
+  complex double *data = (complex double*)
+    buffer_resize(A->data, A->m * A->n, len, sizeof(complex double));
 
-  /* fill the new trailing elements with zeros. */
-  if (newbytes > bytes)
-    memset(A->data + bytes, 0, newbytes - bytes);
+  /* check if reallocation failed. */
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
 
-  /* store the new matrix dimensions. */
+  /* store the new matrix data and dimensions. */
+  A->data = data;
   A->m = m;
   A->n = n;
 
@@ -316,7 +392,172 @@ int complex_matrix_set_size (ComplexMatrix A, long m, long n) {
   return 1;
 }
 
-/* complex_matrix_set(): set an element of a matte complex matrix.
+/* complex_matrix_unshare(): ensure that the data of a matte complex matrix is not
+ * shared with any other complex matrix, so that it may be modified in place.
+ *
+ * arguments:
+ *  @A: matte complex matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_matrix_unshare (ComplexMatrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the matrix data if it is held by other matrices. */
+  const long len = A->m * A->n;
+  complex double *data = (complex double*)
+    buffer_unshare(A->data, len, sizeof(complex double));
+
+  /* check if the copy failed. */
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared matrix data and return success. */
+  A->data = data;
+  return 1;
+}
+
+/* complex_matrix_untranspose(): ensure that the elements of a matte
+ * complex matrix are stored in untransposed order, so that they may be
+ * accessed directly. the transposition status of the matrix is cleared.
+ *
+ * arguments:
+ *  @A: matte complex matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_matrix_untranspose (ComplexMatrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the matrix is not transposed. */
+  if (A->tr == CblasNoTrans)
+    return 1;
+
+  /* transpose square matrices in place, unless their elements are
+   * shared with other matrices.
+   */
+  const int cj = (A->tr == CblasConjTrans);
+  if (A->m == A->n && !buffer_is_shared(A->data)) {
+    A->tr = CblasNoTrans;
+    if (!A->split) {
+      transpose_z_inplace(A->m, A->data, cj);
+      return 1;
+    }
+
+    /* transpose each part of split matrices as a real matrix. */
+    transpose_d_inplace(A->m, RE(A));
+    transpose_d_inplace(A->m, IM(A));
+    return (!cj || complex_matrix_conj(A));
+  }
+
+  /* allocate a new buffer for the transposed elements. */
+  const long len = A->m * A->n;
+  complex double *data = (complex double*)
+    buffer_resize(NULL, 0, len, sizeof(complex double));
+
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the transposed elements. */
+  if (A->split) {
+    transpose_d(A->m, A->n, RE(A), SPLIT_RE(data));
+    transpose_d(A->m, A->n, IM(A), SPLIT_IM(data, len));
+  }
+  else
+    transpose_z(A->m, A->n, A->data, data, cj);
+
+  /* replace the matrix data and dimensions. */
+  buffer_release(A->data);
+  A->data = data;
+  const long m = A->m;
+  A->m = A->n;
+  A->n = m;
+  A->tr = CblasNoTrans;
+
+  /* conjugate split matrices after their transposition. */
+  return (!A->split || !cj || complex_matrix_conj(A));
+}
+
+/* complex_matrix_split(): ensure that the elements of a matte complex
+ * matrix are held in split storage.
+ *
+ * arguments:
+ *  @A: matte complex matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_matrix_split (ComplexMatrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the matrix is already split. */
+  if (A->split)
+    return 1;
+
+  /* allocate a new buffer for the split elements. */
+  const long len = A->m * A->n;
+  complex double *data = (complex double*)
+    buffer_resize(NULL, 0, len, sizeof(complex double));
+
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the split elements and replace the matrix data. */
+  split_deinterleave(len, A->data, SPLIT_RE(data), SPLIT_IM(data, len));
+  buffer_release(A->data);
+  A->data = data;
+  A->split = 1;
+
+  /* return success. */
+  return 1;
+}
+
+/* complex_matrix_interleave(): ensure that the elements of a matte
+ * complex matrix are held in interleaved storage, as required by blas.
+ *
+ * arguments:
+ *  @A: matte complex matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_matrix_interleave (ComplexMatrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the matrix is not split. */
+  if (!A->split)
+    return 1;
+
+  /* allocate a new buffer for the interleaved elements. */
+  const long len = A->m * A->n;
+  complex double *data = (complex double*)
+    buffer_resize(NULL, 0, len, sizeof(complex double));
+
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the interleaved elements and replace the matrix data. */
+  split_interleave(len, RE(A), IM(A), data);
+  buffer_release(A->data);
+  A->data = data;
+  A->split = 0;
+
+  /* return success. */
+  return 1;
+}
+
+/* complex_matrix_set(): set an element of a matte complex matrix. the
+ * matrix data must not be shared, see complex_matrix_unshare().
  *
  * arguments:
  *  @A: matte complex matrix to modify.
@@ -326,9 +567,25 @@ int complex_matrix_set_size (ComplexMatrix A, long m, long n) {
  */
 inline void complex_matrix_set (ComplexMatrix A, long i, long j,
                                 complex double aij) {
+  /* swap the indices of transposed matrices, and conjugate the
+   * elements of conjugate-transposed matrices.
+   */
+  if (A && A->tr != CblasNoTrans) {
+    const long k = i;
+    i = j;
+    j = k;
+
+    if (A->tr == CblasConjTrans)
+      aij = conj(aij);
+  }
+
   /* if the pointer and indices are valid, set the element. */
-  if (A && i < A->m && j < A->n)
-    A->data[i + j * A->m] = aij;
+  if (A && i < A->m && j < A->n) {
+    if (A->split)
+      split_set(A->data, A->m * A->n, i + j * A->m, aij);
+    else
+      A->data[i + j * A->m] = aij;
+  }
 }
 
 /* complex_matrix_set_element(): set an element of a matte complex
@@ -341,9 +598,19 @@ inline void complex_matrix_set (ComplexMatrix A, long i, long j,
  */
 inline void complex_matrix_set_element (ComplexMatrix A, long i,
                                         complex double ai) {
+  /* access transposed matrices by their row and column indices. */
+  if (A && A->tr != CblasNoTrans && A->n) {
+    complex_matrix_set(A, i % A->n, i / A->n, ai);
+    return;
+  }
+
   /* if the pointer and index are valid, set the element. */
-  if (A && i < A->m * A->n)
-    A->data[i] = ai;
+  if (A && i < A->m * A->n) {
+    if (A->split)
+      split_set(A->data, A->m * A->n, i, ai);
+    else
+      A->data[i] = ai;
+  }
 }
 
 /* complex_matrix_conj(): conjugate the elements of a matte complex matrix.
@@ -359,8 +626,20 @@ int complex_matrix_conj (ComplexMatrix A) {
   if (!A)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the matrix data may be modified. */
+  if (!complex_matrix_unshare(A))
+    return 0;
+
   /* conjugate every element of the matrix. */
   const long len = A->m * A->n;
+  if (A->split) {
+    double *im = IM(A);
+    for (long i = 0; i < len; i++)
+      im[i] = -im[i];
+
+    return 1;
+  }
+
   for (long i = 0; i < len; i++)
     A->data[i] = conj(A->data[i]);
 
@@ -372,10 +651,12 @@ int complex_matrix_conj (ComplexMatrix A) {
  */
 int complex_matrix_disp (Zone z, ComplexMatrix A) {
   /* print the matrix contents. */
+  const long m = (A->tr == CblasNoTrans ? A->m : A->n);
+  const long n = (A->tr == CblasNoTrans ? A->n : A->m);
   printf("\n");
-  for (long i = 0; i < A->m; i++) {
+  for (long i = 0; i < m; i++) {
     printf("\n");
-    for (long j = 0; j < A->n; j++) {
+    for (long j = 0; j < n; j++) {
       const complex double cij = complex_matrix_get(A, i, j);
       const double re = creal(cij);
       const double im = cimag(cij);
@@ -391,22 +672,333 @@ int complex_matrix_disp (Zone z, ComplexMatrix A) {
 }
 
 /* complex_matrix_ctranspose(): conjugate transposition function for
- * matte complex matrices.
+ * matte complex matrices. the transposed matrix shares the data of its
+ * operand, unless the operand is already transposed.
  */
 ComplexMatrix complex_matrix_ctranspose (Zone z, ComplexMatrix A) {
-  ComplexMatrix Atr = complex_matrix_copy_trans(z, A);
+  ComplexMatrix Atr = complex_matrix_copy(z, A);
   if (!Atr)
     return NULL;
 
-  complex_matrix_conj(Atr);
+  switch (A->tr) {
+    case CblasNoTrans: Atr->tr = CblasConjTrans; break;
+    case CblasConjTrans: Atr->tr = CblasNoTrans; break;
+    case CblasTrans:
+      Atr->tr = CblasNoTrans;
+      if (!complex_matrix_conj(Atr))
+        return NULL;
+      break;
+    default: break;
+  }
+
   return Atr;
 }
 
 /* complex_matrix_transpose(): matrix transposition function for
- * matte complex matrices.
+ * matte complex matrices. the transposed matrix shares the data of its
+ * operand, unless the operand is conjugate-transposed.
  */
 ComplexMatrix complex_matrix_transpose (Zone z, ComplexMatrix A) {
-  return complex_matrix_copy_trans(z, A);
+  ComplexMatrix Atr = complex_matrix_copy(z, A);
+  if (!Atr)
+    return NULL;
+
+  switch (A->tr) {
+    case CblasNoTrans: Atr->tr = CblasTrans; break;
+    case CblasTrans: Atr->tr = CblasNoTrans; break;
+    case CblasConjTrans:
+      Atr->tr = CblasNoTrans;
+      if (!complex_matrix_conj(Atr))
+        return NULL;
+      break;
+    default: break;
+  }
+
+  return Atr;
+}
+
+/* complex_matrix_fill_lower(): copy the conjugated upper triangle of
+ * a square matte complex matrix into its lower triangle, as required
+ * after hermitian rank-k updates.
+ *
+ * arguments:
+ *  @A: matte complex matrix to modify.
+ */
+static void complex_matrix_fill_lower (ComplexMatrix A) {
+  for (long j = 0; j < A->n; j++)
+    for (long i = j + 1; i < A->m; i++)
+      A->data[i + j * A->m] = conj(A->data[j + i * A->m]);
+}
+
+/* complex_matrix_mtimes(): matrix multiplication function for complex
+ * matrices. real matrix operands are promoted, the transposition status
+ * of each operand is passed to blas, and products of a matrix with its
+ * own conjugate transpose are computed by a hermitian rank-k update.
+ */
+Object complex_matrix_mtimes (Zone z, Object a, Object b) {
+  /* complex matrix * scalar => complex matrix
+   * scalar * complex matrix => complex matrix
+   */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a) ||
+      IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_times(z, a, b);
+
+  /* only matrix operands are supported. */
+  if (!(IS_COMPLEX_MATRIX(a) || IS_MATRIX(a)) ||
+      !(IS_COMPLEX_MATRIX(b) || IS_MATRIX(b)))
+    throw(z, ERR_OBJ_BINARY, "mtimes",
+          MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+
+  /* promote real matrix operands. */
+  ComplexMatrix A = (IS_MATRIX(a) ?
+    complex_matrix_new_from_matrix(z, (Matrix) a) : (ComplexMatrix) a);
+  ComplexMatrix B = (IS_MATRIX(b) ?
+    complex_matrix_new_from_matrix(z, (Matrix) b) : (ComplexMatrix) b);
+
+  /* compute the product. */
+  ComplexMatrix C = NULL;
+  if (!A || !B) {
+    /* promotion failed. */
+  }
+  else if (COLS(A) != ROWS(B)) {
+    /* operand sizes do not conform. */
+    error(ERR_SIZE_MISMATCH_MM(A->tr, B->tr, A, B));
+  }
+  else if (A->data == B->data && A->m == B->m && A->n == B->n &&
+           ((A->tr == CblasNoTrans && B->tr == CblasConjTrans) ||
+            (A->tr == CblasConjTrans && B->tr == CblasNoTrans))) {
+    /* X' * X => hermitian matrix
+     * X * X' => hermitian matrix
+     */
+    C = complex_matrix_new_with_size(z, ROWS(A), ROWS(A));
+    if (C && matte_zherk(CblasUpper, A->tr, 1.0, A, 0.0, C))
+      complex_matrix_fill_lower(C);
+    else
+      C = NULL;
+  }
+  else {
+    /* complex matrix * complex matrix => complex matrix */
+    C = complex_matrix_new_with_size(z, ROWS(A), COLS(B));
+    if (C && !matte_zgemm(A->tr, B->tr, 1.0, A, B, 0.0, C))
+      C = NULL;
+  }
+
+  /* free any promoted operands. */
+  if (A && (Object) A != a) object_free(z, A);
+  if (B && (Object) B != b) object_free(z, B);
+
+  /* return the product, or any raised exception. */
+  return (C ? (Object) C : exceptions_get(z));
+}
+
+/* complex_matrix_plus_inplace(): in-place addition function for matte
+ * complex matrices.
+ */
+int complex_matrix_plus_inplace (Zone z, ComplexMatrix A, Object b) {
+  /* leave transposed matrices to the broadcasting engine. */
+  if (A->tr != CblasNoTrans)
+    return 0;
+
+  const long len = A->m * A->n;
+  if (IS_COMPLEX_MATRIX(b)) {
+    /* complex matrix += complex matrix */
+    ComplexMatrix B = (ComplexMatrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != CblasNoTrans ||
+        !complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split && B->split) {
+      split_axpy(len, 1.0, RE(B), IM(B), RE(A), IM(A));
+      return 1;
+    }
+
+    if (!complex_matrix_interleave(A) || !complex_matrix_interleave(B))
+      return 0;
+
+    for (long i = 0; i < len; i++)
+      A->data[i] += B->data[i];
+
+    return 1;
+  }
+  else if (IS_MATRIX(b)) {
+    /* complex matrix += matrix */
+    Matrix B = (Matrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != CblasNoTrans ||
+        !complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split) {
+      split_axpy(len, 1.0, B->data, NULL, RE(A), IM(A));
+      return 1;
+    }
+
+    for (long i = 0; i < len; i++)
+      A->data[i] += B->data[i];
+
+    return 1;
+  }
+  else if (IS_COMPLEX(b) || IS_FLOAT(b) || IS_INT(b)) {
+    /* complex matrix += scalar */
+    const complex double f =
+      (IS_COMPLEX(b) ? complex_get_value((Complex) b) :
+       IS_FLOAT(b) ? float_get_value((Float) b) :
+                     (double) int_get_value((Int) b));
+
+    if (!complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split) {
+      split_shift(len, f, RE(A), IM(A));
+      return 1;
+    }
+
+    for (long i = 0; i < len; i++)
+      A->data[i] += f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* complex_matrix_minus_inplace(): in-place subtraction function for matte
+ * complex matrices.
+ */
+int complex_matrix_minus_inplace (Zone z, ComplexMatrix A, Object b) {
+  /* leave transposed matrices to the broadcasting engine. */
+  if (A->tr != CblasNoTrans)
+    return 0;
+
+  const long len = A->m * A->n;
+  if (IS_COMPLEX_MATRIX(b)) {
+    /* complex matrix -= complex matrix */
+    ComplexMatrix B = (ComplexMatrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != CblasNoTrans ||
+        !complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split && B->split) {
+      split_axpy(len, -1.0, RE(B), IM(B), RE(A), IM(A));
+      return 1;
+    }
+
+    if (!complex_matrix_interleave(A) || !complex_matrix_interleave(B))
+      return 0;
+
+    for (long i = 0; i < len; i++)
+      A->data[i] -= B->data[i];
+
+    return 1;
+  }
+  else if (IS_MATRIX(b)) {
+    /* complex matrix -= matrix */
+    Matrix B = (Matrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != CblasNoTrans ||
+        !complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split) {
+      split_axpy(len, -1.0, B->data, NULL, RE(A), IM(A));
+      return 1;
+    }
+
+    for (long i = 0; i < len; i++)
+      A->data[i] -= B->data[i];
+
+    return 1;
+  }
+  else if (IS_COMPLEX(b) || IS_FLOAT(b) || IS_INT(b)) {
+    /* complex matrix -= scalar */
+    const complex double f =
+      (IS_COMPLEX(b) ? complex_get_value((Complex) b) :
+       IS_FLOAT(b) ? float_get_value((Float) b) :
+                     (double) int_get_value((Int) b));
+
+    if (!complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split) {
+      split_shift(len, -f, RE(A), IM(A));
+      return 1;
+    }
+
+    for (long i = 0; i < len; i++)
+      A->data[i] -= f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* complex_matrix_times_inplace(): in-place element-wise multiplication
+ * function for matte complex matrices.
+ */
+int complex_matrix_times_inplace (Zone z, ComplexMatrix A, Object b) {
+  /* leave transposed matrices to the broadcasting engine. */
+  if (A->tr != CblasNoTrans)
+    return 0;
+
+  const long len = A->m * A->n;
+  if (IS_COMPLEX_MATRIX(b)) {
+    /* complex matrix .*= complex matrix */
+    ComplexMatrix B = (ComplexMatrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != CblasNoTrans ||
+        !complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split && B->split) {
+      split_mul(len, RE(B), IM(B), RE(A), IM(A));
+      return 1;
+    }
+
+    if (!complex_matrix_interleave(A) || !complex_matrix_interleave(B))
+      return 0;
+
+    for (long i = 0; i < len; i++)
+      A->data[i] *= B->data[i];
+
+    return 1;
+  }
+  else if (IS_MATRIX(b)) {
+    /* complex matrix .*= matrix */
+    Matrix B = (Matrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != CblasNoTrans ||
+        !complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split) {
+      split_mul(len, B->data, NULL, RE(A), IM(A));
+      return 1;
+    }
+
+    for (long i = 0; i < len; i++)
+      A->data[i] *= B->data[i];
+
+    return 1;
+  }
+  else if (IS_COMPLEX(b) || IS_FLOAT(b) || IS_INT(b)) {
+    /* complex matrix .*= scalar */
+    const complex double f =
+      (IS_COMPLEX(b) ? complex_get_value((Complex) b) :
+       IS_FLOAT(b) ? float_get_value((Float) b) :
+                     (double) int_get_value((Int) b));
+
+    if (!complex_matrix_unshare(A))
+      return 0;
+
+    if (A->split) {
+      split_scal(len, f, RE(A), IM(A));
+      return 1;
+    }
+
+    for (long i = 0; i < len; i++)
+      A->data[i] *= f;
+
+    return 1;
+  }
+
+  return 0;
 }
 
 /* ComplexMatrix_type: object type structure for matte complex matrices.
@@ -422,25 +1014,25 @@ struct _ObjectType ComplexMatrix_type = {
   (obj_display)     complex_matrix_disp,         /* fn_disp   */
   NULL,                                          /* fn_true   */
 
-  NULL,                                          /* fn_plus       */
-  NULL,                                          /* fn_minus      */
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
   NULL,                                          /* fn_uminus     */
-  NULL,                                          /* fn_times      */
-  NULL,                                          /* fn_mtimes     */
-  NULL,                                          /* fn_rdivide    */
-  NULL,                                          /* fn_ldivide    */
+  (obj_binary)   broadcast_times,                /* fn_times      */
+  (obj_binary)   complex_matrix_mtimes,          /* fn_mtimes     */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
   NULL,                                          /* fn_mrdivide   */
   NULL,                                          /* fn_mldivide   */
-  NULL,                                          /* fn_power      */
+  (obj_binary)   broadcast_power,                /* fn_power      */
   NULL,                                          /* fn_mpower     */
-  NULL,                                          /* fn_lt         */
-  NULL,                                          /* fn_gt         */
-  NULL,                                          /* fn_le         */
-  NULL,                                          /* fn_ge         */
-  NULL,                                          /* fn_ne         */
-  NULL,                                          /* fn_eq         */
-  NULL,                                          /* fn_and        */
-  NULL,                                          /* fn_or         */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
   NULL,                                          /* fn_mand       */
   NULL,                                          /* fn_mor        */
   NULL,                                          /* fn_not        */
@@ -449,10 +1041,15 @@ struct _ObjectType ComplexMatrix_type = {
   (obj_unary)    complex_matrix_transpose,       /* fn_transpose  */
   NULL,                                          /* fn_horzcat    */
   NULL,                                          /* fn_vertcat    */
-  NULL,                                          /* fn_subsref    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  (obj_inplace)  complex_matrix_plus_inplace,    /* fn_plus_inplace  */
+  (obj_inplace)  complex_matrix_minus_inplace,   /* fn_minus_inplace */
+  (obj_inplace)  complex_matrix_times_inplace,   /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
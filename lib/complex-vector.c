@@ -3,10 +3,15 @@
  * Released under the MIT License
  */
 
-/* include the complex vector, exception and blas headers. */
+/* include the complex vector, exception, blas, broadcast, subscript
+ * and split headers.
+ */
 #include <matte/complex-vector.h>
 #include <matte/except.h>
 #include <matte/blas.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+#include <matte/split.h>
 
 /* include headers for inferior types. */
 #include <matte/int.h>
@@ -15,10 +20,17 @@
 #include <matte/complex.h>
 #include <matte/vector.h>
 #include <matte/matrix.h>
+#include <matte/logical.h>
 
 /* include headers for superior types. */
 #include <matte/complex-matrix.h>
 
+/* RE(), IM(): macros to get the real and imaginary parts of the elements
+ * of a complex vector in split storage.
+ */
+#define RE(x) SPLIT_RE((x)->data)
+#define IM(x) SPLIT_IM((x)->data, (x)->n)
+
 /* complex_vector_type(): return a pointer to the complex vector object type.
  */
 ObjectType complex_vector_type (void) {
@@ -45,8 +57,9 @@ ComplexVector complex_vector_new (Zone z, Object args) {
   x->data = NULL;
   x->n = 0;
 
-  /* initialize the transposition state. */
+  /* initialize the transposition state and storage layout. */
   x->tr = CblasNoTrans;
+  x->split = 0;
 
   /* return the new vector. */
   return x;
@@ -104,7 +117,8 @@ ComplexVector complex_vector_new_from_range (Zone z, Range r) {
 }
 
 /* complex_vector_new_from_vector(): allocate a new matte complex vector
- * from a matte vector.
+ * from a matte vector. the new vector is held in split storage, so that
+ * its real parts are a plain copy of the input elements.
  *
  * arguments:
  *  @z: zone allocator to utilize.
@@ -123,16 +137,21 @@ ComplexVector complex_vector_new_from_vector (Zone z, Vector x) {
   if (!y)
     return NULL;
 
-  /* copy the real data into the complex array. */
+  /* copy the real data into the real parts, leaving the imaginary
+   * parts at zero.
+   */
+  y->split = 1;
+  double *re = RE(y);
   for (long i = 0; i < x->n; i++)
-    y->data[i] = (complex double) x->data[i];
+    re[i] = x->data[i];
 
   /* return the new complex vector. */
   return y;
 }
 
 /* complex_vector_copy(): allocate a new matte complex vector from
- * another matte complex vector.
+ * another matte complex vector. the duplicate shares the data buffer
+ * of the input vector until either of them is modified.
  *
  * arguments:
  *  @z: zone allocator to utilize.
@@ -148,15 +167,16 @@ ComplexVector complex_vector_copy (Zone z, ComplexVector x) {
 
   /* allocate a new complex vector. */
   ComplexVector xnew = complex_vector_new(z, NULL);
-  if (!xnew || !complex_vector_set_length(xnew, x->n))
+  if (!xnew)
     return NULL;
 
-  /* copy the memory contents of the input vector into the duplicate. */
-  if (xnew->n)
-    memcpy(xnew->data, x->data, xnew->n * sizeof(complex double));
+  /* share the data buffer of the input vector with the duplicate. */
+  xnew->data = (complex double*) buffer_share(x->data);
+  xnew->n = x->n;
 
-  /* copy the transposition state. */
+  /* copy the transposition state and storage layout. */
   xnew->tr = x->tr;
+  xnew->split = x->split;
 
   /* return the new vector. */
   return xnew;
@@ -174,8 +194,8 @@ void complex_vector_delete (Zone z, ComplexVector x) {
   if (!x)
     return;
 
-  /* free the vector data. */
-  free(x->data);
+  /* release the vector data. */
+  buffer_release(x->data);
 }
 
 /* complex_vector_get_length(): get the length of a matte complex vector.
@@ -203,7 +223,7 @@ long complex_vector_get_length (ComplexVector x) {
 inline complex double complex_vector_get (ComplexVector x, long i) {
   /* if the pointer and index are valid, return the element. */
   if (x && i < x->n)
-    return x->data[i];
+    return (x->split ? split_get(x->data, x->n, i) : x->data[i]);
 
   /* return zero. */
   return 0.0;
@@ -227,27 +247,126 @@ int complex_vector_set_length (ComplexVector x, long n) {
   if (x->n == n)
     return 1;
 
-  /* reallocate the complex vector data. */
-  x->data = (complex double*)
-    realloc(x->data, n * sizeof(complex double));
+  /* resize split vectors in interleaved storage. */
+  if (!complex_vector_interleave(x))
+    return 0;
+
+  /* reallocate the complex vector data, zeroing any new elements. */
+  complex double *data = (complex double*)
+    buffer_resize(x->data, x->n, n, sizeof(complex double));
 
   /* check if reallocation failed. */
-  if (!x->data)
+  if (n && !data)
     fail(ERR_BAD_ALLOC);
 
-  /* fill the new trailing elements with zeros. */
-  const long excess = (n - x->n) * sizeof(complex double);
-  if (n > x->n)
-    memset(x->data + x->n, 0, excess);
-
-  /* store the new vector length. */
+  /* store the new vector data and length. */
+  x->data = data;
   x->n = n;
 
   /* return success. */
   return 1;
 }
 
-/* complex_vector_set(): set an element of a matte complex vector.
+/* complex_vector_unshare(): ensure that the data of a matte complex
+ * vector is not shared with any other complex vector, so that it may
+ * be modified in place.
+ *
+ * arguments:
+ *  @x: matte complex vector to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_vector_unshare (ComplexVector x) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the vector data if it is held by other vectors. */
+  complex double *data = (complex double*)
+    buffer_unshare(x->data, x->n, sizeof(complex double));
+
+  /* check if the copy failed. */
+  if (x->n && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared vector data and return success. */
+  x->data = data;
+  return 1;
+}
+
+/* complex_vector_split(): ensure that the elements of a matte complex
+ * vector are held in split storage.
+ *
+ * arguments:
+ *  @x: matte complex vector to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_vector_split (ComplexVector x) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the vector is already split. */
+  if (x->split)
+    return 1;
+
+  /* allocate a new buffer for the split elements. */
+  complex double *data = (complex double*)
+    buffer_resize(NULL, 0, x->n, sizeof(complex double));
+
+  if (x->n && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the split elements and replace the vector data. */
+  split_deinterleave(x->n, x->data, SPLIT_RE(data), SPLIT_IM(data, x->n));
+  buffer_release(x->data);
+  x->data = data;
+  x->split = 1;
+
+  /* return success. */
+  return 1;
+}
+
+/* complex_vector_interleave(): ensure that the elements of a matte
+ * complex vector are held in interleaved storage, as required by blas.
+ *
+ * arguments:
+ *  @x: matte complex vector to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int complex_vector_interleave (ComplexVector x) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the vector is not split. */
+  if (!x->split)
+    return 1;
+
+  /* allocate a new buffer for the interleaved elements. */
+  complex double *data = (complex double*)
+    buffer_resize(NULL, 0, x->n, sizeof(complex double));
+
+  if (x->n && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the interleaved elements and replace the vector data. */
+  split_interleave(x->n, RE(x), IM(x), data);
+  buffer_release(x->data);
+  x->data = data;
+  x->split = 0;
+
+  /* return success. */
+  return 1;
+}
+
+/* complex_vector_set(): set an element of a matte complex vector. the
+ * vector data must not be shared, see complex_vector_unshare().
  *
  * arguments:
  *  @x: matte complex vector to modify.
@@ -257,8 +376,12 @@ int complex_vector_set_length (ComplexVector x, long n) {
 inline void complex_vector_set (ComplexVector x, long i,
                                 complex double xi) {
   /* if the pointer and index are valid, set the element. */
-  if (x && i < x->n)
-    x->data[i] = xi;
+  if (x && i < x->n) {
+    if (x->split)
+      split_set(x->data, x->n, i, xi);
+    else
+      x->data[i] = xi;
+  }
 }
 
 /* complex_vector_add_const(): add a constant value to a matte
@@ -276,7 +399,16 @@ int complex_vector_add_const (ComplexVector x, complex double f) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!complex_vector_unshare(x))
+    return 0;
+
   /* add the constant to every element of the vector. */
+  if (x->split) {
+    split_shift(x->n, f, RE(x), IM(x));
+    return 1;
+  }
+
   for (long i = 0; i < x->n; i++)
     x->data[i] += f;
 
@@ -299,6 +431,10 @@ int complex_vector_const_div (complex double f, ComplexVector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data is interleaved and may be modified. */
+  if (!complex_vector_interleave(x) || !complex_vector_unshare(x))
+    return 0;
+
   /* divide the constant by every element of the vector. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = f / x->data[i];
@@ -322,6 +458,10 @@ int complex_vector_pow_const (ComplexVector x, complex double f) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data is interleaved and may be modified. */
+  if (!complex_vector_interleave(x) || !complex_vector_unshare(x))
+    return 0;
+
   /* raise every element of the vector to the constant power. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = cpow(x->data[i], f);
@@ -345,6 +485,10 @@ int complex_vector_const_pow (complex double f, ComplexVector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data is interleaved and may be modified. */
+  if (!complex_vector_interleave(x) || !complex_vector_unshare(x))
+    return 0;
+
   /* raise every element of the vector to the constant power. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = cpow(f, x->data[i]);
@@ -366,9 +510,16 @@ int complex_vector_negate (ComplexVector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
-  /* negate every element of the vector. */
-  for (long i = 0; i < x->n; i++)
-    x->data[i] = -(x->data[i]);
+  /* ensure that the vector data may be modified. */
+  if (!complex_vector_unshare(x))
+    return 0;
+
+  /* negate both parts of every element of the vector, which does not
+   * depend on the storage layout.
+   */
+  double *px = (double*) x->data;
+  for (long i = 0; i < 2 * x->n; i++)
+    px[i] = -px[i];
 
   /* return success. */
   return 1;
@@ -387,7 +538,19 @@ int complex_vector_conj (ComplexVector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!complex_vector_unshare(x))
+    return 0;
+
   /* conjugate every element of the vector. */
+  if (x->split) {
+    double *im = IM(x);
+    for (long i = 0; i < x->n; i++)
+      im[i] = -im[i];
+
+    return 1;
+  }
+
   for (long i = 0; i < x->n; i++)
     x->data[i] = conj(x->data[i]);
 
@@ -395,6 +558,105 @@ int complex_vector_conj (ComplexVector x) {
   return 1;
 }
 
+/* complex_vector_fuse(): prepare the operands of a fused element-wise
+ * expression over complex vectors. every operand must be either a real
+ * or complex scalar or a real or complex vector of one common length and
+ * orientation, and at least one operand must be a vector. each operand
+ * is accessed through exactly one of a real and a complex element
+ * pointer, and the other pointer is null. complex vector operands are
+ * first placed in interleaved storage.
+ *
+ * the result may be written over an existing complex vector, as in
+ * vector_fuse().
+ *
+ * arguments:
+ *  @z: zone allocator to allocate the result from.
+ *  @out: unaliased object to reuse for the result, or null.
+ *  @n: number of operands.
+ *  @args: array of operands.
+ *  @ptr: output array of real operand element pointers.
+ *  @cptr: output array of complex operand element pointers.
+ *  @inc: output array of operand element increments.
+ *  @val: output array of real scalar operand values.
+ *  @cval: output array of complex scalar operand values.
+ *
+ * returns:
+ *  newly allocated complex vector to hold the result of the expression,
+ *  or null if the operands cannot be fused.
+ */
+ComplexVector complex_vector_fuse (Zone z, Object out, int n, Object *args,
+                                   const double **ptr,
+                                   const complex double **cptr,
+                                   long *inc, double *val,
+                                   complex double *cval) {
+  /* check each operand, keeping the last vector length and orientation. */
+  long len = -1;
+  int tr = 0;
+  for (int i = 0; i < n; i++) {
+    ptr[i] = NULL;
+    cptr[i] = NULL;
+    inc[i] = 0;
+
+    if (IS_VECTOR(args[i]) || IS_COMPLEX_VECTOR(args[i])) {
+      /* vector operand: check the length and orientation. */
+      const long ni = (IS_VECTOR(args[i]) ? ((Vector) args[i])->n :
+                                            ((ComplexVector) args[i])->n);
+      const int tri = (IS_VECTOR(args[i]) ? (int) ((Vector) args[i])->tr :
+                                            ((ComplexVector) args[i])->tr);
+      if (len >= 0 && (ni != len || tri != tr))
+        return NULL;
+
+      /* access the elements with unit increments. */
+      if (IS_VECTOR(args[i])) {
+        ptr[i] = ((Vector) args[i])->data;
+      }
+      else {
+        if (!complex_vector_interleave((ComplexVector) args[i]))
+          return NULL;
+
+        cptr[i] = ((ComplexVector) args[i])->data;
+      }
+
+      inc[i] = 1;
+      len = ni;
+      tr = tri;
+    }
+    else if (IS_FLOAT(args[i]) || IS_INT(args[i])) {
+      /* real scalar operand: store the value. */
+      val[i] = (IS_FLOAT(args[i]) ?
+                float_get_value((Float) args[i]) :
+                (double) int_get_value((Int) args[i]));
+
+      ptr[i] = val + i;
+    }
+    else if (IS_COMPLEX(args[i])) {
+      /* complex scalar operand: store the value. */
+      cval[i] = complex_get_value((Complex) args[i]);
+      cptr[i] = cval + i;
+    }
+    else
+      return NULL;
+  }
+
+  /* fail if no vector operands were found. */
+  if (len < 0)
+    return NULL;
+
+  /* reuse the output vector if its size matches the operands. */
+  ComplexVector y = (ComplexVector) out;
+  if (IS_COMPLEX_VECTOR(y) && y->n == len && y->tr == tr &&
+      (!z || !zone_is_locked(y)) && complex_vector_interleave(y) &&
+      complex_vector_unshare(y))
+    return y;
+
+  /* allocate the result vector, in the orientation of the operands. */
+  y = complex_vector_new_with_length(z, len);
+  if (y)
+    y->tr = tr;
+
+  return y;
+}
+
 /* complex_vector_disp(): display function for matte complex vectors.
  */
 int complex_vector_disp (Zone z, ComplexVector x) {
@@ -436,7 +698,8 @@ ComplexVector complex_vector_ctranspose (Zone z, ComplexVector a) {
 }
 
 /* complex_vector_transpose(): matrix transposition function for
- * matte complex vectors.
+ * matte complex vectors. the transposed vector shares the data of
+ * its operand.
  */
 ComplexVector complex_vector_transpose (Zone z, ComplexVector a) {
   ComplexVector atr = complex_vector_copy(z, a);
@@ -457,6 +720,15 @@ ComplexVector complex_vector_transpose (Zone z, ComplexVector a) {
  * complex vectors.
  */
 ComplexVector complex_vector_uminus (Zone z, ComplexVector a) {
+  /* negate split vectors without leaving split storage. */
+  if (a->split) {
+    ComplexVector aneg = complex_vector_copy(z, a);
+    if (!aneg || !complex_vector_negate(aneg))
+      return NULL;
+
+    return aneg;
+  }
+
   ComplexVector aneg = complex_vector_new_with_length(z, a->n);
   if (!matte_zaxpy(-1.0, a, aneg))
     return NULL;
@@ -465,6 +737,168 @@ ComplexVector complex_vector_uminus (Zone z, ComplexVector a) {
   return aneg;
 }
 
+/* complex_vector_plus_inplace(): in-place addition function for matte
+ * complex vectors.
+ */
+int complex_vector_plus_inplace (Zone z, ComplexVector a, Object b) {
+  if (IS_COMPLEX_VECTOR(b)) {
+    /* complex vector += complex vector */
+    ComplexVector vb = (ComplexVector) b;
+    if (vb == a || vb->n != a->n || vb->tr != a->tr ||
+        !complex_vector_unshare(a))
+      return 0;
+
+    if (a->split && vb->split) {
+      split_axpy(a->n, 1.0, RE(vb), IM(vb), RE(a), IM(a));
+      return 1;
+    }
+
+    return matte_zaxpy(1.0, vb, a);
+  }
+  else if (IS_VECTOR(b)) {
+    /* complex vector += vector */
+    Vector vb = (Vector) b;
+    if (vb->n != a->n || (int) vb->tr != a->tr ||
+        !complex_vector_unshare(a))
+      return 0;
+
+    if (a->split) {
+      split_axpy(a->n, 1.0, vb->data, NULL, RE(a), IM(a));
+      return 1;
+    }
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] += vb->data[i];
+
+    return 1;
+  }
+  else if (IS_COMPLEX(b)) {
+    /* complex vector += complex */
+    return complex_vector_add_const(a, complex_get_value((Complex) b));
+  }
+  else if (IS_FLOAT(b)) {
+    /* complex vector += float */
+    return complex_vector_add_const(a, float_get_value((Float) b));
+  }
+  else if (IS_INT(b)) {
+    /* complex vector += int */
+    return complex_vector_add_const(a, (double) int_get_value((Int) b));
+  }
+
+  return 0;
+}
+
+/* complex_vector_minus_inplace(): in-place subtraction function for matte
+ * complex vectors.
+ */
+int complex_vector_minus_inplace (Zone z, ComplexVector a, Object b) {
+  if (IS_COMPLEX_VECTOR(b)) {
+    /* complex vector -= complex vector */
+    ComplexVector vb = (ComplexVector) b;
+    if (vb == a || vb->n != a->n || vb->tr != a->tr ||
+        !complex_vector_unshare(a))
+      return 0;
+
+    if (a->split && vb->split) {
+      split_axpy(a->n, -1.0, RE(vb), IM(vb), RE(a), IM(a));
+      return 1;
+    }
+
+    return matte_zaxpy(-1.0, vb, a);
+  }
+  else if (IS_VECTOR(b)) {
+    /* complex vector -= vector */
+    Vector vb = (Vector) b;
+    if (vb->n != a->n || (int) vb->tr != a->tr ||
+        !complex_vector_unshare(a))
+      return 0;
+
+    if (a->split) {
+      split_axpy(a->n, -1.0, vb->data, NULL, RE(a), IM(a));
+      return 1;
+    }
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] -= vb->data[i];
+
+    return 1;
+  }
+  else if (IS_COMPLEX(b)) {
+    /* complex vector -= complex */
+    return complex_vector_add_const(a, -complex_get_value((Complex) b));
+  }
+  else if (IS_FLOAT(b)) {
+    /* complex vector -= float */
+    return complex_vector_add_const(a, -float_get_value((Float) b));
+  }
+  else if (IS_INT(b)) {
+    /* complex vector -= int */
+    return complex_vector_add_const(a, (double) -int_get_value((Int) b));
+  }
+
+  return 0;
+}
+
+/* complex_vector_times_inplace(): in-place element-wise multiplication
+ * function for matte complex vectors.
+ */
+int complex_vector_times_inplace (Zone z, ComplexVector a, Object b) {
+  if (IS_COMPLEX_VECTOR(b)) {
+    /* complex vector .*= complex vector */
+    ComplexVector vb = (ComplexVector) b;
+    if (vb->n != a->n || !complex_vector_unshare(a))
+      return 0;
+
+    if (a->split && vb->split) {
+      split_mul(a->n, RE(vb), IM(vb), RE(a), IM(a));
+      return 1;
+    }
+
+    if (!complex_vector_interleave(a) || !complex_vector_interleave(vb))
+      return 0;
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] *= vb->data[i];
+
+    return 1;
+  }
+  else if (IS_VECTOR(b)) {
+    /* complex vector .*= vector */
+    Vector vb = (Vector) b;
+    if (vb->n != a->n || !complex_vector_unshare(a))
+      return 0;
+
+    if (a->split) {
+      split_mul(a->n, vb->data, NULL, RE(a), IM(a));
+      return 1;
+    }
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] *= vb->data[i];
+
+    return 1;
+  }
+  else if (IS_COMPLEX(b) || IS_FLOAT(b) || IS_INT(b)) {
+    /* complex vector .*= scalar */
+    const complex double f =
+      (IS_COMPLEX(b) ? complex_get_value((Complex) b) :
+       IS_FLOAT(b) ? float_get_value((Float) b) :
+                     (double) int_get_value((Int) b));
+
+    if (!complex_vector_unshare(a))
+      return 0;
+
+    if (a->split) {
+      split_scal(a->n, f, RE(a), IM(a));
+      return 1;
+    }
+
+    return matte_zscal(f, a);
+  }
+
+  return 0;
+}
+
 /* ComplexVector_type: object type structure for matte complex vectors.
  */
 struct _ObjectType ComplexVector_type = {
@@ -478,25 +912,25 @@ struct _ObjectType ComplexVector_type = {
   (obj_display)     complex_vector_disp,         /* fn_disp   */
   NULL,                                          /* fn_true   */
 
-  NULL,                                          /* fn_plus       */
-  NULL,                                          /* fn_minus      */
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
   (obj_unary)    complex_vector_uminus,          /* fn_uminus     */
-  NULL,                                          /* fn_times      */
+  (obj_binary)   broadcast_times,                /* fn_times      */
   NULL,                                          /* fn_mtimes     */
-  NULL,                                          /* fn_rdivide    */
-  NULL,                                          /* fn_ldivide    */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
   NULL,                                          /* fn_mrdivide   */
   NULL,                                          /* fn_mldivide   */
-  NULL,                                          /* fn_power      */
+  (obj_binary)   broadcast_power,                /* fn_power      */
   NULL,                                          /* fn_mpower     */
-  NULL,                                          /* fn_lt         */
-  NULL,                                          /* fn_gt         */
-  NULL,                                          /* fn_le         */
-  NULL,                                          /* fn_ge         */
-  NULL,                                          /* fn_ne         */
-  NULL,                                          /* fn_eq         */
-  NULL,                                          /* fn_and        */
-  NULL,                                          /* fn_or         */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
   NULL,                                          /* fn_mand       */
   NULL,                                          /* fn_mor        */
   NULL,                                          /* fn_not        */
@@ -505,10 +939,15 @@ struct _ObjectType ComplexVector_type = {
   (obj_unary)    complex_vector_transpose,       /* fn_transpose  */
   NULL,                                          /* fn_horzcat    */
   NULL,                                          /* fn_vertcat    */
-  NULL,                                          /* fn_subsref    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  (obj_inplace)  complex_vector_plus_inplace,    /* fn_plus_inplace  */
+  (obj_inplace)  complex_vector_minus_inplace,   /* fn_minus_inplace */
+  (obj_inplace)  complex_vector_times_inplace,   /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
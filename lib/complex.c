@@ -11,6 +11,7 @@
 #include <matte/int.h>
 #include <matte/range.h>
 #include <matte/float.h>
+#include <matte/float-range.h>
 
 /* include headers for superior types. */
 #include <matte/vector.h>
@@ -679,8 +680,22 @@ ComplexVector complex_horzcat (Zone z, int n, va_list vl) {
         return NULL;
       }
 
-      for (long elem = r->begin; elem <= r->end; elem += r->step)
-        complex_vector_set(x, ix++, (complex double) elem);
+      for (long k = 0; k < nr; k++)
+        complex_vector_set(x, ix++,
+          (complex double) range_get_element(r, k));
+    }
+    else if (IS_FLOAT_RANGE(obj)) {
+      FloatRange r = (FloatRange) obj;
+      long nr = float_range_get_length(r);
+
+      if (!complex_vector_set_length(x, complex_vector_get_length(x) + nr)) {
+        object_free(z, x);
+        return NULL;
+      }
+
+      for (long k = 0; k < nr; k++)
+        complex_vector_set(x, ix++,
+          (complex double) float_range_get_element(r, k));
     }
     else {
       object_free(z, x);
@@ -766,6 +781,11 @@ struct _ObjectType Complex_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
@@ -0,0 +1,191 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the dispatch header and all matte object headers. */
+#include <matte/dispatch.h>
+#include <matte/matte.h>
+
+/* include the compilation object headers. */
+#include <matte/scanner.h>
+#include <matte/parser.h>
+#include <matte/ast.h>
+#include <matte/symbols.h>
+#include <matte/compiler.h>
+
+/* dispatch_table: binary kernels of every operation and type pair. */
+obj_binary dispatch_table[DISPATCH_OPS][DISPATCH_TYPES][DISPATCH_TYPES];
+
+/* dispatch_types: list of registered object types, by index.
+ * n_types: number of used type indices, including the reserved index.
+ */
+static ObjectType dispatch_types[DISPATCH_TYPES];
+static unsigned int n_types = 1;
+
+/* dispatch_offsets: offsets of the method of each binary operation
+ * within an object type structure.
+ */
+static const size_t dispatch_offsets[DISPATCH_OPS] = {
+  offsetof(struct _ObjectType, fn_plus),
+  offsetof(struct _ObjectType, fn_minus),
+  offsetof(struct _ObjectType, fn_times),
+  offsetof(struct _ObjectType, fn_mtimes),
+  offsetof(struct _ObjectType, fn_rdivide),
+  offsetof(struct _ObjectType, fn_ldivide),
+  offsetof(struct _ObjectType, fn_mrdivide),
+  offsetof(struct _ObjectType, fn_mldivide),
+  offsetof(struct _ObjectType, fn_power),
+  offsetof(struct _ObjectType, fn_mpower),
+  offsetof(struct _ObjectType, fn_lt),
+  offsetof(struct _ObjectType, fn_gt),
+  offsetof(struct _ObjectType, fn_le),
+  offsetof(struct _ObjectType, fn_ge),
+  offsetof(struct _ObjectType, fn_ne),
+  offsetof(struct _ObjectType, fn_eq),
+  offsetof(struct _ObjectType, fn_and),
+  offsetof(struct _ObjectType, fn_or),
+  offsetof(struct _ObjectType, fn_mand),
+  offsetof(struct _ObjectType, fn_mor)
+};
+
+/* DISPATCH_METHOD(): macro to get the method of an object type that
+ * implements a binary operation.
+ */
+#define DISPATCH_METHOD(type, op) \
+  (*((obj_binary*) (((char*) (type)) + dispatch_offsets[op])))
+
+/* dispatch_lookup(): determine the generic method that handles a binary
+ * operation on two object types, based on their precedence.
+ *
+ * arguments:
+ *  @op: binary operation to look up.
+ *  @ta: type of the left operand.
+ *  @tb: type of the right operand.
+ *
+ * returns:
+ *  method of the operand type with the higher precedence, or null if
+ *  that type does not implement the operation.
+ */
+obj_binary dispatch_lookup (DispatchOp op, ObjectType ta, ObjectType tb) {
+  /* the left operand wins precedence ties. */
+  return (ta->precedence >= tb->precedence ?
+          DISPATCH_METHOD(ta, op) :
+          DISPATCH_METHOD(tb, op));
+}
+
+/* dispatch_register_type(): assign a dispatch table index to an object
+ * type, and fill its table entries with the generic methods selected by
+ * type precedence.
+ *
+ * arguments:
+ *  @type: object type to register.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int dispatch_register_type (ObjectType type) {
+  /* validate the input arguments. */
+  if (!type)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the type has already been registered. */
+  if (type->index)
+    return 1;
+
+  /* check that the table has room for the type. */
+  if (n_types == DISPATCH_TYPES)
+    fail(ERR_DISPATCH_FULL, type->name);
+
+  /* assign the next available index to the type. */
+  const unsigned int i = n_types++;
+  dispatch_types[i] = type;
+  type->index = i;
+
+  /* fill the table entries that pair the type with each registered type,
+   * including itself.
+   */
+  for (unsigned int op = 0; op < DISPATCH_OPS; op++) {
+    for (unsigned int j = 1; j <= i; j++) {
+      ObjectType other = dispatch_types[j];
+      dispatch_table[op][i][j] = dispatch_lookup(op, type, other);
+      dispatch_table[op][j][i] = dispatch_lookup(op, other, type);
+    }
+  }
+
+  /* return success. */
+  return 1;
+}
+
+/* dispatch_register(): register a kernel that handles a binary operation
+ * on a specific pair of operand types. the kernel may assume that its
+ * operands have the registered types.
+ *
+ * arguments:
+ *  @op: binary operation implemented by the kernel.
+ *  @ta: type of the left operand.
+ *  @tb: type of the right operand.
+ *  @fn: kernel function to register.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int dispatch_register (DispatchOp op, ObjectType ta, ObjectType tb,
+                       obj_binary fn) {
+  /* validate the input arguments. */
+  if (op >= DISPATCH_OPS || !ta || !tb || !fn)
+    fail(ERR_INVALID_ARGIN);
+
+  /* ensure that both operand types are registered. */
+  if (!dispatch_register_type(ta) || !dispatch_register_type(tb))
+    return 0;
+
+  /* store the kernel and return success. */
+  dispatch_table[op][ta->index][tb->index] = fn;
+  return 1;
+}
+
+/* dispatch_init(): register every object type and specialized kernel
+ * provided by the matte library. called once when the library is loaded.
+ */
+__attribute__((constructor))
+void dispatch_init (void) {
+  /* register the numeric types in order of increasing precedence. */
+  dispatch_register_type(&Int_type);
+  dispatch_register_type(&Range_type);
+  dispatch_register_type(&Float_type);
+  dispatch_register_type(&FloatRange_type);
+  dispatch_register_type(&Complex_type);
+  dispatch_register_type(&Vector_type);
+  dispatch_register_type(&Logical_type);
+  dispatch_register_type(&Int32Array_type);
+  dispatch_register_type(&Int64Array_type);
+  dispatch_register_type(&Matrix_type);
+  dispatch_register_type(&ComplexVector_type);
+  dispatch_register_type(&ComplexMatrix_type);
+  dispatch_register_type(&SingleVector_type);
+  dispatch_register_type(&SingleMatrix_type);
+  dispatch_register_type(&SparseMatrix_type);
+
+  /* register the non-numeric types. */
+  dispatch_register_type(&String_type);
+  dispatch_register_type(&Cell_type);
+  dispatch_register_type(&Struct_type);
+  dispatch_register_type(&ObjectList_type);
+  dispatch_register_type(&Iter_type);
+  dispatch_register_type(&Exception_type);
+
+  /* register the compilation types. */
+  dispatch_register_type(&Scanner_type);
+  dispatch_register_type(&Parser_type);
+  dispatch_register_type(&AST_type);
+  dispatch_register_type(&Symbols_type);
+  dispatch_register_type(&Compiler_type);
+
+  /* register the specialized kernels of each type. */
+  float_register();
+  float_range_register();
+  int32_array_register();
+  int64_array_register();
+}
+
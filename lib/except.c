@@ -412,6 +412,11 @@ struct _ObjectType Exception_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  except_methods                                 /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  except_methods,                                /* methods */
+  0                                              /* index   */
 };
 
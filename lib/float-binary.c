@@ -0,0 +1,50 @@
+
+/* define macros for generating a float arithmetic method.
+ */
+#define CONCAT(a,b)      a ## b
+#define CONCAT3(a,b,c)   a ## b ## c
+#define FUNCTION(name)   CONCAT(float_, name)
+#define KERNEL(name,ab)  CONCAT3(float_, name, ab)
+
+/* float <op> float => float */
+Object KERNEL(F,_ff) (Zone z, Object a, Object b) {
+  return (Object) float_new_with_value(z,
+    EXPR(float_get_value((Float) a), float_get_value((Float) b)));
+}
+
+/* float <op> int => float */
+Object KERNEL(F,_fi) (Zone z, Object a, Object b) {
+  return (Object) float_new_with_value(z,
+    EXPR(float_get_value((Float) a), (double) int_get_value((Int) b)));
+}
+
+/* int <op> float => float */
+Object KERNEL(F,_if) (Zone z, Object a, Object b) {
+  return (Object) float_new_with_value(z,
+    EXPR((double) int_get_value((Int) a), float_get_value((Float) b)));
+}
+
+Object FUNCTION(F) (Zone z, Object a, Object b) {
+  if (IS_FLOAT(a)) {
+    if (IS_FLOAT(b))
+      return KERNEL(F,_ff)(z, a, b);
+    else if (IS_INT(b))
+      return KERNEL(F,_fi)(z, a, b);
+  }
+  else if (IS_FLOAT(b)) {
+    if (IS_INT(a))
+      return KERNEL(F,_if)(z, a, b);
+  }
+
+  return NULL;
+}
+
+/* undefine the method generator macros.
+ */
+#undef CONCAT
+#undef CONCAT3
+#undef FUNCTION
+#undef KERNEL
+#undef EXPR
+#undef F
+
@@ -1,28 +1,38 @@
-
 /* define macros for generating a float comparison method.
  */
-#define CONCAT(a,b) a ## b
-#define FUNCTION(name) CONCAT(float_, name)
+#define CONCAT(a,b)      a ## b
+#define CONCAT3(a,b,c)   a ## b ## c
+#define FUNCTION(name)   CONCAT(float_, name)
+#define KERNEL(name,ab)  CONCAT3(float_, name, ab)
+
+/* float <op> float => int */
+Object KERNEL(F,_ff) (Zone z, Object a, Object b) {
+  return (Object) int_new_with_value(z,
+    float_get_value((Float) a) OP float_get_value((Float) b));
+}
+
+/* float <op> int => int */
+Object KERNEL(F,_fi) (Zone z, Object a, Object b) {
+  return (Object) int_new_with_value(z,
+    float_get_value((Float) a) OP (double) int_get_value((Int) b));
+}
+
+/* int <op> float => int */
+Object KERNEL(F,_if) (Zone z, Object a, Object b) {
+  return (Object) int_new_with_value(z,
+    (double) int_get_value((Int) a) OP float_get_value((Float) b));
+}
 
 Object FUNCTION(F) (Zone z, Object a, Object b) {
   if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float <op> float => int */
-      return (Object) int_new_with_value(z,
-        float_get_value((Float) a) OP float_get_value((Float) b));
-    }
-    else if (IS_INT(b)) {
-      /* float <op> int => int */
-      return (Object) int_new_with_value(z,
-        float_get_value((Float) a) OP (double) int_get_value((Int) b));
-    }
+    if (IS_FLOAT(b))
+      return KERNEL(F,_ff)(z, a, b);
+    else if (IS_INT(b))
+      return KERNEL(F,_fi)(z, a, b);
   }
   else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int <op> float => int */
-      return (Object) int_new_with_value(z,
-        (double) int_get_value((Int) a) OP float_get_value((Float) b));
-    }
+    if (IS_INT(a))
+      return KERNEL(F,_if)(z, a, b);
   }
 
   return NULL;
@@ -31,7 +41,9 @@ Object FUNCTION(F) (Zone z, Object a, Object b) {
 /* undefine the method generator macros.
  */
 #undef CONCAT
+#undef CONCAT3
 #undef FUNCTION
+#undef KERNEL
 #undef OP
 #undef F
 
@@ -0,0 +1,668 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the float range, exception and dispatch headers. */
+#include <matte/float-range.h>
+#include <matte/except.h>
+#include <matte/dispatch.h>
+
+/* include headers for inferior types. */
+#include <matte/int.h>
+#include <matte/range.h>
+#include <matte/float.h>
+
+/* include headers for superior types. */
+#include <matte/vector.h>
+
+/* float_range_type(): return a pointer to the float range object type.
+ */
+ObjectType float_range_type (void) {
+  /* return the struct address. */
+  return &FloatRange_type;
+}
+
+/* float_range_new(): allocate a new matte float range.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @args: constructor arguments.
+ *
+ * returns:
+ *  newly allocated float range.
+ */
+FloatRange float_range_new (Zone z, Object args) {
+  /* allocate a new float range. */
+  FloatRange r = (FloatRange) object_alloc(z, &FloatRange_type);
+  if (!r)
+    return NULL;
+
+  /* initialize the range values. */
+  r->begin = 0.0;
+  r->step = 1.0;
+  r->n = 0;
+
+  /* return the new float range. */
+  return r;
+}
+
+/* float_range_new_with_values(): allocate a new matte float range
+ * with set values.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @begin: first value of the range.
+ *  @step: step value of the range.
+ *  @n: number of elements in the range.
+ *
+ * returns:
+ *  newly allocated and initialized float range.
+ */
+FloatRange float_range_new_with_values (Zone z, double begin, double step,
+                                        long n) {
+  /* allocate a new float range. */
+  FloatRange r = float_range_new(z, NULL);
+  if (!r)
+    return NULL;
+
+  /* set the values of the range. */
+  r->begin = begin;
+  r->step = step;
+  r->n = (n > 0 ? n : 0);
+
+  /* return the new float range. */
+  return r;
+}
+
+/* float_range_copy(): allocate a new matte float range from another
+ * matte float range.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @r: matte float range to duplicate.
+ *
+ * returns:
+ *  duplicated matte float range.
+ */
+FloatRange float_range_copy (Zone z, FloatRange r) {
+  /* return null if the input argument is null. */
+  if (!r)
+    return NULL;
+
+  /* allocate a new float range with the values of the input range. */
+  return float_range_new_with_values(z, r->begin, r->step, r->n);
+}
+
+/* float_range_get_begin(): get the first value of a matte float range.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  value of the range start.
+ */
+inline double float_range_get_begin (FloatRange r) {
+  /* return the value from the range. */
+  return (r ? r->begin : 0.0);
+}
+
+/* float_range_get_step(): get the step value of a matte float range.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  value of the range step.
+ */
+inline double float_range_get_step (FloatRange r) {
+  /* return the value from the range. */
+  return (r ? r->step : 0.0);
+}
+
+/* float_range_get_length(): get the number of elements of a matte
+ * float range.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  number of elements in the range.
+ */
+inline long float_range_get_length (FloatRange r) {
+  /* return the length of the range. */
+  return (r ? r->n : 0);
+}
+
+/* float_range_get_element(): get an element of a matte float range,
+ * without bounds checking.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *  @i: zero-based index of the element.
+ *
+ * returns:
+ *  value of the range element.
+ */
+inline double float_range_get_element (FloatRange r, long i) {
+  /* compute the element value. */
+  return (r ? r->begin + (double) i * r->step : 0.0);
+}
+
+/* float_range_get_last(): get the last element of a matte float range.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  value of the last range element.
+ */
+inline double float_range_get_last (FloatRange r) {
+  /* compute the value of the last element. */
+  return float_range_get_element(r, float_range_get_length(r) - 1);
+}
+
+/* float_range_contains(): determine whether a value is an element of a
+ * float range, in constant time. the value must be equal to the element
+ * that is computed for its nearest index.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *  @value: value to search for.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the value is an element.
+ */
+int float_range_contains (FloatRange r, double value) {
+  /* empty ranges contain no values. */
+  if (!r || !r->n)
+    return 0;
+
+  /* ranges with a zero step hold a single value. */
+  if (r->step == 0.0)
+    return (value == r->begin);
+
+  /* locate the nearest element to the value. */
+  const double t = nearbyint((value - r->begin) / r->step);
+  if (t < 0.0 || t >= (double) r->n)
+    return 0;
+
+  /* compare the value against the nearest element. */
+  return (float_range_get_element(r, (long) t) == value);
+}
+
+/* float_range_sum(): compute the sum of the elements of a float range,
+ * in closed form.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  sum of the range elements.
+ */
+double float_range_sum (FloatRange r) {
+  /* compute the sum of the arithmetic series. */
+  const double n = (double) float_range_get_length(r);
+  return n * (float_range_get_begin(r) + float_range_get_last(r)) / 2.0;
+}
+
+/* float_range_prod(): compute the product of the elements of a float
+ * range.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  product of the range elements.
+ */
+double float_range_prod (FloatRange r) {
+  /* the product vanishes if any element is zero. */
+  if (float_range_contains(r, 0.0))
+    return 0.0;
+
+  /* otherwise, compute the product. */
+  const long n = float_range_get_length(r);
+  double y = 1.0;
+  for (long i = 0; i < n; i++)
+    y *= float_range_get_element(r, i);
+
+  return y;
+}
+
+/* float_range_any(): inline evaluator that any elements of a float
+ * range are nonzero.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  long integer indicating the result.
+ */
+inline long float_range_any (FloatRange r) {
+  /* false only if every element is zero. */
+  const long n = float_range_get_length(r);
+  if (!n || (r->begin == 0.0 && (r->step == 0.0 || n == 1)))
+    return 0L;
+
+  return 1L;
+}
+
+/* float_range_all(): inline evaluator that all elements of a float
+ * range are nonzero.
+ *
+ * arguments:
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  long integer indicating the result.
+ */
+inline long float_range_all (FloatRange r) {
+  /* the test fails only if zero is an element of the range. */
+  return (float_range_contains(r, 0.0) ? 0L : 1L);
+}
+
+/* float_range_disp(): display function for float ranges.
+ */
+int float_range_disp (Zone z, FloatRange r) {
+  /* print the range contents and return success. */
+  printf("%lg : %lg : %lg\n", r->begin, r->step, float_range_get_last(r));
+  return 1;
+}
+
+/* float_range_true(): assertion function for float ranges.
+ */
+int float_range_true (FloatRange r) {
+  return (int) float_range_all(r);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* float_range_arg(): describe an operand of an affine operation as an
+ * arithmetic sequence. scalars are described by a zero step and a
+ * negative length.
+ *
+ * arguments:
+ *  @obj: object to describe.
+ *  @begin: pointer to store the first element.
+ *  @step: pointer to store the step value.
+ *  @n: pointer to store the number of elements.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the object is a supported
+ *  operand type.
+ */
+static int float_range_arg (Object obj, double *begin, double *step,
+                            long *n) {
+  /* initialize the operand as a scalar. */
+  *step = 0.0;
+  *n = -1;
+
+  if (IS_INT(obj)) {
+    *begin = (double) int_get_value((Int) obj);
+  }
+  else if (IS_FLOAT(obj)) {
+    *begin = float_get_value((Float) obj);
+  }
+  else if (IS_RANGE(obj)) {
+    *begin = (double) range_get_begin((Range) obj);
+    *step = (double) range_get_step((Range) obj);
+    *n = range_get_length((Range) obj);
+  }
+  else if (IS_FLOAT_RANGE(obj)) {
+    *begin = float_range_get_begin((FloatRange) obj);
+    *step = float_range_get_step((FloatRange) obj);
+    *n = float_range_get_length((FloatRange) obj);
+  }
+  else
+    return 0;
+
+  return 1;
+}
+
+/* float_range_to_vector(): expand a range operand into a row vector.
+ * operands of other types are returned unmodified.
+ */
+static Object float_range_to_vector (Zone z, Object obj) {
+  if (IS_RANGE(obj))
+    return (Object) vector_new_from_range(z, (Range) obj);
+  else if (IS_FLOAT_RANGE(obj))
+    return (Object) vector_new_from_float_range(z, (FloatRange) obj);
+
+  return obj;
+}
+
+/* float_range_expand(): compute an operation that does not preserve the
+ * arithmetic structure of its range operands, by expanding them into
+ * temporary vectors.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @fn: dispatch function of the operation.
+ *
+ * returns:
+ *  result of the operation.
+ */
+static Object float_range_expand (Zone z, Object a, Object b,
+                                  obj_binary fn) {
+  /* expand the range operands. */
+  Object va = float_range_to_vector(z, a);
+  Object vb = float_range_to_vector(z, b);
+
+  /* compute the result. */
+  Object c = (va && vb ? fn(z, va, vb) : NULL);
+
+  /* free the temporary vectors and return the result. */
+  if (va != a) object_free(z, va);
+  if (vb != b) object_free(z, vb);
+  return c;
+}
+
+/* float_range_sum_kernel(): compute the sum or difference of two
+ * operands, at least one of which is a range.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @sign: sign applied to the second operand.
+ *
+ * returns:
+ *  float range result, or the result of the expanded operation if either
+ *  operand is not a scalar or range.
+ */
+static Object float_range_sum_kernel (Zone z, Object a, Object b,
+                                      double sign) {
+  /* describe the operands. */
+  double ab, as, bb, bs;
+  long an, bn;
+  if (!float_range_arg(a, &ab, &as, &an) ||
+      !float_range_arg(b, &bb, &bs, &bn))
+    return float_range_expand(z, a, b,
+                              sign > 0.0 ? object_plus : object_minus);
+
+  /* check that the operand lengths conform. */
+  if (an >= 0 && bn >= 0 && an != bn)
+    throw(z, ERR_SIZE_MISMATCH);
+
+  /* sums of sequences are sequences. */
+  return (Object) float_range_new_with_values(z,
+    ab + sign * bb, as + sign * bs, an >= 0 ? an : bn);
+}
+
+/* float_range_plus(): addition function for float ranges.
+ */
+Object float_range_plus (Zone z, Object a, Object b) {
+  return float_range_sum_kernel(z, a, b, 1.0);
+}
+
+/* float_range_minus(): subtraction function for float ranges.
+ */
+Object float_range_minus (Zone z, Object a, Object b) {
+  return float_range_sum_kernel(z, a, b, -1.0);
+}
+
+/* float_range_uminus(): unary negation function for float ranges.
+ */
+FloatRange float_range_uminus (Zone z, FloatRange a) {
+  return float_range_new_with_values(z, -a->begin, -a->step, a->n);
+}
+
+/* float_range_scale(): compute the product of two operands, at least one
+ * of which is a range, when the other operand is a scalar.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @recip: whether to divide the range by the scalar.
+ *
+ * returns:
+ *  float range result, or null if neither operand is a scalar or the
+ *  result is not an arithmetic sequence of finite values.
+ */
+static Object float_range_scale (Zone z, Object a, Object b, int recip) {
+  /* describe the operands. */
+  double ab, as, bb, bs;
+  long an, bn;
+  if (!float_range_arg(a, &ab, &as, &an) ||
+      !float_range_arg(b, &bb, &bs, &bn))
+    return NULL;
+
+  /* order the operands as (range, scalar). */
+  if (an < 0) {
+    if (recip)
+      return NULL;
+
+    const double tb = ab, ts = as;
+    const long tn = an;
+    ab = bb; as = bs; an = bn;
+    bb = tb; bs = ts; bn = tn;
+  }
+
+  /* scaled sequences are sequences. */
+  if (bn >= 0)
+    return NULL;
+
+  /* division by zero, and non-finite factors or results, do not give
+   * sequences: their elements need not share a single step.
+   */
+  if ((recip && bb == 0.0) || !isfinite(bb))
+    return NULL;
+
+  const double rb = (recip ? ab / bb : ab * bb);
+  const double rs = (recip ? as / bb : as * bb);
+  if (!isfinite(rb) || !isfinite(rs))
+    return NULL;
+
+  return (Object) float_range_new_with_values(z, rb, rs, an);
+}
+
+/* float_range_times(): element-wise multiplication function for float
+ * ranges.
+ */
+Object float_range_times (Zone z, Object a, Object b) {
+  Object c = float_range_scale(z, a, b, 0);
+  return (c ? c : float_range_expand(z, a, b, object_times));
+}
+
+/* float_range_mtimes(): multiplication function for float ranges.
+ */
+Object float_range_mtimes (Zone z, Object a, Object b) {
+  Object c = float_range_scale(z, a, b, 0);
+  return (c ? c : float_range_expand(z, a, b, object_mtimes));
+}
+
+/* float_range_rdivide(): element-wise right division function for float
+ * ranges.
+ */
+Object float_range_rdivide (Zone z, Object a, Object b) {
+  Object c = float_range_scale(z, a, b, 1);
+  return (c ? c : float_range_expand(z, a, b, object_rdivide));
+}
+
+/* float_range_ldivide(): element-wise left division function for float
+ * ranges.
+ */
+Object float_range_ldivide (Zone z, Object a, Object b) {
+  Object c = float_range_scale(z, b, a, 1);
+  return (c ? c : float_range_expand(z, a, b, object_ldivide));
+}
+
+/* float_range_mrdivide(): right division function for float ranges.
+ */
+Object float_range_mrdivide (Zone z, Object a, Object b) {
+  Object c = float_range_scale(z, a, b, 1);
+  return (c ? c : float_range_expand(z, a, b, object_mrdivide));
+}
+
+/* float_range_power(): element-wise exponentiation function for float
+ * ranges.
+ */
+Object float_range_power (Zone z, Object a, Object b) {
+  return float_range_expand(z, a, b, object_power);
+}
+
+/* float_range_transpose(): transposition function for float ranges.
+ * the result is a column vector.
+ */
+Vector float_range_transpose (Zone z, FloatRange a) {
+  Vector x = vector_new_from_float_range(z, a);
+  if (!x)
+    return NULL;
+
+  x->tr = CblasNoTrans;
+  return x;
+}
+
+/* float_range_horzcat(): horizontal concatenation function for float
+ * ranges.
+ */
+Vector float_range_horzcat (Zone z, int n, va_list vl) {
+  Vector x = vector_new(z, NULL);
+  if (!x)
+    return NULL;
+
+  for (long i = 0, ix = 0; i < n; i++) {
+    Object obj = (Object) va_arg(vl, Object);
+
+    /* describe the argument as a sequence. */
+    double begin, step;
+    long nr;
+    if (!float_range_arg(obj, &begin, &step, &nr)) {
+      object_free(z, x);
+      return NULL;
+    }
+
+    /* append the elements of the argument. */
+    if (nr < 0)
+      nr = 1;
+
+    if (!vector_set_length(x, vector_get_length(x) + nr)) {
+      object_free(z, x);
+      return NULL;
+    }
+
+    for (long k = 0; k < nr; k++)
+      vector_set(x, ix++, begin + (double) k * step);
+  }
+
+  x->tr = CblasTrans;
+  return x;
+}
+
+/* float_range_vertcat(): vertical concatenation function for float
+ * ranges.
+ */
+Vector float_range_vertcat (Zone z, int n, va_list vl) {
+  if (n != 1) {
+    error(ERR_INVALID_ARGIN)
+    return NULL;
+  }
+
+  Vector x = vector_new_from_float_range(z,
+    (FloatRange) va_arg(vl, FloatRange));
+  if (!x)
+    return NULL;
+
+  x->tr = CblasTrans;
+  return x;
+}
+
+/* float_range_register(): register the kernels of float ranges into the
+ * binary dispatch table. these include the kernels that scale integer
+ * ranges by floats, which produce float ranges.
+ */
+void float_range_register (void) {
+  /* types: operand types that combine with float ranges. */
+  const ObjectType types[] = {
+    &Int_type, &Range_type, &Float_type, &FloatRange_type, NULL
+  };
+
+  /* REGISTER(): macro to register the kernels of a float range operation
+   * with every operand type that it accepts.
+   */
+#define REGISTER(op, name) \
+  for (int i = 0; types[i]; i++) { \
+    dispatch_register(op, &FloatRange_type, types[i], float_range_ ## name); \
+    dispatch_register(op, types[i], &FloatRange_type, float_range_ ## name); \
+  } \
+  dispatch_register(op, &Range_type, &Float_type, float_range_ ## name); \
+  dispatch_register(op, &Float_type, &Range_type, float_range_ ## name);
+
+  /* register the arithmetic kernels. */
+  REGISTER(DISPATCH_PLUS,     plus);
+  REGISTER(DISPATCH_MINUS,    minus);
+  REGISTER(DISPATCH_TIMES,    times);
+  REGISTER(DISPATCH_MTIMES,   mtimes);
+  REGISTER(DISPATCH_RDIVIDE,  rdivide);
+  REGISTER(DISPATCH_LDIVIDE,  ldivide);
+  REGISTER(DISPATCH_MRDIVIDE, mrdivide);
+  REGISTER(DISPATCH_POWER,    power);
+#undef REGISTER
+
+  /* REGISTER(): macro to register the kernels of integer range operations
+   * that do not produce integer ranges.
+   */
+#define REGISTER(op, name) \
+  dispatch_register(op, &Range_type, &Int_type, float_range_ ## name); \
+  dispatch_register(op, &Int_type, &Range_type, float_range_ ## name);
+
+  /* register the division and exponentiation kernels. */
+  REGISTER(DISPATCH_RDIVIDE,  rdivide);
+  REGISTER(DISPATCH_LDIVIDE,  ldivide);
+  REGISTER(DISPATCH_MRDIVIDE, mrdivide);
+  REGISTER(DISPATCH_POWER,    power);
+#undef REGISTER
+}
+
+/* FloatRange_type: object type structure for matte float ranges.
+ */
+struct _ObjectType FloatRange_type = {
+  "FloatRange",                                  /* name       */
+  sizeof(struct _FloatRange),                    /* size       */
+  3,                                             /* precedence */
+
+  (obj_constructor) float_range_new,             /* fn_new    */
+  (obj_constructor) float_range_copy,            /* fn_copy   */
+  NULL,                                          /* fn_delete */
+  (obj_display)     float_range_disp,            /* fn_disp   */
+  (obj_assert)      float_range_true,            /* fn_true   */
+
+  (obj_binary)   float_range_plus,               /* fn_plus       */
+  (obj_binary)   float_range_minus,              /* fn_minus      */
+  (obj_unary)    float_range_uminus,             /* fn_uminus     */
+  (obj_binary)   float_range_times,              /* fn_times      */
+  (obj_binary)   float_range_mtimes,             /* fn_mtimes     */
+  (obj_binary)   float_range_rdivide,            /* fn_rdivide    */
+  (obj_binary)   float_range_ldivide,            /* fn_ldivide    */
+  (obj_binary)   float_range_mrdivide,           /* fn_mrdivide   */
+  NULL,                                          /* fn_mldivide   */
+  (obj_binary)   float_range_power,              /* fn_power      */
+  NULL,                                          /* fn_mpower     */
+  NULL,                                          /* fn_lt         */
+  NULL,                                          /* fn_gt         */
+  NULL,                                          /* fn_le         */
+  NULL,                                          /* fn_ge         */
+  NULL,                                          /* fn_ne         */
+  NULL,                                          /* fn_eq         */
+  NULL,                                          /* fn_and        */
+  NULL,                                          /* fn_or         */
+  NULL,                                          /* fn_mand       */
+  NULL,                                          /* fn_mor        */
+  NULL,                                          /* fn_not        */
+  NULL,                                          /* fn_colon      */
+  (obj_unary)    float_range_transpose,          /* fn_ctranspose */
+  (obj_unary)    float_range_transpose,          /* fn_transpose  */
+  (obj_variadic) float_range_horzcat,            /* fn_horzcat    */
+  (obj_variadic) float_range_vertcat,            /* fn_vertcat    */
+  NULL,                                          /* fn_subsref    */
+  NULL,                                          /* fn_subsasgn   */
+  NULL,                                          /* fn_subsindex  */
+
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
+};
+
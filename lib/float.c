@@ -3,15 +3,17 @@
  * Released under the MIT License
  */
 
-/* include the float and blas headers. */
+/* include the float, blas and dispatch headers. */
 #include <matte/float.h>
 #include <matte/blas.h>
+#include <matte/dispatch.h>
 
 /* include headers for inferior types. */
 #include <matte/int.h>
 #include <matte/range.h>
 
 /* include headers for superior types. */
+#include <matte/float-range.h>
 #include <matte/vector.h>
 
 /* float_type(): return a pointer to the float object type.
@@ -122,63 +124,15 @@ int float_true (Float f) {
   return (f->value ? 1 : 0);
 }
 
-/* float_plus(): addition operation for floats.
- */
-Object float_plus (Zone z, Object a, Object b) {
-  if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float + float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) +
-                                float_get_value((Float) b));
-    }
-    else if (IS_INT(b)) {
-      /* float + int => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) +
-                             (double) int_get_value((Int) b));
-    }
-  }
-  else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int + float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) b) +
-                             (double) int_get_value((Int) a));
-    }
-  }
-
-  return NULL;
-}
-
-/* float_minus(): subtraction operation for floats.
- */
-Object float_minus (Zone z, Object a, Object b) {
-  if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float - float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) -
-                                float_get_value((Float) b));
-    }
-    else if (IS_INT(b)) {
-      /* float - int => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) -
-                             (double) int_get_value((Int) b));
-    }
-  }
-  else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int - float => float */
-      return (Object)
-        float_new_with_value(z, (double) int_get_value((Int) a) -
-                             float_get_value((Float) b));
-    }
-  }
+/* float_plus(): addition operation for floats. */
+#define F plus
+#define EXPR(a,b) ((a) + (b))
+#include "float-binary.c"
 
-  return NULL;
-}
+/* float_minus(): subtraction operation for floats. */
+#define F minus
+#define EXPR(a,b) ((a) - (b))
+#include "float-binary.c"
 
 /* float_uminus(): unary negation operation for floats.
  */
@@ -187,121 +141,25 @@ Float float_uminus (Zone z, Float a) {
   return float_new_with_value(z, -(a->value));
 }
 
-/* float_times(): element-wise multiplication operation for floats.
- */
-Object float_times (Zone z, Object a, Object b) {
-  if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float * float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) *
-                                float_get_value((Float) b));
-    }
-    else if (IS_INT(b)) {
-      /* float * int => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) *
-                             (double) int_get_value((Int) b));
-    }
-  }
-  else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int * float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) b) *
-                             (double) int_get_value((Int) a));
-    }
-  }
+/* float_times(): element-wise multiplication operation for floats. */
+#define F times
+#define EXPR(a,b) ((a) * (b))
+#include "float-binary.c"
 
-  return NULL;
-}
+/* float_rdivide(): right-division operation for floats. */
+#define F rdivide
+#define EXPR(a,b) ((a) / (b))
+#include "float-binary.c"
 
-/* float_rdivide(): right-division operation for floats.
- */
-Object float_rdivide (Zone z, Object a, Object b) {
-  if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float / float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) /
-                                float_get_value((Float) b));
-    }
-    else if (IS_INT(b)) {
-      /* float / int => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) a) /
-                             (double) int_get_value((Int) b));
-    }
-  }
-  else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int / float => float */
-      return (Object)
-        float_new_with_value(z, (double) int_get_value((Int) a) /
-                             float_get_value((Float) b));
-    }
-  }
+/* float_ldivide(): left-division operation for floats. */
+#define F ldivide
+#define EXPR(a,b) ((b) / (a))
+#include "float-binary.c"
 
-  return NULL;
-}
-
-/* float_ldivide(): left-division for floats.
- */
-Object float_ldivide (Zone z, Object a, Object b) {
-  if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float \ float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) b) /
-                                float_get_value((Float) a));
-    }
-    else if (IS_INT(b)) {
-      /* float \ int => float */
-      return (Object)
-        float_new_with_value(z, (double) int_get_value((Int) b) /
-                             float_get_value((Float) a));
-    }
-  }
-  else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int \ float => float */
-      return (Object)
-        float_new_with_value(z, float_get_value((Float) b) /
-                             (double) int_get_value((Int) a));
-    }
-  }
-
-  return NULL;
-}
-
-/* float_power(): exponentiation operation for floats.
- */
-Object float_power (Zone z, Object a, Object b) {
-  if (IS_FLOAT(a)) {
-    if (IS_FLOAT(b)) {
-      /* float ^ float => float */
-      return (Object)
-        float_new_with_value(z, pow(float_get_value((Float) a),
-                                    float_get_value((Float) b)));
-    }
-    else if (IS_INT(b)) {
-      /* float ^ int => float */
-      return (Object)
-        float_new_with_value(z, pow(float_get_value((Float) a),
-                                    (double) int_get_value((Int) b)));
-    }
-  }
-  else if (IS_FLOAT(b)) {
-    if (IS_INT(a)) {
-      /* int ^ float => float */
-      return (Object)
-        float_new_with_value(z, pow((double) int_get_value((Int) a),
-                                    float_get_value((Float) b)));
-    }
-  }
-
-  return NULL;
-}
+/* float_power(): exponentiation operation for floats. */
+#define F power
+#define EXPR(a,b) pow(a, b)
+#include "float-binary.c"
 
 /* float_lt(): less-than comparison operation for floats. */
 #define F lt
@@ -435,8 +293,20 @@ Vector float_horzcat (Zone z, int n, va_list vl) {
         return NULL;
       }
 
-      for (long elem = r->begin; elem <= r->end; elem += r->step)
-        vector_set(x, ix++, (double) elem);
+      for (long k = 0; k < nr; k++)
+        vector_set(x, ix++, (double) range_get_element(r, k));
+    }
+    else if (IS_FLOAT_RANGE(obj)) {
+      FloatRange r = (FloatRange) obj;
+      long nr = float_range_get_length(r);
+
+      if (!vector_set_length(x, x->n + nr)) {
+        object_free(z, x);
+        return NULL;
+      }
+
+      for (long k = 0; k < nr; k++)
+        vector_set(x, ix++, float_range_get_element(r, k));
     }
     else {
       object_free(z, x);
@@ -473,6 +343,42 @@ Vector float_vertcat (Zone z, int n, va_list vl) {
   return x;
 }
 
+/* float_register(): register the specialized kernels of floats into
+ * the binary dispatch table.
+ */
+void float_register (void) {
+  /* REGISTER(): macro to register the kernels of a float operation. */
+#define REGISTER(op, name) \
+  dispatch_register(op, &Float_type, &Float_type, float_ ## name ## _ff); \
+  dispatch_register(op, &Float_type, &Int_type,   float_ ## name ## _fi); \
+  dispatch_register(op, &Int_type,   &Float_type, float_ ## name ## _if);
+
+  /* register the arithmetic kernels. */
+  REGISTER(DISPATCH_PLUS,     plus);
+  REGISTER(DISPATCH_MINUS,    minus);
+  REGISTER(DISPATCH_TIMES,    times);
+  REGISTER(DISPATCH_MTIMES,   times);
+  REGISTER(DISPATCH_RDIVIDE,  rdivide);
+  REGISTER(DISPATCH_LDIVIDE,  ldivide);
+  REGISTER(DISPATCH_MRDIVIDE, rdivide);
+  REGISTER(DISPATCH_MLDIVIDE, ldivide);
+  REGISTER(DISPATCH_POWER,    power);
+  REGISTER(DISPATCH_MPOWER,   power);
+
+  /* register the comparison and logical kernels. */
+  REGISTER(DISPATCH_LT,   lt);
+  REGISTER(DISPATCH_GT,   gt);
+  REGISTER(DISPATCH_LE,   le);
+  REGISTER(DISPATCH_GE,   ge);
+  REGISTER(DISPATCH_NE,   ne);
+  REGISTER(DISPATCH_EQ,   eq);
+  REGISTER(DISPATCH_AND,  and);
+  REGISTER(DISPATCH_OR,   or);
+  REGISTER(DISPATCH_MAND, mand);
+  REGISTER(DISPATCH_MOR,  mor);
+#undef REGISTER
+}
+
 /* Float_type: object type structure for matte floats.
  */
 struct _ObjectType Float_type = {
@@ -517,6 +423,11 @@ struct _ObjectType Float_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
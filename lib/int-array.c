@@ -0,0 +1,774 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the standard integer format header. */
+#include <inttypes.h>
+
+/* include the exception, broadcast, subscript and dispatch headers. */
+#include <matte/except.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+#include <matte/dispatch.h>
+
+/* include headers for inferior types. */
+#include <matte/int.h>
+#include <matte/range.h>
+#include <matte/float.h>
+#include <matte/float-range.h>
+#include <matte/complex.h>
+
+/* include headers for all array types. */
+#include <matte/vector.h>
+#include <matte/matrix.h>
+#include <matte/complex-vector.h>
+#include <matte/complex-matrix.h>
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+#include <matte/logical.h>
+#include <matte/int32-array.h>
+#include <matte/int64-array.h>
+
+/* define macros for generating an integer array type.
+ */
+#define CONCAT3(a,b,c)   a ## b ## c
+#define FNAME(p,name)    CONCAT3(p, _, name)
+#define FUNCTION(name)   FNAME(P, name)
+
+/* FUNCTION(type)(): return a pointer to the integer array object type.
+ */
+ObjectType FUNCTION(type) (void) {
+  /* return the struct address. */
+  return &TYPE;
+}
+
+/* FUNCTION(new)(): allocate a new empty matte integer array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @args: constructor arguments.
+ *
+ * returns:
+ *  newly allocated empty integer array.
+ */
+S FUNCTION(new) (Zone z, Object args) {
+  /* allocate a new integer array. */
+  S x = (S) object_alloc(z, &TYPE);
+  if (!x)
+    return NULL;
+
+  /* initialize the array data and shape. */
+  x->data = NULL;
+  x->m = 0;
+  x->n = 0;
+  x->mat = 0;
+
+  /* return the new array. */
+  return x;
+}
+
+/* FUNCTION(new_with_size)(): allocate a new matte integer array with a
+ * set number of rows and columns, initialized to zero. arrays with more
+ * than one row and column have the shape of a matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @m: number of rows in the new array.
+ *  @n: number of columns in the new array.
+ *
+ * returns:
+ *  newly allocated zero integer array.
+ */
+S FUNCTION(new_with_size) (Zone z, long m, long n) {
+  /* validate the input arguments. */
+  if (m < 0 || n < 0)
+    fail(ERR_INVALID_ARGIN);
+
+  /* allocate a new integer array. */
+  S x = FUNCTION(new)(z, NULL);
+  if (!x)
+    return NULL;
+
+  /* allocate the array data. */
+  const long len = m * n;
+  x->data = (T*) buffer_resize(NULL, 0, len, sizeof(T));
+  if (len && !x->data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the array shape and return the new array. */
+  x->m = m;
+  x->n = n;
+  x->mat = (m != 1 && n != 1);
+  return x;
+}
+
+/* FUNCTION(round)(): round a real number to the nearest integer, with
+ * ties away from zero, and saturate it at the limits of the element type.
+ * not-a-number is converted to zero.
+ *
+ * arguments:
+ *  @v: real number to convert.
+ *
+ * returns:
+ *  converted array element.
+ */
+static inline T FUNCTION(round) (double v) {
+  if (v != v)
+    return 0;
+  else if (v >= (double) TMAX)
+    return TMAX;
+  else if (v <= (double) TMIN)
+    return TMIN;
+
+  return (T) round(v);
+}
+
+/* FUNCTION(new_from_doubles)(): allocate a new matte integer array that
+ * holds rounded copies of an array of real numbers.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @src: real numbers to convert, in column-major order.
+ *  @m: number of rows in the new array.
+ *  @n: number of columns in the new array.
+ *  @mat: whether the new array has the shape of a matrix.
+ *
+ * returns:
+ *  newly allocated integer array.
+ */
+static S FUNCTION(new_from_doubles) (Zone z, const double *src,
+                                     long m, long n, int mat) {
+  S x = FUNCTION(new_with_size)(z, m, n);
+  if (!x)
+    return NULL;
+
+  const long len = m * n;
+  for (long i = 0; i < len; i++)
+    x->data[i] = FUNCTION(round)(src[i]);
+
+  x->mat = mat;
+  return x;
+}
+
+/* FUNCTION(new_from_object)(): allocate a new matte integer array that
+ * holds the elements of a real numeric object, rounded to the nearest
+ * integer and saturated at the limits of the element type.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @obj: numeric object to convert.
+ *
+ * returns:
+ *  newly allocated integer array.
+ */
+S FUNCTION(new_from_object) (Zone z, Object obj) {
+  if (IS_INT_ARRAY(obj)) {
+    /* integer arrays of the same width are shared with the result. */
+    return FUNCTION(copy)(z, (S) obj);
+  }
+  else if (IS_INT(obj)) {
+    S x = FUNCTION(new_with_size)(z, 1, 1);
+    if (!x)
+      return NULL;
+
+    const long v = int_get_value((Int) obj);
+#if B < 64
+    x->data[0] = (v > TMAX ? TMAX : v < TMIN ? TMIN : (T) v);
+#else
+    x->data[0] = (T) v;
+#endif
+    return x;
+  }
+  else if (IS_FLOAT(obj)) {
+    const double v = float_get_value((Float) obj);
+    return FUNCTION(new_from_doubles)(z, &v, 1, 1, 0);
+  }
+  else if (IS_VECTOR(obj)) {
+    Vector v = (Vector) obj;
+    return (v->tr == CblasNoTrans ?
+            FUNCTION(new_from_doubles)(z, v->data, v->n, 1, 0) :
+            FUNCTION(new_from_doubles)(z, v->data, 1, v->n, 0));
+  }
+  else if (IS_MATRIX(obj)) {
+    Matrix A = (Matrix) obj;
+    if (!matrix_untranspose(A))
+      return NULL;
+
+    return FUNCTION(new_from_doubles)(z, A->data, A->m, A->n, 1);
+  }
+  else if (IS_LOGICAL(obj)) {
+    Logical L = (Logical) obj;
+    S x = FUNCTION(new_with_size)(z, L->m, L->n);
+    if (!x)
+      return NULL;
+
+    const long len = L->m * L->n;
+    for (long i = 0; i < len; i++)
+      x->data[i] = (T) L->data[i];
+
+    x->mat = L->mat;
+    return x;
+  }
+
+  /* widen all other real arrays before rounding their elements. */
+  Object w = NULL;
+  if (IS_RANGE(obj))
+    w = (Object) vector_new_from_range(z, (Range) obj);
+  else if (IS_FLOAT_RANGE(obj))
+    w = (Object) vector_new_from_float_range(z, (FloatRange) obj);
+  else if (IS_SINGLE_VECTOR(obj))
+    w = (Object) single_vector_to_double(z, (SingleVector) obj);
+  else if (IS_SINGLE_MATRIX(obj))
+    w = (Object) single_matrix_to_double(z, (SingleMatrix) obj);
+  else if (IS_INT32_ARRAY(obj))
+    w = int32_array_to_double(z, (Int32Array) obj);
+  else if (IS_INT64_ARRAY(obj))
+    w = int64_array_to_double(z, (Int64Array) obj);
+  else
+    fail(ERR_OBJ_UNARY, CLASS, MATTE_TYPE(obj)->name);
+
+  if (!w)
+    return NULL;
+
+  S x = FUNCTION(new_from_object)(z, w);
+  object_free(z, w);
+  return x;
+}
+
+/* FUNCTION(to_double)(): allocate a new matte vector or matrix that
+ * holds the elements of a matte integer array in double precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte integer array to access.
+ *
+ * returns:
+ *  newly allocated matte vector or matrix.
+ */
+Object FUNCTION(to_double) (Zone z, S x) {
+  /* return null if the input array is null. */
+  if (!x)
+    return NULL;
+
+  /* allocate a matrix or vector of the same shape. */
+  const long len = x->m * x->n;
+  double *data;
+  Object obj;
+  if (x->mat) {
+    Matrix A = matrix_new_with_size(z, x->m, x->n);
+    if (!A)
+      return NULL;
+
+    data = A->data;
+    obj = (Object) A;
+  }
+  else {
+    Vector v = vector_new_with_length(z, len);
+    if (!v)
+      return NULL;
+
+    v->tr = (x->n == 1 ? CblasNoTrans : CblasTrans);
+    data = v->data;
+    obj = (Object) v;
+  }
+
+  /* store the widened elements. */
+  for (long i = 0; i < len; i++)
+    data[i] = (double) x->data[i];
+
+  /* return the new array. */
+  return obj;
+}
+
+/* FUNCTION(copy)(): allocate a new matte integer array from another
+ * matte integer array. the duplicate shares the data buffer of the input
+ * array until either of them is modified.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte integer array to duplicate.
+ *
+ * returns:
+ *  duplicated matte integer array.
+ */
+S FUNCTION(copy) (Zone z, S x) {
+  /* return null if the input argument is null. */
+  if (!x)
+    return NULL;
+
+  /* allocate a new integer array. */
+  S xnew = FUNCTION(new)(z, NULL);
+  if (!xnew)
+    return NULL;
+
+  /* share the data buffer of the input array with the duplicate. */
+  xnew->data = (T*) buffer_share(x->data);
+  xnew->m = x->m;
+  xnew->n = x->n;
+  xnew->mat = x->mat;
+
+  /* return the new array. */
+  return xnew;
+}
+
+/* FUNCTION(delete)(): free all memory associated with a matte integer
+ * array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte integer array to free.
+ */
+void FUNCTION(delete) (Zone z, S x) {
+  /* return if the array is null. */
+  if (!x)
+    return;
+
+  /* release the array data. */
+  buffer_release(x->data);
+}
+
+/* FUNCTION(get_length)(): get the number of elements of a matte integer
+ * array.
+ *
+ * arguments:
+ *  @x: matte integer array to access.
+ *
+ * returns:
+ *  number of elements in the array.
+ */
+long FUNCTION(get_length) (S x) {
+  /* return the array length. */
+  return (x ? x->m * x->n : 0);
+}
+
+/* FUNCTION(get)(): get an element from a matte integer array.
+ *
+ * arguments:
+ *  @x: matte integer array to access.
+ *  @i: linear index of the element to get.
+ *
+ * returns:
+ *  requested array element.
+ */
+inline T FUNCTION(get) (S x, long i) {
+  /* if the pointer and index are valid, return the element. */
+  if (x && i < x->m * x->n)
+    return x->data[i];
+
+  /* return zero. */
+  return 0;
+}
+
+/* FUNCTION(unshare)(): ensure that the data of a matte integer array is
+ * not shared with any other array, so that it may be modified in place.
+ *
+ * arguments:
+ *  @x: matte integer array to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int FUNCTION(unshare) (S x) {
+  /* fail if the array is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the array data if it is held by other arrays. */
+  const long len = x->m * x->n;
+  T *data = (T*) buffer_unshare(x->data, len, sizeof(T));
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared array data and return success. */
+  x->data = data;
+  return 1;
+}
+
+/* FUNCTION(set)(): set an element of a matte integer array. the array
+ * data must not be shared, see FUNCTION(unshare)().
+ *
+ * arguments:
+ *  @x: matte integer array to modify.
+ *  @i: linear index of the element to set.
+ *  @xi: element value.
+ */
+inline void FUNCTION(set) (S x, long i, T xi) {
+  /* if the pointer and index are valid, set the element. */
+  if (x && i < x->m * x->n)
+    x->data[i] = xi;
+}
+
+/* FUNCTION(cat)(): concatenate integer and float scalars and
+ * vector-shaped integer arrays of the same width. float scalars are
+ * rounded to the nearest integer, as by FUNCTION(round)().
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @n: number of arguments.
+ *  @vl: list of arguments.
+ *  @vert: whether to concatenate vertically (1) or horizontally (0).
+ *
+ * returns:
+ *  newly allocated row vector for horizontal concatenation, or column
+ *  vector for vertical concatenation.
+ */
+static S FUNCTION(cat) (Zone z, int n, va_list vl, int vert) {
+  /* check the arguments and sum their lengths. */
+  va_list vc;
+  va_copy(vc, vl);
+  long len = 0;
+  for (int i = 0; i < n; i++) {
+    Object obj = va_arg(vc, Object);
+    if (IS_INT(obj) || IS_FLOAT(obj)) {
+      len++;
+    }
+    else if (IS_INT_ARRAY(obj)) {
+      S x = (S) obj;
+      if (x->mat || (x->m * x->n > 1 && (vert ? x->n : x->m) != 1)) {
+        va_end(vc);
+        fail(ERR_SIZE_MISMATCH);
+      }
+
+      len += x->m * x->n;
+    }
+    else {
+      va_end(vc);
+      fail(ERR_OBJ_VARIADIC, vert ? "vertcat" : "horzcat",
+           MATTE_TYPE(obj)->name);
+    }
+  }
+
+  va_end(vc);
+
+  /* allocate the result. */
+  S y = (vert ? FUNCTION(new_with_size)(z, len, 1) :
+                FUNCTION(new_with_size)(z, 1, len));
+  if (!y)
+    return NULL;
+
+  /* store the concatenated elements. */
+  y->mat = 0;
+  for (int i = 0, k = 0; i < n; i++) {
+    Object obj = va_arg(vl, Object);
+    if (IS_INT(obj)) {
+      const long v = int_get_value((Int) obj);
+#if B < 64
+      y->data[k++] = (v > TMAX ? TMAX : v < TMIN ? TMIN : (T) v);
+#else
+      y->data[k++] = (T) v;
+#endif
+    }
+    else if (IS_FLOAT(obj)) {
+      y->data[k++] = FUNCTION(round)(float_get_value((Float) obj));
+    }
+    else {
+      S x = (S) obj;
+      const long nx = x->m * x->n;
+      memcpy(y->data + k, x->data, nx * sizeof(T));
+      k += nx;
+    }
+  }
+
+  /* return the result. */
+  return y;
+}
+
+/* FUNCTION(horzcat)(): horizontal concatenation function for integer
+ * arrays.
+ */
+S FUNCTION(horzcat) (Zone z, int n, va_list vl) {
+  return FUNCTION(cat)(z, n, vl, 0);
+}
+
+/* FUNCTION(vertcat)(): vertical concatenation function for integer
+ * arrays.
+ */
+S FUNCTION(vertcat) (Zone z, int n, va_list vl) {
+  return FUNCTION(cat)(z, n, vl, 1);
+}
+
+/* FUNCTION(disp)(): display function for matte integer arrays.
+ */
+int FUNCTION(disp) (Zone z, S x) {
+  printf("\n");
+  if (x->mat) {
+    /* print matrix-shaped arrays by rows. */
+    for (long i = 0; i < x->m; i++) {
+      printf("\n");
+      for (long j = 0; j < x->n; j++)
+        printf("  %" FMT, x->data[i + j * x->m]);
+    }
+  }
+  else {
+    /* print vector-shaped arrays one element per line. */
+    const long n = FUNCTION(get_length)(x);
+    for (long i = 0; i < n; i++)
+      printf("\n  %" FMT, x->data[i]);
+  }
+
+  /* print newlines and return success. */
+  printf("\n\n");
+  return 1;
+}
+
+/* FUNCTION(true)(): assert the truth of an integer array, which holds
+ * when the array is non-empty and all its elements are nonzero.
+ */
+int FUNCTION(true) (S x) {
+  const long n = FUNCTION(get_length)(x);
+  for (long i = 0; i < n; i++) {
+    if (!x->data[i]) return 0;
+  }
+
+  return (n > 0);
+}
+
+/* FUNCTION(uminus)(): saturating unary negation function for integer
+ * arrays.
+ */
+S FUNCTION(uminus) (Zone z, S a) {
+  S b = FUNCTION(new_with_size)(z, a->m, a->n);
+  if (!b)
+    return NULL;
+
+  const long n = a->m * a->n;
+  for (long i = 0; i < n; i++)
+    b->data[i] = (a->data[i] == TMIN ? TMAX : -a->data[i]);
+
+  b->mat = a->mat;
+  return b;
+}
+
+/* FUNCTION(not)(): logical negation function for integer arrays.
+ */
+Logical FUNCTION(not) (Zone z, S a) {
+  Logical L = logical_new_with_size(z, a->m, a->n);
+  if (!L)
+    return NULL;
+
+  const long n = a->m * a->n;
+  for (long i = 0; i < n; i++)
+    L->data[i] = (a->data[i] == 0);
+
+  L->mat = a->mat;
+  return L;
+}
+
+/* FUNCTION(transpose)(): transposition function for integer arrays.
+ * vector-shaped arrays share the data of their operand.
+ */
+S FUNCTION(transpose) (Zone z, S a) {
+  /* transpose vectors by exchanging their dimensions. */
+  if (!a->mat) {
+    S b = FUNCTION(copy)(z, a);
+    if (!b)
+      return NULL;
+
+    b->m = a->n;
+    b->n = a->m;
+    return b;
+  }
+
+  /* transpose matrices element by element. */
+  S b = FUNCTION(new_with_size)(z, a->n, a->m);
+  if (!b)
+    return NULL;
+
+  for (long j = 0; j < a->n; j++)
+    for (long i = 0; i < a->m; i++)
+      b->data[j + i * a->n] = a->data[i + j * a->m];
+
+  b->mat = 1;
+  return b;
+}
+
+/* FUNCTION(is_scalar)(): check whether an operand of a matrix operation
+ * on integer arrays is a scalar, including integer arrays that hold a
+ * single element.
+ */
+static int FUNCTION(is_scalar) (Object obj) {
+  return (IS_INT(obj) || IS_FLOAT(obj) || IS_COMPLEX(obj) ||
+          (IS_INT32_ARRAY(obj) &&
+           int32_array_get_length((Int32Array) obj) == 1) ||
+          (IS_INT64_ARRAY(obj) &&
+           int64_array_get_length((Int64Array) obj) == 1));
+}
+
+/* FUNCTION(widen)(): convert an integer array operand of a matrix
+ * operation to double precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @obj: object to convert.
+ *
+ * returns:
+ *  newly allocated double-precision copy of an integer array, or @obj
+ *  itself for all other objects.
+ */
+static Object FUNCTION(widen) (Zone z, Object obj) {
+  if (IS_INT32_ARRAY(obj))
+    return int32_array_to_double(z, (Int32Array) obj);
+  else if (IS_INT64_ARRAY(obj))
+    return int64_array_to_double(z, (Int64Array) obj);
+
+  return obj;
+}
+
+/* FUNCTION(matrix)(): compute a matrix operation that involves integer
+ * arrays in double precision, as the linear algebra kernels operate on
+ * real and complex numbers.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @fn: dispatch function of the operation.
+ *
+ * returns:
+ *  result of the operation.
+ */
+static Object FUNCTION(matrix) (Zone z, Object a, Object b, obj_binary fn) {
+  Object wa = FUNCTION(widen)(z, a);
+  Object wb = FUNCTION(widen)(z, b);
+  Object c = (wa && wb ? fn(z, wa, wb) : NULL);
+
+  if (wa && wa != a) object_free(z, wa);
+  if (wb && wb != b) object_free(z, wb);
+  return c;
+}
+
+/* FUNCTION(mtimes)(): matrix multiplication function for integer arrays.
+ * products with scalars are element-wise, and keep integer elements.
+ */
+Object FUNCTION(mtimes) (Zone z, Object a, Object b) {
+  if (FUNCTION(is_scalar)(a) || FUNCTION(is_scalar)(b))
+    return broadcast_times(z, a, b);
+
+  return FUNCTION(matrix)(z, a, b, object_mtimes);
+}
+
+/* FUNCTION(mrdivide)(): matrix right division function for integer
+ * arrays.
+ */
+Object FUNCTION(mrdivide) (Zone z, Object a, Object b) {
+  if (FUNCTION(is_scalar)(b))
+    return broadcast_rdivide(z, a, b);
+
+  return FUNCTION(matrix)(z, a, b, object_mrdivide);
+}
+
+/* FUNCTION(mldivide)(): matrix left division function for integer
+ * arrays.
+ */
+Object FUNCTION(mldivide) (Zone z, Object a, Object b) {
+  if (FUNCTION(is_scalar)(a))
+    return broadcast_ldivide(z, a, b);
+
+  return FUNCTION(matrix)(z, a, b, object_mldivide);
+}
+
+/* FUNCTION(mpower)(): matrix power function for integer arrays.
+ */
+Object FUNCTION(mpower) (Zone z, Object a, Object b) {
+  return FUNCTION(matrix)(z, a, b, object_mpower);
+}
+
+/* FUNCTION(register)(): register the matrix operations of integer
+ * arrays into the binary dispatch table, so that they take precedence
+ * over the matrix operations of the double-precision arrays.
+ */
+void FUNCTION(register) (void) {
+  /* types: array types that combine with integer arrays. */
+  const ObjectType types[] = {
+    &Vector_type, &Matrix_type, &ComplexVector_type, &ComplexMatrix_type,
+    &SingleVector_type, &SingleMatrix_type, &Logical_type,
+    &Int32Array_type, &Int64Array_type, NULL
+  };
+
+  /* REGISTER(): macro to register the kernels of a matrix operation
+   * with every array type that it accepts.
+   */
+#define REGISTER(op, name) \
+  for (int i = 0; types[i]; i++) { \
+    dispatch_register(op, &TYPE, types[i], (obj_binary) FUNCTION(name)); \
+    dispatch_register(op, types[i], &TYPE, (obj_binary) FUNCTION(name)); \
+  }
+
+  /* register the matrix arithmetic kernels. */
+  REGISTER(DISPATCH_MTIMES,   mtimes);
+  REGISTER(DISPATCH_MRDIVIDE, mrdivide);
+  REGISTER(DISPATCH_MLDIVIDE, mldivide);
+  REGISTER(DISPATCH_MPOWER,   mpower);
+#undef REGISTER
+}
+
+/* TYPE: object type structure for matte integer arrays.
+ */
+struct _ObjectType TYPE = {
+  NAME,                                          /* name       */
+  sizeof(struct STRUCT),                         /* size       */
+  5,                                             /* precedence */
+
+  (obj_constructor) FUNCTION(new),               /* fn_new    */
+  (obj_constructor) FUNCTION(copy),              /* fn_copy   */
+  (obj_destructor)  FUNCTION(delete),            /* fn_delete */
+  (obj_display)     FUNCTION(disp),              /* fn_disp   */
+  (obj_assert)      FUNCTION(true),              /* fn_true   */
+
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
+  (obj_unary)    FUNCTION(uminus),               /* fn_uminus     */
+  (obj_binary)   broadcast_times,                /* fn_times      */
+  (obj_binary)   FUNCTION(mtimes),               /* fn_mtimes     */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
+  (obj_binary)   FUNCTION(mrdivide),             /* fn_mrdivide   */
+  (obj_binary)   FUNCTION(mldivide),             /* fn_mldivide   */
+  (obj_binary)   broadcast_power,                /* fn_power      */
+  (obj_binary)   FUNCTION(mpower),               /* fn_mpower     */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
+  NULL,                                          /* fn_mand       */
+  NULL,                                          /* fn_mor        */
+  (obj_unary)    FUNCTION(not),                  /* fn_not        */
+  NULL,                                          /* fn_colon      */
+  (obj_unary)    FUNCTION(transpose),            /* fn_ctranspose */
+  (obj_unary)    FUNCTION(transpose),            /* fn_transpose  */
+  (obj_variadic) FUNCTION(horzcat),              /* fn_horzcat    */
+  (obj_variadic) FUNCTION(vertcat),              /* fn_vertcat    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
+  NULL,                                          /* fn_subsasgn   */
+  (obj_unary)    FUNCTION(copy),                 /* fn_subsindex  */
+
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
+};
+
+/* undefine the type generator macros.
+ */
+#undef CONCAT3
+#undef FNAME
+#undef FUNCTION
+#undef IS_INT_ARRAY
+#undef TYPE
+#undef NAME
+#undef CLASS
+#undef STRUCT
+#undef TMIN
+#undef TMAX
+#undef FMT
+#undef P
+#undef S
+#undef B
+#undef T
+
@@ -0,0 +1,23 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the 32-bit integer array header. */
+#include <matte/int32-array.h>
+
+/* Int32Array: arrays of 32-bit integers. */
+#define B 32
+#define T int32_t
+#define TMIN INT32_MIN
+#define TMAX INT32_MAX
+#define FMT PRId32
+#define P int32_array
+#define S Int32Array
+#define STRUCT _Int32Array
+#define TYPE Int32Array_type
+#define NAME "Int32Array"
+#define CLASS "int32"
+#define IS_INT_ARRAY IS_INT32_ARRAY
+#include "int-array.c"
+
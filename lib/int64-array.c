@@ -0,0 +1,23 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the 64-bit integer array header. */
+#include <matte/int64-array.h>
+
+/* Int64Array: arrays of 64-bit integers. */
+#define B 64
+#define T int64_t
+#define TMIN INT64_MIN
+#define TMAX INT64_MAX
+#define FMT PRId64
+#define P int64_array
+#define S Int64Array
+#define STRUCT _Int64Array
+#define TYPE Int64Array_type
+#define NAME "Int64Array"
+#define CLASS "int64"
+#define IS_INT_ARRAY IS_INT64_ARRAY
+#include "int-array.c"
+
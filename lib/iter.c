@@ -11,11 +11,18 @@
 #include <matte/int.h>
 #include <matte/range.h>
 #include <matte/float.h>
+#include <matte/float-range.h>
 #include <matte/complex.h>
 #include <matte/vector.h>
 #include <matte/matrix.h>
 #include <matte/complex-vector.h>
 #include <matte/complex-matrix.h>
+#include <matte/logical.h>
+#include <matte/int32-array.h>
+#include <matte/int64-array.h>
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+#include <matte/sparse-matrix.h>
 
 /* next_int(): increment the value of an integer-based iterator.
  */
@@ -65,23 +72,57 @@ static int next_range (Zone z, Iter it) {
   /* get the iteration object. */
   Range r = (Range) it->obj;
 
+  /* check if the range has no elements. */
+  if (!range_get_length(r))
+    return 0;
+
   /* check if initialization is required. */
   if (!it->val) {
     /* initialize the iteration value. */
-    it->i = range_get_begin(r);
-    it->n = range_get_end(r);
-    it->val = (Object) int_new_with_value(z, it->i);
+    it->i = 0;
+    it->n = range_get_length(r);
+    it->val = (Object) int_new(z, NULL);
   }
   else {
-    /* update the iteration value. */
-    it->i += range_get_step(r);
-    int_set_value((Int) it->val, it->i);
+    /* check if the range has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
   }
 
-  /* check if the range limits were exceeded. */
-  if (it->i > it->n)
+  /* update the iteration value. */
+  int_set_value((Int) it->val, range_get_element(r, it->i));
+
+  /* return for another iteration. */
+  return 1;
+}
+
+/* next_float_range(): increment the value of a float range-based
+ * iterator.
+ */
+static int next_float_range (Zone z, Iter it) {
+  /* get the iteration object. */
+  FloatRange r = (FloatRange) it->obj;
+
+  /* check if the range has no elements. */
+  if (!float_range_get_length(r))
     return 0;
 
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = float_range_get_length(r);
+    it->val = (Object) float_new(z, NULL);
+  }
+  else {
+    /* check if the range has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  float_set_value((Float) it->val, float_range_get_element(r, it->i));
+
   /* return for another iteration. */
   return 1;
 }
@@ -209,6 +250,195 @@ static int next_complex_matrix (Zone z, Iter it) {
   return 1;
 }
 
+/* next_logical(): increment the value of a logical array-based
+ * iterator.
+ */
+static int next_logical (Zone z, Iter it) {
+  /* get the iteration object. */
+  Logical L = (Logical) it->obj;
+
+  /* check if the array has no elements. */
+  if (!logical_get_length(L))
+    return 0;
+
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = logical_get_length(L);
+    it->val = (Object) int_new(z, NULL);
+  }
+  else {
+    /* check if the array has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  int_set_value((Int) it->val, (long) logical_get(L, it->i));
+
+  /* return for another iteration. */
+  return 1;
+}
+
+/* next_int32_array(): increment the value of a 32-bit integer
+ * array-based iterator.
+ */
+static int next_int32_array (Zone z, Iter it) {
+  /* get the iteration object. */
+  Int32Array x = (Int32Array) it->obj;
+
+  /* check if the array has no elements. */
+  if (!int32_array_get_length(x))
+    return 0;
+
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = int32_array_get_length(x);
+    it->val = (Object) int_new(z, NULL);
+  }
+  else {
+    /* check if the array has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  int_set_value((Int) it->val, (long) int32_array_get(x, it->i));
+
+  /* return for another iteration. */
+  return 1;
+}
+
+/* next_int64_array(): increment the value of a 64-bit integer
+ * array-based iterator.
+ */
+static int next_int64_array (Zone z, Iter it) {
+  /* get the iteration object. */
+  Int64Array x = (Int64Array) it->obj;
+
+  /* check if the array has no elements. */
+  if (!int64_array_get_length(x))
+    return 0;
+
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = int64_array_get_length(x);
+    it->val = (Object) int_new(z, NULL);
+  }
+  else {
+    /* check if the array has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  int_set_value((Int) it->val, (long) int64_array_get(x, it->i));
+
+  /* return for another iteration. */
+  return 1;
+}
+
+/* next_single_vector(): increment the value of a single-precision
+ * vector-based iterator.
+ */
+static int next_single_vector (Zone z, Iter it) {
+  /* get the iteration object. */
+  SingleVector x = (SingleVector) it->obj;
+
+  /* check if the vector has no elements. */
+  if (!single_vector_get_length(x))
+    return 0;
+
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = single_vector_get_length(x);
+    it->val = (Object) float_new(z, NULL);
+  }
+  else {
+    /* check if the vector has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  float_set_value((Float) it->val, (double) single_vector_get(x, it->i));
+
+  /* return for another iteration. */
+  return 1;
+}
+
+/* next_single_matrix(): increment the value of a single-precision
+ * matrix-based iterator.
+ */
+static int next_single_matrix (Zone z, Iter it) {
+  /* get the iteration object. */
+  SingleMatrix A = (SingleMatrix) it->obj;
+
+  /* check if the matrix has no elements. */
+  if (!single_matrix_get_length(A))
+    return 0;
+
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = single_matrix_get_length(A);
+    it->val = (Object) float_new(z, NULL);
+  }
+  else {
+    /* check if the matrix has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  const long m = (A->tr == CblasNoTrans ? A->m : A->n);
+  float_set_value((Float) it->val,
+    (double) single_matrix_get(A, it->i % m, it->i / m));
+
+  /* return for another iteration. */
+  return 1;
+}
+
+/* next_sparse_matrix(): increment the value of a sparse matrix-based
+ * iterator.
+ */
+static int next_sparse_matrix (Zone z, Iter it) {
+  /* get the iteration object. */
+  SparseMatrix S = (SparseMatrix) it->obj;
+
+  /* check if the matrix has no elements. */
+  if (!S->m || !S->n)
+    return 0;
+
+  /* check if initialization is required. */
+  if (!it->val) {
+    /* initialize the iteration value. */
+    it->i = 0;
+    it->n = S->m * S->n;
+    it->val = (Object) float_new(z, NULL);
+  }
+  else {
+    /* check if the matrix has been exhausted. */
+    if (++it->i >= it->n)
+      return 0;
+  }
+
+  /* update the iteration value. */
+  float_set_value((Float) it->val,
+    sparse_matrix_get(S, it->i % S->m, it->i / S->m));
+
+  /* return for another iteration. */
+  return 1;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* iter_type(): return a pointer to the iterator object type.
@@ -265,6 +495,8 @@ int iter_next (Zone z, Iter it) {
   /* act based on type. */
   if (type == range_type())
     return next_range(z, it);
+  else if (type == float_range_type())
+    return next_float_range(z, it);
   else if (type == vector_type())
     return next_vector(z, it);
   else if (type == complex_vector_type())
@@ -279,6 +511,18 @@ int iter_next (Zone z, Iter it) {
     return next_float(z, it);
   else if (type == complex_type())
     return next_complex(z, it);
+  else if (type == logical_type())
+    return next_logical(z, it);
+  else if (type == int32_array_type())
+    return next_int32_array(z, it);
+  else if (type == int64_array_type())
+    return next_int64_array(z, it);
+  else if (type == single_vector_type())
+    return next_single_vector(z, it);
+  else if (type == single_matrix_type())
+    return next_single_matrix(z, it);
+  else if (type == sparse_matrix_type())
+    return next_sparse_matrix(z, it);
 
   /* unsupported type: throw an exception. */
   error(ERR_ITER_SUPPORT, type->name);
@@ -343,5 +587,10 @@ struct _ObjectType Iter_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
@@ -0,0 +1,733 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the logical, exception, broadcast and subscript headers. */
+#include <matte/logical.h>
+#include <matte/except.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+
+/* include headers for inferior types. */
+#include <matte/int.h>
+#include <matte/float.h>
+#include <matte/complex.h>
+
+/* include headers for superior types. */
+#include <matte/vector.h>
+#include <matte/matrix.h>
+#include <matte/complex-vector.h>
+#include <matte/complex-matrix.h>
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+
+/* LOGICAL_ONES: word whose bytes each hold a logical one. */
+#define LOGICAL_ONES 0x0101010101010101ULL
+
+/* POPCOUNT(): macro to count the nonzero bytes of a word of logical
+ * elements. as each byte is either one or zero, this is the number of
+ * set bits in the word.
+ */
+#ifdef __GNUC__
+#define POPCOUNT(w) ((long) __builtin_popcountll(w))
+#else
+#define POPCOUNT(w) ((long) (((w) * LOGICAL_ONES) >> 56))
+#endif
+
+/* logical_word(): load eight logical elements as one word.
+ *
+ * arguments:
+ *  @x: pointer to the first element to load.
+ *
+ * returns:
+ *  word holding the eight elements.
+ */
+static inline uint64_t logical_word (const unsigned char *x) {
+  uint64_t w;
+  memcpy(&w, x, sizeof(uint64_t));
+  return w;
+}
+
+/* logical_count(): count the true elements of an array of logical
+ * elements, eight at a time.
+ *
+ * arguments:
+ *  @n: number of elements to count.
+ *  @x: array of elements.
+ *
+ * returns:
+ *  number of true elements.
+ */
+static long logical_count (long n, const unsigned char *x) {
+  long nnz = 0, i = 0;
+
+  for (; i + 8 <= n; i += 8)
+    nnz += POPCOUNT(logical_word(x + i));
+
+  for (; i < n; i++)
+    nnz += x[i];
+
+  return nnz;
+}
+
+/* logical_type(): return a pointer to the logical object type.
+ */
+ObjectType logical_type (void) {
+  /* return the struct address. */
+  return &Logical_type;
+}
+
+/* logical_new(): allocate a new empty matte logical array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @args: constructor arguments.
+ *
+ * returns:
+ *  newly allocated empty logical array.
+ */
+Logical logical_new (Zone z, Object args) {
+  /* allocate a new logical array. */
+  Logical L = (Logical) object_alloc(z, &Logical_type);
+  if (!L)
+    return NULL;
+
+  /* initialize the array data and shape. */
+  L->data = NULL;
+  L->m = 0;
+  L->n = 0;
+  L->mat = 0;
+
+  /* return the new array. */
+  return L;
+}
+
+/* logical_new_with_size(): allocate a new matte logical array with a
+ * set number of rows and columns, initialized to false. arrays with
+ * more than one row and column have the shape of a matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @m: number of rows in the new array.
+ *  @n: number of columns in the new array.
+ *
+ * returns:
+ *  newly allocated false logical array.
+ */
+Logical logical_new_with_size (Zone z, long m, long n) {
+  /* validate the input arguments. */
+  if (m < 0 || n < 0)
+    fail(ERR_INVALID_ARGIN);
+
+  /* allocate a new logical array. */
+  Logical L = logical_new(z, NULL);
+  if (!L)
+    return NULL;
+
+  /* allocate the array data. */
+  const long len = m * n;
+  L->data = (unsigned char*) buffer_resize(NULL, 0, len, 1);
+  if (len && !L->data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the array shape and return the new array. */
+  L->m = m;
+  L->n = n;
+  L->mat = (m != 1 && n != 1);
+  return L;
+}
+
+/* logical_to_double(): allocate a new matte vector or matrix that holds
+ * the elements of a matte logical array as ones and zeros.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @L: matte logical array to access.
+ *
+ * returns:
+ *  newly allocated matte vector or matrix.
+ */
+Object logical_to_double (Zone z, Logical L) {
+  /* return null if the input array is null. */
+  if (!L)
+    return NULL;
+
+  /* allocate a matrix or vector of the same shape. */
+  const long len = L->m * L->n;
+  double *data;
+  Object obj;
+  if (L->mat) {
+    Matrix A = matrix_new_with_size(z, L->m, L->n);
+    if (!A)
+      return NULL;
+
+    data = A->data;
+    obj = (Object) A;
+  }
+  else {
+    Vector x = vector_new_with_length(z, len);
+    if (!x)
+      return NULL;
+
+    x->tr = (L->n == 1 ? CblasNoTrans : CblasTrans);
+    data = x->data;
+    obj = (Object) x;
+  }
+
+  /* store the widened elements. */
+  for (long i = 0; i < len; i++)
+    data[i] = (double) L->data[i];
+
+  /* return the new array. */
+  return obj;
+}
+
+/* logical_copy(): allocate a new matte logical array from another
+ * matte logical array. the duplicate shares the data buffer of the input
+ * array until either of them is modified.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @L: matte logical array to duplicate.
+ *
+ * returns:
+ *  duplicated matte logical array.
+ */
+Logical logical_copy (Zone z, Logical L) {
+  /* return null if the input argument is null. */
+  if (!L)
+    return NULL;
+
+  /* allocate a new logical array. */
+  Logical Lnew = logical_new(z, NULL);
+  if (!Lnew)
+    return NULL;
+
+  /* share the data buffer of the input array with the duplicate. */
+  Lnew->data = (unsigned char*) buffer_share(L->data);
+  Lnew->m = L->m;
+  Lnew->n = L->n;
+  Lnew->mat = L->mat;
+
+  /* return the new array. */
+  return Lnew;
+}
+
+/* logical_delete(): free all memory associated with a matte logical
+ * array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @L: matte logical array to free.
+ */
+void logical_delete (Zone z, Logical L) {
+  /* return if the array is null. */
+  if (!L)
+    return;
+
+  /* release the array data. */
+  buffer_release(L->data);
+}
+
+/* logical_get_length(): get the number of elements of a matte logical
+ * array.
+ *
+ * arguments:
+ *  @L: matte logical array to access.
+ *
+ * returns:
+ *  number of elements in the array.
+ */
+long logical_get_length (Logical L) {
+  /* return the array length. */
+  return (L ? L->m * L->n : 0);
+}
+
+/* logical_get(): get an element from a matte logical array.
+ *
+ * arguments:
+ *  @L: matte logical array to access.
+ *  @i: linear index of the element to get.
+ *
+ * returns:
+ *  requested array element.
+ */
+inline int logical_get (Logical L, long i) {
+  /* if the pointer and index are valid, return the element. */
+  if (L && i < L->m * L->n)
+    return L->data[i];
+
+  /* return false. */
+  return 0;
+}
+
+/* logical_unshare(): ensure that the data of a matte logical array is
+ * not shared with any other array, so that it may be modified in place.
+ *
+ * arguments:
+ *  @L: matte logical array to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int logical_unshare (Logical L) {
+  /* fail if the array is null. */
+  if (!L)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the array data if it is held by other arrays. */
+  const long len = L->m * L->n;
+  unsigned char *data = (unsigned char*) buffer_unshare(L->data, len, 1);
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared array data and return success. */
+  L->data = data;
+  return 1;
+}
+
+/* logical_set(): set an element of a matte logical array. the array
+ * data must not be shared, see logical_unshare().
+ *
+ * arguments:
+ *  @L: matte logical array to modify.
+ *  @i: linear index of the element to set.
+ *  @li: element value, which is true if nonzero.
+ */
+inline void logical_set (Logical L, long i, int li) {
+  /* if the pointer and index are valid, set the element. */
+  if (L && i < L->m * L->n)
+    L->data[i] = (li != 0);
+}
+
+/* logical_nnz(): count the true elements of a logical array.
+ *
+ * arguments:
+ *  @L: matte logical array to access.
+ *
+ * returns:
+ *  number of true elements.
+ */
+long logical_nnz (Logical L) {
+  return logical_count(logical_get_length(L), L->data);
+}
+
+/* logical_any(): short-circuit evaluator that any elements of a logical
+ * array are true. elements are tested eight at a time.
+ *
+ * arguments:
+ *  @L: matte logical array to access.
+ *
+ * returns:
+ *  long integer indicating the result.
+ */
+long logical_any (Logical L) {
+  const long n = logical_get_length(L);
+  long i = 0;
+
+  /* short-circuit to true at the first word holding a true element. */
+  for (; i + 8 <= n; i += 8) {
+    if (logical_word(L->data + i)) return 1L;
+  }
+
+  for (; i < n; i++) {
+    if (L->data[i]) return 1L;
+  }
+
+  /* return false. */
+  return 0L;
+}
+
+/* logical_all(): short-circuit evaluator that all elements of a logical
+ * array are true. elements are tested eight at a time.
+ *
+ * arguments:
+ *  @L: matte logical array to access.
+ *
+ * returns:
+ *  long integer indicating the result.
+ */
+long logical_all (Logical L) {
+  const long n = logical_get_length(L);
+  long i = 0;
+
+  /* short-circuit to false at the first word holding a false element. */
+  for (; i + 8 <= n; i += 8) {
+    if (logical_word(L->data + i) != LOGICAL_ONES) return 0L;
+  }
+
+  for (; i < n; i++) {
+    if (!L->data[i]) return 0L;
+  }
+
+  /* return true. */
+  return 1L;
+}
+
+/* logical_reduce(): test whether any or all elements in each column of
+ * a logical array are true.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @L: matte logical array to access.
+ *  @all: whether to test that all (1) or any (0) elements are true.
+ *
+ * returns:
+ *  newly allocated logical row vector holding one result per column.
+ */
+Logical logical_reduce (Zone z, Logical L, int all) {
+  /* allocate the result. */
+  Logical R = logical_new_with_size(z, 1, L->n);
+  if (!R)
+    return NULL;
+
+  /* count the true elements of each column. */
+  for (long j = 0; j < L->n; j++) {
+    const long nnz = logical_count(L->m, L->data + j * L->m);
+    R->data[j] = (all ? nnz == L->m : nnz > 0);
+  }
+
+  /* return the result. */
+  return R;
+}
+
+/* logical_find(): locate the true elements of a logical array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @L: matte logical array to access.
+ *
+ * returns:
+ *  newly allocated vector of one-based linear indices, which is a row
+ *  vector if the array is a row vector, and a column vector otherwise.
+ */
+Object logical_find (Zone z, Logical L) {
+  /* allocate a vector with one element per true element. */
+  Vector x = vector_new_with_length(z, logical_nnz(L));
+  if (!x)
+    return NULL;
+
+  /* store the indices of the true elements. */
+  const long len = logical_get_length(L);
+  for (long i = 0, k = 0; i < len; i++) {
+    if (L->data[i])
+      x->data[k++] = (double) (i + 1);
+  }
+
+  /* return the new vector. */
+  x->tr = (!L->mat && L->m == 1 ? CblasTrans : CblasNoTrans);
+  return (Object) x;
+}
+
+/* logical_disp(): display function for matte logical arrays.
+ */
+int logical_disp (Zone z, Logical L) {
+  printf("\n");
+  if (L->mat) {
+    /* print matrix-shaped arrays by rows. */
+    for (long i = 0; i < L->m; i++) {
+      printf("\n");
+      for (long j = 0; j < L->n; j++)
+        printf("  %d", (int) L->data[i + j * L->m]);
+    }
+  }
+  else {
+    /* print vector-shaped arrays one element per line. */
+    const long n = logical_get_length(L);
+    for (long i = 0; i < n; i++)
+      printf("\n  %d", (int) L->data[i]);
+  }
+
+  /* print newlines and return success. */
+  printf("\n\n");
+  return 1;
+}
+
+/* logical_true(): assert the truth of a logical array, which holds when
+ * the array is non-empty and all its elements are true.
+ */
+int logical_true (Logical L) {
+  return (logical_get_length(L) > 0 && logical_all(L));
+}
+
+/* logical_test(): evaluate the truth of a logical or numeric operand of
+ * a short-circuit logical operation.
+ *
+ * arguments:
+ *  @obj: operand to evaluate.
+ *  @t: truth value of the operand, on return.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the operand is supported.
+ */
+static int logical_test (Object obj, int *t) {
+  if (IS_LOGICAL(obj))
+    *t = logical_true((Logical) obj);
+  else if (IS_VECTOR(obj))
+    *t = vector_all((Vector) obj);
+  else if (IS_COMPLEX(obj))
+    *t = (complex_get_abs((Complex) obj) != 0.0);
+  else if (IS_FLOAT(obj))
+    *t = (float_get_value((Float) obj) != 0.0);
+  else if (IS_INT(obj))
+    *t = (int_get_value((Int) obj) != 0);
+  else
+    return 0;
+
+  return 1;
+}
+
+/* logical_bitwise(): compute the element-wise logical-and or logical-or
+ * of two logical arrays, eight elements at a time.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A, @B: logical arrays of the same shape.
+ *  @lor: whether to compute logical-or (1) or logical-and (0).
+ *
+ * returns:
+ *  newly allocated logical array.
+ */
+static Logical logical_bitwise (Zone z, Logical A, Logical B, int lor) {
+  Logical C = logical_new_with_size(z, A->m, A->n);
+  if (!C)
+    return NULL;
+
+  const long n = A->m * A->n;
+  if (lor) {
+    for (long i = 0; i < n; i++)
+      C->data[i] = A->data[i] | B->data[i];
+  }
+  else {
+    for (long i = 0; i < n; i++)
+      C->data[i] = A->data[i] & B->data[i];
+  }
+
+  C->mat = (A->mat || B->mat);
+  return C;
+}
+
+/* logical_scalar(): check whether an operand of a logical array
+ * operation is a real or complex scalar, which is handled by the
+ * broadcast engine.
+ */
+static int logical_scalar (Object obj) {
+  return (IS_INT(obj) || IS_FLOAT(obj) || IS_COMPLEX(obj) ||
+          (IS_LOGICAL(obj) && logical_get_length((Logical) obj) == 1));
+}
+
+/* logical_expand(): compute an operation on a logical array and an
+ * operand, by widening the logical operands into temporary double
+ * vectors or matrices and dispatching the operation again.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @fn: dispatch function of the operation.
+ *
+ * returns:
+ *  result of the operation.
+ */
+static Object logical_expand (Zone z, Object a, Object b, obj_binary fn) {
+  /* widen the logical operands. */
+  Object wa = (IS_LOGICAL(a) ? logical_to_double(z, (Logical) a) : a);
+  Object wb = (IS_LOGICAL(b) ? logical_to_double(z, (Logical) b) : b);
+
+  /* compute the result. */
+  Object c = (wa && wb ? fn(z, wa, wb) : NULL);
+
+  /* free the temporary arrays and return the result. */
+  if (wa != a) object_free(z, wa);
+  if (wb != b) object_free(z, wb);
+  return c;
+}
+
+/* logical_uminus(): unary negation function for logical arrays.
+ */
+Object logical_uminus (Zone z, Logical A) {
+  Object a = logical_to_double(z, A);
+  if (!a)
+    return NULL;
+
+  Object b = object_uminus(z, a);
+  object_free(z, a);
+  return b;
+}
+
+/* logical_mtimes(): matrix multiplication function for logical arrays.
+ */
+Object logical_mtimes (Zone z, Object a, Object b) {
+  if (logical_scalar(a) || logical_scalar(b))
+    return broadcast_times(z, a, b);
+
+  return logical_expand(z, a, b, object_mtimes);
+}
+
+/* logical_mrdivide(): matrix right division function for logical
+ * arrays.
+ */
+Object logical_mrdivide (Zone z, Object a, Object b) {
+  if (logical_scalar(b))
+    return broadcast_rdivide(z, a, b);
+
+  return logical_expand(z, a, b, object_mrdivide);
+}
+
+/* logical_mldivide(): matrix left division function for logical arrays.
+ */
+Object logical_mldivide (Zone z, Object a, Object b) {
+  if (logical_scalar(a))
+    return broadcast_ldivide(z, a, b);
+
+  return logical_expand(z, a, b, object_mldivide);
+}
+
+/* logical_mpower(): matrix power function for logical arrays.
+ */
+Object logical_mpower (Zone z, Object a, Object b) {
+  if (logical_scalar(a) && logical_scalar(b))
+    return broadcast_power(z, a, b);
+
+  return logical_expand(z, a, b, object_mpower);
+}
+
+/* logical_and(): element-wise logical-and operation for logical
+ * arrays. logical arrays of the same shape are combined directly, and
+ * all other operands are broadcast.
+ */
+Object logical_and (Zone z, Object a, Object b) {
+  if (IS_LOGICAL(a) && IS_LOGICAL(b) &&
+      ((Logical) a)->m == ((Logical) b)->m &&
+      ((Logical) a)->n == ((Logical) b)->n)
+    return (Object) logical_bitwise(z, (Logical) a, (Logical) b, 0);
+
+  return broadcast_and(z, a, b);
+}
+
+/* logical_or(): element-wise logical-or operation for logical arrays.
+ */
+Object logical_or (Zone z, Object a, Object b) {
+  if (IS_LOGICAL(a) && IS_LOGICAL(b) &&
+      ((Logical) a)->m == ((Logical) b)->m &&
+      ((Logical) a)->n == ((Logical) b)->n)
+    return (Object) logical_bitwise(z, (Logical) a, (Logical) b, 1);
+
+  return broadcast_or(z, a, b);
+}
+
+/* logical_mand(): matrix logical-and operation for logical arrays.
+ */
+Int logical_mand (Zone z, Object a, Object b) {
+  int ta, tb;
+  if (!logical_test(a, &ta) || !logical_test(b, &tb))
+    return NULL;
+
+  return int_new_with_value(z, ta && tb);
+}
+
+/* logical_mor(): matrix logical-or operation for logical arrays.
+ */
+Int logical_mor (Zone z, Object a, Object b) {
+  int ta, tb;
+  if (!logical_test(a, &ta) || !logical_test(b, &tb))
+    return NULL;
+
+  return int_new_with_value(z, ta || tb);
+}
+
+/* logical_not(): logical negation operation for logical arrays.
+ */
+Logical logical_not (Zone z, Logical A) {
+  Logical B = logical_new_with_size(z, A->m, A->n);
+  if (!B)
+    return NULL;
+
+  const long n = A->m * A->n;
+  for (long i = 0; i < n; i++)
+    B->data[i] = A->data[i] ^ 1;
+
+  B->mat = A->mat;
+  return B;
+}
+
+/* logical_transpose(): transposition function for logical arrays.
+ * vector-shaped arrays share the data of their operand.
+ */
+Logical logical_transpose (Zone z, Logical A) {
+  /* transpose vectors by exchanging their dimensions. */
+  if (!A->mat) {
+    Logical B = logical_copy(z, A);
+    if (!B)
+      return NULL;
+
+    B->m = A->n;
+    B->n = A->m;
+    return B;
+  }
+
+  /* transpose matrices element by element. */
+  Logical B = logical_new_with_size(z, A->n, A->m);
+  if (!B)
+    return NULL;
+
+  for (long j = 0; j < A->n; j++)
+    for (long i = 0; i < A->m; i++)
+      B->data[j + i * A->n] = A->data[i + j * A->m];
+
+  B->mat = 1;
+  return B;
+}
+
+/* Logical_type: object type structure for matte logical arrays.
+ */
+struct _ObjectType Logical_type = {
+  "Logical",                                     /* name       */
+  sizeof(struct _Logical),                       /* size       */
+  5,                                             /* precedence */
+
+  (obj_constructor) logical_new,                 /* fn_new    */
+  (obj_constructor) logical_copy,                /* fn_copy   */
+  (obj_destructor)  logical_delete,              /* fn_delete */
+  (obj_display)     logical_disp,                /* fn_disp   */
+  (obj_assert)      logical_true,                /* fn_true   */
+
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
+  (obj_unary)    logical_uminus,                 /* fn_uminus     */
+  (obj_binary)   broadcast_times,                /* fn_times      */
+  (obj_binary)   logical_mtimes,                 /* fn_mtimes     */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
+  (obj_binary)   logical_mrdivide,               /* fn_mrdivide   */
+  (obj_binary)   logical_mldivide,               /* fn_mldivide   */
+  (obj_binary)   broadcast_power,                /* fn_power      */
+  (obj_binary)   logical_mpower,                 /* fn_mpower     */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   logical_and,                    /* fn_and        */
+  (obj_binary)   logical_or,                     /* fn_or         */
+  (obj_binary)   logical_mand,                   /* fn_mand       */
+  (obj_binary)   logical_mor,                    /* fn_mor        */
+  (obj_unary)    logical_not,                    /* fn_not        */
+  NULL,                                          /* fn_colon      */
+  (obj_unary)    logical_transpose,              /* fn_ctranspose */
+  (obj_unary)    logical_transpose,              /* fn_transpose  */
+  (obj_variadic) vector_horzcat,                 /* fn_horzcat    */
+  (obj_variadic) vector_vertcat,                 /* fn_vertcat    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
+  NULL,                                          /* fn_subsasgn   */
+  (obj_unary)    logical_find,                   /* fn_subsindex  */
+
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
+};
+
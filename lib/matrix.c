@@ -3,9 +3,16 @@
  * Released under the MIT License
  */
 
-/* include the matrix and exception headers. */
+/* include the matrix, exception, blas, simd, broadcast, subscript and
+ * transpose headers.
+ */
 #include <matte/matrix.h>
 #include <matte/except.h>
+#include <matte/blas.h>
+#include <matte/simd.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+#include <matte/transpose.h>
 
 /* include headers for inferior types. */
 #include <matte/int.h>
@@ -13,11 +20,18 @@
 #include <matte/float.h>
 #include <matte/complex.h>
 #include <matte/vector.h>
+#include <matte/logical.h>
 
 /* include headers for superior types. */
 #include <matte/complex-vector.h>
 #include <matte/complex-matrix.h>
 
+/* ROWS(), COLS(): macros to get the row and column counts of a matrix,
+ * accounting for its transposition status.
+ */
+#define ROWS(A) ((A)->tr == CblasNoTrans ? (A)->m : (A)->n)
+#define COLS(A) ((A)->tr == CblasNoTrans ? (A)->n : (A)->m)
+
 /* matrix_type(): return a pointer to the matrix object type.
  */
 ObjectType matrix_type (void) {
@@ -44,6 +58,7 @@ Matrix matrix_new (Zone z, Object args) {
   A->data = NULL;
   A->m = 0;
   A->n = 0;
+  A->tr = CblasNoTrans;
 
   /* return the new matrix. */
   return A;
@@ -70,55 +85,9 @@ Matrix matrix_new_with_size (Zone z, long m, long n) {
   return A;
 }
 
-/* matrix_new_from_vector_sum(): allocate a new matte matrix using the
- * broadcasted sum of two vectors.
- *
- * arguments:
- *  @z: zone allocator to utilize.
- *  @alpha: scale factor to apply to @y.
- *  @x, @y: vector operands to addition.
- *
- * returns:
- *  newly allocated and filled matrix.
- */
-Matrix matrix_new_from_vector_sum (Zone z, double alpha,
-                                   Vector x, Vector y) {
-  /* return null if either input argument is null. */
-  if (!x || !y)
-    return NULL;
-
-  /* return null if the transposition states match. */
-  if (x->tr == y->tr)
-    return NULL;
-
-  /* determine the matrix row and column count. */
-  const long m = (x->tr == CblasNoTrans ? x->n : y->n);
-  const long n = (x->tr == CblasNoTrans ? y->n : x->n);
-
-  /* allocate a new matrix. */
-  Matrix A = matrix_new_with_size(z, m, n);
-  if (!A)
-    return NULL;
-
-  /* compute the matrix elements. */
-  if (x->tr == CblasNoTrans) {
-    /* use 'un-transposed' indices in the sum. */
-    for (long i = 0; i < m; i++)
-      for (long j = 0; j < n; j++)
-        matrix_set(A, i, j, vector_get(x, i) + alpha * vector_get(y, j));
-  }
-  else {
-    /* use 'transposed' indices in the sum. */
-    for (long i = 0; i < m; i++)
-      for (long j = 0; j < n; j++)
-        matrix_set(A, i, j, vector_get(x, j) + alpha * vector_get(y, i));
-  }
-
-  /* return the newly allocated and initialized matrix. */
-  return A;
-}
-
 /* matrix_copy(): allocate a new matte matrix from another matte matrix.
+ * the duplicate shares the data buffer of the input matrix until either
+ * of them is modified.
  *
  * arguments:
  *  @z: zone allocator to utilize.
@@ -132,22 +101,24 @@ Matrix matrix_copy (Zone z, Matrix A) {
   if (!A)
     return NULL;
 
-  /* allocate a new matrix of the same size. */
-  Matrix Anew = matrix_new_with_size(z, A->m, A->n);
+  /* allocate a new matrix. */
+  Matrix Anew = matrix_new(z, NULL);
   if (!Anew)
     return NULL;
 
-  /* copy the memory contents of the input matrix into the duplicate. */
-  const long bytes = Anew->m * Anew->n * sizeof(double);
-  if (bytes)
-    memcpy(Anew->data, A->data, bytes);
+  /* share the data buffer of the input matrix with the duplicate. */
+  Anew->data = (double*) buffer_share(A->data);
+  Anew->m = A->m;
+  Anew->n = A->n;
+  Anew->tr = A->tr;
 
   /* return the new matrix. */
   return Anew;
 }
 
 /* matrix_copy_trans(): allocate a new, transposed matte matrix
- * from another matte matrix.
+ * from another matte matrix. the elements of the duplicate are stored
+ * in transposed order, and its transposition status is cleared.
  *
  * arguments:
  *  @z: zone allocator to utilize.
@@ -161,15 +132,24 @@ Matrix matrix_copy_trans (Zone z, Matrix A) {
   if (!A)
     return NULL;
 
-  /* allocate a new matrix of the same size. */
+  /* transposed matrices already store the elements of their
+   * transpose, which may be shared with the duplicate.
+   */
+  if (A->tr != CblasNoTrans) {
+    Matrix Anew = matrix_copy(z, A);
+    if (Anew)
+      Anew->tr = CblasNoTrans;
+
+    return Anew;
+  }
+
+  /* allocate a new matrix of the transposed size. */
   Matrix Anew = matrix_new_with_size(z, A->n, A->m);
   if (!Anew)
     return NULL;
 
-  /* copy the memory contents of the input matrix into the duplicate. */
-  for (long i = 0; i < A->m; i++)
-    for (long j = 0; j < A->n; j++)
-      matrix_set(Anew, j, i, matrix_get(A, i, j));
+  /* store the transposed elements of the input matrix. */
+  transpose_d(A->m, A->n, A->data, Anew->data);
 
   /* return the new matrix. */
   return Anew;
@@ -186,8 +166,8 @@ void matrix_delete (Zone z, Matrix A) {
   if (!A)
     return;
 
-  /* free the matrix data. */
-  free(A->data);
+  /* release the matrix data. */
+  buffer_release(A->data);
 }
 
 /* matrix_get_rows(): get the row count of a matte matrix.
@@ -240,6 +220,13 @@ long matrix_get_length (Matrix A) {
  *  requested matrix element.
  */
 inline double matrix_get (Matrix A, long i, long j) {
+  /* swap the indices of transposed matrices. */
+  if (A && A->tr != CblasNoTrans) {
+    const long k = i;
+    i = j;
+    j = k;
+  }
+
   /* if the pointer and indices are valid, return the element. */
   if (A && i < A->m && j < A->n)
     return A->data[i + j * A->m];
@@ -259,6 +246,10 @@ inline double matrix_get (Matrix A, long i, long j) {
  *  requested matrix element.
  */
 inline double matrix_get_element (Matrix A, long i) {
+  /* map the index of transposed matrices into their elements. */
+  if (A && A->tr != CblasNoTrans && A->n)
+    i = i / A->n + (i % A->n) * A->m;
+
   /* if the pointer and index are valid, return the element. */
   if (A && i < A->m * A->n)
     return A->data[i];
@@ -322,20 +313,19 @@ int matrix_set_size (Matrix A, long m, long n) {
   if (A->m == m && A->n == n)
     return 1;
 
-  /* compute the current and new allocation requirements. */
-  const long bytes = A->m * A->n * sizeof(double);
-  const long newbytes = m * n * sizeof(double);
+  /* compute the new number of matrix elements. */
+  const long len = m * n;
 
-  /* reallocate the matrix data. */
-  A->data = (double*) realloc(A->data, newbytes);
-  if (!A->data)
-    fail(ERR_BAD_ALLOC);
+  /* reallocate the matrix data, zeroing any new elements. */
+  double *data = (double*)
+    buffer_resize(A->data, A->m * A->n, len, sizeof(double));
 
-  /* fill the new trailing elements with zeros. */
-  if (newbytes > bytes)
-    memset(A->data + bytes, 0, newbytes - bytes);
+  /* check if reallocation failed. */
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
 
-  /* store the new matrix dimensions. */
+  /* store the new matrix data and dimensions. */
+  A->data = data;
   A->m = m;
   A->n = n;
 
@@ -343,7 +333,85 @@ int matrix_set_size (Matrix A, long m, long n) {
   return 1;
 }
 
-/* matrix_set(): set an element of a matte matrix.
+/* matrix_unshare(): ensure that the data of a matte matrix is not
+ * shared with any other matrix, so that it may be modified in place.
+ *
+ * arguments:
+ *  @A: matte matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int matrix_unshare (Matrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the matrix data if it is held by other matrices. */
+  const long len = A->m * A->n;
+  double *data = (double*)
+    buffer_unshare(A->data, len, sizeof(double));
+
+  /* check if the copy failed. */
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared matrix data and return success. */
+  A->data = data;
+  return 1;
+}
+
+/* matrix_untranspose(): ensure that the elements of a matte matrix are
+ * stored in untransposed order, so that they may be accessed directly.
+ * the transposition status of the matrix is cleared.
+ *
+ * arguments:
+ *  @A: matte matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int matrix_untranspose (Matrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the matrix is not transposed. */
+  if (A->tr == CblasNoTrans)
+    return 1;
+
+  /* transpose square matrices in place, unless their elements are
+   * shared with other matrices.
+   */
+  if (A->m == A->n && !buffer_is_shared(A->data)) {
+    transpose_d_inplace(A->m, A->data);
+    A->tr = CblasNoTrans;
+    return 1;
+  }
+
+  /* allocate a new buffer for the transposed elements. */
+  const long len = A->m * A->n;
+  double *data = (double*) buffer_resize(NULL, 0, len, sizeof(double));
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the transposed elements. */
+  transpose_d(A->m, A->n, A->data, data);
+
+  /* replace the matrix data and dimensions. */
+  buffer_release(A->data);
+  A->data = data;
+  const long m = A->m;
+  A->m = A->n;
+  A->n = m;
+  A->tr = CblasNoTrans;
+
+  /* return success. */
+  return 1;
+}
+
+/* matrix_set(): set an element of a matte matrix. the matrix data must
+ * not be shared, see matrix_unshare().
  *
  * arguments:
  *  @A: matte matrix to modify.
@@ -352,6 +420,13 @@ int matrix_set_size (Matrix A, long m, long n) {
  *  @aij: element value.
  */
 inline void matrix_set (Matrix A, long i, long j, double aij) {
+  /* swap the indices of transposed matrices. */
+  if (A && A->tr != CblasNoTrans) {
+    const long k = i;
+    i = j;
+    j = k;
+  }
+
   /* if the pointer and indices are valid, set the element. */
   if (A && i < A->m && j < A->n)
     A->data[i + j * A->m] = aij;
@@ -366,6 +441,10 @@ inline void matrix_set (Matrix A, long i, long j, double aij) {
  *  @ai: element value.
  */
 inline void matrix_set_element (Matrix A, long i, double ai) {
+  /* map the index of transposed matrices into their elements. */
+  if (A && A->tr != CblasNoTrans && A->n)
+    i = i / A->n + (i % A->n) * A->m;
+
   /* if the pointer and index are valid, set the element. */
   if (A && i < A->m * A->n)
     A->data[i] = ai;
@@ -376,9 +455,9 @@ inline void matrix_set_element (Matrix A, long i, double ai) {
 int matrix_disp (Zone z, Matrix A) {
   /* print the matrix contents. */
   printf("\n");
-  for (long i = 0; i < A->m; i++) {
+  for (long i = 0; i < ROWS(A); i++) {
     printf("\n");
-    for (long j = 0; j < A->n; j++) {
+    for (long j = 0; j < COLS(A); j++) {
       const double aij = matrix_get(A, i, j);
       printf("  %lg", aij);
     }
@@ -389,10 +468,540 @@ int matrix_disp (Zone z, Matrix A) {
   return 1;
 }
 
-/* matrix_transpose(): transposition function for matte matrices.
+/* matrix_transpose(): transposition function for matte matrices. the
+ * transposed matrix shares the data of its operand.
  */
 Matrix matrix_transpose (Zone z, Matrix A) {
-  return matrix_copy_trans(z, A);
+  Matrix Atr = matrix_copy(z, A);
+  if (!Atr)
+    return NULL;
+
+  Atr->tr = (A->tr == CblasNoTrans ? CblasTrans : CblasNoTrans);
+  return Atr;
+}
+
+/* matrix_solve(): solve a square linear system in place, using the
+ * cheapest method allowed by the structure of its coefficients:
+ * substitution for triangular matrices, cholesky factorization for
+ * symmetric positive definite matrices, and lu factorization otherwise.
+ *
+ * arguments:
+ *  @A: square matrix of coefficients, which may be transposed.
+ *  @trans: whether to solve with @A or its transpose.
+ *  @B: column-major right-hand sides, overwritten by the solutions.
+ *  @nrhs: number of right-hand sides in @B.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int matrix_solve (Matrix A, MatteTranspose trans,
+                         double *B, long nrhs) {
+  /* fail if the matrix is not square. */
+  if (A->m != A->n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* return if the system is empty. */
+  const long n = A->n;
+  if (n == 0 || nrhs == 0)
+    return 1;
+
+  /* fold the transposition status of the matrix into the solve. */
+  if (A->tr != CblasNoTrans)
+    trans = (trans == CblasNoTrans ? CblasTrans : CblasNoTrans);
+
+  /* determine the structure of the matrix, stopping early once it
+   * is known to be general.
+   */
+  int upper = 1, lower = 1, spd = 1;
+  for (long j = 0; j < n && (upper || lower || spd); j++) {
+    if (A->data[j + j * n] <= 0.0)
+      spd = 0;
+
+    for (long i = 0; i < j; i++) {
+      const double aij = A->data[i + j * n];
+      const double aji = A->data[j + i * n];
+      if (aij) lower = 0;
+      if (aji) upper = 0;
+      if (aij != aji) spd = 0;
+    }
+  }
+
+  /* solve triangular systems by substitution. */
+  if (upper || lower) {
+    matte_blas->dtrsm(CblasColMajor, CblasLeft,
+                      upper ? CblasUpper : CblasLower, trans, CblasNonUnit,
+                      n, nrhs, 1.0, A->data, n, B, n);
+
+    return 1;
+  }
+
+  /* allocate a workspace for the factorization. */
+  double *W = malloc(n * n * sizeof(double));
+  int *ipiv = malloc(n * sizeof(int));
+  if (!W || !ipiv) {
+    free(W);
+    free(ipiv);
+    fail(ERR_BAD_ALLOC);
+  }
+
+  /* attempt a cholesky factorization of symmetric matrices with
+   * positive diagonals, which is only possible if they are also
+   * positive definite.
+   */
+  memcpy(W, A->data, n * n * sizeof(double));
+  if (spd && matte_blas->dpotrf(CblasColMajor, CblasUpper, n, W, n) == 0) {
+          matte_blas->dpotrs(CblasColMajor, CblasUpper, n, nrhs, W, n, B, n);
+    free(W);
+    free(ipiv);
+    return 1;
+  }
+  else if (spd) {
+    memcpy(W, A->data, n * n * sizeof(double));
+  }
+
+  /* fall back to an lu factorization. */
+  if (matte_blas->dgetrf(CblasColMajor, n, n, W, n, ipiv) != 0) {
+          free(W);
+    free(ipiv);
+    fail(ERR_MATRIX_SINGULAR);
+  }
+
+  /* solve the system and free the workspace. */
+  matte_blas->dgetrs(CblasColMajor, trans, n, nrhs, W, n, ipiv, B, n);
+  free(W);
+  free(ipiv);
+  return 1;
+}
+
+/* matrix_uminus(): unary negation function for matrices.
+ */
+Matrix matrix_uminus (Zone z, Matrix A) {
+  Matrix B = matrix_new_with_size(z, A->m, A->n);
+  if (!B)
+    return NULL;
+
+  matte_blas->daxpy(A->m * A->n, -1.0, A->data, 1, B->data, 1);
+  B->tr = A->tr;
+  return B;
+}
+
+/* matrix_fill_lower(): copy the upper triangle of a square matte matrix
+ * into its lower triangle, as required after symmetric rank-k updates.
+ *
+ * arguments:
+ *  @A: matte matrix to modify.
+ */
+static void matrix_fill_lower (Matrix A) {
+  for (long j = 0; j < A->n; j++)
+    for (long i = j + 1; i < A->m; i++)
+      A->data[i + j * A->m] = A->data[j + i * A->m];
+}
+
+/* matrix_widen(): compute a matrix operation that involves a logical
+ * array, by widening the logical operands into temporary double arrays
+ * and dispatching the operation again.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @fn: dispatch function of the operation.
+ *
+ * returns:
+ *  result of the operation.
+ */
+static Object matrix_widen (Zone z, Object a, Object b, obj_binary fn) {
+  /* widen the logical operands. */
+  Object wa = (IS_LOGICAL(a) ? logical_to_double(z, (Logical) a) : a);
+  Object wb = (IS_LOGICAL(b) ? logical_to_double(z, (Logical) b) : b);
+
+  /* compute the result. */
+  Object c = (wa && wb ? fn(z, wa, wb) : NULL);
+
+  /* free the temporary arrays and return the result. */
+  if (wa != a) object_free(z, wa);
+  if (wb != b) object_free(z, wb);
+  return c;
+}
+
+/* matrix_mtimes(): matrix multiplication function for matrices. the
+ * transposition status of each operand is passed to blas, so that
+ * transposed operands are never copied. products of a matrix with its
+ * own transpose are computed by a symmetric rank-k update.
+ */
+Object matrix_mtimes (Zone z, Object a, Object b) {
+  if (IS_MATRIX(a)) {
+    Matrix A = (Matrix) a;
+
+    if (IS_COMPLEX_MATRIX(b)) {
+      /* matrix * complex matrix => complex matrix */
+      ComplexMatrix Ac = complex_matrix_new_from_matrix(z, A);
+      if (!Ac)
+        return NULL;
+
+      Object C = object_mtimes(z, (Object) Ac, b);
+      object_free(z, Ac);
+      return C;
+    }
+    else if (IS_MATRIX(b)) {
+      /* matrix * matrix => matrix */
+      Matrix B = (Matrix) b;
+      if (COLS(A) != ROWS(B))
+        throw(z, ERR_SIZE_MISMATCH_MM(A->tr, B->tr, A, B));
+
+      /* X' * X => symmetric matrix
+       * X * X' => symmetric matrix
+       */
+      if (A->data == B->data && A->m == B->m && A->n == B->n &&
+          A->tr != B->tr) {
+        Matrix C = matrix_new_with_size(z, ROWS(A), ROWS(A));
+        if (!C || !matte_dsyrk(CblasUpper, A->tr, 1.0, A, 0.0, C))
+          return NULL;
+
+        matrix_fill_lower(C);
+        return (Object) C;
+      }
+
+      Matrix C = matrix_new_with_size(z, ROWS(A), COLS(B));
+      if (C && matte_dgemm(A->tr, B->tr, 1.0, A, B, 0.0, C))
+        return (Object) C;
+
+      return NULL;
+    }
+    else if (IS_VECTOR(b)) {
+      Vector x = (Vector) b;
+
+      if (x->tr == CblasNoTrans && x->n == COLS(A)) {
+        /* matrix * column => column */
+        Vector y = vector_new_with_length(z, ROWS(A));
+        if (y && matte_dgemv(A->tr, 1.0, A, x, 0.0, y))
+          return (Object) y;
+
+        return NULL;
+      }
+      else if (x->tr != CblasNoTrans && COLS(A) == 1) {
+        /* matrix * row => matrix */
+        Matrix C = matrix_new_with_size(z, ROWS(A), x->n);
+        if (!C)
+          return NULL;
+
+        matte_blas->dger(CblasColMajor, C->m, C->n, 1.0, A->data, 1,
+                         x->data, 1, C->data, C->m);
+
+        return (Object) C;
+      }
+
+      throw(z, ERR_SIZE_MISMATCH_MV(A->tr, A, x));
+    }
+  }
+  else if (IS_MATRIX(b) && IS_VECTOR(a)) {
+    Matrix B = (Matrix) b;
+    Vector x = (Vector) a;
+
+    if (x->tr != CblasNoTrans && x->n == ROWS(B)) {
+      /* row * matrix => row */
+      const MatteTranspose trB =
+        (B->tr == CblasNoTrans ? CblasTrans : CblasNoTrans);
+
+      Vector y = vector_new_with_length(z, COLS(B));
+      if (y && matte_dgemv(trB, 1.0, B, x, 0.0, y)) {
+        y->tr = CblasTrans;
+        return (Object) y;
+      }
+
+      return NULL;
+    }
+    else if (x->tr == CblasNoTrans && ROWS(B) == 1) {
+      /* column * matrix => matrix */
+      Matrix C = matrix_new_with_size(z, x->n, COLS(B));
+      if (!C)
+        return NULL;
+
+      matte_blas->dger(CblasColMajor, C->m, C->n, 1.0, x->data, 1,
+                       B->data, 1, C->data, C->m);
+
+      return (Object) C;
+    }
+
+    throw(z, ERR_SIZE_MISMATCH_VM(x, B->tr, B));
+  }
+
+  /* matrix * scalar => matrix
+   * scalar * matrix => matrix
+   */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a) ||
+      IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_times(z, a, b);
+
+  /* matrix * logical => matrix * double */
+  if (IS_LOGICAL(a) || IS_LOGICAL(b))
+    return matrix_widen(z, a, b, object_mtimes);
+
+  throw(z, ERR_OBJ_BINARY, "mtimes",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* matrix_mldivide(): matrix left division function for matrices.
+ */
+Object matrix_mldivide (Zone z, Object a, Object b) {
+  if (IS_MATRIX(a)) {
+    Matrix A = (Matrix) a;
+
+    if (IS_MATRIX(b)) {
+      /* matrix \ matrix => matrix */
+      Matrix B = (Matrix) b;
+      if (ROWS(A) != ROWS(B))
+        throw(z, ERR_SIZE_MISMATCH_MM(A->tr, B->tr, A, B));
+
+      Matrix X = matrix_copy(z, B);
+      if (X && matrix_untranspose(X) && matrix_unshare(X) &&
+          matrix_solve(A, CblasNoTrans, X->data, X->n))
+        return (Object) X;
+
+      return NULL;
+    }
+    else if (IS_VECTOR(b)) {
+      /* matrix \ column => column */
+      Vector x = (Vector) b;
+      if (x->tr != CblasNoTrans || ROWS(A) != x->n)
+        throw(z, ERR_SIZE_MISMATCH_MV(A->tr, A, x));
+
+      Vector y = vector_copy(z, x);
+      if (y && vector_unshare(y) &&
+          matrix_solve(A, CblasNoTrans, y->data, 1))
+        return (Object) y;
+
+      return NULL;
+    }
+  }
+  else if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a)) {
+    /* scalar \ matrix => matrix */
+    return broadcast_ldivide(z, a, b);
+  }
+
+  /* matrix \ logical => matrix \ double */
+  if (IS_LOGICAL(a) || IS_LOGICAL(b))
+    return matrix_widen(z, a, b, object_mldivide);
+
+  throw(z, ERR_OBJ_BINARY, "mldivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* matrix_mrdivide(): matrix right division function for matrices.
+ * right division by a matrix is computed as left division by its
+ * transpose.
+ */
+Object matrix_mrdivide (Zone z, Object a, Object b) {
+  if (IS_MATRIX(b)) {
+    Matrix B = (Matrix) b;
+
+    if (IS_MATRIX(a)) {
+      /* matrix / matrix => matrix */
+      Matrix A = (Matrix) a;
+      if (COLS(A) != COLS(B))
+        throw(z, ERR_SIZE_MISMATCH_MM(A->tr, B->tr, A, B));
+
+      Matrix Xtr = matrix_copy_trans(z, A);
+      if (Xtr && matrix_unshare(Xtr) &&
+          matrix_solve(B, CblasTrans, Xtr->data, Xtr->n))
+        return (Object) matrix_transpose(z, Xtr);
+
+      return NULL;
+    }
+    else if (IS_VECTOR(a)) {
+      /* row / matrix => row */
+      Vector x = (Vector) a;
+      if (x->tr == CblasNoTrans || x->n != COLS(B))
+        throw(z, ERR_SIZE_MISMATCH_VM(x, B->tr, B));
+
+      Vector y = vector_copy(z, x);
+      if (y && vector_unshare(y) &&
+          matrix_solve(B, CblasTrans, y->data, 1))
+        return (Object) y;
+
+      return NULL;
+    }
+  }
+  else if (IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b)) {
+    /* matrix / scalar => matrix */
+    return broadcast_rdivide(z, a, b);
+  }
+
+  /* matrix / logical => matrix / double */
+  if (IS_LOGICAL(a) || IS_LOGICAL(b))
+    return matrix_widen(z, a, b, object_mrdivide);
+
+  throw(z, ERR_OBJ_BINARY, "mrdivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* matrix_mpower(): matrix exponentiation function for matrices. only
+ * integer exponents are supported, and are computed by repeated
+ * squaring.
+ */
+Object matrix_mpower (Zone z, Object a, Object b) {
+  if (IS_MATRIX(a) && (IS_FLOAT(b) || IS_INT(b))) {
+    Matrix A = (Matrix) a;
+    if (A->m != A->n)
+      throw(z, ERR_SIZE_NONSQUARE(A));
+
+    /* only accept integer exponents. */
+    const double p = (IS_FLOAT(b) ? float_get_value((Float) b) :
+                      (double) int_get_value((Int) b));
+    if (p != floor(p))
+      throw(z, ERR_OBJ_BINARY, "mpower",
+            MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+
+    /* initialize the result to the identity matrix. */
+    const long n = A->n;
+    Matrix P = matrix_new_with_size(z, n, n);
+    if (!P)
+      return NULL;
+
+    for (long i = 0; i < n; i++)
+      P->data[i + i * n] = 1.0;
+
+    /* initialize the base, inverting the matrix for negative powers. */
+    Matrix Q;
+    if (p < 0.0) {
+      Q = matrix_copy(z, P);
+      if (!Q || !matrix_unshare(Q) ||
+          !matrix_solve(A, CblasNoTrans, Q->data, n))
+        return NULL;
+    }
+    else
+      Q = A;
+
+    /* multiply in the powers of two that make up the exponent. */
+    for (unsigned long k = (unsigned long) fabs(p); k; k >>= 1) {
+      if (k & 1) {
+        Matrix R = matrix_new_with_size(z, n, n);
+        if (!R || !matte_dgemm(P->tr, Q->tr, 1.0, P, Q, 0.0, R))
+          return NULL;
+
+        P = R;
+      }
+
+      if (k > 1) {
+        Matrix R = matrix_new_with_size(z, n, n);
+        if (!R || !matte_dgemm(Q->tr, Q->tr, 1.0, Q, Q, 0.0, R))
+          return NULL;
+
+        Q = R;
+      }
+    }
+
+    return (Object) P;
+  }
+
+  throw(z, ERR_OBJ_BINARY, "mpower",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* matrix_plus_inplace(): in-place addition function for matrices.
+ */
+int matrix_plus_inplace (Zone z, Matrix A, Object b) {
+  if (IS_MATRIX(b)) {
+    /* matrix += matrix */
+    Matrix B = (Matrix) b;
+    if (B == A || B->m != A->m || B->n != A->n || B->tr != A->tr ||
+        !matrix_unshare(A))
+      return 0;
+
+    matte_blas->daxpy(A->m * A->n, 1.0, B->data, 1, A->data, 1);
+    return 1;
+  }
+  else if (IS_FLOAT(b) || IS_INT(b)) {
+    /* matrix += scalar */
+    const double f = (IS_FLOAT(b) ? float_get_value((Float) b) :
+                      (double) int_get_value((Int) b));
+
+    if (!matrix_unshare(A))
+      return 0;
+
+    for (long i = 0; i < A->m * A->n; i++)
+      A->data[i] += f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* matrix_minus_inplace(): in-place subtraction function for matrices.
+ */
+int matrix_minus_inplace (Zone z, Matrix A, Object b) {
+  if (IS_MATRIX(b)) {
+    /* matrix -= matrix */
+    Matrix B = (Matrix) b;
+    if (B == A || B->m != A->m || B->n != A->n || B->tr != A->tr ||
+        !matrix_unshare(A))
+      return 0;
+
+    matte_blas->daxpy(A->m * A->n, -1.0, B->data, 1, A->data, 1);
+    return 1;
+  }
+  else if (IS_FLOAT(b) || IS_INT(b)) {
+    /* matrix -= scalar */
+    const double f = (IS_FLOAT(b) ? float_get_value((Float) b) :
+                      (double) int_get_value((Int) b));
+
+    if (!matrix_unshare(A))
+      return 0;
+
+    for (long i = 0; i < A->m * A->n; i++)
+      A->data[i] -= f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* matrix_times_inplace(): in-place element-wise multiplication function
+ * for matrices.
+ */
+int matrix_times_inplace (Zone z, Matrix A, Object b) {
+  if (IS_MATRIX(b)) {
+    /* matrix .*= matrix */
+    Matrix B = (Matrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != A->tr ||
+        !matrix_unshare(A))
+      return 0;
+
+    for (long i = 0; i < A->m * A->n; i++)
+      A->data[i] *= B->data[i];
+
+    return 1;
+  }
+  else if (IS_FLOAT(b) || IS_INT(b)) {
+    /* matrix .*= scalar */
+    const double f = (IS_FLOAT(b) ? float_get_value((Float) b) :
+                      (double) int_get_value((Int) b));
+
+    if (!matrix_unshare(A))
+      return 0;
+
+    matte_blas->dscal(A->m * A->n, f, A->data, 1);
+    return 1;
+  }
+
+  return 0;
+}
+
+/* matrix_not(): logical negation operation for matrices.
+ */
+Logical matrix_not (Zone z, Matrix A) {
+  if (!matrix_untranspose(A))
+    return NULL;
+
+  Logical B = logical_new_with_size(z, A->m, A->n);
+  if (!B)
+    return NULL;
+
+  const double zero = 0.0;
+  simd_compare(SIMD_EQ, A->m * A->n, A->data, 1, &zero, 0, B->data);
+  B->mat = 1;
+  return B;
 }
 
 /* Matrix_type: object type structure for matte matrices.
@@ -408,37 +1017,42 @@ struct _ObjectType Matrix_type = {
   (obj_display)     matrix_disp,                 /* fn_disp   */
   NULL,                                          /* fn_true   */
 
-  NULL,                                          /* fn_plus       */
-  NULL,                                          /* fn_minus      */
-  NULL,                                          /* fn_uminus     */
-  NULL,                                          /* fn_times      */
-  NULL,                                          /* fn_mtimes     */
-  NULL,                                          /* fn_rdivide    */
-  NULL,                                          /* fn_ldivide    */
-  NULL,                                          /* fn_mrdivide   */
-  NULL,                                          /* fn_mldivide   */
-  NULL,                                          /* fn_power      */
-  NULL,                                          /* fn_mpower     */
-  NULL,                                          /* fn_lt         */
-  NULL,                                          /* fn_gt         */
-  NULL,                                          /* fn_le         */
-  NULL,                                          /* fn_ge         */
-  NULL,                                          /* fn_ne         */
-  NULL,                                          /* fn_eq         */
-  NULL,                                          /* fn_and        */
-  NULL,                                          /* fn_or         */
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
+  (obj_unary)    matrix_uminus,                  /* fn_uminus     */
+  (obj_binary)   broadcast_times,                /* fn_times      */
+  (obj_binary)   matrix_mtimes,                  /* fn_mtimes     */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
+  (obj_binary)   matrix_mrdivide,                /* fn_mrdivide   */
+  (obj_binary)   matrix_mldivide,                /* fn_mldivide   */
+  (obj_binary)   broadcast_power,                /* fn_power      */
+  (obj_binary)   matrix_mpower,                  /* fn_mpower     */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
   NULL,                                          /* fn_mand       */
   NULL,                                          /* fn_mor        */
-  NULL,                                          /* fn_not        */
+  (obj_unary)    matrix_not,                     /* fn_not        */
   NULL,                                          /* fn_colon      */
   (obj_unary)    matrix_transpose,               /* fn_ctranspose */
   (obj_unary)    matrix_transpose,               /* fn_transpose  */
   NULL,                                          /* fn_horzcat    */
   NULL,                                          /* fn_vertcat    */
-  NULL,                                          /* fn_subsref    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  (obj_inplace)  matrix_plus_inplace,            /* fn_plus_inplace  */
+  (obj_inplace)  matrix_minus_inplace,           /* fn_minus_inplace */
+  (obj_inplace)  matrix_times_inplace,           /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
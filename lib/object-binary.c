@@ -5,7 +5,6 @@
 #define STRING(a)         STR(a)
 #define CONCAT(a,b)       a ## b
 #define FUNCTION(name)    CONCAT(object_, name)
-#define METHOD(type,name) CONCAT(type->fn_, name)
 
 Object FUNCTION(F) (Zone z, Object a, Object b) {
   if (!a || !b)
@@ -13,13 +12,11 @@ Object FUNCTION(F) (Zone z, Object a, Object b) {
 
   const ObjectType ta = MATTE_TYPE(a);
   const ObjectType tb = MATTE_TYPE(b);
-  obj_binary fn = NULL;
+  obj_binary fn = dispatch_table[OP][ta->index][tb->index];
   Object obj = NULL;
 
-  if (ta->precedence >= tb->precedence)
-    fn = METHOD(ta,F);
-  else
-    fn = METHOD(tb,F);
+  if (!fn && !(ta->index && tb->index))
+    fn = dispatch_lookup(OP, ta, tb);
 
   if (fn) {
     obj = fn(z, a, b);
@@ -37,7 +34,7 @@ Object FUNCTION(F) (Zone z, Object a, Object b) {
 #undef STR
 #undef STRING
 #undef CONCAT
-#undef METHOD
 #undef FUNCTION
+#undef OP
 #undef F
 
@@ -0,0 +1,24 @@
+/* define macros for generating an arbitrary in-place method handler.
+ */
+#define CONCAT(a,b)       a ## b
+#define FUNCTION(name)    CONCAT(object_, name)
+#define INPLACE(name)     CONCAT(name, _inplace)
+#define METHOD(type,name) CONCAT(type->fn_, name)
+
+Object INPLACE(FUNCTION(F)) (Zone z, Object a, Object b) {
+  if (a && b && (!z || !zone_is_locked(a))) {
+    obj_inplace fn = METHOD(MATTE_TYPE(a), INPLACE(F));
+    if (fn && fn(z, a, b))
+      return a;
+  }
+
+  return FUNCTION(F) (z, a, b);
+}
+
+/* undefine the method handler generation macros.
+ */
+#undef CONCAT
+#undef FUNCTION
+#undef INPLACE
+#undef METHOD
+#undef F
@@ -42,14 +42,15 @@ ObjectList object_list_new (Zone z, Object args) {
  *
  * arguments:
  *  @z: zone allocator to utilize.
- *  @cp: whether or not to copy the objects into the list.
+ *  @src: zone allocator to move the objects out of, or null to place
+ *        the objects into the list as they are.
  *  @n: number of objects to place in the list.
  *  @...: list of objects to place in the list.
  *
  * returns:
  *  newly allocated object list, cast to a base object.
  */
-Object object_list_new_with_args (Zone z, bool cp, int n, ...) {
+Object object_list_new_with_args (Zone z, Zone src, int n, ...) {
   /* declare required variables:
    *  @lst: new object list.
    *  @obj: object to add to the list.
@@ -72,21 +73,39 @@ Object object_list_new_with_args (Zone z, bool cp, int n, ...) {
     return exceptions_get(z);
   }
 
-  /* loop over the arguments. */
+  /* loop over the arguments, storing each object into the list. */
   va_start(vl, n);
-  for (i = 0; i < n; i++) {
-    /* get the object. */
-    obj = (Object) va_arg(vl, Object);
+  for (i = 0; i < n; i++)
+    lst->objs[i] = (Object) va_arg(vl, Object);
 
-    /* copy or store the object into the list. */
-    if (cp)
+  va_end(vl);
+
+  /* return the list if its objects are not to be moved. */
+  if (!src)
+    return (Object) lst;
+
+  /* move the objects into the list zone. objects are moved from last
+   * to first, so that any object appearing more than once is copied
+   * from an earlier occurrence that has not yet been moved. objects
+   * that are already held by the list zone were passed in by the
+   * caller, and are copied so that the caller never receives an alias
+   * of one of its own variables.
+   */
+  for (i = n - 1; i >= 0; i--) {
+    /* check for an earlier occurrence of the object. */
+    obj = lst->objs[i];
+    int j = 0;
+    while (j < i && lst->objs[j] != obj)
+      j++;
+
+    /* move or copy the object. */
+    if (j < i || (obj && ZONE_BLOCK(obj)->zone == z))
       lst->objs[i] = object_copy(z, obj);
     else
-      lst->objs[i] = obj;
+      lst->objs[i] = object_move(z, src, obj);
   }
 
   /* return the new object list as a base object. */
-  va_end(vl);
   return (Object) lst;
 }
 
@@ -310,6 +329,11 @@ struct _ObjectType ObjectList_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
@@ -6,6 +6,9 @@
 /* include the matte header. */
 #include <matte/matte.h>
 
+/* include the dispatch table header. */
+#include <matte/dispatch.h>
+
 /* include the compilation object headers. */
 #include <matte/scanner.h>
 #include <matte/parser.h>
@@ -31,7 +34,7 @@ Object object_alloc (Zone z, ObjectType type) {
   Object obj;
   if (z) {
     /* use the zone allocator. */
-    obj = (Object) zone_alloc(z);
+    obj = (Object) zone_alloc(z, type->size);
   }
   else {
     /* use standard malloc(). */
@@ -80,6 +83,50 @@ Object object_copy (Zone z, Object obj) {
   return type->fn_copy(z, obj);
 }
 
+/* object_move(): transfer a matte object out of the zone allocator that
+ * holds it and into another zone allocator. the object structure is moved
+ * as plain memory, so its contents are not duplicated. objects that are
+ * not held by the source zone are left intact and copied instead.
+ *
+ * arguments:
+ *  @z: zone allocator to move the object into.
+ *  @src: zone allocator that may hold the object.
+ *  @obj: matte object to move.
+ *
+ * returns:
+ *  moved or duplicated matte object.
+ */
+Object object_move (Zone z, Zone src, Object obj) {
+  /* return null if the object is null. */
+  if (!obj) {
+    error(ERR_INVALID_ARGIN);
+    return NULL;
+  }
+
+  /* objects may only be moved between zone allocators. */
+  if (!z || !src)
+    return object_copy(z, obj);
+
+  /* return objects that are already held by the target zone. */
+  ZoneBlock b = ZONE_BLOCK(obj);
+  if (b->zone == z)
+    return obj;
+
+  /* copy objects that are held by any other zone. */
+  if (b->zone != src)
+    return object_copy(z, obj);
+
+  /* move the object into the target zone. */
+  Object onew = (Object) zone_adopt(z, obj);
+  if (!onew) {
+    error(ERR_OBJ_ALLOC, MATTE_TYPE(obj)->name);
+    return NULL;
+  }
+
+  /* return the moved object. */
+  return onew;
+}
+
 /* object_free(): free all memory associated with a matte object.
  *
  * arguments:
@@ -95,12 +142,14 @@ void object_free (Zone z, void *ptr) {
   Object obj = (Object) ptr;
   const ObjectType type = MATTE_TYPE(obj);
 
-  /* return if the object is untyped or has no destructor. */
-  if (!type || !type->fn_delete)
+  /* return if the object is untyped, or is an immutable literal. */
+  if (!type || (z && zone_is_locked(obj)))
     return;
 
-  /* call the destructor function and free the structure pointer. */
-  type->fn_delete(z, obj);
+  /* call the destructor function, if any, and free the structure. */
+  if (type->fn_delete)
+    type->fn_delete(z, obj);
+
   zone_free(z, obj);
 }
 
@@ -115,28 +164,8 @@ void object_free_all (Zone z) {
   if (!z)
     return;
 
-  /* loop over each block of the zone. */
-  Zone zsrc = z;
-  while (zsrc) {
-    /* compute the unit stride over the zone data, and initialize
-     * a pointer into the zone data.
-     */
-    const unsigned long stride = (zsrc->dend - zsrc->data) / zsrc->n;
-    char *ptr = zsrc->data;
-
-    /* loop over all units of the zone. */
-    for (unsigned long i = 0; i < zsrc->n; i++, ptr += stride) {
-      /* get the type of the current unit. */
-      ObjectType type = MATTE_TYPE(ptr);
-
-      /* if the type is valid and contains a destructor, execute it. */
-      if (type && type->fn_delete)
-        type->fn_delete(z, (Object) ptr);
-    }
-
-    /* move to the next block. */
-    zsrc = zsrc->next;
-  }
+  /* destruct all objects held by the zone. */
+  zone_sweep(z);
 
   /* destroy the zone. */
   zone_destroy(z);
@@ -198,10 +227,12 @@ int object_true (Object obj) {
 
 /* object_plus(): addition dispatch function. */
 #define F plus
+#define OP DISPATCH_PLUS
 #include "object-binary.c"
 
 /* object_minus(): subtraction dispatch function. */
 #define F minus
+#define OP DISPATCH_MINUS
 #include "object-binary.c"
 
 /* object_uminus(): unary negation dispatch function. */
@@ -210,74 +241,92 @@ int object_true (Object obj) {
 
 /* object_times(): element-wise multiplication dispatch function. */
 #define F times
+#define OP DISPATCH_TIMES
 #include "object-binary.c"
 
 /* object_mtimes(): matrix multiplication dispatch function. */
 #define F mtimes
+#define OP DISPATCH_MTIMES
 #include "object-binary.c"
 
 /* object_rdivide(): element-wise right division dispatch function. */
 #define F rdivide
+#define OP DISPATCH_RDIVIDE
 #include "object-binary.c"
 
 /* object_ldivide(): element-wise left division dispatch function. */
 #define F ldivide
+#define OP DISPATCH_LDIVIDE
 #include "object-binary.c"
 
 /* object_mrdivide(): matrix right division dispatch function. */
 #define F mrdivide
+#define OP DISPATCH_MRDIVIDE
 #include "object-binary.c"
 
 /* object_mldivide(): matrix left division dispatch function. */
 #define F mldivide
+#define OP DISPATCH_MLDIVIDE
 #include "object-binary.c"
 
 /* object_power(): element-wise power dispatch function. */
 #define F power
+#define OP DISPATCH_POWER
 #include "object-binary.c"
 
 /* object_mpower(): matrix power dispatch function. */
 #define F mpower
+#define OP DISPATCH_MPOWER
 #include "object-binary.c"
 
 /* object_lt(): less than comparison dispatch function. */
 #define F lt
+#define OP DISPATCH_LT
 #include "object-binary.c"
 
 /* object_gt(): greater than comparison dispatch function. */
 #define F gt
+#define OP DISPATCH_GT
 #include "object-binary.c"
 
 /* object_le(): less than or equal to comparison dispatch function. */
 #define F le
+#define OP DISPATCH_LE
 #include "object-binary.c"
 
 /* object_ge(): greater than or equal to comparison dispatch function. */
 #define F ge
+#define OP DISPATCH_GE
 #include "object-binary.c"
 
 /* object_ne(): inequality comparison dispatch function. */
 #define F ne
+#define OP DISPATCH_NE
 #include "object-binary.c"
 
 /* object_eq(): equality comparison dispatch function. */
 #define F eq
+#define OP DISPATCH_EQ
 #include "object-binary.c"
 
 /* object_and(): logical and dispatch function. */
 #define F and
+#define OP DISPATCH_AND
 #include "object-binary.c"
 
 /* object_or(): logical or dispatch function. */
 #define F or
+#define OP DISPATCH_OR
 #include "object-binary.c"
 
 /* object_mand(): matrix logical and dispatch function. */
 #define F mand
+#define OP DISPATCH_MAND
 #include "object-binary.c"
 
 /* object_mor(): matrix logical or dispatch function. */
 #define F mor
+#define OP DISPATCH_MOR
 #include "object-binary.c"
 
 /* object_not(): logical negation dispatch function. */
@@ -338,6 +387,18 @@ Object object_subsasgn (Zone z, Object a, Object s, Object b) {
 #define F subsindex
 #include "object-unary.c"
 
+/* object_plus_inplace(): in-place addition dispatch function. */
+#define F plus
+#include "object-inplace.c"
+
+/* object_minus_inplace(): in-place subtraction dispatch function. */
+#define F minus
+#include "object-inplace.c"
+
+/* object_times_inplace(): in-place multiplication dispatch function. */
+#define F times
+#include "object-inplace.c"
+
 /* strdup(): duplicate a string.
  *
  * arguments:
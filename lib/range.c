@@ -11,6 +11,7 @@
 #include <matte/int.h>
 
 /* include headers for superior types. */
+#include <matte/float-range.h>
 #include <matte/vector.h>
 
 /* range_type(): return a pointer to the range object type.
@@ -140,13 +141,110 @@ inline long range_get_length (Range r) {
   if (!r)
     return 0;
 
-  /* compute the (non-negative) number of elements in the range. */
-  long n = (r->end - r->begin) / r->step + 1;
-  if (n < 0)
-    n = 0;
+  /* ranges with a zero step have no elements. */
+  if (!r->step)
+    return 0;
+
+  /* ranges that step away from their end value have no elements. */
+  const long d = r->end - r->begin;
+  if ((d > 0 && r->step < 0) || (d < 0 && r->step > 0))
+    return 0;
 
-  /* return the number of elements. */
-  return n;
+  /* otherwise, the truncated quotient is the floor of the quotient. */
+  return d / r->step + 1;
+}
+
+/* range_get_element(): get an element of a matte range, without bounds
+ * checking.
+ *
+ * arguments:
+ *  @r: matte range to access.
+ *  @i: zero-based index of the element.
+ *
+ * returns:
+ *  long integer value of the range element.
+ */
+inline long range_get_element (Range r, long i) {
+  /* compute the element value. */
+  return (r ? r->begin + i * r->step : 0L);
+}
+
+/* range_get_last(): get the last element of a matte range. unlike the
+ * end value, the last element is always a member of the range.
+ *
+ * arguments:
+ *  @r: matte range to access.
+ *
+ * returns:
+ *  long integer value of the last range element.
+ */
+inline long range_get_last (Range r) {
+  /* compute the value of the last element. */
+  return range_get_element(r, range_get_length(r) - 1);
+}
+
+/* range_contains(): determine whether a value is an element of a range,
+ * in constant time.
+ *
+ * arguments:
+ *  @r: matte range to access.
+ *  @value: value to search for.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the value is an element.
+ */
+int range_contains (Range r, long value) {
+  /* empty ranges contain no values. */
+  const long n = range_get_length(r);
+  if (!n)
+    return 0;
+
+  /* the value must lie on a step from the first element. */
+  const long d = value - r->begin;
+  if (d % r->step)
+    return 0;
+
+  /* and within the extent of the range. */
+  const long i = d / r->step;
+  return (i >= 0 && i < n);
+}
+
+/* range_sum(): compute the sum of the elements of a range, in
+ * closed form.
+ *
+ * arguments:
+ *  @r: matte range to access.
+ *
+ * returns:
+ *  long integer sum of the range elements.
+ */
+long range_sum (Range r) {
+  /* one of the two factors of the arithmetic series is always even. */
+  const long n = range_get_length(r);
+  const long s = r->begin + range_get_last(r);
+  return (n % 2 ? n * (s / 2) : (n / 2) * s);
+}
+
+/* range_prod(): compute the product of the elements of a range.
+ *
+ * arguments:
+ *  @r: matte range to access.
+ *
+ * returns:
+ *  long integer product of the range elements.
+ */
+long range_prod (Range r) {
+  /* the product vanishes if any element is zero. */
+  if (range_contains(r, 0L))
+    return 0L;
+
+  /* otherwise, compute the product. */
+  const long n = range_get_length(r);
+  long y = 1L;
+  for (long i = 0; i < n; i++)
+    y *= range_get_element(r, i);
+
+  return y;
 }
 
 /* range_set_begin(): set the first value of a matte range.
@@ -223,14 +321,9 @@ inline void range_set (Range r, long begin, long step, long end) {
  *  long integer indicating the result.
  */
 inline long range_any (Range r) {
-  /* loop over the elements of the range to evaluate the result. */
-  for (long elem = r->begin; elem < r->end; elem += r->step) {
-    /* short-circuit to true if any element is nonzero. */
-    if (elem) return 1L;
-  }
-
-  /* return false. */
-  return 0L;
+  /* only the empty range and the range holding only zero are false. */
+  const long n = range_get_length(r);
+  return (n > 1 || (n == 1 && r->begin) ? 1L : 0L);
 }
 
 /* range_all(): inline short-circuit evaluator that all elements of
@@ -243,14 +336,8 @@ inline long range_any (Range r) {
  *  long integer indicating the result.
  */
 inline long range_all (Range r) {
-  /* loop over the elements of the range to evaluate the test. */
-  for (long elem = r->begin; elem < r->end; elem += r->step) {
-    /* short-circuit to false if any element is zero. */
-    if (!elem) return 0L;
-  }
-
-  /* return true. */
-  return 1L;
+  /* the test fails only if zero is an element of the range. */
+  return (range_contains(r, 0L) ? 0L : 1L);
 }
 
 /* range_disp(): display function for ranges.
@@ -267,46 +354,87 @@ int range_true (Range r) {
   return (int) range_all(r);
 }
 
+/* range_new_affine(): allocate the result of an affine operation on
+ * ranges from its first element, step and length. the end value of the
+ * result is set to its last element. results with a zero step cannot
+ * be held by a range, and are returned as float ranges.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @begin: first element of the result.
+ *  @step: step value of the result.
+ *  @n: number of elements in the result.
+ *
+ * returns:
+ *  newly allocated range or float range.
+ */
+static Object range_new_affine (Zone z, long begin, long step, long n) {
+  /* handle results with a zero step. */
+  if (!step)
+    return (Object) float_range_new_with_values(z, (double) begin, 0.0, n);
+
+  /* allocate and fill the range. */
+  Range r = range_new(z, NULL);
+  if (!r)
+    return NULL;
+
+  range_set(r, begin, step, begin + (n - 1) * step);
+  return (Object) r;
+}
+
+/* range_expand(): compute an operation on a range and an operand that
+ * has no affine kernel, by expanding the range operands into temporary
+ * vectors and dispatching the operation again.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @fn: dispatch function of the operation.
+ *
+ * returns:
+ *  result of the operation.
+ */
+static Object range_expand (Zone z, Object a, Object b, obj_binary fn) {
+  /* expand the range operands. */
+  Object va = (IS_RANGE(a) ? (Object) vector_new_from_range(z, (Range) a) : a);
+  Object vb = (IS_RANGE(b) ? (Object) vector_new_from_range(z, (Range) b) : b);
+
+  /* compute the result. */
+  Object c = (va && vb ? fn(z, va, vb) : NULL);
+
+  /* free the temporary vectors and return the result. */
+  if (va != a) object_free(z, va);
+  if (vb != b) object_free(z, vb);
+  return c;
+}
+
 /* range_plus(): addition function for ranges.
  */
 Object range_plus (Zone z, Object a, Object b) {
   if (IS_RANGE(a) && IS_RANGE(b)) {
     /* range + range => range */
-    if (range_get_length((Range) a) != range_get_length((Range) b))
+    const long n = range_get_length((Range) a);
+    if (n != range_get_length((Range) b))
       throw(z, ERR_SIZE_MISMATCH);
 
-    const long lb = range_get_begin((Range) a) + range_get_begin((Range) b);
-    const long ls = range_get_step((Range) a)  + range_get_step((Range) b);
-    const long le = range_get_end((Range) a)   + range_get_end((Range) b);
-
-    Range r = range_new(z, NULL);
-    range_set(r, lb, ls, le);
-    return (Object) r;
+    return range_new_affine(z,
+      range_get_begin((Range) a) + range_get_begin((Range) b),
+      range_get_step((Range) a)  + range_get_step((Range) b), n);
   }
   else if (IS_RANGE(a) && IS_INT(b)) {
     /* range + int => range */
-    const long bval = int_get_value((Int) b);
-
-    Range r = range_new(z, NULL);
-    range_set(r, range_get_begin((Range) a) + bval,
-                 range_get_step((Range) a),
-                 range_get_end((Range) a) + bval);
-
-    return (Object) r;
+    return range_new_affine(z,
+      range_get_begin((Range) a) + int_get_value((Int) b),
+      range_get_step((Range) a), range_get_length((Range) a));
   }
   else if (IS_RANGE(b) && IS_INT(a)) {
     /* int + range => range */
-    const long aval = int_get_value((Int) a);
-
-    Range r = range_new(z, NULL);
-    range_set(r, range_get_begin((Range) b) + aval,
-                 range_get_step((Range) b),
-                 range_get_end((Range) b) + aval);
-
-    return (Object) r;
+    return range_new_affine(z,
+      int_get_value((Int) a) + range_get_begin((Range) b),
+      range_get_step((Range) b), range_get_length((Range) b));
   }
 
-  return NULL;
+  return range_expand(z, a, b, object_plus);
 }
 
 /* range_minus(): subtraction function for ranges.
@@ -314,83 +442,91 @@ Object range_plus (Zone z, Object a, Object b) {
 Object range_minus (Zone z, Object a, Object b) {
   if (IS_RANGE(a) && IS_RANGE(b)) {
     /* range - range => range */
-    if (range_get_length((Range) a) != range_get_length((Range) b))
+    const long n = range_get_length((Range) a);
+    if (n != range_get_length((Range) b))
       throw(z, ERR_SIZE_MISMATCH);
 
-    const long lb = range_get_begin((Range) a) - range_get_begin((Range) b);
-    const long ls = range_get_step((Range) a)  - range_get_step((Range) b);
-    const long le = range_get_end((Range) a)   - range_get_end((Range) b);
-
-    Range r = range_new(z, NULL);
-    range_set(r, lb, ls, le);
-    return (Object) r;
+    return range_new_affine(z,
+      range_get_begin((Range) a) - range_get_begin((Range) b),
+      range_get_step((Range) a)  - range_get_step((Range) b), n);
   }
   else if (IS_RANGE(a) && IS_INT(b)) {
     /* range - int => range */
-    const long bval = int_get_value((Int) b);
-
-    Range r = range_new(z, NULL);
-    range_set(r, range_get_begin((Range) a) - bval,
-                 range_get_step((Range) a),
-                 range_get_end((Range) a) - bval);
-
-    return (Object) r;
+    return range_new_affine(z,
+      range_get_begin((Range) a) - int_get_value((Int) b),
+      range_get_step((Range) a), range_get_length((Range) a));
   }
   else if (IS_RANGE(b) && IS_INT(a)) {
     /* int - range => range */
-    const long aval = int_get_value((Int) a);
-
-    Range r = range_new(z, NULL);
-    range_set(r, aval - range_get_begin((Range) b),
-                       -range_get_step((Range) b),
-                 aval - range_get_end((Range) b));
-
-    return (Object) r;
+    return range_new_affine(z,
+      int_get_value((Int) a) - range_get_begin((Range) b),
+      -range_get_step((Range) b), range_get_length((Range) b));
   }
 
-  return NULL;
+  return range_expand(z, a, b, object_minus);
 }
 
 /* range_uminus(): unary negation function for ranges.
  */
-Range range_uminus (Zone z, Range a) {
-  Range r = range_new(z, NULL);
-  range_set(r, -range_get_begin(a),
-               -range_get_step(a),
-               -range_get_end(a));
-
-  return r;
+Object range_uminus (Zone z, Range a) {
+  return range_new_affine(z, -range_get_begin(a), -range_get_step(a),
+                          range_get_length(a));
 }
 
-/* range_times(): multiplication function for ranges.
+/* range_scale(): compute the product of a range and an integer scalar.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *
+ * returns:
+ *  range result, or null if neither operand is an integer.
  */
-Range range_times (Zone z, Object a, Object b) {
+static Object range_scale (Zone z, Object a, Object b) {
   if (IS_RANGE(a) && IS_INT(b)) {
     /* range .* int => range */
     const long bval = int_get_value((Int) b);
-    Range r = range_new(z, NULL);
-
-    range_set(r, range_get_begin((Range) a) * bval,
-                 range_get_step((Range) a)  * bval,
-                 range_get_end((Range) a)   * bval);
-
-    return r;
+    return range_new_affine(z, range_get_begin((Range) a) * bval,
+                               range_get_step((Range) a) * bval,
+                               range_get_length((Range) a));
   }
   else if (IS_RANGE(b) && IS_INT(a)) {
     /* int .* range => range */
     const long aval = int_get_value((Int) a);
-    Range r = range_new(z, NULL);
-
-    range_set(r, range_get_begin((Range) b) * aval,
-                 range_get_step((Range) b)  * aval,
-                 range_get_end((Range) b)   * aval);
-
-    return r;
+    return range_new_affine(z, aval * range_get_begin((Range) b),
+                               aval * range_get_step((Range) b),
+                               range_get_length((Range) b));
   }
 
   return NULL;
 }
 
+/* range_times(): element-wise multiplication function for ranges.
+ */
+Object range_times (Zone z, Object a, Object b) {
+  Object c = range_scale(z, a, b);
+  return (c ? c : range_expand(z, a, b, object_times));
+}
+
+/* range_mtimes(): multiplication function for ranges.
+ */
+Object range_mtimes (Zone z, Object a, Object b) {
+  Object c = range_scale(z, a, b);
+  return (c ? c : range_expand(z, a, b, object_mtimes));
+}
+
+/* range_transpose(): transposition function for ranges. the result is
+ * a column vector.
+ */
+Vector range_transpose (Zone z, Range a) {
+  Vector x = vector_new_from_range(z, a);
+  if (!x)
+    return NULL;
+
+  x->tr = CblasNoTrans;
+  return x;
+}
+
 /* range_eq(): equality operation for ranges.
  */
 Int range_eq (Zone z, Object a, Object b) {
@@ -496,8 +632,8 @@ Vector range_horzcat (Zone z, int n, va_list vl) {
         return NULL;
       }
 
-      for (long elem = r->begin; elem <= r->end; elem += r->step)
-        vector_set(x, ix++, (double) elem);
+      for (long k = 0; k < nr; k++)
+        vector_set(x, ix++, (double) range_get_element(r, k));
     }
     else {
       object_free(z, x);
@@ -542,7 +678,7 @@ struct _ObjectType Range_type = {
   (obj_binary)   range_minus,                    /* fn_minus      */
   (obj_unary)    range_uminus,                   /* fn_uminus     */
   (obj_binary)   range_times,                    /* fn_times      */
-  (obj_binary)   range_times,                    /* fn_mtimes     */
+  (obj_binary)   range_mtimes,                   /* fn_mtimes     */
   NULL,                                          /* fn_rdivide    */
   NULL,                                          /* fn_ldivide    */
   NULL,                                          /* fn_mrdivide   */
@@ -561,14 +697,19 @@ struct _ObjectType Range_type = {
   (obj_binary)   range_mor,                      /* fn_mor        */
   NULL,                                          /* fn_not        */
   NULL,                                          /* fn_colon      */
-  NULL,                                          /* fn_ctranspose */
-  NULL,                                          /* fn_transpose  */
+  (obj_unary)    range_transpose,                /* fn_ctranspose */
+  (obj_unary)    range_transpose,                /* fn_transpose  */
   (obj_variadic) range_horzcat,                  /* fn_horzcat    */
   (obj_variadic) range_vertcat,                  /* fn_vertcat    */
   NULL,                                          /* fn_subsref    */
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
@@ -0,0 +1,91 @@
+/* define macros for generating a set of element-wise kernels.
+ */
+#define CONCAT(a,b,c) a ## b ## c
+#define KERNEL(name,isa) CONCAT(simd_, name, isa)
+
+/* portable kernel, used by all processors. */
+static void KERNEL(F, _generic) (long n, const double *a, long sa,
+                                 const double *b, long sb,
+                                 unsigned char *c) {
+  for (long i = 0; i < n; i++)
+    c[i] = (a[i * sa] OP b[i * sb]);
+}
+
+#ifdef SIMD_X86
+/* sse2 kernel, computing two elements per instruction. */
+__attribute__((target("sse2")))
+static void KERNEL(F, _sse2) (long n, const double *a, long sa,
+                              const double *b, long sb,
+                              unsigned char *c) {
+  const __m128d zero = _mm_setzero_pd();
+  long i = 0;
+
+  if (sa && sb) {
+    for (; i + 2 <= n; i += 2) {
+      const __m128d x = _mm_loadu_pd(a + i);
+      const __m128d y = _mm_loadu_pd(b + i);
+      STORE2(c + i, _mm_movemask_pd(SSE(x, y)));
+    }
+  }
+  else if (sa) {
+    const __m128d y = _mm_set1_pd(*b);
+    for (; i + 2 <= n; i += 2) {
+      const __m128d x = _mm_loadu_pd(a + i);
+      STORE2(c + i, _mm_movemask_pd(SSE(x, y)));
+    }
+  }
+  else if (sb) {
+    const __m128d x = _mm_set1_pd(*a);
+    for (; i + 2 <= n; i += 2) {
+      const __m128d y = _mm_loadu_pd(b + i);
+      STORE2(c + i, _mm_movemask_pd(SSE(x, y)));
+    }
+  }
+
+  for (; i < n; i++)
+    c[i] = (a[i * sa] OP b[i * sb]);
+}
+
+/* avx2 kernel, computing four elements per instruction. */
+__attribute__((target("avx2")))
+static void KERNEL(F, _avx2) (long n, const double *a, long sa,
+                              const double *b, long sb,
+                              unsigned char *c) {
+  const __m256d zero = _mm256_setzero_pd();
+  long i = 0;
+
+  if (sa && sb) {
+    for (; i + 4 <= n; i += 4) {
+      const __m256d x = _mm256_loadu_pd(a + i);
+      const __m256d y = _mm256_loadu_pd(b + i);
+      STORE4(c + i, _mm256_movemask_pd(AVX(x, y)));
+    }
+  }
+  else if (sa) {
+    const __m256d y = _mm256_set1_pd(*b);
+    for (; i + 4 <= n; i += 4) {
+      const __m256d x = _mm256_loadu_pd(a + i);
+      STORE4(c + i, _mm256_movemask_pd(AVX(x, y)));
+    }
+  }
+  else if (sb) {
+    const __m256d x = _mm256_set1_pd(*a);
+    for (; i + 4 <= n; i += 4) {
+      const __m256d y = _mm256_loadu_pd(b + i);
+      STORE4(c + i, _mm256_movemask_pd(AVX(x, y)));
+    }
+  }
+
+  for (; i < n; i++)
+    c[i] = (a[i * sa] OP b[i * sb]);
+}
+#endif
+
+/* undefine the kernel generator macros.
+ */
+#undef CONCAT
+#undef KERNEL
+#undef SSE
+#undef AVX
+#undef OP
+#undef F
@@ -0,0 +1,285 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the simd header. */
+#include <matte/simd.h>
+
+/* include the x86 intrinsics header. */
+#ifdef SIMD_X86
+#include <immintrin.h>
+
+/* STORE2(), STORE4(): macros to store the sign masks of two or four
+ * vectorized comparisons as ones and zeros.
+ */
+#define STORE2(c,mask) \
+  { const int m_ = (mask); (c)[0] = m_ & 1; (c)[1] = (m_ >> 1) & 1; }
+#define STORE4(c,mask) \
+  { const int m_ = (mask); \
+    (c)[0] = m_ & 1;        (c)[1] = (m_ >> 1) & 1; \
+    (c)[2] = (m_ >> 2) & 1; (c)[3] = (m_ >> 3) & 1; }
+#endif
+
+/* simd_lt_*(): less-than comparison kernels. */
+#define F lt
+#define OP <
+#define SSE(x,y) _mm_cmplt_pd(x, y)
+#define AVX(x,y) _mm256_cmp_pd(x, y, _CMP_LT_OQ)
+#include "simd-cmp.c"
+
+/* simd_gt_*(): greater-than comparison kernels. */
+#define F gt
+#define OP >
+#define SSE(x,y) _mm_cmpgt_pd(x, y)
+#define AVX(x,y) _mm256_cmp_pd(x, y, _CMP_GT_OQ)
+#include "simd-cmp.c"
+
+/* simd_le_*(): less-than or equal-to comparison kernels. */
+#define F le
+#define OP <=
+#define SSE(x,y) _mm_cmple_pd(x, y)
+#define AVX(x,y) _mm256_cmp_pd(x, y, _CMP_LE_OQ)
+#include "simd-cmp.c"
+
+/* simd_ge_*(): greater-than or equal-to comparison kernels. */
+#define F ge
+#define OP >=
+#define SSE(x,y) _mm_cmpge_pd(x, y)
+#define AVX(x,y) _mm256_cmp_pd(x, y, _CMP_GE_OQ)
+#include "simd-cmp.c"
+
+/* simd_ne_*(): inequality comparison kernels. unordered (nan) operands
+ * compare as unequal.
+ */
+#define F ne
+#define OP !=
+#define SSE(x,y) _mm_cmpneq_pd(x, y)
+#define AVX(x,y) _mm256_cmp_pd(x, y, _CMP_NEQ_UQ)
+#include "simd-cmp.c"
+
+/* simd_eq_*(): equality comparison kernels. */
+#define F eq
+#define OP ==
+#define SSE(x,y) _mm_cmpeq_pd(x, y)
+#define AVX(x,y) _mm256_cmp_pd(x, y, _CMP_EQ_OQ)
+#include "simd-cmp.c"
+
+/* simd_and_*(): logical-and kernels. nonzero (and nan) operands are
+ * treated as true.
+ */
+#define F and
+#define OP &&
+#define SSE(x,y) \
+  _mm_and_pd(_mm_cmpneq_pd(x, zero), _mm_cmpneq_pd(y, zero))
+#define AVX(x,y) \
+  _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_NEQ_UQ), \
+                _mm256_cmp_pd(y, zero, _CMP_NEQ_UQ))
+#include "simd-cmp.c"
+
+/* simd_or_*(): logical-or kernels. */
+#define F or
+#define OP ||
+#define SSE(x,y) \
+  _mm_or_pd(_mm_cmpneq_pd(x, zero), _mm_cmpneq_pd(y, zero))
+#define AVX(x,y) \
+  _mm256_or_pd(_mm256_cmp_pd(x, zero, _CMP_NEQ_UQ), \
+               _mm256_cmp_pd(y, zero, _CMP_NEQ_UQ))
+#include "simd-cmp.c"
+
+/* simd_sum_generic(): portable summation kernel, using eight independent
+ * accumulators to break the dependency between additions.
+ */
+static void simd_sum_generic (long n, const double *x, double *s) {
+  double a[8] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+  long i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    for (int k = 0; k < 8; k++)
+      a[k] += x[i + k];
+  }
+
+  for (; i < n; i += 2) {
+    a[0] += x[i];
+    a[1] += x[i + 1];
+  }
+
+  s[0] += (a[0] + a[2]) + (a[4] + a[6]);
+  s[1] += (a[1] + a[3]) + (a[5] + a[7]);
+}
+
+#ifdef SIMD_X86
+/* simd_sum_sse2(): sse2 summation kernel, using four accumulators of
+ * two elements each.
+ */
+__attribute__((target("sse2")))
+static void simd_sum_sse2 (long n, const double *x, double *s) {
+  __m128d a0 = _mm_setzero_pd(), a1 = _mm_setzero_pd();
+  __m128d a2 = _mm_setzero_pd(), a3 = _mm_setzero_pd();
+  long i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    a0 = _mm_add_pd(a0, _mm_loadu_pd(x + i));
+    a1 = _mm_add_pd(a1, _mm_loadu_pd(x + i + 2));
+    a2 = _mm_add_pd(a2, _mm_loadu_pd(x + i + 4));
+    a3 = _mm_add_pd(a3, _mm_loadu_pd(x + i + 6));
+  }
+
+  for (; i < n; i += 2)
+    a0 = _mm_add_pd(a0, _mm_loadu_pd(x + i));
+
+  double t[2];
+  _mm_storeu_pd(t, _mm_add_pd(_mm_add_pd(a0, a2), _mm_add_pd(a1, a3)));
+  s[0] += t[0];
+  s[1] += t[1];
+}
+
+/* simd_sum_avx2(): avx2 summation kernel, using four accumulators of
+ * four elements each.
+ */
+__attribute__((target("avx2")))
+static void simd_sum_avx2 (long n, const double *x, double *s) {
+  __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+  __m256d a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+  double t0 = 0.0, t1 = 0.0;
+  long i = 0;
+
+  for (; i + 16 <= n; i += 16) {
+    a0 = _mm256_add_pd(a0, _mm256_loadu_pd(x + i));
+    a1 = _mm256_add_pd(a1, _mm256_loadu_pd(x + i + 4));
+    a2 = _mm256_add_pd(a2, _mm256_loadu_pd(x + i + 8));
+    a3 = _mm256_add_pd(a3, _mm256_loadu_pd(x + i + 12));
+  }
+
+  for (; i + 4 <= n; i += 4)
+    a0 = _mm256_add_pd(a0, _mm256_loadu_pd(x + i));
+
+  for (; i < n; i += 2) {
+    t0 += x[i];
+    t1 += x[i + 1];
+  }
+
+  double t[4];
+  a0 = _mm256_add_pd(_mm256_add_pd(a0, a2), _mm256_add_pd(a1, a3));
+  _mm256_storeu_pd(t, a0);
+  s[0] += (t[0] + t[2]) + t0;
+  s[1] += (t[1] + t[3]) + t1;
+}
+#endif
+
+/* simd_generic: portable kernels of each operation.
+ */
+static const simd_kernel simd_generic[SIMD_OPS] = {
+  simd_lt_generic, simd_gt_generic, simd_le_generic, simd_ge_generic,
+  simd_ne_generic, simd_eq_generic, simd_and_generic, simd_or_generic
+};
+
+#ifdef SIMD_X86
+/* simd_sse2: sse2 kernels of each operation.
+ */
+static const simd_kernel simd_sse2[SIMD_OPS] = {
+  simd_lt_sse2, simd_gt_sse2, simd_le_sse2, simd_ge_sse2,
+  simd_ne_sse2, simd_eq_sse2, simd_and_sse2, simd_or_sse2
+};
+
+/* simd_avx2: avx2 kernels of each operation.
+ */
+static const simd_kernel simd_avx2[SIMD_OPS] = {
+  simd_lt_avx2, simd_gt_avx2, simd_le_avx2, simd_ge_avx2,
+  simd_ne_avx2, simd_eq_avx2, simd_and_avx2, simd_or_avx2
+};
+#endif
+
+/* simd_kernels: kernels of each operation that were selected for the
+ * host processor.
+ */
+static const simd_kernel *simd_kernels = simd_generic;
+
+/* simd_reduce: summation kernel that was selected for the host
+ * processor.
+ */
+static simd_reducer simd_reduce = simd_sum_generic;
+
+/* simd_compare(): compute an element-wise comparison or logical operation
+ * over arrays and scalars, using the fastest kernel supported by the
+ * host processor.
+ *
+ * arguments:
+ *  @op: operation to compute.
+ *  @n: number of result elements.
+ *  @a: first operand array or scalar.
+ *  @sa: increment of the first operand, one for arrays or zero for scalars.
+ *  @b: second operand array or scalar.
+ *  @sb: increment of the second operand, one for arrays or zero for scalars.
+ *  @c: output array of ones and zeros, one byte per element.
+ */
+void simd_compare (SimdOp op, long n, const double *a, long sa,
+                   const double *b, long sb, unsigned char *c) {
+  /* execute the selected kernel. */
+  simd_kernels[op](n, a, sa, b, sb, c);
+}
+
+/* simd_sum_pairwise(): sum an array by recursively splitting it into
+ * halves, until each half is short enough for the summation kernel.
+ *
+ * arguments:
+ *  @n: number of elements to sum, which must be even.
+ *  @x: array of elements to sum.
+ *  @s: partial sums of even and odd elements to add into.
+ */
+static void simd_sum_pairwise (long n, const double *x, double *s) {
+  /* sum short arrays directly. */
+  if (n <= SIMD_SUM_BLOCK) {
+    simd_reduce(n, x, s);
+    return;
+  }
+
+  /* split at an even, kernel-friendly index and sum each half. */
+  const long h = (n / 2) & ~7L;
+  double sa[2] = { 0.0, 0.0 };
+  double sb[2] = { 0.0, 0.0 };
+  simd_sum_pairwise(h, x, sa);
+  simd_sum_pairwise(n - h, x + h, sb);
+
+  s[0] += sa[0] + sb[0];
+  s[1] += sa[1] + sb[1];
+}
+
+/* simd_sum(): compute the pairwise sums of the even and odd elements of
+ * an array, using the fastest kernel supported by the host processor.
+ * the sum of a real array is (@s[0] + @s[1]), and the sum of an array
+ * of complex numbers, viewed as twice as many doubles, is (@s[0], @s[1]).
+ *
+ * arguments:
+ *  @n: number of elements to sum.
+ *  @x: array of elements to sum.
+ *  @s: output partial sums of the even and odd elements.
+ */
+void simd_sum (long n, const double *x, double *s) {
+  s[0] = s[1] = 0.0;
+  simd_sum_pairwise(n & ~1L, x, s);
+
+  /* add the final element of odd-length arrays. */
+  if (n & 1)
+    s[0] += x[n - 1];
+}
+
+/* simd_init(): select the kernels supported by the host processor.
+ * called once when the library is loaded.
+ */
+__attribute__((constructor))
+void simd_init (void) {
+#ifdef SIMD_X86
+  /* prefer the widest supported instruction set. */
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    simd_kernels = simd_avx2;
+    simd_reduce = simd_sum_avx2;
+  }
+  else if (__builtin_cpu_supports("sse2")) {
+    simd_kernels = simd_sse2;
+    simd_reduce = simd_sum_sse2;
+  }
+#endif
+}
+
@@ -0,0 +1,772 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the single matrix, exception, blas, broadcast, subscript and
+ * transpose headers.
+ */
+#include <matte/single-matrix.h>
+#include <matte/except.h>
+#include <matte/blas.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+#include <matte/transpose.h>
+
+/* include headers for inferior types. */
+#include <matte/int.h>
+#include <matte/float.h>
+#include <matte/complex.h>
+#include <matte/vector.h>
+#include <matte/matrix.h>
+#include <matte/complex-vector.h>
+#include <matte/complex-matrix.h>
+#include <matte/single-vector.h>
+#include <matte/logical.h>
+
+/* ROWS(), COLS(): macros to get the row and column counts of a matrix,
+ * accounting for its transposition status.
+ */
+#define ROWS(A) ((A)->tr == CblasNoTrans ? (A)->m : (A)->n)
+#define COLS(A) ((A)->tr == CblasNoTrans ? (A)->n : (A)->m)
+
+/* single_matrix_type(): return a pointer to the single matrix object type.
+ */
+ObjectType single_matrix_type (void) {
+  /* return the struct address. */
+  return &SingleMatrix_type;
+}
+
+/* single_matrix_new(): allocate a new empty matte single matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @args: constructor arguments.
+ *
+ * returns:
+ *  newly allocated empty single matrix.
+ */
+SingleMatrix single_matrix_new (Zone z, Object args) {
+  /* allocate a new single matrix. */
+  SingleMatrix A = (SingleMatrix) object_alloc(z, &SingleMatrix_type);
+  if (!A)
+    return NULL;
+
+  /* initialize the matrix data and dimensions. */
+  A->data = NULL;
+  A->m = 0;
+  A->n = 0;
+
+  /* initialize the transposition state. */
+  A->tr = CblasNoTrans;
+
+  /* return the new matrix. */
+  return A;
+}
+
+/* single_matrix_new_with_size(): allocate a new matte single matrix
+ * with a set number of zero elements.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @m: number of rows in the new matrix.
+ *  @n: number of columns in the new matrix.
+ *
+ * returns:
+ *  newly allocated zero single matrix.
+ */
+SingleMatrix single_matrix_new_with_size (Zone z, long m, long n) {
+  /* allocate a new single matrix. */
+  SingleMatrix A = single_matrix_new(z, NULL);
+  if (!A || !single_matrix_set_size(A, m, n))
+    return NULL;
+
+  /* return the newly allocated and initialized matrix. */
+  return A;
+}
+
+/* single_matrix_new_from_matrix(): allocate a new matte single matrix
+ * that holds the elements of a matte matrix, rounded to single
+ * precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A: matte matrix to access.
+ *
+ * returns:
+ *  newly allocated and initialized single matrix.
+ */
+SingleMatrix single_matrix_new_from_matrix (Zone z, Matrix A) {
+  /* return null if the input matrix is null. */
+  if (!A)
+    return NULL;
+
+  /* allocate the single matrix. */
+  SingleMatrix As = single_matrix_new_with_size(z, A->m, A->n);
+  if (!As)
+    return NULL;
+
+  /* store the rounded elements, in the same order. */
+  for (long i = 0; i < A->m * A->n; i++)
+    As->data[i] = (float) A->data[i];
+
+  /* return the new matrix. */
+  As->tr = A->tr;
+  return As;
+}
+
+/* single_matrix_to_double(): allocate a new matte matrix that holds the
+ * elements of a matte single matrix in double precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A: matte single matrix to access.
+ *
+ * returns:
+ *  newly allocated and initialized matte matrix.
+ */
+Matrix single_matrix_to_double (Zone z, SingleMatrix A) {
+  /* return null if the input matrix is null. */
+  if (!A)
+    return NULL;
+
+  /* allocate the double matrix. */
+  Matrix Ad = matrix_new_with_size(z, A->m, A->n);
+  if (!Ad)
+    return NULL;
+
+  /* store the widened elements, in the same order. */
+  for (long i = 0; i < A->m * A->n; i++)
+    Ad->data[i] = (double) A->data[i];
+
+  /* return the new matrix. */
+  Ad->tr = A->tr;
+  return Ad;
+}
+
+/* single_matrix_copy(): allocate a new matte single matrix from another
+ * matte single matrix. the duplicate shares the data buffer of the input
+ * matrix until either of them is modified.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A: matte single matrix to duplicate.
+ *
+ * returns:
+ *  duplicated matte single matrix.
+ */
+SingleMatrix single_matrix_copy (Zone z, SingleMatrix A) {
+  /* return null if the input argument is null. */
+  if (!A)
+    return NULL;
+
+  /* allocate a new single matrix. */
+  SingleMatrix Anew = single_matrix_new(z, NULL);
+  if (!Anew)
+    return NULL;
+
+  /* share the data buffer of the input matrix with the duplicate. */
+  Anew->data = (float*) buffer_share(A->data);
+  Anew->m = A->m;
+  Anew->n = A->n;
+  Anew->tr = A->tr;
+
+  /* return the new matrix. */
+  return Anew;
+}
+
+/* single_matrix_delete(): free all memory associated with a matte
+ * single matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A: matte single matrix to free.
+ */
+void single_matrix_delete (Zone z, SingleMatrix A) {
+  /* return if the matrix is null. */
+  if (!A)
+    return;
+
+  /* release the matrix data. */
+  buffer_release(A->data);
+}
+
+/* single_matrix_get_rows(): get the row count of a matte single matrix.
+ *
+ * arguments:
+ *  @A: matte single matrix to access.
+ *
+ * returns:
+ *  number of rows in the matrix, when untransposed.
+ */
+long single_matrix_get_rows (SingleMatrix A) {
+  /* return the matrix row count. */
+  return (A ? A->m : 0);
+}
+
+/* single_matrix_get_cols(): get the column count of a matte single
+ * matrix.
+ *
+ * arguments:
+ *  @A: matte single matrix to access.
+ *
+ * returns:
+ *  number of columns in the matrix, when untransposed.
+ */
+long single_matrix_get_cols (SingleMatrix A) {
+  /* return the matrix column count. */
+  return (A ? A->n : 0);
+}
+
+/* single_matrix_get_length(): get the number of elements of a matte
+ * single matrix.
+ *
+ * arguments:
+ *  @A: matte single matrix to access.
+ *
+ * returns:
+ *  number of elements in the matrix.
+ */
+long single_matrix_get_length (SingleMatrix A) {
+  /* return the matrix length. */
+  return (A ? A->m * A->n : 0);
+}
+
+/* single_matrix_get(): get an element from a matte single matrix.
+ *
+ * arguments:
+ *  @A: matte single matrix to access.
+ *  @i: element row index to get.
+ *  @j: element column index to get.
+ *
+ * returns:
+ *  requested matrix element.
+ */
+inline float single_matrix_get (SingleMatrix A, long i, long j) {
+  /* swap the indices of transposed matrices. */
+  if (A && A->tr != CblasNoTrans) {
+    const long k = i;
+    i = j;
+    j = k;
+  }
+
+  /* if the pointer and indices are valid, return the element. */
+  if (A && i < A->m && j < A->n)
+    return A->data[i + j * A->m];
+
+  /* return zero. */
+  return 0.0f;
+}
+
+/* single_matrix_set_size(): set the dimensions of a matte single matrix.
+ *
+ * arguments:
+ *  @A: matte single matrix to modify.
+ *  @m: new row count of the matrix.
+ *  @n: new column count of the matrix.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int single_matrix_set_size (SingleMatrix A, long m, long n) {
+  /* validate the input arguments. */
+  if (!A || m < 0 || n < 0)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the matrix already has the desired dimensions. */
+  if (A->m == m && A->n == n)
+    return 1;
+
+  /* compute the new number of matrix elements. */
+  const long len = m * n;
+
+  /* reallocate the matrix data, zeroing any new elements. */
+  float *data = (float*)
+    buffer_resize(A->data, A->m * A->n, len, sizeof(float));
+
+  /* check if reallocation failed. */
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the new matrix data and dimensions. */
+  A->data = data;
+  A->m = m;
+  A->n = n;
+
+  /* return success. */
+  return 1;
+}
+
+/* single_matrix_unshare(): ensure that the data of a matte single matrix
+ * is not shared with any other matrix, so that it may be modified in
+ * place.
+ *
+ * arguments:
+ *  @A: matte single matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int single_matrix_unshare (SingleMatrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the matrix data if it is held by other matrices. */
+  const long len = A->m * A->n;
+  float *data = (float*) buffer_unshare(A->data, len, sizeof(float));
+
+  /* check if the copy failed. */
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared matrix data and return success. */
+  A->data = data;
+  return 1;
+}
+
+/* single_matrix_untranspose(): ensure that the elements of a matte
+ * single matrix are stored in untransposed order, so that they may be
+ * accessed directly. the transposition status of the matrix is cleared.
+ *
+ * arguments:
+ *  @A: matte single matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int single_matrix_untranspose (SingleMatrix A) {
+  /* fail if the matrix is null. */
+  if (!A)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the matrix is not transposed. */
+  if (A->tr == CblasNoTrans)
+    return 1;
+
+  /* transpose square matrices in place, unless their elements are
+   * shared with other matrices.
+   */
+  if (A->m == A->n && !buffer_is_shared(A->data)) {
+    transpose_s_inplace(A->m, A->data);
+    A->tr = CblasNoTrans;
+    return 1;
+  }
+
+  /* allocate a new buffer for the transposed elements. */
+  const long len = A->m * A->n;
+  float *data = (float*) buffer_resize(NULL, 0, len, sizeof(float));
+  if (len && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the transposed elements. */
+  transpose_s(A->m, A->n, A->data, data);
+
+  /* replace the matrix data and dimensions. */
+  buffer_release(A->data);
+  A->data = data;
+  const long m = A->m;
+  A->m = A->n;
+  A->n = m;
+  A->tr = CblasNoTrans;
+
+  /* return success. */
+  return 1;
+}
+
+/* single_matrix_set(): set an element of a matte single matrix. the
+ * matrix data must not be shared, see single_matrix_unshare().
+ *
+ * arguments:
+ *  @A: matte single matrix to modify.
+ *  @i: element row index to set.
+ *  @j: element column index to set.
+ *  @aij: element value.
+ */
+inline void single_matrix_set (SingleMatrix A, long i, long j, float aij) {
+  /* swap the indices of transposed matrices. */
+  if (A && A->tr != CblasNoTrans) {
+    const long k = i;
+    i = j;
+    j = k;
+  }
+
+  /* if the pointer and indices are valid, set the element. */
+  if (A && i < A->m && j < A->n)
+    A->data[i + j * A->m] = aij;
+}
+
+/* single_matrix_disp(): display function for matte single matrices.
+ */
+int single_matrix_disp (Zone z, SingleMatrix A) {
+  /* print the matrix contents. */
+  printf("\n");
+  for (long i = 0; i < ROWS(A); i++) {
+    printf("\n");
+    for (long j = 0; j < COLS(A); j++) {
+      const float aij = single_matrix_get(A, i, j);
+      printf("  %g", (double) aij);
+    }
+  }
+
+  /* print newlines and return success. */
+  printf("\n\n");
+  return 1;
+}
+
+/* single_matrix_transpose(): transposition function for matte single
+ * matrices. the transposed matrix shares the data of its operand.
+ */
+SingleMatrix single_matrix_transpose (Zone z, SingleMatrix A) {
+  SingleMatrix Atr = single_matrix_copy(z, A);
+  if (!Atr)
+    return NULL;
+
+  Atr->tr = (A->tr == CblasNoTrans ? CblasTrans : CblasNoTrans);
+  return Atr;
+}
+
+/* single_matrix_uminus(): unary negation function for single matrices.
+ */
+SingleMatrix single_matrix_uminus (Zone z, SingleMatrix A) {
+  SingleMatrix B = single_matrix_new_with_size(z, A->m, A->n);
+  if (!B)
+    return NULL;
+
+  matte_blas->saxpy(A->m * A->n, -1.0f, A->data, 1, B->data, 1);
+  B->tr = A->tr;
+  return B;
+}
+
+/* single_matrix_convert(): convert an array operand of a product to the
+ * precision of the other operand. double arrays are rounded to single
+ * precision, unless @widen is set, in which case single arrays are
+ * widened to double precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @obj: operand to convert.
+ *  @widen: whether to widen single operands.
+ *
+ * returns:
+ *  converted operand, or @obj itself if no conversion was required.
+ */
+static Object single_matrix_convert (Zone z, Object obj, int widen) {
+  if (widen && IS_SINGLE_VECTOR(obj))
+    return (Object) single_vector_to_double(z, (SingleVector) obj);
+  else if (widen && IS_SINGLE_MATRIX(obj))
+    return (Object) single_matrix_to_double(z, (SingleMatrix) obj);
+  else if (!widen && IS_VECTOR(obj))
+    return (Object) single_vector_new_from_vector(z, (Vector) obj);
+  else if (!widen && IS_MATRIX(obj))
+    return (Object) single_matrix_new_from_matrix(z, (Matrix) obj);
+
+  return obj;
+}
+
+/* single_matrix_mtimes(): matrix multiplication function for single
+ * matrices. products with double arrays are computed in single
+ * precision, and products with complex operands are computed in double
+ * precision.
+ */
+Object single_matrix_mtimes (Zone z, Object a, Object b) {
+  /* single * scalar => single
+   * scalar * single => single
+   */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a) ||
+      IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_times(z, a, b);
+
+  /* convert the operands to a common precision. */
+  const int widen =
+    (IS_COMPLEX_VECTOR(a) || IS_COMPLEX_MATRIX(a) ||
+     IS_COMPLEX_VECTOR(b) || IS_COMPLEX_MATRIX(b));
+
+  Object pa = single_matrix_convert(z, a, widen);
+  Object pb = single_matrix_convert(z, b, widen);
+  if (pa != a || pb != b) {
+    Object c = (pa && pb ? object_mtimes(z, pa, pb) : NULL);
+    if (pa && pa != a) object_free(z, pa);
+    if (pb && pb != b) object_free(z, pb);
+    return c;
+  }
+
+  if (IS_SINGLE_MATRIX(a)) {
+    SingleMatrix A = (SingleMatrix) a;
+
+    if (IS_SINGLE_MATRIX(b)) {
+      /* single matrix * single matrix => single matrix */
+      SingleMatrix B = (SingleMatrix) b;
+      if (COLS(A) != ROWS(B))
+        throw(z, ERR_SIZE_MISMATCH_MM(A->tr, B->tr, A, B));
+
+      SingleMatrix C = single_matrix_new_with_size(z, ROWS(A), COLS(B));
+      if (C && matte_sgemm(A->tr, B->tr, 1.0f, A, B, 0.0f, C))
+        return (Object) C;
+
+      return NULL;
+    }
+    else if (IS_SINGLE_VECTOR(b)) {
+      SingleVector x = (SingleVector) b;
+
+      if (x->tr == CblasNoTrans && x->n == COLS(A)) {
+        /* single matrix * column => single column */
+        SingleVector y = single_vector_new_with_length(z, ROWS(A));
+        if (y && matte_sgemv(A->tr, 1.0f, A, x, 0.0f, y))
+          return (Object) y;
+
+        return NULL;
+      }
+      else if (x->tr != CblasNoTrans && COLS(A) == 1) {
+        /* single matrix * row => single matrix */
+        SingleMatrix C = single_matrix_new_with_size(z, ROWS(A), x->n);
+        if (!C)
+          return NULL;
+
+        matte_blas->sger(CblasColMajor, C->m, C->n, 1.0f, A->data, 1,
+                         x->data, 1, C->data, C->m);
+
+        return (Object) C;
+      }
+
+      throw(z, ERR_SIZE_MISMATCH_MV(A->tr, A, x));
+    }
+  }
+  else if (IS_SINGLE_MATRIX(b) && IS_SINGLE_VECTOR(a)) {
+    SingleMatrix B = (SingleMatrix) b;
+    SingleVector x = (SingleVector) a;
+
+    if (x->tr != CblasNoTrans && x->n == ROWS(B)) {
+      /* row * single matrix => single row */
+      const MatteTranspose trB =
+        (B->tr == CblasNoTrans ? CblasTrans : CblasNoTrans);
+
+      SingleVector y = single_vector_new_with_length(z, COLS(B));
+      if (y && matte_sgemv(trB, 1.0f, B, x, 0.0f, y)) {
+        y->tr = CblasTrans;
+        return (Object) y;
+      }
+
+      return NULL;
+    }
+    else if (x->tr == CblasNoTrans && ROWS(B) == 1) {
+      /* column * single matrix => single matrix */
+      SingleMatrix C = single_matrix_new_with_size(z, x->n, COLS(B));
+      if (!C)
+        return NULL;
+
+      matte_blas->sger(CblasColMajor, C->m, C->n, 1.0f, x->data, 1,
+                       B->data, 1, C->data, C->m);
+
+      return (Object) C;
+    }
+
+    throw(z, ERR_SIZE_MISMATCH_VM(x, B->tr, B));
+  }
+
+  throw(z, ERR_OBJ_BINARY, "mtimes",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* single_matrix_mrdivide(): matrix right division function for single
+ * matrices.
+ */
+Object single_matrix_mrdivide (Zone z, Object a, Object b) {
+  /* single matrix / scalar => single matrix */
+  if (IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_rdivide(z, a, b);
+
+  throw(z, ERR_OBJ_BINARY, "mrdivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* single_matrix_mldivide(): matrix left division function for single
+ * matrices.
+ */
+Object single_matrix_mldivide (Zone z, Object a, Object b) {
+  /* scalar \ single matrix => single matrix */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a))
+    return broadcast_ldivide(z, a, b);
+
+  throw(z, ERR_OBJ_BINARY, "mldivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* single_matrix_scalar(): get the value of a real scalar operand of an
+ * in-place operation on single matrices.
+ *
+ * arguments:
+ *  @b: operand to access.
+ *  @f: pointer to the operand value, on return.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the operand is a real
+ *  scalar.
+ */
+static int single_matrix_scalar (Object b, float *f) {
+  if (IS_FLOAT(b))
+    *f = (float) float_get_value((Float) b);
+  else if (IS_INT(b))
+    *f = (float) int_get_value((Int) b);
+  else
+    return 0;
+
+  return 1;
+}
+
+/* single_matrix_plus_inplace(): in-place addition function for single
+ * matrices.
+ */
+int single_matrix_plus_inplace (Zone z, SingleMatrix A, Object b) {
+  float f;
+  if (IS_SINGLE_MATRIX(b)) {
+    /* single matrix += single matrix */
+    SingleMatrix B = (SingleMatrix) b;
+    if (B == A || B->m != A->m || B->n != A->n || B->tr != A->tr ||
+        !single_matrix_unshare(A))
+      return 0;
+
+    matte_blas->saxpy(A->m * A->n, 1.0f, B->data, 1, A->data, 1);
+    return 1;
+  }
+  else if (single_matrix_scalar(b, &f)) {
+    /* single matrix += scalar */
+    if (!single_matrix_unshare(A))
+      return 0;
+
+    for (long i = 0; i < A->m * A->n; i++)
+      A->data[i] += f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* single_matrix_minus_inplace(): in-place subtraction function for
+ * single matrices.
+ */
+int single_matrix_minus_inplace (Zone z, SingleMatrix A, Object b) {
+  float f;
+  if (IS_SINGLE_MATRIX(b)) {
+    /* single matrix -= single matrix */
+    SingleMatrix B = (SingleMatrix) b;
+    if (B == A || B->m != A->m || B->n != A->n || B->tr != A->tr ||
+        !single_matrix_unshare(A))
+      return 0;
+
+    matte_blas->saxpy(A->m * A->n, -1.0f, B->data, 1, A->data, 1);
+    return 1;
+  }
+  else if (single_matrix_scalar(b, &f)) {
+    /* single matrix -= scalar */
+    if (!single_matrix_unshare(A))
+      return 0;
+
+    for (long i = 0; i < A->m * A->n; i++)
+      A->data[i] -= f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* single_matrix_times_inplace(): in-place element-wise multiplication
+ * function for single matrices.
+ */
+int single_matrix_times_inplace (Zone z, SingleMatrix A, Object b) {
+  float f;
+  if (IS_SINGLE_MATRIX(b)) {
+    /* single matrix .*= single matrix */
+    SingleMatrix B = (SingleMatrix) b;
+    if (B->m != A->m || B->n != A->n || B->tr != A->tr ||
+        !single_matrix_unshare(A))
+      return 0;
+
+    for (long i = 0; i < A->m * A->n; i++)
+      A->data[i] *= B->data[i];
+
+    return 1;
+  }
+  else if (single_matrix_scalar(b, &f)) {
+    /* single matrix .*= scalar */
+    if (!single_matrix_unshare(A))
+      return 0;
+
+    matte_blas->sscal(A->m * A->n, f, A->data, 1);
+    return 1;
+  }
+
+  return 0;
+}
+
+/* single_matrix_not(): logical negation operation for single matrices.
+ */
+Logical single_matrix_not (Zone z, SingleMatrix A) {
+  if (!single_matrix_untranspose(A))
+    return NULL;
+
+  Logical B = logical_new_with_size(z, A->m, A->n);
+  if (!B)
+    return NULL;
+
+  for (long i = 0; i < A->m * A->n; i++)
+    B->data[i] = (A->data[i] == 0.0f);
+
+  B->mat = 1;
+  return B;
+}
+
+/* SingleMatrix_type: object type structure for matte single matrices.
+ */
+struct _ObjectType SingleMatrix_type = {
+  "SingleMatrix",                                /* name       */
+  sizeof(struct _SingleMatrix),                  /* size       */
+  8,                                             /* precedence */
+
+  (obj_constructor) single_matrix_new,           /* fn_new    */
+  (obj_constructor) single_matrix_copy,          /* fn_copy   */
+  (obj_destructor)  single_matrix_delete,        /* fn_delete */
+  (obj_display)     single_matrix_disp,          /* fn_disp   */
+  NULL,                                          /* fn_true   */
+
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
+  (obj_unary)    single_matrix_uminus,           /* fn_uminus     */
+  (obj_binary)   broadcast_times,                /* fn_times      */
+  (obj_binary)   single_matrix_mtimes,           /* fn_mtimes     */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
+  (obj_binary)   single_matrix_mrdivide,         /* fn_mrdivide   */
+  (obj_binary)   single_matrix_mldivide,         /* fn_mldivide   */
+  (obj_binary)   broadcast_power,                /* fn_power      */
+  NULL,                                          /* fn_mpower     */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
+  NULL,                                          /* fn_mand       */
+  NULL,                                          /* fn_mor        */
+  (obj_unary)    single_matrix_not,              /* fn_not        */
+  NULL,                                          /* fn_colon      */
+  (obj_unary)    single_matrix_transpose,        /* fn_ctranspose */
+  (obj_unary)    single_matrix_transpose,        /* fn_transpose  */
+  NULL,                                          /* fn_horzcat    */
+  NULL,                                          /* fn_vertcat    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
+  NULL,                                          /* fn_subsasgn   */
+  NULL,                                          /* fn_subsindex  */
+
+  (obj_inplace)  single_matrix_plus_inplace,     /* fn_plus_inplace  */
+  (obj_inplace)  single_matrix_minus_inplace,    /* fn_minus_inplace */
+  (obj_inplace)  single_matrix_times_inplace,    /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
+};
+
@@ -0,0 +1,537 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the single vector, exception, blas, broadcast and subscript
+ * headers.
+ */
+#include <matte/single-vector.h>
+#include <matte/except.h>
+#include <matte/blas.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
+
+/* include headers for inferior types. */
+#include <matte/int.h>
+#include <matte/float.h>
+#include <matte/complex.h>
+#include <matte/vector.h>
+#include <matte/logical.h>
+
+/* include headers for superior types. */
+#include <matte/single-matrix.h>
+
+/* single_vector_type(): return a pointer to the single vector object type.
+ */
+ObjectType single_vector_type (void) {
+  /* return the struct address. */
+  return &SingleVector_type;
+}
+
+/* single_vector_new(): allocate a new empty matte single vector.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @args: constructor arguments.
+ *
+ * returns:
+ *  newly allocated empty single vector.
+ */
+SingleVector single_vector_new (Zone z, Object args) {
+  /* allocate a new single vector. */
+  SingleVector x = (SingleVector) object_alloc(z, &SingleVector_type);
+  if (!x)
+    return NULL;
+
+  /* initialize the vector data and length. */
+  x->data = NULL;
+  x->n = 0;
+
+  /* initialize the transposition state. */
+  x->tr = CblasNoTrans;
+
+  /* return the new vector. */
+  return x;
+}
+
+/* single_vector_new_with_length(): allocate a new matte single vector
+ * with a set number of zero elements.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @n: number of elements in the new vector.
+ *
+ * returns:
+ *  newly allocated zero single vector.
+ */
+SingleVector single_vector_new_with_length (Zone z, long n) {
+  /* allocate a new single vector. */
+  SingleVector x = single_vector_new(z, NULL);
+  if (!x || !single_vector_set_length(x, n))
+    return NULL;
+
+  /* return the newly allocated and initialized vector. */
+  return x;
+}
+
+/* single_vector_new_from_vector(): allocate a new matte single vector
+ * that holds the elements of a matte vector, rounded to single
+ * precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte vector to access.
+ *
+ * returns:
+ *  newly allocated and initialized single vector.
+ */
+SingleVector single_vector_new_from_vector (Zone z, Vector x) {
+  /* return null if the input vector is null. */
+  if (!x)
+    return NULL;
+
+  /* allocate the single vector. */
+  SingleVector xs = single_vector_new_with_length(z, x->n);
+  if (!xs)
+    return NULL;
+
+  /* store the rounded elements. */
+  for (long i = 0; i < x->n; i++)
+    xs->data[i] = (float) x->data[i];
+
+  /* return the new vector. */
+  xs->tr = x->tr;
+  return xs;
+}
+
+/* single_vector_to_double(): allocate a new matte vector that holds the
+ * elements of a matte single vector in double precision.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte single vector to access.
+ *
+ * returns:
+ *  newly allocated and initialized matte vector.
+ */
+Vector single_vector_to_double (Zone z, SingleVector x) {
+  /* return null if the input vector is null. */
+  if (!x)
+    return NULL;
+
+  /* allocate the double vector. */
+  Vector xd = vector_new_with_length(z, x->n);
+  if (!xd)
+    return NULL;
+
+  /* store the widened elements. */
+  for (long i = 0; i < x->n; i++)
+    xd->data[i] = (double) x->data[i];
+
+  /* return the new vector. */
+  xd->tr = x->tr;
+  return xd;
+}
+
+/* single_vector_copy(): allocate a new matte single vector from another
+ * matte single vector. the duplicate shares the data buffer of the input
+ * vector until either of them is modified.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte single vector to duplicate.
+ *
+ * returns:
+ *  duplicated matte single vector.
+ */
+SingleVector single_vector_copy (Zone z, SingleVector x) {
+  /* return null if the input argument is null. */
+  if (!x)
+    return NULL;
+
+  /* allocate a new single vector. */
+  SingleVector xnew = single_vector_new(z, NULL);
+  if (!xnew)
+    return NULL;
+
+  /* share the data buffer of the input vector with the duplicate. */
+  xnew->data = (float*) buffer_share(x->data);
+  xnew->n = x->n;
+
+  /* copy the transposition state. */
+  xnew->tr = x->tr;
+
+  /* return the new vector. */
+  return xnew;
+}
+
+/* single_vector_delete(): free all memory associated with a matte
+ * single vector.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: matte single vector to free.
+ */
+void single_vector_delete (Zone z, SingleVector x) {
+  /* return if the vector is null. */
+  if (!x)
+    return;
+
+  /* release the vector data. */
+  buffer_release(x->data);
+}
+
+/* single_vector_get_length(): get the length of a matte single vector.
+ *
+ * arguments:
+ *  @x: matte single vector to access.
+ *
+ * returns:
+ *  number of elements in the vector.
+ */
+long single_vector_get_length (SingleVector x) {
+  /* return the vector length. */
+  return (x ? x->n : 0);
+}
+
+/* single_vector_get(): get an element from a matte single vector.
+ *
+ * arguments:
+ *  @x: matte single vector to access.
+ *  @i: element index to get.
+ *
+ * returns:
+ *  requested vector element.
+ */
+inline float single_vector_get (SingleVector x, long i) {
+  /* if the pointer and index are valid, return the element. */
+  if (x && i < x->n)
+    return x->data[i];
+
+  /* return zero. */
+  return 0.0f;
+}
+
+/* single_vector_set_length(): set the length of a matte single vector.
+ *
+ * arguments:
+ *  @x: matte single vector to modify.
+ *  @n: new length of the vector.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int single_vector_set_length (SingleVector x, long n) {
+  /* validate the input arguments. */
+  if (!x || n < 0)
+    fail(ERR_INVALID_ARGIN);
+
+  /* return if the vector already has the desired length. */
+  if (x->n == n)
+    return 1;
+
+  /* reallocate the vector data, zeroing any new trailing elements. */
+  float *data = (float*) buffer_resize(x->data, x->n, n, sizeof(float));
+  if (n && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the new vector data and length. */
+  x->data = data;
+  x->n = n;
+
+  /* return success. */
+  return 1;
+}
+
+/* single_vector_unshare(): ensure that the data of a matte single vector
+ * is not shared with any other vector, so that it may be modified in
+ * place.
+ *
+ * arguments:
+ *  @x: matte single vector to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int single_vector_unshare (SingleVector x) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the vector data if it is held by other vectors. */
+  float *data = (float*) buffer_unshare(x->data, x->n, sizeof(float));
+  if (x->n && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared vector data and return success. */
+  x->data = data;
+  return 1;
+}
+
+/* single_vector_set(): set an element of a matte single vector. the
+ * vector data must not be shared, see single_vector_unshare().
+ *
+ * arguments:
+ *  @x: matte single vector to modify.
+ *  @i: element index to set.
+ *  @xi: element value.
+ */
+inline void single_vector_set (SingleVector x, long i, float xi) {
+  /* if the pointer and index are valid, set the element. */
+  if (x && i < x->n)
+    x->data[i] = xi;
+}
+
+/* single_vector_disp(): display function for matte single vectors.
+ */
+int single_vector_disp (Zone z, SingleVector x) {
+  /* print the vector contents. */
+  printf("\n");
+  const long n = single_vector_get_length(x);
+  for (long i = 0; i < n; i++)
+    printf("\n  %g", (double) single_vector_get(x, i));
+
+  /* print newlines and return success. */
+  printf("\n\n");
+  return 1;
+}
+
+/* single_vector_uminus(): unary negation function for single vectors.
+ */
+SingleVector single_vector_uminus (Zone z, SingleVector a) {
+  SingleVector aneg = single_vector_new_with_length(z, a->n);
+  if (!matte_saxpy(-1.0f, a, aneg))
+    return NULL;
+
+  aneg->tr = a->tr;
+  return aneg;
+}
+
+/* single_vector_scalar(): get the value of a real scalar operand of an
+ * in-place operation on single vectors.
+ *
+ * arguments:
+ *  @b: operand to access.
+ *  @f: pointer to the operand value, on return.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the operand is a real
+ *  scalar.
+ */
+static int single_vector_scalar (Object b, float *f) {
+  if (IS_FLOAT(b))
+    *f = (float) float_get_value((Float) b);
+  else if (IS_INT(b))
+    *f = (float) int_get_value((Int) b);
+  else
+    return 0;
+
+  return 1;
+}
+
+/* single_vector_plus_inplace(): in-place addition function for single
+ * vectors.
+ */
+int single_vector_plus_inplace (Zone z, SingleVector a, Object b) {
+  float f;
+  if (IS_SINGLE_VECTOR(b)) {
+    /* single vector += single vector */
+    SingleVector vb = (SingleVector) b;
+    if (vb != a && vb->n == a->n && vb->tr == a->tr)
+      return (single_vector_unshare(a) && matte_saxpy(1.0f, vb, a));
+  }
+  else if (single_vector_scalar(b, &f)) {
+    /* single vector += scalar */
+    if (!single_vector_unshare(a))
+      return 0;
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] += f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* single_vector_minus_inplace(): in-place subtraction function for
+ * single vectors.
+ */
+int single_vector_minus_inplace (Zone z, SingleVector a, Object b) {
+  float f;
+  if (IS_SINGLE_VECTOR(b)) {
+    /* single vector -= single vector */
+    SingleVector vb = (SingleVector) b;
+    if (vb != a && vb->n == a->n && vb->tr == a->tr)
+      return (single_vector_unshare(a) && matte_saxpy(-1.0f, vb, a));
+  }
+  else if (single_vector_scalar(b, &f)) {
+    /* single vector -= scalar */
+    if (!single_vector_unshare(a))
+      return 0;
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] -= f;
+
+    return 1;
+  }
+
+  return 0;
+}
+
+/* single_vector_times_inplace(): in-place element-wise multiplication
+ * function for single vectors.
+ */
+int single_vector_times_inplace (Zone z, SingleVector a, Object b) {
+  float f;
+  if (IS_SINGLE_VECTOR(b)) {
+    /* single vector .*= single vector */
+    SingleVector vb = (SingleVector) b;
+    if (vb->n != a->n || vb->tr != a->tr || !single_vector_unshare(a))
+      return 0;
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] *= vb->data[i];
+
+    return 1;
+  }
+  else if (single_vector_scalar(b, &f)) {
+    /* single vector .*= scalar */
+    return (single_vector_unshare(a) && matte_sscal(f, a));
+  }
+
+  return 0;
+}
+
+/* single_vector_mtimes(): matrix multiplication function for single
+ * vectors. products involving other operand types are computed by the
+ * single matrix function.
+ */
+Object single_vector_mtimes (Zone z, Object a, Object b) {
+  if (IS_SINGLE_VECTOR(a) && IS_SINGLE_VECTOR(b)) {
+    SingleVector va = (SingleVector) a;
+    SingleVector vb = (SingleVector) b;
+
+    if (va->tr == CblasNoTrans && vb->tr == CblasTrans) {
+      /* column * row => single matrix */
+      SingleMatrix A = single_matrix_new_with_size(z, va->n, vb->n);
+      if (matte_sger(1.0f, va, vb, A))
+        return (Object) A;
+    }
+    else if (va->tr == CblasTrans && vb->tr == CblasNoTrans) {
+      /* row * column => float */
+      float fval;
+      if (matte_sdot(va, vb, &fval))
+        return (Object) float_new_with_value(z, fval);
+    }
+
+    throw(z, ERR_SIZE_MISMATCH_VV(va, vb));
+  }
+
+  return single_matrix_mtimes(z, a, b);
+}
+
+/* single_vector_mrdivide(): matrix right division function for single
+ * vectors.
+ */
+Object single_vector_mrdivide (Zone z, Object a, Object b) {
+  /* single vector / scalar => single vector */
+  if (IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_rdivide(z, a, b);
+
+  throw(z, ERR_OBJ_BINARY, "mrdivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* single_vector_mldivide(): matrix left division function for single
+ * vectors.
+ */
+Object single_vector_mldivide (Zone z, Object a, Object b) {
+  /* scalar \ single vector => single vector */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a))
+    return broadcast_ldivide(z, a, b);
+
+  throw(z, ERR_OBJ_BINARY, "mldivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
+
+/* single_vector_not(): logical negation operation for single vectors.
+ */
+Logical single_vector_not (Zone z, SingleVector a) {
+  Logical x = (a->tr == CblasNoTrans ? logical_new_with_size(z, a->n, 1) :
+                                       logical_new_with_size(z, 1, a->n));
+  if (!x)
+    return NULL;
+
+  for (long i = 0; i < a->n; i++)
+    x->data[i] = (a->data[i] == 0.0f);
+
+  x->mat = 0;
+  return x;
+}
+
+/* single_vector_transpose(): transposition function for single vectors.
+ * the transposed vector shares the data of its operand.
+ */
+SingleVector single_vector_transpose (Zone z, SingleVector a) {
+  SingleVector atr = single_vector_copy(z, a);
+  if (!atr)
+    return NULL;
+
+  atr->tr = (a->tr == CblasNoTrans ? CblasTrans : CblasNoTrans);
+  return atr;
+}
+
+/* SingleVector_type: object type structure for matte single vectors.
+ */
+struct _ObjectType SingleVector_type = {
+  "SingleVector",                                /* name       */
+  sizeof(struct _SingleVector),                  /* size       */
+  8,                                             /* precedence */
+
+  (obj_constructor) single_vector_new,           /* fn_new    */
+  (obj_constructor) single_vector_copy,          /* fn_copy   */
+  (obj_destructor)  single_vector_delete,        /* fn_delete */
+  (obj_display)     single_vector_disp,          /* fn_disp   */
+  NULL,                                          /* fn_true   */
+
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
+  (obj_unary)    single_vector_uminus,           /* fn_uminus     */
+  (obj_binary)   broadcast_times,                /* fn_times      */
+  (obj_binary)   single_vector_mtimes,           /* fn_mtimes     */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
+  (obj_binary)   single_vector_mrdivide,         /* fn_mrdivide   */
+  (obj_binary)   single_vector_mldivide,         /* fn_mldivide   */
+  (obj_binary)   broadcast_power,                /* fn_power      */
+  NULL,                                          /* fn_mpower     */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
+  NULL,                                          /* fn_mand       */
+  NULL,                                          /* fn_mor        */
+  (obj_unary)    single_vector_not,              /* fn_not        */
+  NULL,                                          /* fn_colon      */
+  (obj_unary)    single_vector_transpose,        /* fn_ctranspose */
+  (obj_unary)    single_vector_transpose,        /* fn_transpose  */
+  NULL,                                          /* fn_horzcat    */
+  NULL,                                          /* fn_vertcat    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
+  NULL,                                          /* fn_subsasgn   */
+  NULL,                                          /* fn_subsindex  */
+
+  (obj_inplace)  single_vector_plus_inplace,     /* fn_plus_inplace  */
+  (obj_inplace)  single_vector_minus_inplace,    /* fn_minus_inplace */
+  (obj_inplace)  single_vector_times_inplace,    /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
+};
+
@@ -0,0 +1,1354 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the sparse matrix, exception, threads and sparse solver
+ * headers.
+ */
+#include <matte/sparse-matrix.h>
+#include <matte/except.h>
+#include <matte/threads.h>
+#include <matte/sparse-solve.h>
+
+/* include headers for inferior types. */
+#include <matte/int.h>
+#include <matte/float.h>
+#include <matte/vector.h>
+#include <matte/matrix.h>
+
+/* SparseOp: enumeration of the element-wise operations of sparse
+ * matrices with scalars that preserve their sparsity.
+ */
+typedef enum {
+  SPARSE_TIMES = 0,
+  SPARSE_RDIVIDE,
+  SPARSE_POWER
+}
+SparseOp;
+
+/* sparse_matrix_type(): return a pointer to the sparse matrix object
+ * type.
+ */
+ObjectType sparse_matrix_type (void) {
+  /* return the struct address. */
+  return &SparseMatrix_type;
+}
+
+/* sparse_matrix_new(): allocate a new empty matte sparse matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @args: constructor arguments.
+ *
+ * returns:
+ *  newly allocated empty sparse matrix.
+ */
+SparseMatrix sparse_matrix_new (Zone z, Object args) {
+  /* allocate a new sparse matrix. */
+  SparseMatrix S = (SparseMatrix) object_alloc(z, &SparseMatrix_type);
+  if (!S)
+    return NULL;
+
+  /* initialize the matrix shape. */
+  S->m = 0;
+  S->n = 0;
+  S->nnz = 0;
+
+  /* initialize the matrix data. */
+  S->colptr = S->rowidx = NULL;
+  S->data = NULL;
+  S->rowptr = S->colidx = NULL;
+  S->rdata = NULL;
+
+  /* return the new matrix. */
+  return S;
+}
+
+/* sparse_matrix_new_with_size(): allocate a new matte sparse matrix with
+ * a set number of rows and columns, and space for a set number of stored
+ * elements. the column offsets are initialized to zero.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @m: number of rows in the new matrix.
+ *  @n: number of columns in the new matrix.
+ *  @nnz: number of stored elements in the new matrix.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+SparseMatrix sparse_matrix_new_with_size (Zone z, long m, long n, long nnz) {
+  /* validate the input arguments. */
+  if (m < 0 || n < 0 || nnz < 0)
+    fail(ERR_INVALID_ARGIN);
+
+  /* allocate a new sparse matrix. */
+  SparseMatrix S = sparse_matrix_new(z, NULL);
+  if (!S)
+    return NULL;
+
+  /* allocate the matrix data. */
+  S->colptr = (long*) buffer_resize(NULL, 0, n + 1, sizeof(long));
+  S->rowidx = (long*) buffer_resize(NULL, 0, nnz, sizeof(long));
+  S->data = (double*) buffer_resize(NULL, 0, nnz, sizeof(double));
+  if (!S->colptr || (nnz && (!S->rowidx || !S->data))) {
+    object_free(z, S);
+    fail(ERR_BAD_ALLOC);
+  }
+
+  /* store the matrix shape and return the new matrix. */
+  S->m = m;
+  S->n = n;
+  S->nnz = nnz;
+  return S;
+}
+
+/* sparse_matrix_trim(): reduce the number of stored elements of a newly
+ * built sparse matrix, releasing any unused space.
+ *
+ * arguments:
+ *  @S: sparse matrix to modify.
+ *  @nnz: new number of stored elements.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int sparse_matrix_trim (SparseMatrix S, long nnz) {
+  if (nnz == S->nnz)
+    return 1;
+
+  long *rowidx = (long*) buffer_resize(S->rowidx, S->nnz, nnz, sizeof(long));
+  double *data = (double*) buffer_resize(S->data, S->nnz, nnz,
+                                         sizeof(double));
+  if (nnz && (!rowidx || !data))
+    fail(ERR_BAD_ALLOC);
+
+  S->rowidx = rowidx;
+  S->data = data;
+  S->nnz = nnz;
+  return 1;
+}
+
+/* sparse_matrix_new_from_triplets(): allocate a new matte sparse matrix
+ * from a list of (row, column, value) triplets. the values of repeated
+ * elements are summed, and elements that sum to zero are not stored.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @m: number of rows in the new matrix.
+ *  @n: number of columns in the new matrix.
+ *  @nnz: number of triplets.
+ *  @i: zero-based row index of each triplet.
+ *  @j: zero-based column index of each triplet.
+ *  @v: value of each triplet.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+SparseMatrix sparse_matrix_new_from_triplets (Zone z, long m, long n,
+                                              long nnz, const long *i,
+                                              const long *j,
+                                              const double *v) {
+  /* check that the indices lie within the matrix. */
+  for (long k = 0; k < nnz; k++) {
+    if (i[k] < 0 || j[k] < 0)
+      fail(ERR_INDEX_INVALID);
+
+    if (i[k] >= m)
+      fail(ERR_INDEX_BOUNDS(i[k] + 1, m));
+
+    if (j[k] >= n)
+      fail(ERR_INDEX_BOUNDS(j[k] + 1, n));
+  }
+
+  /* allocate the new matrix with space for every triplet. */
+  SparseMatrix S = sparse_matrix_new_with_size(z, m, n, nnz);
+  if (!S)
+    return NULL;
+
+  /* allocate workspaces for sorting the triplets. */
+  long *perm = (long*) malloc((nnz > 0 ? nnz : 1) * sizeof(long));
+  long *next = (long*) calloc((m > n ? m : n) + 1, sizeof(long));
+  if (!perm || !next) {
+    free(perm);
+    free(next);
+    object_free(z, S);
+    fail(ERR_BAD_ALLOC);
+  }
+
+  /* order the triplets by row. */
+  for (long k = 0; k < nnz; k++)
+    next[i[k] + 1]++;
+
+  for (long r = 0; r < m; r++)
+    next[r + 1] += next[r];
+
+  for (long k = 0; k < nnz; k++)
+    perm[next[i[k]]++] = k;
+
+  /* distribute the triplets into their columns. as they are visited in
+   * order of row, the rows of each column are in ascending order.
+   */
+  long *cp = S->colptr;
+  for (long k = 0; k < nnz; k++)
+    cp[j[k] + 1]++;
+
+  for (long c = 0; c < n; c++) {
+    cp[c + 1] += cp[c];
+    next[c] = cp[c];
+  }
+
+  for (long q = 0; q < nnz; q++) {
+    const long k = perm[q];
+    const long p = next[j[k]]++;
+    S->rowidx[p] = i[k];
+    S->data[p] = v[k];
+  }
+
+  free(perm);
+  free(next);
+
+  /* sum repeated elements and drop zeros, compacting each column. */
+  long p = 0;
+  for (long c = 0; c < n; c++) {
+    const long start = cp[c];
+    const long end = cp[c + 1];
+    const long first = p;
+    cp[c] = p;
+
+    for (long q = start; q < end; q++) {
+      if (p > first && S->rowidx[p - 1] == S->rowidx[q]) {
+        S->data[p - 1] += S->data[q];
+      }
+      else {
+        S->rowidx[p] = S->rowidx[q];
+        S->data[p] = S->data[q];
+        p++;
+      }
+    }
+
+    long w = first;
+    for (long q = first; q < p; q++) {
+      if (S->data[q] != 0.0) {
+        S->rowidx[w] = S->rowidx[q];
+        S->data[w] = S->data[q];
+        w++;
+      }
+    }
+
+    p = w;
+  }
+
+  /* store the final number of elements and return the new matrix. */
+  cp[n] = p;
+  if (!sparse_matrix_trim(S, p)) {
+    object_free(z, S);
+    return NULL;
+  }
+
+  return S;
+}
+
+/* sparse_matrix_new_from_matrix(): allocate a new matte sparse matrix
+ * that holds the nonzero elements of a matte matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A: matte matrix to access.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+SparseMatrix sparse_matrix_new_from_matrix (Zone z, Matrix A) {
+  /* return null if the input matrix is null. */
+  if (!A || !matrix_untranspose(A))
+    return NULL;
+
+  /* count the nonzero elements. */
+  const long len = A->m * A->n;
+  long nnz = 0;
+  for (long k = 0; k < len; k++)
+    nnz += (A->data[k] != 0.0);
+
+  /* allocate the new matrix. */
+  SparseMatrix S = sparse_matrix_new_with_size(z, A->m, A->n, nnz);
+  if (!S)
+    return NULL;
+
+  /* store the nonzero elements, column by column. */
+  long p = 0;
+  for (long j = 0; j < A->n; j++) {
+    const double *aj = A->data + j * A->m;
+    S->colptr[j] = p;
+
+    for (long i = 0; i < A->m; i++) {
+      if (aj[i] != 0.0) {
+        S->rowidx[p] = i;
+        S->data[p] = aj[i];
+        p++;
+      }
+    }
+  }
+
+  /* return the new matrix. */
+  S->colptr[A->n] = p;
+  return S;
+}
+
+/* sparse_matrix_to_matrix(): allocate a new matte matrix that holds all
+ * elements of a matte sparse matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @S: matte sparse matrix to access.
+ *
+ * returns:
+ *  newly allocated matte matrix.
+ */
+Matrix sparse_matrix_to_matrix (Zone z, SparseMatrix S) {
+  /* return null if the input matrix is null. */
+  if (!S)
+    return NULL;
+
+  /* allocate a zero matrix of the same size. */
+  Matrix A = matrix_new_with_size(z, S->m, S->n);
+  if (!A)
+    return NULL;
+
+  /* scatter the stored elements. */
+  for (long j = 0; j < S->n; j++) {
+    for (long p = S->colptr[j]; p < S->colptr[j + 1]; p++)
+      A->data[S->rowidx[p] + j * S->m] = S->data[p];
+  }
+
+  /* return the new matrix. */
+  return A;
+}
+
+/* sparse_matrix_copy(): allocate a new matte sparse matrix from another
+ * matte sparse matrix. the duplicate shares the data buffers of the input
+ * matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @S: matte sparse matrix to duplicate.
+ *
+ * returns:
+ *  duplicated matte sparse matrix.
+ */
+SparseMatrix sparse_matrix_copy (Zone z, SparseMatrix S) {
+  /* return null if the input argument is null. */
+  if (!S)
+    return NULL;
+
+  /* allocate a new sparse matrix. */
+  SparseMatrix Snew = sparse_matrix_new(z, NULL);
+  if (!Snew)
+    return NULL;
+
+  /* share the data buffers of the input matrix with the duplicate. */
+  Snew->m = S->m;
+  Snew->n = S->n;
+  Snew->nnz = S->nnz;
+  Snew->colptr = (long*) buffer_share(S->colptr);
+  Snew->rowidx = (long*) buffer_share(S->rowidx);
+  Snew->data = (double*) buffer_share(S->data);
+  Snew->rowptr = (long*) buffer_share(S->rowptr);
+  Snew->colidx = (long*) buffer_share(S->colidx);
+  Snew->rdata = (double*) buffer_share(S->rdata);
+
+  /* return the new matrix. */
+  return Snew;
+}
+
+/* sparse_matrix_delete(): free all memory associated with a matte
+ * sparse matrix.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @S: matte sparse matrix to free.
+ */
+void sparse_matrix_delete (Zone z, SparseMatrix S) {
+  /* return if the matrix is null. */
+  if (!S)
+    return;
+
+  /* release the matrix data. */
+  buffer_release(S->colptr);
+  buffer_release(S->rowidx);
+  buffer_release(S->data);
+  buffer_release(S->rowptr);
+  buffer_release(S->colidx);
+  buffer_release(S->rdata);
+}
+
+/* sparse_matrix_get_nnz(): get the number of stored elements of a matte
+ * sparse matrix.
+ *
+ * arguments:
+ *  @S: matte sparse matrix to access.
+ *
+ * returns:
+ *  number of stored elements in the matrix.
+ */
+long sparse_matrix_get_nnz (SparseMatrix S) {
+  /* return the element count. */
+  return (S ? S->nnz : 0);
+}
+
+/* sparse_matrix_get(): get an element from a matte sparse matrix.
+ *
+ * arguments:
+ *  @S: matte sparse matrix to access.
+ *  @i: row index of the element to get.
+ *  @j: column index of the element to get.
+ *
+ * returns:
+ *  requested matrix element, which is zero if it is not stored.
+ */
+double sparse_matrix_get (SparseMatrix S, long i, long j) {
+  /* return zero if the pointer or indices are invalid. */
+  if (!S || i < 0 || i >= S->m || j < 0 || j >= S->n)
+    return 0.0;
+
+  /* search the rows of the column for the element. */
+  long lo = S->colptr[j];
+  long hi = S->colptr[j + 1];
+  while (lo < hi) {
+    const long mid = lo + (hi - lo) / 2;
+    if (S->rowidx[mid] < i)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  /* return the element, or zero if it is not stored. */
+  if (lo < S->colptr[j + 1] && S->rowidx[lo] == i)
+    return S->data[lo];
+
+  return 0.0;
+}
+
+/* sparse_matrix_rows(): compute the compressed sparse row format of the
+ * elements of a matte sparse matrix, if it has not been computed.
+ *
+ * arguments:
+ *  @S: matte sparse matrix to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int sparse_matrix_rows (SparseMatrix S) {
+  /* return if the row format is already available. */
+  if (S->rowptr)
+    return 1;
+
+  /* allocate the row offsets, column indices and values. */
+  long *rowptr = (long*) buffer_resize(NULL, 0, S->m + 1, sizeof(long));
+  long *colidx = (long*) buffer_resize(NULL, 0, S->nnz, sizeof(long));
+  double *rdata = (double*) buffer_resize(NULL, 0, S->nnz, sizeof(double));
+  if (!rowptr || (S->nnz && (!colidx || !rdata))) {
+    buffer_release(rowptr);
+    buffer_release(colidx);
+    buffer_release(rdata);
+    fail(ERR_BAD_ALLOC);
+  }
+
+  /* count the elements of each row. */
+  for (long p = 0; p < S->nnz; p++)
+    rowptr[S->rowidx[p] + 1]++;
+
+  for (long i = 0; i < S->m; i++)
+    rowptr[i + 1] += rowptr[i];
+
+  /* distribute the elements into their rows, using the offsets of the
+   * following rows as insertion points.
+   */
+  for (long j = 0; j < S->n; j++) {
+    for (long p = S->colptr[j]; p < S->colptr[j + 1]; p++) {
+      const long q = rowptr[S->rowidx[p]]++;
+      colidx[q] = j;
+      rdata[q] = S->data[p];
+    }
+  }
+
+  /* restore the row offsets. */
+  for (long i = S->m; i > 0; i--)
+    rowptr[i] = rowptr[i - 1];
+
+  rowptr[0] = 0;
+
+  /* store the row format and return success. */
+  S->rowptr = rowptr;
+  S->colidx = colidx;
+  S->rdata = rdata;
+  return 1;
+}
+
+/* sparse_matrix_is_symmetric(): check whether a matte sparse matrix is
+ * exactly equal to its transpose.
+ *
+ * arguments:
+ *  @S: matte sparse matrix to access.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the matrix is symmetric.
+ */
+int sparse_matrix_is_symmetric (SparseMatrix S) {
+  if (S->m != S->n || !sparse_matrix_rows(S))
+    return 0;
+
+  /* symmetric matrices have identical row and column formats. */
+  for (long j = 0; j <= S->n; j++) {
+    if (S->colptr[j] != S->rowptr[j]) return 0;
+  }
+
+  for (long p = 0; p < S->nnz; p++) {
+    if (S->rowidx[p] != S->colidx[p] || S->data[p] != S->rdata[p])
+      return 0;
+  }
+
+  return 1;
+}
+
+/* SparseLoop: structure for holding the operands of a product between
+ * a sparse matrix and a dense matrix that is split across the thread
+ * pool.
+ */
+typedef struct {
+  /* @ptr: offsets of each compressed row or column.
+   * @idx: column or row index of each element.
+   * @val: value of each element.
+   */
+  const long *ptr, *idx;
+  const double *val;
+
+  /* @X: elements of the dense operand.
+   * @Y: elements of the dense result.
+   * @k: number of rows or columns of the dense operand.
+   * @ldx, @ldy: leading dimensions of the dense operand and result.
+   */
+  const double *X;
+  double *Y;
+  long k, ldx, ldy;
+}
+SparseLoop;
+
+/* sparse_matrix_spmv_rows(): compute a range of rows of the product of
+ * a sparse matrix and a dense matrix. each row of the result is computed
+ * from one compressed row of the sparse matrix, so rows are independent.
+ */
+static void sparse_matrix_spmv_rows (void *arg, int id, long start,
+                                     long end) {
+  const SparseLoop *L = (const SparseLoop*) arg;
+  for (long c = 0; c < L->k; c++) {
+    const double *x = L->X + c * L->ldx;
+    double *y = L->Y + c * L->ldy;
+
+    for (long i = start; i < end; i++) {
+      double yi = 0.0;
+      for (long p = L->ptr[i]; p < L->ptr[i + 1]; p++)
+        yi += L->val[p] * x[L->idx[p]];
+
+      y[i] = yi;
+    }
+  }
+}
+
+/* sparse_matrix_spmv_cols(): compute a range of columns of the product
+ * of a dense matrix and a sparse matrix. each column of the result is a
+ * combination of the columns of the dense matrix that are selected by
+ * one compressed column of the sparse matrix.
+ */
+static void sparse_matrix_spmv_cols (void *arg, int id, long start,
+                                     long end) {
+  const SparseLoop *L = (const SparseLoop*) arg;
+  for (long j = start; j < end; j++) {
+    double *y = L->Y + j * L->ldy;
+    for (long r = 0; r < L->k; r++)
+      y[r] = 0.0;
+
+    for (long p = L->ptr[j]; p < L->ptr[j + 1]; p++) {
+      const double *x = L->X + L->idx[p] * L->ldx;
+      const double v = L->val[p];
+      for (long r = 0; r < L->k; r++)
+        y[r] += v * x[r];
+    }
+  }
+}
+
+/* sparse_matrix_spmv(): compute the product of a sparse matrix and a
+ * dense matrix, split by rows across the thread pool.
+ *
+ * arguments:
+ *  @S: sparse matrix operand, with @m rows and @n columns.
+ *  @k: number of columns of the dense operand and result.
+ *  @X: elements of the dense operand, with @n rows.
+ *  @ldx: leading dimension of the dense operand.
+ *  @Y: elements of the dense result, with @m rows.
+ *  @ldy: leading dimension of the dense result.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int sparse_matrix_spmv (SparseMatrix S, long k, const double *X, long ldx,
+                        double *Y, long ldy) {
+  /* the rows of the product are computed from the row format. */
+  if (!sparse_matrix_rows(S))
+    return 0;
+
+  SparseLoop L;
+  L.ptr = S->rowptr;
+  L.idx = S->colidx;
+  L.val = S->rdata;
+  L.X = X;
+  L.Y = Y;
+  L.k = k;
+  L.ldx = ldx;
+  L.ldy = ldy;
+
+  const long work = (S->nnz / (S->m > 0 ? S->m : 1) + 1) * k;
+  threads_run(S->m, work, sparse_matrix_spmv_rows, &L);
+  return 1;
+}
+
+/* sparse_matrix_scalar(): get the value of a real scalar operand.
+ *
+ * arguments:
+ *  @obj: object to access.
+ *  @f: value of the scalar, on return.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) @obj is a real scalar.
+ */
+static int sparse_matrix_scalar (Object obj, double *f) {
+  if (IS_INT(obj))
+    *f = (double) int_get_value((Int) obj);
+  else if (IS_FLOAT(obj))
+    *f = float_get_value((Float) obj);
+  else
+    return 0;
+
+  return 1;
+}
+
+/* sparse_matrix_dense_arg(): describe a real vector or matrix operand of
+ * a mixed sparse-dense operation.
+ *
+ * arguments:
+ *  @obj: object to access.
+ *  @m: number of operand rows, on return.
+ *  @n: number of operand columns, on return.
+ *  @data: operand elements in column-major order, on return.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) @obj is a real vector or
+ *  matrix.
+ */
+static int sparse_matrix_dense_arg (Object obj, long *m, long *n,
+                                    const double **data) {
+  if (IS_VECTOR(obj)) {
+    Vector x = (Vector) obj;
+    *m = (x->tr == CblasNoTrans ? x->n : 1);
+    *n = (x->tr == CblasNoTrans ? 1 : x->n);
+    *data = x->data;
+  }
+  else if (IS_MATRIX(obj)) {
+    Matrix A = (Matrix) obj;
+    if (!matrix_untranspose(A))
+      return 0;
+
+    *m = A->m;
+    *n = A->n;
+    *data = A->data;
+  }
+  else
+    return 0;
+
+  return 1;
+}
+
+/* sparse_matrix_dense_alloc(): allocate a dense vector or matrix result
+ * of a mixed sparse-dense operation.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @m: number of result rows.
+ *  @n: number of result columns.
+ *  @data: pointer to the result elements, on return.
+ *
+ * returns:
+ *  newly allocated vector, if either dimension is one, or matrix.
+ */
+static Object sparse_matrix_dense_alloc (Zone z, long m, long n,
+                                         double **data) {
+  if (m != 1 && n != 1) {
+    Matrix A = matrix_new_with_size(z, m, n);
+    if (!A)
+      return NULL;
+
+    *data = A->data;
+    return (Object) A;
+  }
+
+  Vector x = vector_new_with_length(z, m * n);
+  if (!x)
+    return NULL;
+
+  x->tr = (n == 1 ? CblasNoTrans : CblasTrans);
+  *data = x->data;
+  return (Object) x;
+}
+
+/* sparse_matrix_dense(): compute an operation that does not preserve
+ * sparsity on the full matrices that are held by its sparse operands.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @a, @b: operands of the operation.
+ *  @fn: dispatch function of the operation.
+ *
+ * returns:
+ *  result of the operation.
+ */
+static Object sparse_matrix_dense (Zone z, Object a, Object b,
+                                   obj_binary fn) {
+  Object fa = (IS_SPARSE_MATRIX(a) ?
+               (Object) sparse_matrix_to_matrix(z, (SparseMatrix) a) : a);
+  Object fb = (IS_SPARSE_MATRIX(b) ?
+               (Object) sparse_matrix_to_matrix(z, (SparseMatrix) b) : b);
+  Object c = (fa && fb ? fn(z, fa, fb) : NULL);
+
+  if (fa && fa != a) object_free(z, fa);
+  if (fb && fb != b) object_free(z, fb);
+  return c;
+}
+
+/* sparse_matrix_map(): compute an element-wise operation between a
+ * sparse matrix and a real scalar, which maps zeros to zeros. elements
+ * that become zero are not stored in the result.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @S: sparse matrix operand.
+ *  @op: operation to compute.
+ *  @f: scalar operand.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+static SparseMatrix sparse_matrix_map (Zone z, SparseMatrix S, SparseOp op,
+                                       double f) {
+  SparseMatrix C = sparse_matrix_new_with_size(z, S->m, S->n, S->nnz);
+  if (!C)
+    return NULL;
+
+  long q = 0;
+  for (long j = 0; j < S->n; j++) {
+    C->colptr[j] = q;
+    for (long p = S->colptr[j]; p < S->colptr[j + 1]; p++) {
+      const double v = (op == SPARSE_TIMES ? S->data[p] * f :
+                        op == SPARSE_RDIVIDE ? S->data[p] / f :
+                        pow(S->data[p], f));
+      if (v != 0.0) {
+        C->rowidx[q] = S->rowidx[p];
+        C->data[q] = v;
+        q++;
+      }
+    }
+  }
+
+  C->colptr[S->n] = q;
+  if (!sparse_matrix_trim(C, q)) {
+    object_free(z, C);
+    return NULL;
+  }
+
+  return C;
+}
+
+/* sparse_matrix_merge(): compute the sum or difference of two sparse
+ * matrices of the same size, by merging the rows of each column.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A, @B: sparse matrix operands.
+ *  @sign: sign applied to the elements of @B.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+static SparseMatrix sparse_matrix_merge (Zone z, SparseMatrix A,
+                                         SparseMatrix B, double sign) {
+  if (A->m != B->m || A->n != B->n)
+    fail(ERR_SIZE_MISMATCH_BC(A, B));
+
+  SparseMatrix C = sparse_matrix_new_with_size(z, A->m, A->n,
+                                               A->nnz + B->nnz);
+  if (!C)
+    return NULL;
+
+  long q = 0;
+  for (long j = 0; j < A->n; j++) {
+    long pa = A->colptr[j], pb = B->colptr[j];
+    const long ea = A->colptr[j + 1], eb = B->colptr[j + 1];
+    C->colptr[j] = q;
+
+    while (pa < ea || pb < eb) {
+      const long ia = (pa < ea ? A->rowidx[pa] : A->m);
+      const long ib = (pb < eb ? B->rowidx[pb] : B->m);
+      const long i = (ia < ib ? ia : ib);
+
+      double v = 0.0;
+      if (ia == i) v += A->data[pa++];
+      if (ib == i) v += sign * B->data[pb++];
+
+      if (v != 0.0) {
+        C->rowidx[q] = i;
+        C->data[q] = v;
+        q++;
+      }
+    }
+  }
+
+  C->colptr[A->n] = q;
+  if (!sparse_matrix_trim(C, q)) {
+    object_free(z, C);
+    return NULL;
+  }
+
+  return C;
+}
+
+/* sparse_matrix_intersect(): compute the element-wise product of a
+ * sparse matrix with a sparse or dense matrix of the same size. only the
+ * stored elements of @A are visited.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A: sparse matrix operand.
+ *  @B: sparse matrix operand, or null.
+ *  @X: dense operand elements in column-major order, if @B is null.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+static SparseMatrix sparse_matrix_intersect (Zone z, SparseMatrix A,
+                                             SparseMatrix B,
+                                             const double *X) {
+  SparseMatrix C = sparse_matrix_new_with_size(z, A->m, A->n, A->nnz);
+  if (!C)
+    return NULL;
+
+  long q = 0;
+  for (long j = 0; j < A->n; j++) {
+    long pb = (B ? B->colptr[j] : 0);
+    const long eb = (B ? B->colptr[j + 1] : 0);
+    C->colptr[j] = q;
+
+    for (long pa = A->colptr[j]; pa < A->colptr[j + 1]; pa++) {
+      const long i = A->rowidx[pa];
+      double y;
+      if (B) {
+        /* advance to the matching row of the sparse operand. */
+        while (pb < eb && B->rowidx[pb] < i)
+          pb++;
+
+        if (pb == eb || B->rowidx[pb] != i)
+          continue;
+
+        y = B->data[pb];
+      }
+      else
+        y = X[i + j * A->m];
+
+      const double v = A->data[pa] * y;
+      if (v != 0.0) {
+        C->rowidx[q] = i;
+        C->data[q] = v;
+        q++;
+      }
+    }
+  }
+
+  C->colptr[A->n] = q;
+  if (!sparse_matrix_trim(C, q)) {
+    object_free(z, C);
+    return NULL;
+  }
+
+  return C;
+}
+
+/* sparse_matrix_compare(): comparison function for sorting row indices.
+ */
+static int sparse_matrix_compare (const void *a, const void *b) {
+  const long ia = *(const long*) a;
+  const long ib = *(const long*) b;
+  return (ia > ib) - (ia < ib);
+}
+
+/* sparse_matrix_product(): compute the product of two sparse matrices,
+ * one column at a time, by accumulating the columns of @A selected by
+ * each column of @B into a dense workspace.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @A, @B: sparse matrix operands.
+ *
+ * returns:
+ *  newly allocated sparse matrix.
+ */
+static SparseMatrix sparse_matrix_product (Zone z, SparseMatrix A,
+                                           SparseMatrix B) {
+  if (A->n != B->m)
+    fail(ERR_SIZE_MISMATCH);
+
+  /* allocate the workspace of row markers and values. */
+  const long m = A->m, n = B->n;
+  long *mark = (long*) malloc((m > 0 ? m : 1) * sizeof(long));
+  double *w = (double*) malloc((m > 0 ? m : 1) * sizeof(double));
+  if (!mark || !w) {
+    free(mark);
+    free(w);
+    fail(ERR_BAD_ALLOC);
+  }
+
+  /* count the elements of the product. */
+  long nnz = 0;
+  for (long i = 0; i < m; i++)
+    mark[i] = -1;
+
+  for (long j = 0; j < n; j++) {
+    for (long pb = B->colptr[j]; pb < B->colptr[j + 1]; pb++) {
+      const long k = B->rowidx[pb];
+      for (long pa = A->colptr[k]; pa < A->colptr[k + 1]; pa++) {
+        const long i = A->rowidx[pa];
+        if (mark[i] != j) {
+          mark[i] = j;
+          nnz++;
+        }
+      }
+    }
+  }
+
+  /* allocate the product. */
+  SparseMatrix C = sparse_matrix_new_with_size(z, m, n, nnz);
+  if (!C) {
+    free(mark);
+    free(w);
+    return NULL;
+  }
+
+  /* compute each column of the product. */
+  long q = 0;
+  for (long i = 0; i < m; i++)
+    mark[i] = -1;
+
+  for (long j = 0; j < n; j++) {
+    const long start = q;
+    C->colptr[j] = q;
+
+    for (long pb = B->colptr[j]; pb < B->colptr[j + 1]; pb++) {
+      const long k = B->rowidx[pb];
+      const double bkj = B->data[pb];
+      for (long pa = A->colptr[k]; pa < A->colptr[k + 1]; pa++) {
+        const long i = A->rowidx[pa];
+        if (mark[i] != j) {
+          mark[i] = j;
+          C->rowidx[q++] = i;
+          w[i] = A->data[pa] * bkj;
+        }
+        else
+          w[i] += A->data[pa] * bkj;
+      }
+    }
+
+    /* sort the rows of the column and gather their nonzero values. */
+    qsort(C->rowidx + start, q - start, sizeof(long), sparse_matrix_compare);
+
+    long p = start;
+    for (long t = start; t < q; t++) {
+      const long i = C->rowidx[t];
+      if (w[i] != 0.0) {
+        C->rowidx[p] = i;
+        C->data[p] = w[i];
+        p++;
+      }
+    }
+
+    q = p;
+  }
+
+  /* free the workspace and store the final number of elements. */
+  free(mark);
+  free(w);
+
+  C->colptr[n] = q;
+  if (!sparse_matrix_trim(C, q)) {
+    object_free(z, C);
+    return NULL;
+  }
+
+  return C;
+}
+
+/* sparse_matrix_disp(): display function for matte sparse matrices.
+ * stored elements are printed with their one-based indices, in order of
+ * column.
+ */
+int sparse_matrix_disp (Zone z, SparseMatrix S) {
+  printf("\n");
+  if (!S->nnz)
+    printf("\n  all zero sparse: %ldx%ld", S->m, S->n);
+
+  for (long j = 0; j < S->n; j++) {
+    for (long p = S->colptr[j]; p < S->colptr[j + 1]; p++)
+      printf("\n  (%ld,%ld)  %lg", S->rowidx[p] + 1, j + 1, S->data[p]);
+  }
+
+  /* print newlines and return success. */
+  printf("\n\n");
+  return 1;
+}
+
+/* sparse_matrix_true(): assert the truth of a sparse matrix, which holds
+ * when the matrix is non-empty and all its elements are nonzero.
+ */
+int sparse_matrix_true (SparseMatrix S) {
+  if (S->m * S->n == 0 || S->nnz != S->m * S->n)
+    return 0;
+
+  for (long p = 0; p < S->nnz; p++) {
+    if (S->data[p] == 0.0) return 0;
+  }
+
+  return 1;
+}
+
+/* sparse_matrix_plus(): addition function for sparse matrices. sums of
+ * sparse matrices are sparse, and all other sums are full.
+ */
+Object sparse_matrix_plus (Zone z, Object a, Object b) {
+  if (IS_SPARSE_MATRIX(a) && IS_SPARSE_MATRIX(b))
+    return (Object) sparse_matrix_merge(z, (SparseMatrix) a,
+                                        (SparseMatrix) b, 1.0);
+
+  return sparse_matrix_dense(z, a, b, object_plus);
+}
+
+/* sparse_matrix_minus(): subtraction function for sparse matrices.
+ */
+Object sparse_matrix_minus (Zone z, Object a, Object b) {
+  if (IS_SPARSE_MATRIX(a) && IS_SPARSE_MATRIX(b))
+    return (Object) sparse_matrix_merge(z, (SparseMatrix) a,
+                                        (SparseMatrix) b, -1.0);
+
+  return sparse_matrix_dense(z, a, b, object_minus);
+}
+
+/* sparse_matrix_uminus(): unary negation function for sparse matrices.
+ */
+SparseMatrix sparse_matrix_uminus (Zone z, SparseMatrix S) {
+  return sparse_matrix_map(z, S, SPARSE_TIMES, -1.0);
+}
+
+/* sparse_matrix_times(): element-wise multiplication function for sparse
+ * matrices. products with sparse matrices, with dense matrices of the
+ * same size and with finite scalars are sparse.
+ */
+Object sparse_matrix_times (Zone z, Object a, Object b) {
+  /* order the operands so that the first is sparse. */
+  if (!IS_SPARSE_MATRIX(a)) {
+    Object t = a;
+    a = b;
+    b = t;
+  }
+
+  SparseMatrix S = (SparseMatrix) a;
+  long m, n;
+  const double *X;
+  double f;
+
+  if (IS_SPARSE_MATRIX(b)) {
+    /* sparse .* sparse => sparse */
+    SparseMatrix B = (SparseMatrix) b;
+    if (S->m != B->m || S->n != B->n)
+      throw(z, ERR_SIZE_MISMATCH_BC(S, B));
+
+    return (Object) sparse_matrix_intersect(z, S, B, NULL);
+  }
+  else if (sparse_matrix_scalar(b, &f) && isfinite(f)) {
+    /* sparse .* scalar => sparse */
+    return (Object) sparse_matrix_map(z, S, SPARSE_TIMES, f);
+  }
+  else if (sparse_matrix_dense_arg(b, &m, &n, &X) &&
+           m == S->m && n == S->n) {
+    /* sparse .* dense => sparse */
+    return (Object) sparse_matrix_intersect(z, S, NULL, X);
+  }
+
+  return sparse_matrix_dense(z, a, b, object_times);
+}
+
+/* sparse_matrix_rdivide(): element-wise right division function for
+ * sparse matrices. quotients by nonzero scalars are sparse.
+ */
+Object sparse_matrix_rdivide (Zone z, Object a, Object b) {
+  double f;
+  if (IS_SPARSE_MATRIX(a) && sparse_matrix_scalar(b, &f) &&
+      f != 0.0 && !isnan(f))
+    return (Object) sparse_matrix_map(z, (SparseMatrix) a,
+                                      SPARSE_RDIVIDE, f);
+
+  return sparse_matrix_dense(z, a, b, object_rdivide);
+}
+
+/* sparse_matrix_ldivide(): element-wise left division function for
+ * sparse matrices.
+ */
+Object sparse_matrix_ldivide (Zone z, Object a, Object b) {
+  double f;
+  if (IS_SPARSE_MATRIX(b) && sparse_matrix_scalar(a, &f) &&
+      f != 0.0 && !isnan(f))
+    return (Object) sparse_matrix_map(z, (SparseMatrix) b,
+                                      SPARSE_RDIVIDE, f);
+
+  return sparse_matrix_dense(z, a, b, object_ldivide);
+}
+
+/* sparse_matrix_power(): element-wise power function for sparse matrices.
+ * powers with positive scalar exponents are sparse.
+ */
+Object sparse_matrix_power (Zone z, Object a, Object b) {
+  double f;
+  if (IS_SPARSE_MATRIX(a) && sparse_matrix_scalar(b, &f) && f > 0.0)
+    return (Object) sparse_matrix_map(z, (SparseMatrix) a, SPARSE_POWER, f);
+
+  return sparse_matrix_dense(z, a, b, object_power);
+}
+
+/* sparse_matrix_mtimes(): matrix multiplication function for sparse
+ * matrices. products of sparse matrices are sparse, and products with
+ * dense vectors and matrices are dense.
+ */
+Object sparse_matrix_mtimes (Zone z, Object a, Object b) {
+  long m, n;
+  const double *X;
+  double *Y;
+  double f;
+
+  if (IS_SPARSE_MATRIX(a) && IS_SPARSE_MATRIX(b)) {
+    /* sparse * sparse => sparse */
+    return (Object) sparse_matrix_product(z, (SparseMatrix) a,
+                                          (SparseMatrix) b);
+  }
+  else if (sparse_matrix_scalar(a, &f) || sparse_matrix_scalar(b, &f)) {
+    /* sparse * scalar => sparse */
+    return sparse_matrix_times(z, a, b);
+  }
+  else if (IS_SPARSE_MATRIX(a) && sparse_matrix_dense_arg(b, &m, &n, &X)) {
+    /* sparse * dense => dense, computed by rows. */
+    SparseMatrix S = (SparseMatrix) a;
+    if (S->n != m)
+      throw(z, ERR_SIZE_MISMATCH);
+
+    Object y = sparse_matrix_dense_alloc(z, S->m, n, &Y);
+    if (!y)
+      return NULL;
+
+    if (!sparse_matrix_spmv(S, n, X, m, Y, S->m)) {
+      object_free(z, y);
+      return NULL;
+    }
+
+    return y;
+  }
+  else if (IS_SPARSE_MATRIX(b) && sparse_matrix_dense_arg(a, &m, &n, &X)) {
+    /* dense * sparse => dense, computed by columns. */
+    SparseMatrix S = (SparseMatrix) b;
+    if (S->m != n)
+      throw(z, ERR_SIZE_MISMATCH);
+
+    Object y = sparse_matrix_dense_alloc(z, m, S->n, &Y);
+    if (!y)
+      return NULL;
+
+    SparseLoop L;
+    L.ptr = S->colptr;
+    L.idx = S->rowidx;
+    L.val = S->data;
+    L.X = X;
+    L.Y = Y;
+    L.k = m;
+    L.ldx = m;
+    L.ldy = m;
+
+    const long work = (S->nnz / (S->n > 0 ? S->n : 1) + 1) * m;
+    threads_run(S->n, work, sparse_matrix_spmv_cols, &L);
+    return y;
+  }
+
+  return sparse_matrix_dense(z, a, b, object_mtimes);
+}
+
+/* sparse_matrix_mldivide(): matrix left division function for sparse
+ * matrices. sparse systems are solved iteratively, see sparse_solve().
+ */
+Object sparse_matrix_mldivide (Zone z, Object a, Object b) {
+  double f;
+  if (sparse_matrix_scalar(a, &f))
+    return sparse_matrix_ldivide(z, a, b);
+
+  if (!IS_SPARSE_MATRIX(a))
+    return sparse_matrix_dense(z, a, b, object_mldivide);
+
+  /* solve against the full matrix of sparse right-hand sides. */
+  if (IS_SPARSE_MATRIX(b)) {
+    Matrix B = sparse_matrix_to_matrix(z, (SparseMatrix) b);
+    if (!B)
+      return NULL;
+
+    Object x = sparse_matrix_mldivide(z, a, (Object) B);
+    object_free(z, B);
+    return x;
+  }
+
+  /* check that the system is square and that its sizes conform. */
+  SparseMatrix A = (SparseMatrix) a;
+  long m, n;
+  const double *B;
+  if (!sparse_matrix_dense_arg(b, &m, &n, &B))
+    throw(z, ERR_OBJ_BINARY, "mldivide",
+          MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+
+  if (A->m != A->n)
+    throw(z, ERR_SIZE_NONSQUARE(A));
+
+  if (A->m != m)
+    throw(z, ERR_SIZE_MISMATCH);
+
+  /* solve for each column of the right-hand side. */
+  double *X;
+  Object x = sparse_matrix_dense_alloc(z, m, n, &X);
+  if (!x)
+    return NULL;
+
+  if (!sparse_solve(A, n, B, m, X, m)) {
+    object_free(z, x);
+    return exceptions_get(z);
+  }
+
+  return x;
+}
+
+/* sparse_matrix_transpose(): transposition function for sparse matrices.
+ * the transpose shares the row and column formats of its operand, with
+ * their roles exchanged.
+ */
+SparseMatrix sparse_matrix_transpose (Zone z, SparseMatrix S) {
+  if (!sparse_matrix_rows(S))
+    return NULL;
+
+  SparseMatrix T = sparse_matrix_new(z, NULL);
+  if (!T)
+    return NULL;
+
+  T->m = S->n;
+  T->n = S->m;
+  T->nnz = S->nnz;
+  T->colptr = (long*) buffer_share(S->rowptr);
+  T->rowidx = (long*) buffer_share(S->colidx);
+  T->data = (double*) buffer_share(S->rdata);
+  T->rowptr = (long*) buffer_share(S->colptr);
+  T->colidx = (long*) buffer_share(S->rowidx);
+  T->rdata = (double*) buffer_share(S->data);
+
+  return T;
+}
+
+/* sparse_matrix_not(): logical negation function for sparse matrices.
+ */
+Object sparse_matrix_not (Zone z, SparseMatrix S) {
+  Matrix A = sparse_matrix_to_matrix(z, S);
+  if (!A)
+    return NULL;
+
+  Object L = object_not(z, (Object) A);
+  object_free(z, A);
+  return L;
+}
+
+/* SPARSE_DENSE_OP(): macro to define an operation of sparse matrices
+ * that is computed on their full matrices.
+ */
+#define SPARSE_DENSE_OP(name) \
+Object sparse_matrix_ ## name (Zone z, Object a, Object b) { \
+  return sparse_matrix_dense(z, a, b, object_ ## name); \
+}
+
+/* sparse_matrix_*(): comparison and logical operations of sparse
+ * matrices, which produce full logical arrays.
+ */
+SPARSE_DENSE_OP(lt)
+SPARSE_DENSE_OP(gt)
+SPARSE_DENSE_OP(le)
+SPARSE_DENSE_OP(ge)
+SPARSE_DENSE_OP(ne)
+SPARSE_DENSE_OP(eq)
+SPARSE_DENSE_OP(and)
+SPARSE_DENSE_OP(or)
+
+/* SparseMatrix_type: object type structure for matte sparse matrices.
+ */
+struct _ObjectType SparseMatrix_type = {
+  "SparseMatrix",                                /* name       */
+  sizeof(struct _SparseMatrix),                  /* size       */
+  9,                                             /* precedence */
+
+  (obj_constructor) sparse_matrix_new,           /* fn_new    */
+  (obj_constructor) sparse_matrix_copy,          /* fn_copy   */
+  (obj_destructor)  sparse_matrix_delete,        /* fn_delete */
+  (obj_display)     sparse_matrix_disp,          /* fn_disp   */
+  (obj_assert)      sparse_matrix_true,          /* fn_true   */
+
+  (obj_binary)   sparse_matrix_plus,             /* fn_plus       */
+  (obj_binary)   sparse_matrix_minus,            /* fn_minus      */
+  (obj_unary)    sparse_matrix_uminus,           /* fn_uminus     */
+  (obj_binary)   sparse_matrix_times,            /* fn_times      */
+  (obj_binary)   sparse_matrix_mtimes,           /* fn_mtimes     */
+  (obj_binary)   sparse_matrix_rdivide,          /* fn_rdivide    */
+  (obj_binary)   sparse_matrix_ldivide,          /* fn_ldivide    */
+  NULL,                                          /* fn_mrdivide   */
+  (obj_binary)   sparse_matrix_mldivide,         /* fn_mldivide   */
+  (obj_binary)   sparse_matrix_power,            /* fn_power      */
+  NULL,                                          /* fn_mpower     */
+  (obj_binary)   sparse_matrix_lt,               /* fn_lt         */
+  (obj_binary)   sparse_matrix_gt,               /* fn_gt         */
+  (obj_binary)   sparse_matrix_le,               /* fn_le         */
+  (obj_binary)   sparse_matrix_ge,               /* fn_ge         */
+  (obj_binary)   sparse_matrix_ne,               /* fn_ne         */
+  (obj_binary)   sparse_matrix_eq,               /* fn_eq         */
+  (obj_binary)   sparse_matrix_and,              /* fn_and        */
+  (obj_binary)   sparse_matrix_or,               /* fn_or         */
+  NULL,                                          /* fn_mand       */
+  NULL,                                          /* fn_mor        */
+  (obj_unary)    sparse_matrix_not,              /* fn_not        */
+  NULL,                                          /* fn_colon      */
+  (obj_unary)    sparse_matrix_transpose,        /* fn_ctranspose */
+  (obj_unary)    sparse_matrix_transpose,        /* fn_transpose  */
+  NULL,                                          /* fn_horzcat    */
+  NULL,                                          /* fn_vertcat    */
+  NULL,                                          /* fn_subsref    */
+  NULL,                                          /* fn_subsasgn   */
+  NULL,                                          /* fn_subsindex  */
+
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
+};
+
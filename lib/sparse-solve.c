@@ -0,0 +1,264 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the sparse solver and exception headers. */
+#include <matte/sparse-solve.h>
+#include <matte/except.h>
+
+/* include the required standard c library header. */
+#include <math.h>
+
+/* sparse_solve_dot(): compute the inner product of two vectors.
+ */
+static double sparse_solve_dot (long n, const double *x, const double *y) {
+  double d = 0.0;
+  for (long i = 0; i < n; i++)
+    d += x[i] * y[i];
+
+  return d;
+}
+
+/* sparse_solve_cg(): solve a symmetric positive definite sparse linear
+ * system by the jacobi-preconditioned conjugate gradient method.
+ *
+ * arguments:
+ *  @A: sparse system matrix.
+ *  @dinv: inverted diagonal elements of @A.
+ *  @b: right-hand side vector.
+ *  @x: solution vector, on return.
+ *  @w: workspace of four vectors.
+ *  @maxit: iteration limit.
+ *  @res: relative residual norm, on return.
+ *
+ * returns:
+ *  integer indicating convergence (1), breakdown on a system that is not
+ *  positive definite (-1), or exhaustion of the iteration limit (0).
+ */
+static int sparse_solve_cg (SparseMatrix A, const double *dinv,
+                            const double *b, double *x, double *w,
+                            long maxit, double *res) {
+  /* locate the residual, preconditioned residual, search direction and
+   * matrix-direction product vectors in the workspace.
+   */
+  const long n = A->n;
+  double *r = w, *s = w + n, *p = w + 2 * n, *q = w + 3 * n;
+
+  /* start from the zero vector. */
+  const double bnrm = sqrt(sparse_solve_dot(n, b, b));
+  for (long i = 0; i < n; i++) {
+    x[i] = 0.0;
+    r[i] = b[i];
+    s[i] = p[i] = dinv[i] * r[i];
+  }
+
+  double rs = sparse_solve_dot(n, r, s);
+  *res = 1.0;
+
+  for (long it = 0; it < maxit; it++) {
+    /* compute the step along the search direction. */
+    if (!sparse_matrix_spmv(A, 1, p, n, q, n))
+      return 0;
+
+    const double pq = sparse_solve_dot(n, p, q);
+    if (!(pq > 0.0))
+      return -1;
+
+    const double alpha = rs / pq;
+    for (long i = 0; i < n; i++) {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+    }
+
+    /* check for convergence. */
+    *res = sqrt(sparse_solve_dot(n, r, r)) / bnrm;
+    if (*res <= SPARSE_SOLVE_TOL)
+      return 1;
+
+    /* update the search direction. */
+    for (long i = 0; i < n; i++)
+      s[i] = dinv[i] * r[i];
+
+    const double rsnew = sparse_solve_dot(n, r, s);
+    const double beta = rsnew / rs;
+    for (long i = 0; i < n; i++)
+      p[i] = s[i] + beta * p[i];
+
+    rs = rsnew;
+  }
+
+  return 0;
+}
+
+/* sparse_solve_bicgstab(): solve a general sparse linear system by the
+ * jacobi-preconditioned biconjugate gradient stabilized method.
+ *
+ * arguments:
+ *  @A: sparse system matrix.
+ *  @dinv: inverted diagonal elements of @A.
+ *  @b: right-hand side vector.
+ *  @x: solution vector, on return.
+ *  @w: workspace of seven vectors.
+ *  @maxit: iteration limit.
+ *  @res: relative residual norm, on return.
+ *
+ * returns:
+ *  integer indicating convergence (1) or failure (0).
+ */
+static int sparse_solve_bicgstab (SparseMatrix A, const double *dinv,
+                                  const double *b, double *x, double *w,
+                                  long maxit, double *res) {
+  /* locate the residual, shadow residual, search direction and
+   * intermediate vectors in the workspace.
+   */
+  const long n = A->n;
+  double *r = w, *rh = w + n, *p = w + 2 * n, *v = w + 3 * n;
+  double *ph = w + 4 * n, *sh = w + 5 * n, *t = w + 6 * n;
+
+  /* start from the zero vector. */
+  const double bnrm = sqrt(sparse_solve_dot(n, b, b));
+  for (long i = 0; i < n; i++) {
+    x[i] = 0.0;
+    r[i] = rh[i] = b[i];
+    p[i] = v[i] = 0.0;
+  }
+
+  double rho = 1.0, alpha = 1.0, omega = 1.0;
+  *res = 1.0;
+
+  for (long it = 0; it < maxit; it++) {
+    /* update the search direction. */
+    const double rhonew = sparse_solve_dot(n, rh, r);
+    if (rhonew == 0.0 || omega == 0.0)
+      return 0;
+
+    const double beta = (rhonew / rho) * (alpha / omega);
+    for (long i = 0; i < n; i++) {
+      p[i] = r[i] + beta * (p[i] - omega * v[i]);
+      ph[i] = dinv[i] * p[i];
+    }
+
+    /* compute the step along the search direction. */
+    if (!sparse_matrix_spmv(A, 1, ph, n, v, n))
+      return 0;
+
+    const double rhv = sparse_solve_dot(n, rh, v);
+    if (rhv == 0.0)
+      return 0;
+
+    alpha = rhonew / rhv;
+    for (long i = 0; i < n; i++) {
+      x[i] += alpha * ph[i];
+      r[i] -= alpha * v[i];
+    }
+
+    *res = sqrt(sparse_solve_dot(n, r, r)) / bnrm;
+    if (*res <= SPARSE_SOLVE_TOL)
+      return 1;
+
+    /* compute the stabilizing step. */
+    for (long i = 0; i < n; i++)
+      sh[i] = dinv[i] * r[i];
+
+    if (!sparse_matrix_spmv(A, 1, sh, n, t, n))
+      return 0;
+
+    const double tt = sparse_solve_dot(n, t, t);
+    omega = (tt > 0.0 ? sparse_solve_dot(n, t, r) / tt : 0.0);
+    for (long i = 0; i < n; i++) {
+      x[i] += omega * sh[i];
+      r[i] -= omega * t[i];
+    }
+
+    *res = sqrt(sparse_solve_dot(n, r, r)) / bnrm;
+    if (*res <= SPARSE_SOLVE_TOL)
+      return 1;
+
+    rho = rhonew;
+  }
+
+  return 0;
+}
+
+/* sparse_solve(): solve a square sparse linear system for one or more
+ * right-hand sides. symmetric systems are first solved by the conjugate
+ * gradient method, and all other systems (or symmetric systems that are
+ * not positive definite) are solved by the biconjugate gradient
+ * stabilized method.
+ *
+ * arguments:
+ *  @A: sparse system matrix, with @n rows and columns.
+ *  @k: number of right-hand sides.
+ *  @B: elements of the right-hand sides, with @n rows.
+ *  @ldb: leading dimension of the right-hand sides.
+ *  @X: elements of the solutions, with @n rows, on return.
+ *  @ldx: leading dimension of the solutions.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int sparse_solve (SparseMatrix A, long k, const double *B, long ldb,
+                  double *X, long ldx) {
+  /* check that the system is square. */
+  const long n = A->n;
+  if (A->m != n)
+    fail(ERR_SIZE_NONSQUARE(A));
+
+  /* determine the iteration limit. */
+  const long maxit = (2 * n > SPARSE_SOLVE_MIN_ITER ?
+                      2 * n : SPARSE_SOLVE_MIN_ITER);
+
+  /* allocate the preconditioner and the solver workspace. */
+  double *dinv = (double*) malloc((n > 0 ? 8 * n : 1) * sizeof(double));
+  if (!dinv)
+    fail(ERR_BAD_ALLOC);
+
+  double *w = dinv + n;
+
+  /* invert the diagonal elements, which must be positive for the
+   * system to be considered for the conjugate gradient method.
+   */
+  int spd = sparse_matrix_is_symmetric(A);
+  for (long j = 0; j < n; j++) {
+    const double ajj = sparse_matrix_get(A, j, j);
+    dinv[j] = (ajj != 0.0 ? 1.0 / ajj : 1.0);
+    spd = spd && (ajj > 0.0);
+  }
+
+  /* solve for each right-hand side. */
+  for (long c = 0; c < k; c++) {
+    const double *b = B + c * ldb;
+    double *x = X + c * ldx;
+
+    /* zero right-hand sides have zero solutions. */
+    long nz = 0;
+    for (long i = 0; i < n; i++)
+      nz += (b[i] != 0.0);
+
+    if (!nz) {
+      for (long i = 0; i < n; i++)
+        x[i] = 0.0;
+
+      continue;
+    }
+
+    double res = 1.0;
+    int status = 0;
+    if (spd)
+      status = sparse_solve_cg(A, dinv, b, x, w, maxit, &res);
+
+    if (status != 1)
+      status = sparse_solve_bicgstab(A, dinv, b, x, w, maxit, &res);
+
+    if (status != 1) {
+      free(dinv);
+      fail(ERR_SOLVE_CONVERGENCE(res));
+    }
+  }
+
+  /* free the workspace and return success. */
+  free(dinv);
+  return 1;
+}
+
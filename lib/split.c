@@ -0,0 +1,204 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the split and threads headers. */
+#include <matte/split.h>
+#include <matte/threads.h>
+
+/* SplitLoop: a struct _SplitLoop. */
+typedef struct _SplitLoop SplitLoop;
+
+/* _SplitLoop: structure for holding the state of a layout conversion
+ * that is split across the thread pool.
+ */
+struct _SplitLoop {
+  /* @x: interleaved elements.
+   * @re, @im: real and imaginary parts of the split elements.
+   */
+  complex double *x;
+  double *re, *im;
+};
+
+/* split_get(): get an element of a complex array in split storage.
+ *
+ * arguments:
+ *  @data: split elements of the array.
+ *  @len: number of array elements.
+ *  @i: element index to get.
+ *
+ * returns:
+ *  requested array element.
+ */
+complex double split_get (const complex double *data, long len, long i) {
+  /* assemble the element from its parts, which avoids the arithmetic
+   * of (re + I * im) on infinite imaginary parts.
+   */
+  complex double x;
+  double *px = (double*) &x;
+  px[0] = SPLIT_RE(data)[i];
+  px[1] = SPLIT_IM(data, len)[i];
+  return x;
+}
+
+/* split_set(): set an element of a complex array in split storage.
+ *
+ * arguments:
+ *  @data: split elements of the array.
+ *  @len: number of array elements.
+ *  @i: element index to set.
+ *  @x: element value.
+ */
+void split_set (complex double *data, long len, long i, complex double x) {
+  SPLIT_RE(data)[i] = creal(x);
+  SPLIT_IM(data, len)[i] = cimag(x);
+}
+
+/* split_deinterleave_range(): convert a range of interleaved elements
+ * into split storage, as one chunk of a parallel loop.
+ */
+static void split_deinterleave_range (void *arg, int id,
+                                      long start, long end) {
+  const SplitLoop *L = (const SplitLoop*) arg;
+  const double *x = (const double*) L->x;
+
+  for (long i = start; i < end; i++) {
+    L->re[i] = x[2 * i];
+    L->im[i] = x[2 * i + 1];
+  }
+}
+
+/* split_interleave_range(): convert a range of split elements into
+ * interleaved storage, as one chunk of a parallel loop.
+ */
+static void split_interleave_range (void *arg, int id,
+                                    long start, long end) {
+  const SplitLoop *L = (const SplitLoop*) arg;
+  double *x = (double*) L->x;
+
+  for (long i = start; i < end; i++) {
+    x[2 * i] = L->re[i];
+    x[2 * i + 1] = L->im[i];
+  }
+}
+
+/* split_deinterleave(): convert an array of complex elements from
+ * interleaved storage into split storage.
+ *
+ * arguments:
+ *  @n: number of elements to convert.
+ *  @x: interleaved source elements.
+ *  @re: output real parts of the elements.
+ *  @im: output imaginary parts of the elements.
+ */
+void split_deinterleave (long n, const complex double *x,
+                         double *re, double *im) {
+  SplitLoop L = { (complex double*) x, re, im };
+  threads_run(n, 2, split_deinterleave_range, &L);
+}
+
+/* split_interleave(): convert an array of complex elements from split
+ * storage into interleaved storage.
+ *
+ * arguments:
+ *  @n: number of elements to convert.
+ *  @re: real parts of the source elements.
+ *  @im: imaginary parts of the source elements.
+ *  @x: output interleaved elements.
+ */
+void split_interleave (long n, const double *re, const double *im,
+                       complex double *x) {
+  SplitLoop L = { x, (double*) re, (double*) im };
+  threads_run(n, 2, split_interleave_range, &L);
+}
+
+/* split_shift(): add a complex constant to an array of split elements.
+ *
+ * arguments:
+ *  @n: number of elements to modify.
+ *  @f: constant to add to each element.
+ *  @re, @im: real and imaginary parts of the elements.
+ */
+void split_shift (long n, complex double f, double *re, double *im) {
+  const double fr = creal(f);
+  const double fi = cimag(f);
+
+  for (long i = 0; i < n; i++)
+    re[i] += fr;
+
+  for (long i = 0; i < n; i++)
+    im[i] += fi;
+}
+
+/* split_scal(): multiply an array of split elements by a complex
+ * constant.
+ *
+ * arguments:
+ *  @n: number of elements to modify.
+ *  @f: constant to multiply each element by.
+ *  @re, @im: real and imaginary parts of the elements.
+ */
+void split_scal (long n, complex double f, double *re, double *im) {
+  const double fr = creal(f);
+  const double fi = cimag(f);
+
+  for (long i = 0; i < n; i++) {
+    const double xr = re[i];
+    const double xi = im[i];
+    re[i] = fr * xr - fi * xi;
+    im[i] = fr * xi + fi * xr;
+  }
+}
+
+/* split_axpy(): add a scaled array to an array of split elements, as in
+ * (y += alpha * x).
+ *
+ * arguments:
+ *  @n: number of elements to modify.
+ *  @alpha: real scale factor of @x.
+ *  @xr, @xi: real and imaginary parts of @x, where @xi is null if the
+ *            elements of @x are real.
+ *  @yr, @yi: real and imaginary parts of @y.
+ */
+void split_axpy (long n, double alpha, const double *xr, const double *xi,
+                 double *yr, double *yi) {
+  for (long i = 0; i < n; i++)
+    yr[i] += alpha * xr[i];
+
+  if (xi) {
+    for (long i = 0; i < n; i++)
+      yi[i] += alpha * xi[i];
+  }
+}
+
+/* split_mul(): multiply an array of split elements by another array,
+ * element-wise, as in (y .*= x).
+ *
+ * arguments:
+ *  @n: number of elements to modify.
+ *  @xr, @xi: real and imaginary parts of @x, where @xi is null if the
+ *            elements of @x are real.
+ *  @yr, @yi: real and imaginary parts of @y.
+ */
+void split_mul (long n, const double *xr, const double *xi,
+                double *yr, double *yi) {
+  if (!xi) {
+    /* scale each element by a real factor. */
+    for (long i = 0; i < n; i++) {
+      yr[i] *= xr[i];
+      yi[i] *= xr[i];
+    }
+
+    return;
+  }
+
+  /* multiply each element by a complex factor. */
+  for (long i = 0; i < n; i++) {
+    const double ar = xr[i], ai = xi[i];
+    const double br = yr[i], bi = yi[i];
+    yr[i] = ar * br - ai * bi;
+    yi[i] = ar * bi + ai * br;
+  }
+}
+
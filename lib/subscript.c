@@ -0,0 +1,482 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the subscript, exception and object list headers. */
+#include <matte/subscript.h>
+#include <matte/except.h>
+#include <matte/object-list.h>
+
+/* include headers for all numeric types. */
+#include <matte/int.h>
+#include <matte/range.h>
+#include <matte/float.h>
+#include <matte/complex.h>
+#include <matte/vector.h>
+#include <matte/matrix.h>
+#include <matte/complex-vector.h>
+#include <matte/complex-matrix.h>
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+#include <matte/logical.h>
+#include <matte/int32-array.h>
+#include <matte/int64-array.h>
+
+/* SubscriptKind: enumeration of the element types of subscripted
+ * arrays.
+ */
+typedef enum {
+  SUBSCRIPT_DOUBLE = 0,
+  SUBSCRIPT_COMPLEX,
+  SUBSCRIPT_SINGLE,
+  SUBSCRIPT_LOGICAL,
+  SUBSCRIPT_INT32,
+  SUBSCRIPT_INT64
+}
+SubscriptKind;
+
+/* SubscriptArray: a struct _SubscriptArray. */
+typedef struct _SubscriptArray SubscriptArray;
+
+/* _SubscriptArray: structure for holding the elements and shape of a
+ * subscripted array.
+ */
+struct _SubscriptArray {
+  /* @src: array elements, in column-major order.
+   * @sz: size of each array element.
+   * @len: number of array elements.
+   * @kind: element type of the array.
+   */
+  const char *src;
+  size_t sz;
+  long len;
+  SubscriptKind kind;
+
+  /* @vec: whether the array has the shape of a vector.
+   * @row: whether the array is a row vector.
+   */
+  int vec, row;
+};
+
+/* subscript_array(): describe the elements and shape of a subscripted
+ * array.
+ *
+ * arguments:
+ *  @a: array to describe.
+ *  @x: array structure to fill.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int subscript_array (Object a, SubscriptArray *x) {
+  x->vec = 1;
+  x->row = 0;
+
+  if (IS_VECTOR(a)) {
+    Vector v = (Vector) a;
+    x->src = (const char*) v->data;
+    x->sz = sizeof(double);
+    x->len = v->n;
+    x->kind = SUBSCRIPT_DOUBLE;
+    x->row = (v->tr != CblasNoTrans);
+  }
+  else if (IS_MATRIX(a)) {
+    Matrix A = (Matrix) a;
+    if (!matrix_untranspose(A))
+      return 0;
+
+    x->src = (const char*) A->data;
+    x->sz = sizeof(double);
+    x->len = A->m * A->n;
+    x->kind = SUBSCRIPT_DOUBLE;
+    x->vec = 0;
+  }
+  else if (IS_COMPLEX_VECTOR(a)) {
+    ComplexVector v = (ComplexVector) a;
+    if (!complex_vector_interleave(v))
+      return 0;
+
+    x->src = (const char*) v->data;
+    x->sz = sizeof(complex double);
+    x->len = v->n;
+    x->kind = SUBSCRIPT_COMPLEX;
+    x->row = (v->tr != CblasNoTrans);
+  }
+  else if (IS_COMPLEX_MATRIX(a)) {
+    ComplexMatrix A = (ComplexMatrix) a;
+    if (!complex_matrix_untranspose(A) || !complex_matrix_interleave(A))
+      return 0;
+
+    x->src = (const char*) A->data;
+    x->sz = sizeof(complex double);
+    x->len = A->m * A->n;
+    x->kind = SUBSCRIPT_COMPLEX;
+    x->vec = 0;
+  }
+  else if (IS_SINGLE_VECTOR(a)) {
+    SingleVector v = (SingleVector) a;
+    x->src = (const char*) v->data;
+    x->sz = sizeof(float);
+    x->len = v->n;
+    x->kind = SUBSCRIPT_SINGLE;
+    x->row = (v->tr != CblasNoTrans);
+  }
+  else if (IS_SINGLE_MATRIX(a)) {
+    SingleMatrix A = (SingleMatrix) a;
+    if (!single_matrix_untranspose(A))
+      return 0;
+
+    x->src = (const char*) A->data;
+    x->sz = sizeof(float);
+    x->len = A->m * A->n;
+    x->kind = SUBSCRIPT_SINGLE;
+    x->vec = 0;
+  }
+  else if (IS_LOGICAL(a)) {
+    Logical L = (Logical) a;
+    x->src = (const char*) L->data;
+    x->sz = sizeof(unsigned char);
+    x->len = L->m * L->n;
+    x->kind = SUBSCRIPT_LOGICAL;
+    x->vec = !L->mat;
+    x->row = (!L->mat && L->m == 1);
+  }
+  else if (IS_INT32_ARRAY(a)) {
+    Int32Array A = (Int32Array) a;
+    x->src = (const char*) A->data;
+    x->sz = sizeof(int32_t);
+    x->len = A->m * A->n;
+    x->kind = SUBSCRIPT_INT32;
+    x->vec = !A->mat;
+    x->row = (!A->mat && A->m == 1);
+  }
+  else if (IS_INT64_ARRAY(a)) {
+    Int64Array A = (Int64Array) a;
+    x->src = (const char*) A->data;
+    x->sz = sizeof(int64_t);
+    x->len = A->m * A->n;
+    x->kind = SUBSCRIPT_INT64;
+    x->vec = !A->mat;
+    x->row = (!A->mat && A->m == 1);
+  }
+  else
+    fail(ERR_OBJ_UNARY, "subsref", MATTE_TYPE(a)->name);
+
+  return 1;
+}
+
+/* subscript_alloc(): allocate a vector that holds elements gathered from
+ * a subscripted array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @kind: element type of the vector.
+ *  @n: number of vector elements.
+ *  @row: whether the vector is a row vector.
+ *  @dst: pointer to the vector elements, on return.
+ *
+ * returns:
+ *  newly allocated vector of the same element type as the array.
+ */
+static Object subscript_alloc (Zone z, SubscriptKind kind, long n, int row,
+                               char **dst) {
+  const MatteTranspose tr = (row ? CblasTrans : CblasNoTrans);
+  const long m = (row ? 1 : n);
+  const long k = (row ? n : 1);
+
+  if (kind == SUBSCRIPT_DOUBLE) {
+    Vector x = vector_new_with_length(z, n);
+    if (!x)
+      return NULL;
+
+    x->tr = tr;
+    *dst = (char*) x->data;
+    return (Object) x;
+  }
+  else if (kind == SUBSCRIPT_COMPLEX) {
+    ComplexVector x = complex_vector_new_with_length(z, n);
+    if (!x)
+      return NULL;
+
+    x->tr = tr;
+    *dst = (char*) x->data;
+    return (Object) x;
+  }
+  else if (kind == SUBSCRIPT_SINGLE) {
+    SingleVector x = single_vector_new_with_length(z, n);
+    if (!x)
+      return NULL;
+
+    x->tr = tr;
+    *dst = (char*) x->data;
+    return (Object) x;
+  }
+  else if (kind == SUBSCRIPT_INT32) {
+    Int32Array x = int32_array_new_with_size(z, m, k);
+    if (!x)
+      return NULL;
+
+    x->mat = 0;
+    *dst = (char*) x->data;
+    return (Object) x;
+  }
+  else if (kind == SUBSCRIPT_INT64) {
+    Int64Array x = int64_array_new_with_size(z, m, k);
+    if (!x)
+      return NULL;
+
+    x->mat = 0;
+    *dst = (char*) x->data;
+    return (Object) x;
+  }
+
+  Logical x = logical_new_with_size(z, m, k);
+  if (!x)
+    return NULL;
+
+  x->mat = 0;
+  *dst = (char*) x->data;
+  return (Object) x;
+}
+
+/* subscript_scalar(): allocate a scalar that holds a single element of
+ * a subscripted array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @x: array to access.
+ *  @i: zero-based linear index of the element.
+ *
+ * returns:
+ *  newly allocated float, complex or integer scalar.
+ */
+static Object subscript_scalar (Zone z, const SubscriptArray *x, long i) {
+  const void *p = x->src + i * x->sz;
+  switch (x->kind) {
+    case SUBSCRIPT_DOUBLE:
+      return (Object) float_new_with_value(z, *(const double*) p);
+
+    case SUBSCRIPT_COMPLEX:
+      return (Object) complex_new_with_value(z, *(const complex double*) p);
+
+    case SUBSCRIPT_SINGLE:
+      return (Object) float_new_with_value(z, *(const float*) p);
+
+    case SUBSCRIPT_LOGICAL:
+      return (Object) int_new_with_value(z, *(const unsigned char*) p);
+
+    case SUBSCRIPT_INT32:
+      return (Object) int_new_with_value(z, *(const int32_t*) p);
+
+    case SUBSCRIPT_INT64:
+      return (Object) int_new_with_value(z, (long) *(const int64_t*) p);
+  }
+
+  return NULL;
+}
+
+/* subscript_mask(): gather the elements of an array that are selected
+ * by a logical mask, skipping words of false elements.
+ *
+ * arguments:
+ *  @x: array to access.
+ *  @mask: logical mask of the same length as the array.
+ *  @dst: destination of the gathered elements.
+ */
+static void subscript_mask (const SubscriptArray *x,
+                            const unsigned char *mask, char *dst) {
+  const size_t sz = x->sz;
+  const long len = x->len;
+  long i = 0, k = 0;
+
+  for (; i + 8 <= len; i += 8) {
+    uint64_t w;
+    memcpy(&w, mask + i, sizeof(uint64_t));
+    if (!w)
+      continue;
+
+    for (long j = i; j < i + 8; j++) {
+      if (mask[j])
+        memcpy(dst + (k++) * sz, x->src + j * sz, sz);
+    }
+  }
+
+  for (; i < len; i++) {
+    if (mask[i])
+      memcpy(dst + (k++) * sz, x->src + i * sz, sz);
+  }
+}
+
+/* subscript_check(): check that an index lies within the bounds of a
+ * subscripted array.
+ *
+ * arguments:
+ *  @i: one-based linear index to check.
+ *  @len: number of array elements.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the index is valid.
+ */
+static inline int subscript_check (long i, long len) {
+  if (i < 1)
+    fail(ERR_INDEX_INVALID);
+
+  if (i > len)
+    fail(ERR_INDEX_BOUNDS(i, len));
+
+  return 1;
+}
+
+/* SUBSCRIPT_GATHER(): macro to gather the elements of an array at the
+ * one-based linear indices held by an integer array. the indices are
+ * read in their native width, and checked before any element is copied.
+ */
+#define SUBSCRIPT_GATHER(x, idx, n, dst) \
+  for (long k = 0; k < n; k++) { \
+    if (!subscript_check((long) idx[k], (x)->len)) \
+      return 0; \
+  } \
+  for (long k = 0; k < n; k++) \
+    memcpy(dst + k * (x)->sz, (x)->src + (idx[k] - 1) * (x)->sz, (x)->sz);
+
+/* subscript_gather(): gather the elements of an array at the indices
+ * held by a 32-bit or 64-bit integer array.
+ *
+ * arguments:
+ *  @x: array to access.
+ *  @s: integer array of one-based linear indices.
+ *  @dst: destination of the gathered elements.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+static int subscript_gather (const SubscriptArray *x, Object s, char *dst) {
+  if (IS_INT32_ARRAY(s)) {
+    const Int32Array S = (Int32Array) s;
+    const int32_t *idx = S->data;
+    const long n = S->m * S->n;
+    SUBSCRIPT_GATHER(x, idx, n, dst);
+  }
+  else {
+    const Int64Array S = (Int64Array) s;
+    const int64_t *idx = S->data;
+    const long n = S->m * S->n;
+    SUBSCRIPT_GATHER(x, idx, n, dst);
+  }
+
+  return 1;
+}
+
+/* subscript_integral(): check that the elements of a real index array
+ * are whole numbers.
+ *
+ * arguments:
+ *  @x: pointer to the index elements.
+ *  @n: number of index elements.
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the indices are integral.
+ */
+static int subscript_integral (const double *x, long n) {
+  for (long i = 0; i < n; i++) {
+    if (x[i] != floor(x[i]))
+      fail(ERR_INDEX_INVALID);
+  }
+
+  return 1;
+}
+
+/* subscript_ref(): subscripted reference function for arrays. arrays are
+ * indexed by a logical mask of the same length, by an integer or whole
+ * real scalar, or by an integer range or array, or whole real vector,
+ * of one-based linear indices.
+ *
+ * masked elements are gathered in column-major order into a vector that
+ * is a row vector if the array is a row vector, and a column vector
+ * otherwise. indexed elements are gathered into a vector of the same
+ * orientation as a vector-shaped array, or as the indices otherwise.
+ */
+Object subscript_ref (Zone z, Object a, Object s) {
+  /* accept the subscript directly, or as the only subscript of a list. */
+  if (IS_OBJECT_LIST(s) && object_list_get_length((ObjectList) s) == 1)
+    s = object_list_get((ObjectList) s, 0);
+
+  /* describe the elements and shape of the array. */
+  SubscriptArray x;
+  if (!subscript_array(a, &x))
+    return exceptions_get(z);
+
+  if (IS_INT(s) || IS_FLOAT(s)) {
+    /* index a single element. */
+    const double v = (IS_FLOAT(s) ? float_get_value((Float) s) : 0.0);
+    if (IS_FLOAT(s) && !subscript_integral(&v, 1))
+      return exceptions_get(z);
+
+    const long i = (IS_INT(s) ? int_get_value((Int) s) : (long) v);
+    if (!subscript_check(i, x.len))
+      return exceptions_get(z);
+
+    return subscript_scalar(z, &x, i - 1);
+  }
+  else if (IS_RANGE(s) || IS_VECTOR(s)) {
+    /* convert ranges and whole real vectors into integer indices. */
+    if (IS_VECTOR(s) &&
+        !subscript_integral(((Vector) s)->data, ((Vector) s)->n))
+      return exceptions_get(z);
+
+    Int64Array S = int64_array_new_from_object(z, s);
+    if (!S)
+      return NULL;
+
+    Object y = subscript_ref(z, a, (Object) S);
+    object_free(z, (Object) S);
+    return y;
+  }
+  else if (IS_LOGICAL(s)) {
+    /* check that the mask and the array have the same length. */
+    Logical L = (Logical) s;
+    if (logical_get_length(L) != x.len)
+      throw(z, ERR_SIZE_MISMATCH);
+
+    /* gather the masked elements. */
+    char *dst;
+    Object y = subscript_alloc(z, x.kind, logical_nnz(L), x.row, &dst);
+    if (y)
+      subscript_mask(&x, L->data, dst);
+
+    return y;
+  }
+  else if (IS_INT32_ARRAY(s) || IS_INT64_ARRAY(s)) {
+    /* determine the length and orientation of the result. */
+    long n;
+    int row;
+    if (IS_INT32_ARRAY(s)) {
+      Int32Array S = (Int32Array) s;
+      n = S->m * S->n;
+      row = (!S->mat && S->m == 1);
+    }
+    else {
+      Int64Array S = (Int64Array) s;
+      n = S->m * S->n;
+      row = (!S->mat && S->m == 1);
+    }
+
+    /* gather the indexed elements. */
+    char *dst;
+    Object y = subscript_alloc(z, x.kind, n, x.vec ? x.row : row, &dst);
+    if (!y)
+      return NULL;
+
+    if (!subscript_gather(&x, s, dst)) {
+      object_free(z, y);
+      return exceptions_get(z);
+    }
+
+    return y;
+  }
+
+  throw(z, ERR_OBJ_BINARY, "subsref",
+        MATTE_TYPE(a)->name, MATTE_TYPE(s)->name);
+}
+
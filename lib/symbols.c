@@ -283,6 +283,19 @@ inline SymbolType symbol_type (Symbols syms, long index) {
           syms->sym_type[index] : SYMBOL_ANY);
 }
 
+/* symbol_set_type(): change the type of a registered symbol.
+ *
+ * arguments:
+ *  @syms: matte symbol table to modify.
+ *  @index: zero-based symbol index in the table.
+ *  @stype: new symbol type.
+ */
+inline void symbol_set_type (Symbols syms, long index, SymbolType stype) {
+  /* store the new symbol type. */
+  if (syms && index >= 0 && index < syms->n)
+    syms->sym_type[index] = stype;
+}
+
 /* symbol_int(): return the integer data of a symbol.
  *
  * arguments:
@@ -375,6 +388,11 @@ struct _ObjectType Symbols_type = {
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  NULL,                                          /* fn_plus_inplace  */
+  NULL,                                          /* fn_minus_inplace */
+  NULL,                                          /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
@@ -0,0 +1,228 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* enable posix extensions for sysconf(). */
+#define _POSIX_C_SOURCE 200809L
+
+/* include the threads header. */
+#include <matte/threads.h>
+
+/* include the required standard c library headers. */
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/* pool: state of the persistent pool of worker threads.
+ */
+static struct {
+  /* @n: number of threads, including the calling thread.
+   * @tid: identifiers of the worker threads.
+   * @once: initialization control of the pool.
+   */
+  int n;
+  pthread_t tid[THREADS_MAX];
+  pthread_once_t once;
+
+  /* @run: lock held by the thread that submits a loop.
+   * @lock: lock that protects the loop state below.
+   * @start: condition signaled when a loop is submitted.
+   * @done: condition signaled when all chunks of a loop are finished.
+   */
+  pthread_mutex_t run, lock;
+  pthread_cond_t start, done;
+
+  /* @gen: generation counter, incremented for every submitted loop.
+   * @pending: number of unfinished chunks executed by worker threads.
+   * @stop: whether the worker threads should exit.
+   */
+  long gen;
+  int pending, stop;
+
+  /* @fn: loop function of the current loop.
+   * @arg: loop data of the current loop.
+   * @len: number of iterations of the current loop.
+   * @chunks: number of chunks of the current loop.
+   */
+  thread_fn fn;
+  void *arg;
+  long len;
+  int chunks;
+}
+pool = {
+  1, {0}, PTHREAD_ONCE_INIT,
+  PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+  PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+  0, 0, 0,
+  NULL, NULL, 0, 0
+};
+
+/* threads_worker: set within worker threads, so that loops submitted
+ * from within other loops are executed serially.
+ */
+static __thread int threads_worker = 0;
+
+/* threads_chunk(): execute one chunk of the current loop.
+ *
+ * arguments:
+ *  @id: index of the chunk to execute.
+ */
+static inline void threads_chunk (int id) {
+  const long start = (pool.len * id) / pool.chunks;
+  const long end = (pool.len * (id + 1)) / pool.chunks;
+  pool.fn(pool.arg, id, start, end);
+}
+
+/* threads_main(): main function of each worker thread.
+ *
+ * arguments:
+ *  @ptr: index of the worker thread, cast to a pointer.
+ *
+ * returns:
+ *  null.
+ */
+static void *threads_main (void *ptr) {
+  /* get the index of the worker, which is also its chunk index. */
+  const int id = (int) (long) ptr;
+  threads_worker = 1;
+
+  /* wait for loops to be submitted. workers are started before the
+   * first loop, so every generation after zero must be executed.
+   */
+  long gen = 0;
+  pthread_mutex_lock(&pool.lock);
+  while (1) {
+    while (pool.gen == gen && !pool.stop)
+      pthread_cond_wait(&pool.start, &pool.lock);
+
+    if (pool.stop)
+      break;
+
+    gen = pool.gen;
+    if (id >= pool.chunks)
+      continue;
+
+    /* execute the chunk of the worker without holding the lock. */
+    pthread_mutex_unlock(&pool.lock);
+    threads_chunk(id);
+    pthread_mutex_lock(&pool.lock);
+
+    /* signal the submitting thread after the last chunk. */
+    if (--pool.pending == 0)
+      pthread_cond_signal(&pool.done);
+  }
+
+  /* unlock and exit. */
+  pthread_mutex_unlock(&pool.lock);
+  return NULL;
+}
+
+/* threads_init(): determine the size of the thread pool and start its
+ * worker threads. called once, before the first parallel loop.
+ */
+static void threads_init (void) {
+  /* read the requested number of threads, or use the processor count. */
+  const char *env = getenv(THREADS_ENV);
+  long n = (env ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN));
+
+  /* keep the number of threads within bounds. */
+  if (n < 1) n = 1;
+  if (n > THREADS_MAX) n = THREADS_MAX;
+
+  /* start the worker threads, stopping at the first failure. */
+  pool.n = 1;
+  for (long i = 1; i < n; i++) {
+    if (pthread_create(pool.tid + i, NULL, threads_main, (void*) i))
+      break;
+
+    pool.n++;
+  }
+}
+
+/* threads_count(): get the number of threads in the pool.
+ *
+ * returns:
+ *  number of threads that execute parallel loops, including the
+ *  calling thread.
+ */
+int threads_count (void) {
+  pthread_once(&pool.once, threads_init);
+  return pool.n;
+}
+
+/* threads_run(): execute a loop over the thread pool. the iterations of
+ * the loop are split into contiguous chunks, and the calling thread
+ * executes the first chunk. loops that are too small to benefit from
+ * parallel execution, and loops submitted from within another loop,
+ * are executed serially as a single chunk.
+ *
+ * arguments:
+ *  @n: number of loop iterations.
+ *  @size: number of elements processed by each iteration.
+ *  @fn: loop function to execute.
+ *  @arg: loop data to pass to @fn.
+ *
+ * returns:
+ *  number of chunks that the loop was split into.
+ */
+int threads_run (long n, long size, thread_fn fn, void *arg) {
+  /* determine the number of chunks to execute. */
+  long chunks = (n * size) / THREADS_MIN_WORK;
+  if (chunks > n) chunks = n;
+
+  /* execute small and nested loops serially. */
+  if (chunks < 2 || threads_worker || threads_count() < 2) {
+    if (n > 0)
+      fn(arg, 0, 0, n);
+
+    return 1;
+  }
+
+  /* use at most one chunk per thread. */
+  if (chunks > pool.n)
+    chunks = pool.n;
+
+  /* submit the loop to the worker threads. */
+  pthread_mutex_lock(&pool.run);
+  pthread_mutex_lock(&pool.lock);
+  pool.fn = fn;
+  pool.arg = arg;
+  pool.len = n;
+  pool.chunks = chunks;
+  pool.pending = chunks - 1;
+  pool.gen++;
+  pthread_cond_broadcast(&pool.start);
+  pthread_mutex_unlock(&pool.lock);
+
+  /* execute the first chunk. */
+  threads_chunk(0);
+
+  /* wait for the remaining chunks. */
+  pthread_mutex_lock(&pool.lock);
+  while (pool.pending)
+    pthread_cond_wait(&pool.done, &pool.lock);
+
+  pthread_mutex_unlock(&pool.lock);
+  pthread_mutex_unlock(&pool.run);
+
+  /* return the number of chunks. */
+  return chunks;
+}
+
+/* threads_fini(): stop the worker threads of the pool. called once when
+ * the library is unloaded.
+ */
+__attribute__((destructor))
+static void threads_fini (void) {
+  /* signal the worker threads to exit. */
+  pthread_mutex_lock(&pool.lock);
+  pool.stop = 1;
+  pthread_cond_broadcast(&pool.start);
+  pthread_mutex_unlock(&pool.lock);
+
+  /* wait for the worker threads to exit. */
+  for (int i = 1; i < pool.n; i++)
+    pthread_join(pool.tid[i], NULL);
+}
+
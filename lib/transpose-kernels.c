@@ -0,0 +1,162 @@
+/* define macros for generating tiled transposition kernels. all matrices
+ * are stored in column-major order.
+ */
+#define CONCAT3(a,b,c)   a ## b ## c
+#define KNAME(p,name)    CONCAT3(transpose_, p, name)
+#define NAME(name)       KNAME(P, name)
+
+/* ELEM(): macro to access an element of a column-major matrix. */
+#define ELEM(A,lda,i,j) (A)[(i) + (j) * (lda)]
+
+/* OPC(): macro to conditionally conjugate an element. */
+#define OPC(c,x) ((c) ? CONJ(x) : (x))
+
+/* transpose_*_tile(): transpose a tile of at most TRANSPOSE_BLOCK rows
+ * and columns, using the selected kernel on each full micro-block.
+ */
+static void NAME(_tile) (long m, long n, const T *a, long lda,
+                         T *b, long ldb, int c) {
+  const long M = TRANSPOSE_MICRO;
+  long i, j;
+
+  for (j = 0; j + M <= n; j += M) {
+    for (i = 0; i + M <= m; i += M)
+      NAME(_micro)(&ELEM(a, lda, i, j), lda, &ELEM(b, ldb, j, i), ldb, c);
+
+    for (; i < m; i++)
+      for (long k = j; k < j + M; k++)
+        ELEM(b, ldb, k, i) = OPC(c, ELEM(a, lda, i, k));
+  }
+
+  for (; j < n; j++)
+    for (i = 0; i < m; i++)
+      ELEM(b, ldb, j, i) = OPC(c, ELEM(a, lda, i, j));
+}
+
+/* transpose_*_rec(): transpose a matrix by recursively halving its
+ * larger dimension, which keeps every level of the memory hierarchy
+ * busy without tuning for its sizes.
+ */
+static void NAME(_rec) (long m, long n, const T *a, long lda,
+                        T *b, long ldb, int c) {
+  /* transpose small tiles directly. */
+  if (m <= TRANSPOSE_BLOCK && n <= TRANSPOSE_BLOCK) {
+    NAME(_tile)(m, n, a, lda, b, ldb, c);
+    return;
+  }
+
+  /* split at a multiple of the micro-block size. */
+  if (m >= n) {
+    const long h = (m / 2) & ~(TRANSPOSE_MICRO - 1L);
+    NAME(_rec)(h, n, a, lda, b, ldb, c);
+    NAME(_rec)(m - h, n, a + h, lda, b + h * ldb, ldb, c);
+  }
+  else {
+    const long h = (n / 2) & ~(TRANSPOSE_MICRO - 1L);
+    NAME(_rec)(m, h, a, lda, b, ldb, c);
+    NAME(_rec)(m, n - h, a + h * lda, lda, b + h, ldb, c);
+  }
+}
+
+/* transpose_*_cols(): transpose a range of columns of a matrix, as one
+ * chunk of a parallel loop.
+ */
+static void NAME(_cols) (void *arg, int id, long start, long end) {
+  const TransposeLoop *L = (const TransposeLoop*) arg;
+  const T *a = (const T*) L->a;
+  T *b = (T*) L->b;
+
+  NAME(_rec)(L->m, end - start, a + start * L->m, L->m,
+             b + start, L->n, L->cj);
+}
+
+/* transpose_*_swap_tile(): exchange an off-diagonal tile of a square
+ * matrix with its mirror image, transposing both. full micro-blocks are
+ * exchanged through a temporary block, using the selected kernel.
+ */
+static void NAME(_swap_tile) (long n, T *a, long i0, long i1,
+                              long j0, long j1, int c) {
+  const long M = TRANSPOSE_MICRO;
+  T t[TRANSPOSE_MICRO * TRANSPOSE_MICRO];
+  long i, j;
+
+  for (j = j0; j + M <= j1; j += M) {
+    for (i = i0; i + M <= i1; i += M) {
+      /* transpose the upper block aside, then move the lower block. */
+      NAME(_micro)(&ELEM(a, n, i, j), n, t, M, c);
+      NAME(_micro)(&ELEM(a, n, j, i), n, &ELEM(a, n, i, j), n, c);
+
+      /* store the upper block in place of the lower block. */
+      for (long k = 0; k < M; k++)
+        memcpy(&ELEM(a, n, j, i + k), t + k * M, M * sizeof(T));
+    }
+
+    for (; i < i1; i++)
+      for (long k = j; k < j + M; k++) {
+        const T x = ELEM(a, n, i, k);
+        ELEM(a, n, i, k) = OPC(c, ELEM(a, n, k, i));
+        ELEM(a, n, k, i) = OPC(c, x);
+      }
+  }
+
+  for (; j < j1; j++)
+    for (i = i0; i < i1; i++) {
+      const T x = ELEM(a, n, i, j);
+      ELEM(a, n, i, j) = OPC(c, ELEM(a, n, j, i));
+      ELEM(a, n, j, i) = OPC(c, x);
+    }
+}
+
+/* transpose_*_swap_row(): transpose one block row of a square matrix
+ * in place, by exchanging each tile right of the diagonal with its
+ * mirror image below the diagonal.
+ */
+static void NAME(_swap_row) (long n, T *a, long bi, int c) {
+  const long i0 = bi * TRANSPOSE_BLOCK;
+  const long i1 = (i0 + TRANSPOSE_BLOCK < n ? i0 + TRANSPOSE_BLOCK : n);
+
+  /* transpose the diagonal tile, visiting only its upper triangle. */
+  for (long j = i0; j < i1; j++) {
+    for (long i = i0; i < j; i++) {
+      const T x = ELEM(a, n, i, j);
+      ELEM(a, n, i, j) = OPC(c, ELEM(a, n, j, i));
+      ELEM(a, n, j, i) = OPC(c, x);
+    }
+
+    ELEM(a, n, j, j) = OPC(c, ELEM(a, n, j, j));
+  }
+
+  /* exchange the off-diagonal tiles. */
+  for (long j0 = i1; j0 < n; j0 += TRANSPOSE_BLOCK) {
+    const long j1 = (j0 + TRANSPOSE_BLOCK < n ? j0 + TRANSPOSE_BLOCK : n);
+    NAME(_swap_tile)(n, a, i0, i1, j0, j1, c);
+  }
+}
+
+/* transpose_*_swap(): transpose a range of block rows of a square
+ * matrix in place, as one chunk of a parallel loop. each index @k
+ * handles the block rows @k and (nb - 1 - k), so that every index
+ * carries the same number of tiles.
+ */
+static void NAME(_swap) (void *arg, int id, long start, long end) {
+  const TransposeLoop *L = (const TransposeLoop*) arg;
+  const long nb = (L->n + TRANSPOSE_BLOCK - 1) / TRANSPOSE_BLOCK;
+  T *a = (T*) L->a;
+
+  for (long k = start; k < end; k++) {
+    NAME(_swap_row)(L->n, a, k, L->cj);
+    if (nb - 1 - k != k)
+      NAME(_swap_row)(L->n, a, nb - 1 - k, L->cj);
+  }
+}
+
+/* undefine the kernel generator macros.
+ */
+#undef CONCAT3
+#undef KNAME
+#undef NAME
+#undef ELEM
+#undef OPC
+#undef P
+#undef T
+#undef CONJ
@@ -0,0 +1,287 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* include the transpose, simd and threads headers. */
+#include <matte/transpose.h>
+#include <matte/simd.h>
+#include <matte/threads.h>
+
+/* include the x86 intrinsics header. */
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+/* TransposeLoop: a struct _TransposeLoop. */
+typedef struct _TransposeLoop TransposeLoop;
+
+/* _TransposeLoop: structure for holding the state of a transposition
+ * that is split across the thread pool.
+ */
+struct _TransposeLoop {
+  /* @a: elements of the source matrix, or of the in-place matrix.
+   * @b: elements of the destination matrix.
+   */
+  const void *a;
+  void *b;
+
+  /* @m: number of source rows.
+   * @n: number of source columns.
+   * @cj: whether to conjugate the transposed elements.
+   */
+  long m, n;
+  int cj;
+};
+
+/* transpose_micro_d: function pointer type of real micro-kernels. each
+ * kernel transposes a block of TRANSPOSE_MICRO rows and columns of @a
+ * into @b.
+ */
+typedef void (*transpose_micro_d) (const double *a, long lda,
+                                   double *b, long ldb, int c);
+
+/* transpose_micro_s: function pointer type of single-precision real
+ * micro-kernels.
+ */
+typedef void (*transpose_micro_s) (const float *a, long lda,
+                                   float *b, long ldb, int c);
+
+/* transpose_micro_z: function pointer type of complex micro-kernels,
+ * which also conjugate the transposed elements when @c is set.
+ */
+typedef void (*transpose_micro_z) (const complex double *a, long lda,
+                                   complex double *b, long ldb, int c);
+
+/* transpose_d_generic(): portable real micro-kernel. */
+static void transpose_d_generic (const double *a, long lda,
+                                 double *b, long ldb, int c) {
+  for (long j = 0; j < TRANSPOSE_MICRO; j++)
+    for (long i = 0; i < TRANSPOSE_MICRO; i++)
+      b[j + i * ldb] = a[i + j * lda];
+}
+
+/* transpose_s_generic(): portable single-precision micro-kernel. */
+static void transpose_s_generic (const float *a, long lda,
+                                 float *b, long ldb, int c) {
+  for (long j = 0; j < TRANSPOSE_MICRO; j++)
+    for (long i = 0; i < TRANSPOSE_MICRO; i++)
+      b[j + i * ldb] = a[i + j * lda];
+}
+
+/* transpose_z_generic(): portable complex micro-kernel. */
+static void transpose_z_generic (const complex double *a, long lda,
+                                 complex double *b, long ldb, int c) {
+  for (long j = 0; j < TRANSPOSE_MICRO; j++)
+    for (long i = 0; i < TRANSPOSE_MICRO; i++)
+      b[j + i * ldb] = (c ? conj(a[i + j * lda]) : a[i + j * lda]);
+}
+
+#ifdef SIMD_X86
+/* transpose_d_sse2(): sse2 real micro-kernel, transposing each 2x2
+ * sub-block with a pair of unpack instructions.
+ */
+__attribute__((target("sse2")))
+static void transpose_d_sse2 (const double *a, long lda,
+                              double *b, long ldb, int c) {
+  for (long j = 0; j < TRANSPOSE_MICRO; j += 2) {
+    for (long i = 0; i < TRANSPOSE_MICRO; i += 2) {
+      const __m128d x0 = _mm_loadu_pd(a + i + j * lda);
+      const __m128d x1 = _mm_loadu_pd(a + i + (j + 1) * lda);
+      _mm_storeu_pd(b + j + i * ldb, _mm_unpacklo_pd(x0, x1));
+      _mm_storeu_pd(b + j + (i + 1) * ldb, _mm_unpackhi_pd(x0, x1));
+    }
+  }
+}
+
+/* transpose_d_avx2(): avx2 real micro-kernel, transposing the whole
+ * 4x4 block in registers.
+ */
+__attribute__((target("avx2")))
+static void transpose_d_avx2 (const double *a, long lda,
+                              double *b, long ldb, int c) {
+  /* load the columns of the block. */
+  const __m256d r0 = _mm256_loadu_pd(a);
+  const __m256d r1 = _mm256_loadu_pd(a + lda);
+  const __m256d r2 = _mm256_loadu_pd(a + 2 * lda);
+  const __m256d r3 = _mm256_loadu_pd(a + 3 * lda);
+
+  /* interleave pairs of columns. */
+  const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+  const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+  const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+  const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+  /* exchange the halves and store the rows of the block. */
+  _mm256_storeu_pd(b,           _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(b + ldb,     _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(b + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(b + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+/* transpose_s_sse(): sse single-precision micro-kernel, transposing
+ * the whole 4x4 block in registers.
+ */
+__attribute__((target("sse")))
+static void transpose_s_sse (const float *a, long lda,
+                             float *b, long ldb, int c) {
+  __m128 r0 = _mm_loadu_ps(a);
+  __m128 r1 = _mm_loadu_ps(a + lda);
+  __m128 r2 = _mm_loadu_ps(a + 2 * lda);
+  __m128 r3 = _mm_loadu_ps(a + 3 * lda);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(b,           r0);
+  _mm_storeu_ps(b + ldb,     r1);
+  _mm_storeu_ps(b + 2 * ldb, r2);
+  _mm_storeu_ps(b + 3 * ldb, r3);
+}
+
+/* transpose_z_sse2(): sse2 complex micro-kernel, moving each element
+ * with a single load and store, and conjugating it by flipping the sign
+ * bit of its imaginary part.
+ */
+__attribute__((target("sse2")))
+static void transpose_z_sse2 (const complex double *a, long lda,
+                              complex double *b, long ldb, int c) {
+  const __m128d mask = _mm_set_pd(c ? -0.0 : 0.0, 0.0);
+  const double *pa = (const double*) a;
+  double *pb = (double*) b;
+
+  for (long j = 0; j < TRANSPOSE_MICRO; j++)
+    for (long i = 0; i < TRANSPOSE_MICRO; i++)
+      _mm_storeu_pd(pb + 2 * (j + i * ldb),
+        _mm_xor_pd(_mm_loadu_pd(pa + 2 * (i + j * lda)), mask));
+}
+#endif
+
+/* transpose_d_micro, transpose_s_micro, transpose_z_micro: micro-kernels
+ * that were selected for the host processor.
+ */
+static transpose_micro_d transpose_d_micro = transpose_d_generic;
+static transpose_micro_s transpose_s_micro = transpose_s_generic;
+static transpose_micro_z transpose_z_micro = transpose_z_generic;
+
+/* transpose_d_*(): real transposition kernels. */
+#define P d
+#define T double
+#define CONJ(x) (x)
+#include "transpose-kernels.c"
+
+/* transpose_s_*(): single-precision transposition kernels. */
+#define P s
+#define T float
+#define CONJ(x) (x)
+#include "transpose-kernels.c"
+
+/* transpose_z_*(): complex transposition kernels. */
+#define P z
+#define T complex double
+#define CONJ(x) conj(x)
+#include "transpose-kernels.c"
+
+/* transpose_d(): compute the transpose of a real matrix out of place.
+ * the columns of the source are split across the thread pool, and the
+ * chunk of each thread is transposed recursively.
+ *
+ * arguments:
+ *  @m: number of rows of the source matrix.
+ *  @n: number of columns of the source matrix.
+ *  @a: column-major elements of the source matrix.
+ *  @b: output column-major elements of the (n x m) transpose.
+ */
+void transpose_d (long m, long n, const double *a, double *b) {
+  TransposeLoop L = { a, b, m, n, 0 };
+  threads_run(n, m, transpose_d_cols, &L);
+}
+
+/* transpose_s(): compute the transpose of a single-precision real
+ * matrix out of place.
+ *
+ * arguments:
+ *  @m: number of rows of the source matrix.
+ *  @n: number of columns of the source matrix.
+ *  @a: column-major elements of the source matrix.
+ *  @b: output column-major elements of the (n x m) transpose.
+ */
+void transpose_s (long m, long n, const float *a, float *b) {
+  TransposeLoop L = { a, b, m, n, 0 };
+  threads_run(n, m, transpose_s_cols, &L);
+}
+
+/* transpose_z(): compute the transpose or conjugate transpose of a
+ * complex matrix out of place.
+ *
+ * arguments:
+ *  @m: number of rows of the source matrix.
+ *  @n: number of columns of the source matrix.
+ *  @a: column-major elements of the source matrix.
+ *  @b: output column-major elements of the (n x m) transpose.
+ *  @cj: whether to conjugate the transposed elements.
+ */
+void transpose_z (long m, long n, const complex double *a,
+                  complex double *b, int cj) {
+  TransposeLoop L = { a, b, m, n, cj };
+  threads_run(n, m, transpose_z_cols, &L);
+}
+
+/* transpose_d_inplace(): transpose a square real matrix in place. the
+ * block rows of the matrix are split across the thread pool.
+ *
+ * arguments:
+ *  @n: number of rows and columns of the matrix.
+ *  @a: column-major elements of the matrix.
+ */
+void transpose_d_inplace (long n, double *a) {
+  TransposeLoop L = { a, NULL, n, n, 0 };
+  const long nb = (n + TRANSPOSE_BLOCK - 1) / TRANSPOSE_BLOCK;
+  threads_run((nb + 1) / 2, n * TRANSPOSE_BLOCK, transpose_d_swap, &L);
+}
+
+/* transpose_s_inplace(): transpose a square single-precision real
+ * matrix in place.
+ *
+ * arguments:
+ *  @n: number of rows and columns of the matrix.
+ *  @a: column-major elements of the matrix.
+ */
+void transpose_s_inplace (long n, float *a) {
+  TransposeLoop L = { a, NULL, n, n, 0 };
+  const long nb = (n + TRANSPOSE_BLOCK - 1) / TRANSPOSE_BLOCK;
+  threads_run((nb + 1) / 2, n * TRANSPOSE_BLOCK, transpose_s_swap, &L);
+}
+
+/* transpose_z_inplace(): transpose or conjugate transpose a square
+ * complex matrix in place.
+ *
+ * arguments:
+ *  @n: number of rows and columns of the matrix.
+ *  @a: column-major elements of the matrix.
+ *  @cj: whether to conjugate the transposed elements.
+ */
+void transpose_z_inplace (long n, complex double *a, int cj) {
+  TransposeLoop L = { a, NULL, n, n, cj };
+  const long nb = (n + TRANSPOSE_BLOCK - 1) / TRANSPOSE_BLOCK;
+  threads_run((nb + 1) / 2, n * TRANSPOSE_BLOCK, transpose_z_swap, &L);
+}
+
+/* transpose_init(): select the micro-kernels supported by the host
+ * processor. called once when the library is loaded.
+ */
+__attribute__((constructor))
+void transpose_init (void) {
+#ifdef SIMD_X86
+  /* prefer the widest supported instruction set. */
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    transpose_d_micro = transpose_d_avx2;
+    transpose_s_micro = transpose_s_sse;
+    transpose_z_micro = transpose_z_sse2;
+  }
+  else if (__builtin_cpu_supports("sse2")) {
+    transpose_d_micro = transpose_d_sse2;
+    transpose_s_micro = transpose_s_sse;
+    transpose_z_micro = transpose_z_sse2;
+  }
+#endif
+}
+
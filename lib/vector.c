@@ -3,16 +3,23 @@
  * Released under the MIT License
  */
 
-/* include the vector, exception and blas headers. */
+/* include the vector, exception, blas, simd, broadcast and subscript
+ * headers.
+ */
 #include <matte/vector.h>
 #include <matte/except.h>
 #include <matte/blas.h>
+#include <matte/simd.h>
+#include <matte/broadcast.h>
+#include <matte/subscript.h>
 
 /* include headers for inferior types. */
 #include <matte/int.h>
 #include <matte/range.h>
 #include <matte/float.h>
+#include <matte/float-range.h>
 #include <matte/complex.h>
+#include <matte/logical.h>
 
 /* include headers for superior types. */
 #include <matte/matrix.h>
@@ -96,8 +103,38 @@ Vector vector_new_from_range (Zone z, Range r) {
     return NULL;
 
   /* if any vector elements exist, compute and store them. */
-  for (long i = 0, elem = r->begin; i < n; i++, elem += r->step)
-    x->data[i] = (double) elem;
+  for (long i = 0; i < n; i++)
+    x->data[i] = (double) range_get_element(r, i);
+
+  /* return the new vector. */
+  x->tr = CblasTrans;
+  return x;
+}
+
+/* vector_new_from_float_range(): allocate a new matte vector using the
+ * contents of a matte float range.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @r: matte float range to access.
+ *
+ * returns:
+ *  newly allocated and initialized matte vector.
+ */
+Vector vector_new_from_float_range (Zone z, FloatRange r) {
+  /* return null if the input range is null. */
+  if (!r)
+    return NULL;
+
+  /* allocate the vector. */
+  const long n = float_range_get_length(r);
+  Vector x = vector_new_with_length(z, n);
+  if (!x)
+    return NULL;
+
+  /* compute and store the vector elements. */
+  for (long i = 0; i < n; i++)
+    x->data[i] = float_range_get_element(r, i);
 
   /* return the new vector. */
   x->tr = CblasTrans;
@@ -105,6 +142,8 @@ Vector vector_new_from_range (Zone z, Range r) {
 }
 
 /* vector_copy(): allocate a new matte vector from another matte vector.
+ * the duplicate shares the data buffer of the input vector until either
+ * of them is modified.
  *
  * arguments:
  *  @z: zone allocator to utilize.
@@ -120,12 +159,12 @@ Vector vector_copy (Zone z, Vector x) {
 
   /* allocate a new vector. */
   Vector xnew = vector_new(z, NULL);
-  if (!xnew || !vector_set_length(xnew, x->n))
+  if (!xnew)
     return NULL;
 
-  /* copy the memory contents of the input vector into the duplicate. */
-  if (xnew->n)
-    memcpy(xnew->data, x->data, xnew->n * sizeof(double));
+  /* share the data buffer of the input vector with the duplicate. */
+  xnew->data = (double*) buffer_share(x->data);
+  xnew->n = x->n;
 
   /* copy the transposition state. */
   xnew->tr = x->tr;
@@ -145,8 +184,8 @@ void vector_delete (Zone z, Vector x) {
   if (!x)
     return;
 
-  /* free the vector data. */
-  free(x->data);
+  /* release the vector data. */
+  buffer_release(x->data);
 }
 
 /* vector_get_length(): get the length of a matte vector.
@@ -198,24 +237,45 @@ int vector_set_length (Vector x, long n) {
   if (x->n == n)
     return 1;
 
-  /* reallocate the vector data. */
-  x->data = (double*) realloc(x->data, n * sizeof(double));
-  if (!x->data)
+  /* reallocate the vector data, zeroing any new trailing elements. */
+  double *data = (double*) buffer_resize(x->data, x->n, n, sizeof(double));
+  if (n && !data)
     fail(ERR_BAD_ALLOC);
 
-  /* fill the new trailing elements with zeros. */
-  const long excess = (n - x->n) * sizeof(double);
-  if (n > x->n)
-    memset(x->data + x->n, 0, excess);
-
-  /* store the new vector length. */
+  /* store the new vector data and length. */
+  x->data = data;
   x->n = n;
 
   /* return success. */
   return 1;
 }
 
-/* vector_set(): set an element of a matte vector.
+/* vector_unshare(): ensure that the data of a matte vector is not
+ * shared with any other vector, so that it may be modified in place.
+ *
+ * arguments:
+ *  @x: matte vector to modify.
+ *
+ * returns:
+ *  integer indicating success (1) or failure (0).
+ */
+int vector_unshare (Vector x) {
+  /* fail if the vector is null. */
+  if (!x)
+    fail(ERR_INVALID_ARGIN);
+
+  /* copy the vector data if it is held by other vectors. */
+  double *data = (double*) buffer_unshare(x->data, x->n, sizeof(double));
+  if (x->n && !data)
+    fail(ERR_BAD_ALLOC);
+
+  /* store the unshared vector data and return success. */
+  x->data = data;
+  return 1;
+}
+
+/* vector_set(): set an element of a matte vector. the vector data must
+ * not be shared, see vector_unshare().
  *
  * arguments:
  *  @x: matte vector to modify.
@@ -282,6 +342,10 @@ int vector_add_const (Vector x, double f) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!vector_unshare(x))
+    return 0;
+
   /* add the constant to every element of the vector. */
   for (long i = 0; i < x->n; i++)
     x->data[i] += f;
@@ -304,6 +368,10 @@ int vector_const_div (double f, Vector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!vector_unshare(x))
+    return 0;
+
   /* divide the constant by every element of the vector. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = f / x->data[i];
@@ -326,6 +394,10 @@ int vector_pow_const (Vector x, double f) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!vector_unshare(x))
+    return 0;
+
   /* raise every element of the vector to the constant power. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = pow(x->data[i], f);
@@ -348,6 +420,10 @@ int vector_const_pow (double f, Vector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!vector_unshare(x))
+    return 0;
+
   /* raise the constant by every element of the vector. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = pow(f, x->data[i]);
@@ -369,6 +445,10 @@ int vector_negate (Vector x) {
   if (!x)
     fail(ERR_INVALID_ARGIN);
 
+  /* ensure that the vector data may be modified. */
+  if (!vector_unshare(x))
+    return 0;
+
   /* negate every element of the vector. */
   for (long i = 0; i < x->n; i++)
     x->data[i] = -(x->data[i]);
@@ -377,6 +457,77 @@ int vector_negate (Vector x) {
   return 1;
 }
 
+/* vector_fuse(): prepare the operands of a fused element-wise expression
+ * over real vectors. every operand must be either a real scalar or a
+ * vector of one common length and orientation, and at least one operand
+ * must be a vector. vector operands are accessed with unit increments,
+ * and scalar operands are stored into a value array and accessed with
+ * zero increments.
+ *
+ * the result may be written over an existing vector whose value is no
+ * longer needed, which avoids allocating a new result. the existing
+ * vector may itself be an operand, as each result element only depends
+ * on the operand elements at the same index.
+ *
+ * arguments:
+ *  @z: zone allocator to allocate the result from.
+ *  @out: unaliased object to reuse for the result, or null.
+ *  @n: number of operands.
+ *  @args: array of operands.
+ *  @ptr: output array of operand element pointers.
+ *  @inc: output array of operand element increments.
+ *  @val: output array of scalar operand values.
+ *
+ * returns:
+ *  newly allocated vector to hold the result of the expression, or null
+ *  if the operands cannot be fused.
+ */
+Vector vector_fuse (Zone z, Object out, int n, Object *args,
+                    const double **ptr, long *inc, double *val) {
+  /* check each operand, keeping the last vector operand. */
+  Vector x = NULL;
+  for (int i = 0; i < n; i++) {
+    if (IS_VECTOR(args[i])) {
+      /* vector operand: check the length and orientation. */
+      Vector v = (Vector) args[i];
+      if (x && (v->n != x->n || v->tr != x->tr))
+        return NULL;
+
+      ptr[i] = v->data;
+      inc[i] = 1;
+      x = v;
+    }
+    else if (IS_FLOAT(args[i]) || IS_INT(args[i])) {
+      /* scalar operand: store the value. */
+      val[i] = (IS_FLOAT(args[i]) ?
+                float_get_value((Float) args[i]) :
+                (double) int_get_value((Int) args[i]));
+
+      ptr[i] = val + i;
+      inc[i] = 0;
+    }
+    else
+      return NULL;
+  }
+
+  /* fail if no vector operands were found. */
+  if (!x)
+    return NULL;
+
+  /* reuse the output vector if its size matches the operands. */
+  Vector y = (Vector) out;
+  if (IS_VECTOR(y) && y->n == x->n && y->tr == x->tr &&
+      (!z || !zone_is_locked(y)) && vector_unshare(y))
+    return y;
+
+  /* allocate the result vector, in the orientation of the operands. */
+  y = vector_new_with_length(z, x->n);
+  if (y)
+    y->tr = x->tr;
+
+  return y;
+}
+
 /* vector_disp(): display function for matte vectors.
  */
 int vector_disp (Zone z, Vector x) {
@@ -391,139 +542,6 @@ int vector_disp (Zone z, Vector x) {
   return 1;
 }
 
-/* vector_plus(): addition function for vectors.
- */
-Object vector_plus (Zone z, Object a, Object b) {
-  if (IS_VECTOR(a)) {
-    if (IS_VECTOR(b)) {
-      /* vector + vector => vector */
-      Vector va = (Vector) a;
-      Vector vb = (Vector) b;
-
-      if (va->tr == vb->tr) {
-        Vector vc = vector_copy(z, va);
-        if (matte_daxpy(1.0, vb, vc))
-          return (Object) vc;
-      }
-      else
-        return (Object) matrix_new_from_vector_sum(z, 1.0, va, vb);
-    }
-    else if (IS_COMPLEX(b)) {
-      /* vector + complex => complex vector */
-      complex double fval = complex_get_value((Complex) b);
-      ComplexVector v = complex_vector_new_from_vector(z, (Vector) a);
-      if (complex_vector_add_const(v, fval))
-        return (Object) v;
-    }
-    else if (IS_FLOAT(b)) {
-      /* vector + float => vector */
-      double fval = float_get_value((Float) b);
-      Vector v = vector_copy(z, (Vector) a);
-      if (vector_add_const(v, fval))
-        return (Object) v;
-    }
-    else if (IS_INT(b)) {
-      /* vector + int => vector */
-      double fval = (double) int_get_value((Int) b);
-      Vector v = vector_copy(z, (Vector) a);
-      if (vector_add_const(v, fval))
-        return (Object) v;
-    }
-  }
-  else if (IS_VECTOR(b)) {
-    if (IS_COMPLEX(a)) {
-      /* complex + vector => complex vector */
-      complex double fval = complex_get_value((Complex) a);
-      ComplexVector v = complex_vector_new_from_vector(z, (Vector) b);
-      if (complex_vector_add_const(v, fval))
-        return (Object) v;
-    }
-    else if (IS_FLOAT(a)) {
-      /* float + vector => vector */
-      double fval = float_get_value((Float) a);
-      Vector v = vector_copy(z, (Vector) b);
-      if (vector_add_const(v, fval))
-        return (Object) v;
-    }
-    else if (IS_INT(a)) {
-      /* int + vector => vector */
-      double fval = (double) int_get_value((Int) a);
-      Vector v = vector_copy(z, (Vector) b);
-      if (vector_add_const(v, fval))
-        return (Object) v;
-    }
-  }
-
-  return NULL;
-}
-
-/* vector_minus(): subtraction function for vectors.
- */
-Object vector_minus (Zone z, Object a, Object b) {
-  if (IS_VECTOR(a)) {
-    if (IS_VECTOR(b)) {
-      /* vector - vector => vector */
-      Vector va = (Vector) a;
-      Vector vb = (Vector) b;
-
-      if (va->tr == vb->tr) {
-        Vector vc = vector_copy(z, va);
-        if (matte_daxpy(-1.0, vb, vc))
-          return (Object) vc;
-      }
-      else
-        return (Object) matrix_new_from_vector_sum(z, -1.0, va, vb);
-    }
-    else if (IS_COMPLEX(b)) {
-      /* vector - complex => complex vector */
-      complex double fval = complex_get_value((Complex) b);
-      ComplexVector v = complex_vector_new_from_vector(z, (Vector) a);
-      if (complex_vector_add_const(v, -fval))
-        return (Object) v;
-    }
-    else if (IS_FLOAT(b)) {
-      /* vector - float => vector */
-      double fval = float_get_value((Float) b);
-      Vector v = vector_copy(z, (Vector) a);
-      if (vector_add_const(v, -fval))
-        return (Object) v;
-    }
-    else if (IS_INT(b)) {
-      /* vector - int => vector */
-      double fval = (double) int_get_value((Int) b);
-      Vector v = vector_copy(z, (Vector) a);
-      if (vector_add_const(v, -fval))
-        return (Object) v;
-    }
-  }
-  else if (IS_VECTOR(b)) {
-    if (IS_COMPLEX(a)) {
-      /* complex - vector => complex vector */
-      complex double fval = complex_get_value((Complex) a);
-      ComplexVector v = complex_vector_new_from_vector(z, (Vector) b);
-      if (complex_vector_add_const(v, -fval) &&
-          complex_vector_negate(v))
-        return (Object) v;
-    }
-    else if (IS_FLOAT(a)) {
-      /* float - vector => vector */
-      double fval = float_get_value((Float) a);
-      Vector v = vector_copy(z, (Vector) b);
-      if (vector_add_const(v, -fval) && vector_negate(v))
-        return (Object) v;
-    }
-    else if (IS_INT(a)) {
-      /* int - vector => vector */
-      double fval = (double) int_get_value((Int) a);
-      Vector v = vector_copy(z, (Vector) b);
-      if (vector_add_const(v, -fval) && vector_negate(v))
-        return (Object) v;
-    }
-  }
-
-  return NULL;
-}
-
 /* vector_uminus(): unary negation function for vectors.
  */
 Vector vector_uminus (Zone z, Vector a) {
@@ -535,63 +553,97 @@ Vector vector_uminus (Zone z, Vector a) {
   return aneg;
 }
 
-/* vector_times(): element-wise multiplication function for vectors.
+/* vector_plus_inplace(): in-place addition function for vectors.
  */
-Object vector_times (Zone z, Object a, Object b) {
-  if (IS_VECTOR(a) && IS_VECTOR(b)) {
-    /* vector .* vector */
-    Vector va = (Vector) a;
+int vector_plus_inplace (Zone z, Vector a, Object b) {
+  if (IS_VECTOR(b)) {
+    /* vector += vector */
     Vector vb = (Vector) b;
+    if (vb != a && vb->n == a->n && vb->tr == a->tr)
+      return (vector_unshare(a) && matte_daxpy(1.0, vb, a));
+  }
+  else if (IS_FLOAT(b)) {
+    /* vector += float */
+    return vector_add_const(a, float_get_value((Float) b));
+  }
+  else if (IS_INT(b)) {
+    /* vector += int */
+    return vector_add_const(a, (double) int_get_value((Int) b));
+  }
 
-    if (va->n != vb->n)
-      throw(z, ERR_SIZE_MISMATCH_VV(va, vb));
-
-    Vector vc = vector_new_with_length(z, va->n);
-    if (vc) {
-      for (long i = 0; i < vc->n; i++)
-        vector_set(vc, i, vector_get(va, i) * vector_get(vb, i));
-
-      return (Object) vc;
-    }
+  return 0;
+}
 
-    return NULL;
+/* vector_minus_inplace(): in-place subtraction function for vectors.
+ */
+int vector_minus_inplace (Zone z, Vector a, Object b) {
+  if (IS_VECTOR(b)) {
+    /* vector -= vector */
+    Vector vb = (Vector) b;
+    if (vb != a && vb->n == a->n && vb->tr == a->tr)
+      return (vector_unshare(a) && matte_daxpy(-1.0, vb, a));
   }
-
-  /* properly cast the operands. */
-  Vector x;
-  Object s;
-  if (IS_VECTOR(a)) {
-    x = (Vector) a;
-    s = b;
+  else if (IS_FLOAT(b)) {
+    /* vector -= float */
+    return vector_add_const(a, -float_get_value((Float) b));
   }
-  else {
-    x = (Vector) b;
-    s = a;
+  else if (IS_INT(b)) {
+    /* vector -= int */
+    return vector_add_const(a, (double) -int_get_value((Int) b));
   }
 
-  if (IS_COMPLEX(s)) {
-    /* vector .* complex => complex vector */
-    ComplexVector y = complex_vector_new_from_vector(z, x);
-    complex double sval = complex_get_value((Complex) s);
-    if (matte_zscal(sval, y))
-      return (Object) y;
+  return 0;
+}
+
+/* vector_times_inplace(): in-place element-wise multiplication function
+ * for vectors.
+ */
+int vector_times_inplace (Zone z, Vector a, Object b) {
+  if (IS_VECTOR(b)) {
+    /* vector .*= vector */
+    Vector vb = (Vector) b;
+    if (vb->n != a->n || !vector_unshare(a))
+      return 0;
+
+    for (long i = 0; i < a->n; i++)
+      a->data[i] *= vb->data[i];
+
+    return 1;
   }
-  else if (IS_FLOAT(s)) {
-    /* vector .* float => vector */
-    Vector y = vector_copy(z, x);
-    double sval = float_get_value((Float) s);
-    if (matte_dscal(sval, y))
-      return (Object) y;
+  else if (IS_FLOAT(b)) {
+    /* vector .*= float */
+    double fval = float_get_value((Float) b);
+    return (vector_unshare(a) && matte_dscal(fval, a));
   }
-  else if (IS_INT(s)) {
-    /* vector .* int => vector */
-    Vector y = vector_copy(z, x);
-    long sval = int_get_value((Int) s);
-    if (matte_dscal((double) sval, y))
-      return (Object) y;
+  else if (IS_INT(b)) {
+    /* vector .*= int */
+    double fval = (double) int_get_value((Int) b);
+    return (vector_unshare(a) && matte_dscal(fval, a));
   }
 
-  return NULL;
+  return 0;
+}
+
+/* vector_widen(): expand a range or logical operand of a matrix
+ * operation into a double-precision array.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @obj: operand to expand.
+ *
+ * returns:
+ *  newly allocated vector or matrix holding the elements of a range or
+ *  logical array, or @obj itself for all other objects.
+ */
+static Object vector_widen (Zone z, Object obj) {
+  if (IS_RANGE(obj))
+    return (Object) vector_new_from_range(z, (Range) obj);
+  else if (IS_FLOAT_RANGE(obj))
+    return (Object) vector_new_from_float_range(z, (FloatRange) obj);
+  else if (IS_LOGICAL(obj))
+    return logical_to_double(z, (Logical) obj);
+
+  return obj;
 }
 
 /* vector_mtimes(): matrix multiplication function for vectors.
@@ -617,138 +669,45 @@ Object vector_mtimes (Zone z, Object a, Object b) {
     throw(z, ERR_SIZE_MISMATCH_VV(va, vb));
   }
 
-  return vector_times(z, a, b);
+  /* vector * scalar => vector */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a) ||
+      IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_times(z, a, b);
+
+  /* expand ranges and logical arrays, and multiply again. */
+  Object wa = vector_widen(z, a);
+  Object wb = vector_widen(z, b);
+  if (wa == a && wb == b)
+    throw(z, ERR_OBJ_BINARY, "mtimes",
+          MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+
+  Object c = (wa && wb ? object_mtimes(z, wa, wb) : NULL);
+  if (wa && wa != a) object_free(z, wa);
+  if (wb && wb != b) object_free(z, wb);
+  return c;
 }
 
-/* FIXME: implement vector division functions. */
-
-/* vector_power(): element-wise exponentiation function for vectors.
+/* vector_mrdivide(): matrix right division function for vectors.
  */
-Object vector_power (Zone z, Object a, Object b) {
-  if (IS_VECTOR(a)) {
-    if (IS_VECTOR(b)) {
-      Vector va = (Vector) a;
-      Vector vb = (Vector) b;
-
-      if (va->tr == vb->tr) {
-        /* column .^ column => column
-         * row    .^ row    => row
-         */
-        if (va->n != vb->n)
-          throw(z, ERR_SIZE_MISMATCH_VV(va, vb));
-
-        Vector vc = vector_new_with_length(z, va->n);
-        vc->tr = va->tr;
-        if (vc) {
-          for (long i = 0; i < vc->n; i++)
-            vector_set(vc, i, pow(vector_get(va, i), vector_get(vb, i)));
-
-          return (Object) vc;
-        }
-      }
-      else if (va->tr == CblasNoTrans) {
-        /* column .^ row => matrix */
-        Matrix A = matrix_new_with_size(z, va->n, vb->n);
-        if (A) {
-          for (long i = 0; i < A->m; i++)
-            for (long j = 0; j < A->n; j++)
-              matrix_set(A, i, j, pow(vector_get(va, i),
-                                      vector_get(vb, j)));
-
-          return (Object) A;
-        }
-      }
-    }
-    else if (IS_COMPLEX(b)) {
-      /* vector .^ complex => complex vector */
-      ComplexVector v = complex_vector_new_from_vector(z, (Vector) a);
-      complex double fval = complex_get_value((Complex) b);
-      if (complex_vector_pow_const(v, fval))
-        return (Object) v;
-    }
-    else if (IS_FLOAT(b)) {
-      /* vector .^ float => vector */
-      Vector v = vector_copy(z, (Vector) a);
-      double fval = float_get_value((Float) b);
-      if (vector_pow_const(v, fval))
-        return (Object) v;
-    }
-    else if (IS_INT(b)) {
-      /* vector .^ int => vector */
-      Vector v = vector_copy(z, (Vector) a);
-      double fval = int_get_value((Int) b);
-      if (vector_pow_const(v, fval))
-        return (Object) v;
-    }
-  }
-  else if (IS_VECTOR(b)) {
-    if (IS_COMPLEX(a)) {
-      /* complex .^ vector => complex vector */
-      ComplexVector v = complex_vector_new_from_vector(z, (Vector) b);
-      complex double fval = complex_get_value((Complex) a);
-      if (complex_vector_const_pow(fval, v))
-        return (Object) v;
-    }
-    else if (IS_FLOAT(a)) {
-      /* float .^ vector => vector */
-      Vector v = vector_copy(z, (Vector) b);
-      double fval = float_get_value((Float) a);
-      if (vector_const_pow(fval, v))
-        return (Object) v;
-    }
-    else if (IS_INT(a)) {
-      /* int .^ vector => vector */
-      Vector v = vector_copy(z, (Vector) b);
-      double fval = int_get_value((Int) a);
-      if (vector_const_pow(fval, v))
-        return (Object) v;
-    }
-  }
+Object vector_mrdivide (Zone z, Object a, Object b) {
+  /* vector / scalar => vector */
+  if (IS_FLOAT(b) || IS_INT(b) || IS_COMPLEX(b))
+    return broadcast_rdivide(z, a, b);
 
-  return NULL;
+  throw(z, ERR_OBJ_BINARY, "mrdivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
 }
 
-/* vector_lt(): less-than comparison operation for vectors. */
-#define F lt
-#define OP <
-#include "vector-cmp.c"
-
-/* vector_gt(): greater-than comparison operation for vectors. */
-#define F gt
-#define OP >
-#include "vector-cmp.c"
-
-/* vector_le(): less-than or equal-to comparison operation for vectors. */
-#define F le
-#define OP <=
-#include "vector-cmp.c"
-
-/* vector_ge(): greater-than or equal-to comparison operation for vectors. */
-#define F ge
-#define OP >=
-#include "vector-cmp.c"
-
-/* vector_ne(): inequality comparison operation for vectors. */
-#define CMPEQ
-#define F ne
-#define OP !=
-#include "vector-cmp.c"
-
-/* vector_eq(): equality comparison operation for vectors. */
-#define CMPEQ
-#define F eq
-#define OP ==
-#include "vector-cmp.c"
-
-/* vector_and(): element-wise logical-and operation for vectors. */
-#define F and
-#define OP &&
-#include "vector-cmp.c"
-
-/* vector_or(): element-wise logical-or operation for vectors. */
-#define F or
-#define OP ||
-#include "vector-cmp.c"
+/* vector_mldivide(): matrix left division function for vectors.
+ */
+Object vector_mldivide (Zone z, Object a, Object b) {
+  /* scalar \ vector => vector */
+  if (IS_FLOAT(a) || IS_INT(a) || IS_COMPLEX(a))
+    return broadcast_ldivide(z, a, b);
+
+  throw(z, ERR_OBJ_BINARY, "mldivide",
+        MATTE_TYPE(a)->name, MATTE_TYPE(b)->name);
+}
 
 /* vector_mand(): matrix logical-and operation for vectors.
  */
@@ -844,18 +803,20 @@ Int vector_mor (Zone z, Object a, Object b) {
 
 /* vector_not(): logical negation operation for vectors.
  */
-Vector vector_not (Zone z, Vector a) {
-  Vector x = vector_copy(z, a);
+Logical vector_not (Zone z, Vector a) {
+  Logical x = (a->tr == CblasNoTrans ? logical_new_with_size(z, a->n, 1) :
+                                       logical_new_with_size(z, 1, a->n));
   if (!x)
     return NULL;
 
-  for (long i = 0; i < x->n; i++)
-    vector_set(x, i, !vector_get(x, i));
-
+  const double zero = 0.0;
+  simd_compare(SIMD_EQ, a->n, a->data, 1, &zero, 0, x->data);
+  x->mat = 0;
   return x;
 }
 
-/* vector_transpose(): transposition function for vectors.
+/* vector_transpose(): transposition function for vectors. the
+ * transposed vector shares the data of its operand.
  */
 Vector vector_transpose (Zone z, Vector a) {
   Vector atr = vector_copy(z, a);
@@ -872,6 +833,165 @@ Vector vector_transpose (Zone z, Vector a) {
   return atr;
 }
 
+/* vector_cat_arg(): describe an argument of a vector concatenation.
+ *
+ * arguments:
+ *  @obj: argument to describe.
+ *  @len: number of elements in the argument, on return.
+ *  @row: shape of the argument, on return: a row (1), a column (0) or
+ *        a single element (-1).
+ *
+ * returns:
+ *  integer indicating whether (1) or not (0) the argument is a supported
+ *  type.
+ */
+static int vector_cat_arg (Object obj, long *len, int *row) {
+  if (IS_INT(obj) || IS_FLOAT(obj))
+    *len = 1;
+  else if (IS_RANGE(obj))
+    *len = range_get_length((Range) obj);
+  else if (IS_FLOAT_RANGE(obj))
+    *len = float_range_get_length((FloatRange) obj);
+  else if (IS_VECTOR(obj))
+    *len = ((Vector) obj)->n;
+  else if (IS_LOGICAL(obj) && !((Logical) obj)->mat)
+    *len = logical_get_length((Logical) obj);
+  else
+    return 0;
+
+  *row = (*len == 1 ? -1 :
+          IS_VECTOR(obj) ? ((Vector) obj)->tr != CblasNoTrans :
+          IS_LOGICAL(obj) ? ((Logical) obj)->m == 1 : 1);
+
+  return 1;
+}
+
+/* vector_cat_get(): get an element of a vector concatenation argument.
+ */
+static double vector_cat_get (Object obj, long i) {
+  if (IS_INT(obj))
+    return (double) int_get_value((Int) obj);
+  else if (IS_FLOAT(obj))
+    return float_get_value((Float) obj);
+  else if (IS_RANGE(obj))
+    return (double) range_get_element((Range) obj, i);
+  else if (IS_FLOAT_RANGE(obj))
+    return float_range_get_element((FloatRange) obj, i);
+  else if (IS_LOGICAL(obj))
+    return (double) logical_get((Logical) obj, i);
+
+  return vector_get((Vector) obj, i);
+}
+
+/* vector_cat(): concatenate real scalars, ranges, logical vectors and
+ * vectors. arguments that lie along the direction of concatenation are
+ * joined into a vector, and arguments of one common length that lie
+ * across it are stacked into a matrix. empty arguments are skipped.
+ *
+ * arguments:
+ *  @z: zone allocator to utilize.
+ *  @n: number of arguments.
+ *  @vl: list of arguments.
+ *  @vert: whether to concatenate vertically (1) or horizontally (0).
+ *
+ * returns:
+ *  newly allocated vector or matrix, or null on failure.
+ */
+static Object vector_cat (Zone z, int n, va_list vl, int vert) {
+  /* check the arguments and sum their lengths. */
+  va_list vc;
+  va_copy(vc, vl);
+  long total = 0, across = -1, m = 0;
+  int along = 1;
+  for (int i = 0; i < n; i++) {
+    Object obj = va_arg(vc, Object);
+    long len;
+    int row;
+    if (!vector_cat_arg(obj, &len, &row)) {
+      va_end(vc);
+      fail(ERR_OBJ_VARIADIC, vert ? "vertcat" : "horzcat",
+           MATTE_TYPE(obj)->name);
+    }
+
+    if (!len)
+      continue;
+
+    /* track whether the arguments lie along or across the direction. */
+    if (row >= 0 && row == vert)
+      along = 0;
+
+    if (across < 0)
+      across = len;
+    else if (across != len || (row >= 0 && row != vert))
+      across = 0;
+
+    total += len;
+    m++;
+  }
+
+  va_end(vc);
+
+  if (along) {
+    /* join the arguments into a vector. */
+    Vector x = vector_new_with_length(z, total);
+    if (!x)
+      return NULL;
+
+    for (int i = 0, k = 0; i < n; i++) {
+      Object obj = va_arg(vl, Object);
+      long len;
+      int row;
+      vector_cat_arg(obj, &len, &row);
+      for (long j = 0; j < len; j++)
+        x->data[k++] = vector_cat_get(obj, j);
+    }
+
+    x->tr = (vert ? CblasNoTrans : CblasTrans);
+    return (Object) x;
+  }
+
+  if (across <= 0)
+    fail(ERR_SIZE_MISMATCH);
+
+  /* stack the arguments into the rows or columns of a matrix. */
+  Matrix A = (vert ? matrix_new_with_size(z, m, across) :
+                     matrix_new_with_size(z, across, m));
+  if (!A)
+    return NULL;
+
+  for (long i = 0, k = 0; i < n; i++) {
+    Object obj = va_arg(vl, Object);
+    long len;
+    int row;
+    vector_cat_arg(obj, &len, &row);
+    if (!len)
+      continue;
+
+    for (long j = 0; j < len; j++) {
+      if (vert)
+        matrix_set(A, k, j, vector_cat_get(obj, j));
+      else
+        matrix_set(A, j, k, vector_cat_get(obj, j));
+    }
+
+    k++;
+  }
+
+  return (Object) A;
+}
+
+/* vector_horzcat(): horizontal concatenation function for vectors.
+ */
+Object vector_horzcat (Zone z, int n, va_list vl) {
+  return vector_cat(z, n, vl, 0);
+}
+
+/* vector_vertcat(): vertical concatenation function for vectors.
+ */
+Object vector_vertcat (Zone z, int n, va_list vl) {
+  return vector_cat(z, n, vl, 1);
+}
+
 /* Vector_type: object type structure for matte vectors.
  */
 struct _ObjectType Vector_type = {
@@ -885,37 +1005,42 @@ struct _ObjectType Vector_type = {
   (obj_display)     vector_disp,                 /* fn_disp   */
   NULL,                                          /* fn_true   */
 
-  (obj_binary)   vector_plus,                    /* fn_plus       */
-  (obj_binary)   vector_minus,                   /* fn_minus      */
+  (obj_binary)   broadcast_plus,                 /* fn_plus       */
+  (obj_binary)   broadcast_minus,                /* fn_minus      */
   (obj_unary)    vector_uminus,                  /* fn_uminus     */
-  (obj_binary)   vector_times,                   /* fn_times      */
+  (obj_binary)   broadcast_times,                /* fn_times      */
   (obj_binary)   vector_mtimes,                  /* fn_mtimes     */
-  NULL,                                          /* fn_rdivide    */
-  NULL,                                          /* fn_ldivide    */
-  NULL,                                          /* fn_mrdivide   */
-  NULL,                                          /* fn_mldivide   */
-  (obj_binary)   vector_power,                   /* fn_power      */
+  (obj_binary)   broadcast_rdivide,              /* fn_rdivide    */
+  (obj_binary)   broadcast_ldivide,              /* fn_ldivide    */
+  (obj_binary)   vector_mrdivide,                /* fn_mrdivide   */
+  (obj_binary)   vector_mldivide,                /* fn_mldivide   */
+  (obj_binary)   broadcast_power,                /* fn_power      */
   NULL,                                          /* fn_mpower     */
-  (obj_binary)   vector_lt,                      /* fn_lt         */
-  (obj_binary)   vector_gt,                      /* fn_gt         */
-  (obj_binary)   vector_le,                      /* fn_le         */
-  (obj_binary)   vector_ge,                      /* fn_ge         */
-  (obj_binary)   vector_ne,                      /* fn_ne         */
-  (obj_binary)   vector_eq,                      /* fn_eq         */
-  (obj_binary)   vector_and,                     /* fn_and        */
-  (obj_binary)   vector_or,                      /* fn_or         */
+  (obj_binary)   broadcast_lt,                   /* fn_lt         */
+  (obj_binary)   broadcast_gt,                   /* fn_gt         */
+  (obj_binary)   broadcast_le,                   /* fn_le         */
+  (obj_binary)   broadcast_ge,                   /* fn_ge         */
+  (obj_binary)   broadcast_ne,                   /* fn_ne         */
+  (obj_binary)   broadcast_eq,                   /* fn_eq         */
+  (obj_binary)   broadcast_and,                  /* fn_and        */
+  (obj_binary)   broadcast_or,                   /* fn_or         */
   (obj_binary)   vector_mand,                    /* fn_mand       */
   (obj_binary)   vector_mor,                     /* fn_mor        */
   (obj_unary)    vector_not,                     /* fn_not        */
   NULL,                                          /* fn_colon      */
   (obj_unary)    vector_transpose,               /* fn_ctranspose */
   (obj_unary)    vector_transpose,               /* fn_transpose  */
-  NULL,                                          /* fn_horzcat    */
-  NULL,                                          /* fn_vertcat    */
-  NULL,                                          /* fn_subsref    */
+  (obj_variadic) vector_horzcat,                 /* fn_horzcat    */
+  (obj_variadic) vector_vertcat,                 /* fn_vertcat    */
+  (obj_binary)   subscript_ref,                  /* fn_subsref    */
   NULL,                                          /* fn_subsasgn   */
   NULL,                                          /* fn_subsindex  */
 
-  NULL                                           /* methods */
+  (obj_inplace)  vector_plus_inplace,            /* fn_plus_inplace  */
+  (obj_inplace)  vector_minus_inplace,           /* fn_minus_inplace */
+  (obj_inplace)  vector_times_inplace,           /* fn_times_inplace */
+
+  NULL,                                          /* methods */
+  0                                              /* index   */
 };
 
@@ -3,20 +3,172 @@
  * Released under the MIT License
  */
 
-/* include the zone allocator header. */
+/* request posix_memalign() from the standard library. */
+#define _POSIX_C_SOURCE 200112L
+
+/* include the zone allocator and object headers. */
 #include <matte/zone.h>
+#include <matte/object.h>
+
+/* include the required standard c library header. */
+#include <pthread.h>
+
+/* ZONE_CACHE_MAX: maximum number of released slab blocks that are
+ * kept for reuse by subsequently initialized zones.
+ */
+#define ZONE_CACHE_MAX  64
+
+/* ZONE_NEXT(): macro to access the availability link of a released
+ * unit. the link is stored in the second word of the unit, so that
+ * the type pointer of a released unit always reads as null.
+ */
+#define ZONE_NEXT(ptr) \
+  (((void**) (ptr))[1])
+
+/* cache: list of released slab blocks, shared by all zones.
+ * n_cache: number of blocks in the cache.
+ * cache_lock: mutex serializing access to the cache, as zones may be
+ *             initialized and destroyed from multiple threads.
+ */
+static ZoneBlock cache = NULL;
+static unsigned long n_cache = 0;
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* zone_class(): determine the size class index for a requested
+ * allocation size.
+ *
+ * arguments:
+ *  @sz: number of bytes requested.
+ *
+ * returns:
+ *  size class index, or ZONE_LARGE if no class holds the size.
+ */
+static inline unsigned int zone_class (unsigned long sz) {
+  /* find the smallest class with sufficiently large units. */
+  unsigned int c = 0;
+  unsigned long unit = ZONE_UNIT_MIN;
+  while (unit < sz && c < ZONE_LARGE) {
+    unit <<= 1;
+    c++;
+  }
+
+  /* return the class index. */
+  return c;
+}
+
+/* zone_block_alloc(): allocate an aligned slab block of memory for use
+ * by a zone allocator.
+ *
+ * returns:
+ *  pointer to the newly allocated block, or null on failure.
+ */
+static ZoneBlock zone_block_alloc (void) {
+  /* use a cached block if one is available. */
+  pthread_mutex_lock(&cache_lock);
+  ZoneBlock b = cache;
+  if (b) {
+    cache = b->next;
+    n_cache--;
+  }
+
+  pthread_mutex_unlock(&cache_lock);
+  if (b)
+    return b;
+
+  /* allocate a new block, aligned to the block size. */
+  void *ptr = NULL;
+  if (posix_memalign(&ptr, ZONE_BLOCK_SIZE, ZONE_BLOCK_SIZE))
+    return NULL;
+
+  /* return the new block. */
+  return (ZoneBlock) ptr;
+}
 
-/* ZONE_UNIT: number of bytes per unit of memory returned by a zone
- * allocator. must be greater than the size of any matte object
- * that the zone is expected to handle.
+/* zone_block_release(): release a slab block, either into the block
+ * cache or back to the system.
+ *
+ * arguments:
+ *  @b: pointer to the block to release.
  */
-#define ZONE_UNIT  64
+static void zone_block_release (ZoneBlock b) {
+  /* place the block into the cache, unless the cache is full. */
+  pthread_mutex_lock(&cache_lock);
+  const int cached = (n_cache < ZONE_CACHE_MAX);
+  if (cached) {
+    b->next = cache;
+    b->zone = NULL;
+    cache = b;
+    n_cache++;
+  }
+
+  pthread_mutex_unlock(&cache_lock);
+
+  /* otherwise, free the block. */
+  if (!cached)
+    free(b);
+}
+
+/* zone_class_release(): release all blocks held by a size class.
+ *
+ * arguments:
+ *  @cls: pointer to the size class to release.
+ */
+static void zone_class_release (struct _ZoneClass *cls) {
+  /* release each block of the class. */
+  ZoneBlock b = cls->head;
+  while (b) {
+    ZoneBlock bnext = b->next;
+    zone_block_release(b);
+    b = bnext;
+  }
+
+  /* empty the class. */
+  cls->head = cls->tail = NULL;
+  cls->avail = NULL;
+}
+
+/* zone_large_release(): free all blocks in a list of large blocks.
+ *
+ * arguments:
+ *  @b: first block of the list to free.
+ */
+static void zone_large_release (ZoneBlock b) {
+  /* free each block of the list. */
+  while (b) {
+    ZoneBlock bnext = b->next;
+    free(b);
+    b = bnext;
+  }
+}
+
+/* zone_swap_stage(): exchange the current size classes and large blocks
+ * of a zone allocator with those of its staging area.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to modify.
+ */
+static void zone_swap_stage (Zone z) {
+  /* swap the size classes. */
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++) {
+    struct _ZoneClass cls = z->cls[c];
+    z->cls[c] = z->stage[c];
+    z->stage[c] = cls;
+  }
+
+  /* swap the large block lists. */
+  ZoneBlock b = z->large;
+  z->large = z->stage_large;
+  z->stage_large = b;
+}
 
 /* zone_init(): initialize the contents of a zone allocator structure.
+ *
+ * blocks are reserved on demand from a shared cache of released blocks,
+ * so the number of units is only a hint and no memory is reserved here.
  *
  * arguments:
  *  @z: pointer to the zone structure to initialize.
- *  @n: number of units to reserve for allocation.
+ *  @n: number of units expected to be allocated.
  *
  * returns:
  *  integer indicating success (1) or failure (0).
@@ -25,119 +177,171 @@ int zone_init (Zone z, unsigned long n) {
   /* fail if the zone pointer is null. */
   if (!z) return 0;
 
-  /* initialize the zone data block and availability array. */
-  z->data = NULL;
-  z->av = NULL;
-
-  /* initialize the zone size information. */
-  z->n = z->nav = 0;
-
-  /* initialize the zone chain pointer. */
-  z->next = NULL;
+  /* initialize the block lists of each size class. */
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++) {
+    z->cls[c].head = z->cls[c].tail = NULL;
+    z->cls[c].avail = NULL;
+  }
 
-  /* allocate the zone data block. */
-  z->data = malloc(n * ZONE_UNIT);
-  if (!z->data)
-    return 0;
+  /* initialize the large block list. */
+  z->large = NULL;
 
-  /* allocate the zone availability array. */
-  z->av = (unsigned long*) malloc(n * sizeof(unsigned long));
-  if (!z->av)
-    return 0;
+  /* initialize the mark stack. */
+  z->frames = NULL;
+  z->depth = z->n_frames = 0;
 
-  /* initialize the contents of the data block. */
-  memset(z->data, 0, n * ZONE_UNIT);
+  /* initialize the staging area. */
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++) {
+    z->stage[c].head = z->stage[c].tail = NULL;
+    z->stage[c].avail = NULL;
+  }
 
-  /* initialize the contents of the availability array. */
-  for (unsigned long i = 0; i < n; i++)
-    z->av[i] = i;
+  z->stage_large = NULL;
 
-  /* store the size information into the zone. */
-  z->dend = ((char*) z->data) + (n * ZONE_UNIT);
-  z->n = z->nav = n;
+  /* zones are initially unlocked. */
+  z->locked = 0;
 
   /* return success. */
   return 1;
 }
 
-/* zone_alloc(): return a new unit of memory from a zone allocator.
- *
- * if the zone contains no available units, then a new block will be
- * added to the zone, and the new unit will be returned from the new
- * block.
+/* zone_alloc_large(): return a new unit of memory that is too large
+ * for any size class of a zone allocator. the unit is held in its own
+ * block from malloc(), which is not aligned to the slab block size.
  *
  * arguments:
  *  @z: pointer to the zone structure to utilize.
+ *  @sz: number of bytes to allocate.
  *
  * returns:
- *  pointer into a previously unused location of the zone's data chunk.
- */
-void *zone_alloc (Zone z) {
-  /* declare required variables:
-   *  @i: unit index for the new pointer.
-   *  @n: zone unit count for expansion.
-   *  @sz: memory block size.
-   *  @ptr: unit pointer.
+ *  pointer to a zero-initialized unit of memory.
+ */
+static void *zone_alloc_large (Zone z, unsigned long sz) {
+  /* allocate a dedicated block for the unit. the block address is
+   * aligned to at least twice the tag offset, so the unit address is
+   * an odd multiple of the tag.
    */
-  unsigned long i, n, sz;
-  Zone zsrc;
-  void *ptr;
+  ZoneBlock b = (ZoneBlock) malloc(ZONE_HEADER + ZONE_LARGE_TAG + sz);
+  if (!b)
+    return NULL;
+
+  /* initialize the block header. */
+  b->zone = z;
+  b->cls = ZONE_LARGE;
+  b->depth = z->depth;
+  b->unit = sz;
+  b->n = b->used = 1;
+
+  /* link the block into the head of the large block list. */
+  b->prev = NULL;
+  b->next = z->large;
+  if (z->large)
+    z->large->prev = b;
+
+  z->large = b;
+
+  /* initialize and return the unit. */
+  memset(ZONE_LARGE_UNIT(b), 0, sz);
+  return ZONE_LARGE_UNIT(b);
+}
 
+/* zone_alloc(): return a new unit of memory from a zone allocator.
+ *
+ * previously released units of the matching size class are reused
+ * first. otherwise, the unit is taken from the newest block of the
+ * class, and a new block is added to the class if it is full.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ *  @sz: number of bytes required by the unit.
+ *
+ * returns:
+ *  pointer to a zero-initialized unit of memory from the zone.
+ */
+void *zone_alloc (Zone z, unsigned long sz) {
   /* use malloc() if the zone pointer is null. */
   if (!z)
-    return malloc(ZONE_UNIT);
-
-  /* locate the first non-empty zone block. */
-  zsrc = z;
-  while (!zsrc->nav && zsrc->next)
-    zsrc = zsrc->next;
-
-  /* check if no blocks are non empty. */
-  if (!zsrc->nav) {
-    /* reserve a slightly larger block than the previous one. */
-    n = zsrc->nav;
-    n += (n >> 3) + (n < 9 ? 3 : 6);
-
-    /* allocate a pointer to the next block. */
-    sz = sizeof(ZoneData) + (n * (ZONE_UNIT + sizeof(unsigned long)));
-    zsrc->next = (Zone) malloc(sz);
-    if (!zsrc->next)
-      return NULL;
-
-    /* move to the newly allocated block. */
-    zsrc = zsrc->next;
-    zsrc->next = NULL;
-
-    /* set the zone data pointers into the allocated block. */
-    zsrc->data = ((char*) zsrc) + sizeof(ZoneData);
-    zsrc->dend = ((char*) zsrc->data) + (n * ZONE_UNIT);
-    zsrc->n = n;
-
-    /* set the availability array pointer into the allocated block. */
-    zsrc->av = (unsigned long*) zsrc->dend;
-    zsrc->nav = n;
+    return malloc(sz);
+
+  /* determine the size class of the request. */
+  const unsigned int c = zone_class(sz);
+  if (c == ZONE_LARGE)
+    return zone_alloc_large(z, sz);
+
+  /* check if a released unit is available. */
+  struct _ZoneClass *cls = z->cls + c;
+  void *ptr = cls->avail;
+  if (ptr) {
+    /* unlink the unit from the availability list. */
+    cls->avail = ZONE_NEXT(ptr);
+    ZONE_NEXT(ptr) = NULL;
+
+    /* return the released unit. */
+    return ptr;
+  }
 
-    /* initialize the contents of the data block. */
-    memset(zsrc->data, 0, n * ZONE_UNIT);
+  /* check if the newest block of the class is exhausted. */
+  ZoneBlock b = cls->tail;
+  if (!b || b->used == b->n) {
+    /* allocate a new block. */
+    b = zone_block_alloc();
+    if (!b)
+      return NULL;
 
-    /* initialize the contents of the availability array. */
-    for (unsigned long i = 0; i < n; i++)
-      zsrc->av[i] = i;
+    /* initialize the block header. */
+    b->zone = z;
+    b->cls = c;
+    b->depth = z->depth;
+    b->unit = ZONE_UNIT_MIN << c;
+    b->n = (ZONE_BLOCK_SIZE - ZONE_HEADER) / b->unit;
+    b->used = 0;
+
+    /* link the block into the tail of the class. */
+    b->next = NULL;
+    b->prev = cls->tail;
+    if (cls->tail)
+      cls->tail->next = b;
+    else
+      cls->head = b;
+
+    cls->tail = b;
   }
 
-  /* get the first available unit index. */
-  i = zsrc->av[0];
-  ptr = ((char*) zsrc->data) + (i * ZONE_UNIT);
+  /* take the next unused unit from the block. */
+  ptr = ZONE_UNITS(b) + b->used * b->unit;
+  b->used++;
 
-  /* swap in a new unit index for the next allocation. */
-  zsrc->av[0] = zsrc->av[zsrc->nav - 1];
-  zsrc->nav--;
-
-  /* return the new pointer. */
+  /* initialize and return the unit. */
+  memset(ptr, 0, b->unit);
   return ptr;
 }
 
+/* zone_large_unlink(): remove a dedicated block from the large block
+ * list of its owning zone allocator.
+ *
+ * arguments:
+ *  @b: pointer to the block to unlink.
+ */
+static void zone_large_unlink (ZoneBlock b) {
+  /* unlink the block from either the current or the staged list. */
+  Zone z = b->zone;
+  if (b->prev)
+    b->prev->next = b->next;
+  else if (z->stage_large == b)
+    z->stage_large = b->next;
+  else
+    z->large = b->next;
+
+  if (b->next)
+    b->next->prev = b->prev;
+
+  b->next = b->prev = NULL;
+}
+
 /* zone_free(): release a unit of memory back to a zone allocator.
+ *
+ * the owning block is located by masking the unit address, so the
+ * unit is always released into the zone that allocated it.
  *
  * arguments:
  *  @z: pointer to the zone structure to utilize.
@@ -153,27 +357,39 @@ void zone_free (Zone z, void *ptr) {
     return;
   }
 
-  /* loop until the correct block is identified. */
-  Zone zsrc = z;
-  while (zsrc) {
-    /* check if the pointer is within the current block. */
-    if (ptr >= zsrc->data && ptr < zsrc->dend) {
-      /* compute the offset of the pointer in the zone data block. */
-      const unsigned long i = ((char*) ptr - (char*) zsrc->data) / ZONE_UNIT;
+  /* locate the block and zone that own the unit. */
+  ZoneBlock b = ZONE_BLOCK(ptr);
+  z = b->zone;
 
-      /* place the offset back into the availability array. */
-      zsrc->av[zsrc->nav++] = i;
+  /* units of locked zones are never released. */
+  if (z->locked)
+    return;
 
-      /* re-initialize the released memory. */
-      memset(ptr, 0, ZONE_UNIT);
+  /* check if the unit is held in a dedicated block. */
+  if (b->cls == ZONE_LARGE) {
+    /* unlink and free the block. */
+    zone_large_unlink(b);
+    free(b);
+    return;
+  }
 
-      /* the pointer is freed. return without checking the next blocks. */
-      return;
-    }
+  /* re-initialize the released memory. */
+  memset(ptr, 0, b->unit);
 
-    /* no dice. move to the next block. */
-    zsrc = zsrc->next;
-  }
+  /* units of blocks added after the current mark depth are reclaimed
+   * along with their blocks, and are not made available again.
+   */
+  if (b->depth > z->depth)
+    return;
+
+  /* place the unit into the availability list of its class, which
+   * may be held in a saved frame if a mark was placed after the block
+   * was added.
+   */
+  struct _ZoneClass *cls = (b->depth == z->depth ? z->cls :
+                            z->frames[b->depth].cls) + b->cls;
+  ZONE_NEXT(ptr) = cls->avail;
+  cls->avail = ptr;
 }
 
 /* zone_destroy(): release all allocated memory associated with a zone
@@ -188,23 +404,351 @@ void zone_destroy (Zone z) {
   /* return if the zone pointer is null. */
   if (!z) return;
 
-  /* reset the data sizes. */
-  z->n = z->nav = 0;
+  /* release the blocks of each size class, and of each saved frame. */
+  for (unsigned int d = 0; d <= z->depth; d++) {
+    struct _ZoneClass *cls = (d == z->depth ? z->cls : z->frames[d].cls);
+    for (unsigned int c = 0; c < ZONE_CLASSES; c++)
+      zone_class_release(cls + c);
+  }
+
+  /* release the blocks of the staging area. */
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++)
+    zone_class_release(z->stage + c);
+
+  /* free the mark stack. */
+  free(z->frames);
 
-  /* free the zone data. */
-  free(z->data);
-  z->data = NULL;
-  z->dend = NULL;
+  /* free the large blocks, and the large blocks of the staging area. */
+  zone_large_release(z->large);
+  zone_large_release(z->stage_large);
 
-  /* free the availability array. */
-  free(z->av);
-  z->av = NULL;
+  /* re-initialize the zone structure. */
+  zone_init(z, 0);
+}
 
-  /* free the next block. */
-  if (z->next) {
-    zone_destroy(z->next);
-    free(z->next);
-    z->next = NULL;
+/* zone_mark(): place a mark in a zone allocator. all units allocated
+ * after the mark are held in new blocks, which are reclaimed in a single
+ * step by zone_release(). marks may be nested.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ *
+ * returns:
+ *  handle to the new mark, or zero on failure.
+ */
+ZoneMark zone_mark (Zone z) {
+  /* return zero if the zone pointer is null. */
+  if (!z) return 0;
+
+  /* check if the mark stack requires expansion. */
+  if (z->depth == z->n_frames) {
+    /* reallocate the mark stack. */
+    const unsigned int n = 2 * z->n_frames + 4;
+    struct _ZoneFrame *frames = (struct _ZoneFrame*)
+      realloc(z->frames, n * sizeof(struct _ZoneFrame));
+
+    /* check if reallocation failed. */
+    if (!frames)
+      return 0;
+
+    /* store the new mark stack. */
+    z->frames = frames;
+    z->n_frames = n;
+  }
+
+  /* save the current size classes and start new ones. */
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++) {
+    z->frames[z->depth].cls[c] = z->cls[c];
+    z->cls[c].head = z->cls[c].tail = NULL;
+    z->cls[c].avail = NULL;
+  }
+
+  /* return the new mark depth as the handle. */
+  return ++z->depth;
+}
+
+/* zone_promote(): move a unit allocated after a mark into the staging
+ * area of a zone allocator, so that it survives the next release of the
+ * mark. matte objects are moved using their copy constructor, and all
+ * other units are moved as plain memory.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ *  @m: mark to promote the unit past.
+ *  @ptr: pointer to the unit to promote.
+ *
+ * returns:
+ *  pointer to the promoted unit, or @ptr if no promotion was required.
+ */
+void *zone_promote (Zone z, ZoneMark m, void *ptr) {
+  /* return the unit if it cannot have been allocated after the mark. */
+  if (!z || !ptr || !m || m > z->depth)
+    return ptr;
+
+  /* return the unit if it was allocated before the mark. */
+  ZoneBlock b = ZONE_BLOCK(ptr);
+  if (b->zone != z || b->depth < m)
+    return ptr;
+
+  /* allocate from the staging area, into blocks that will belong
+   * to the mark after its release.
+   */
+  const unsigned int depth = z->depth;
+  zone_swap_stage(z);
+  z->depth = m;
+
+  /* move the unit into the staging area. */
+  Object obj = (Object) ptr;
+  void *pnew = NULL;
+  if (b->cls != ZONE_LARGE && MATTE_TYPE(obj) && MATTE_TYPE(obj)->fn_copy) {
+    /* duplicate the object. */
+    pnew = MATTE_TYPE(obj)->fn_copy(z, obj);
+  }
+  else {
+    /* duplicate the unit memory. */
+    pnew = zone_alloc(z, b->unit);
+    if (pnew) {
+      memcpy(pnew, ptr, b->unit);
+      memset(ptr, 0, b->unit);
+    }
+  }
+
+  /* return to allocating from the current size classes. */
+  z->depth = depth;
+  zone_swap_stage(z);
+
+  /* return the promoted unit. */
+  return (pnew ? pnew : ptr);
+}
+
+/* zone_promote_vars(): promote the values of a set of variables past
+ * a mark. each distinct unit is promoted only once, so variables that
+ * alias the same unit continue to share it after promotion.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ *  @m: mark to promote the units past.
+ *  @n: number of variables to promote.
+ *  @vars: array of pointers to each (Object) variable.
+ */
+void zone_promote_vars (Zone z, ZoneMark m, int n, void *vars[]) {
+  for (int i = 0; i < n; i++) {
+    /* promote the value of the variable. */
+    Object *var = (Object*) vars[i];
+    Object ptr = *var;
+    Object pnew = (Object) zone_promote(z, m, ptr);
+    if (pnew == ptr)
+      continue;
+
+    /* update every later variable that aliases the same unit. */
+    for (int j = i; j < n; j++) {
+      Object *alias = (Object*) vars[j];
+      if (*alias == ptr)
+        *alias = pnew;
+    }
+  }
+}
+
+/* zone_adopt(): move a unit out of the zone allocator that owns it and
+ * into another zone allocator. dedicated blocks are relinked into the
+ * new zone without copying, and slab units are moved as plain memory,
+ * so any heap memory referenced by the unit changes hands unchanged.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to move the unit into.
+ *  @ptr: pointer to the unit to move, which must have been allocated
+ *        from a zone allocator.
+ *
+ * returns:
+ *  pointer to the moved unit, or null on failure, in which case the
+ *  unit is left in its original zone.
+ */
+void *zone_adopt (Zone z, void *ptr) {
+  /* return null if either argument is null. */
+  if (!z || !ptr)
+    return NULL;
+
+  /* return the unit if it already belongs to the zone. */
+  ZoneBlock b = ZONE_BLOCK(ptr);
+  if (b->zone == z)
+    return ptr;
+
+  /* check if the unit is held in a dedicated block. */
+  if (b->cls == ZONE_LARGE) {
+    /* unlink the block from its zone. */
+    zone_large_unlink(b);
+
+    /* link the block into the head of the new large block list. */
+    b->zone = z;
+    b->depth = z->depth;
+    b->next = z->large;
+    if (z->large)
+      z->large->prev = b;
+
+    z->large = b;
+    return ptr;
   }
+
+  /* allocate a unit of the same class from the new zone. */
+  void *pnew = zone_alloc(z, b->unit);
+  if (!pnew)
+    return NULL;
+
+  /* move the unit memory and release the original unit. */
+  memcpy(pnew, ptr, b->unit);
+  zone_free(b->zone, ptr);
+
+  /* return the moved unit. */
+  return pnew;
+}
+
+/* zone_sweep_frame(): destruct and free all units allocated after the
+ * innermost mark of a zone allocator, or all units allocated before
+ * the first mark if the zone holds no marks.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ */
+static void zone_sweep_frame (Zone z) {
+  /* loop over the blocks of each size class. */
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++) {
+    for (ZoneBlock b = z->cls[c].head; b; b = b->next) {
+      /* loop over all units handed out from the block. */
+      char *ptr = ZONE_UNITS(b);
+      for (unsigned long i = 0; i < b->used; i++, ptr += b->unit) {
+        /* released units have null types, and are skipped. */
+        if (MATTE_TYPE(ptr))
+          object_free(z, ptr);
+      }
+    }
+  }
+
+  /* free the units held in large blocks of the innermost mark. each
+   * release unlinks its block, so the scan restarts from the head.
+   */
+  ZoneBlock b = z->large;
+  while (b) {
+    /* skip blocks added before the innermost mark. */
+    if (b->depth < z->depth) {
+      b = b->next;
+      continue;
+    }
+
+    /* free the unit and restart the scan. */
+    void *ptr = ZONE_LARGE_UNIT(b);
+    if (MATTE_TYPE(ptr))
+      object_free(z, ptr);
+    else
+      zone_free(z, ptr);
+
+    b = z->large;
+  }
+}
+
+/* zone_pop_frame(): release the blocks held after the innermost mark
+ * of a zone allocator, and restore the size classes that were saved
+ * when the mark was placed.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ */
+static void zone_pop_frame (Zone z) {
+  /* release the blocks and remove the mark. */
+  z->depth--;
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++) {
+    zone_class_release(z->cls + c);
+    z->cls[c] = z->frames[z->depth].cls[c];
+  }
+}
+
+/* zone_release(): roll a zone allocator back to a mark, destructing and
+ * freeing all units allocated after the mark, except for those promoted
+ * since the previous release. any marks placed after the specified mark
+ * are removed, and the specified mark is kept in place with only the
+ * promoted units allocated after it.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ *  @m: mark to roll back to.
+ */
+void zone_release (Zone z, ZoneMark m) {
+  /* return if the zone pointer or mark is invalid. */
+  if (!z || !m || m > z->depth)
+    return;
+
+  /* remove all marks placed after the specified mark. */
+  while (z->depth > m) {
+    zone_sweep_frame(z);
+    zone_pop_frame(z);
+  }
+
+  /* empty the blocks held after the specified mark. */
+  zone_sweep_frame(z);
+  for (unsigned int c = 0; c < ZONE_CLASSES; c++)
+    zone_class_release(z->cls + c);
+
+  /* move the promoted units into the emptied blocks. */
+  zone_swap_stage(z);
+  if (z->stage_large) {
+    /* append the remaining large blocks after the promoted ones. */
+    ZoneBlock b = z->large;
+    if (b) {
+      while (b->next)
+        b = b->next;
+
+      b->next = z->stage_large;
+      z->stage_large->prev = b;
+    }
+    else
+      z->large = z->stage_large;
+
+    z->stage_large = NULL;
+  }
+}
+
+/* zone_sweep(): destruct and free all units held by a zone allocator,
+ * and remove all of its marks. the zone remains initialized.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ */
+void zone_sweep (Zone z) {
+  /* return if the zone pointer is null. */
+  if (!z) return;
+
+  /* sweep and remove each mark. */
+  while (z->depth) {
+    zone_sweep_frame(z);
+    zone_pop_frame(z);
+  }
+
+  /* sweep the units allocated before any marks. */
+  zone_sweep_frame(z);
+}
+
+/* zone_lock(): lock a zone allocator, so that its units are treated as
+ * immutable. units may still be allocated from a locked zone, but they
+ * are not released until the zone is destroyed.
+ *
+ * arguments:
+ *  @z: pointer to the zone structure to utilize.
+ */
+void zone_lock (Zone z) {
+  /* lock the zone. */
+  if (z)
+    z->locked = 1;
+}
+
+/* zone_is_locked(): check whether a unit is owned by a locked zone.
+ *
+ * arguments:
+ *  @ptr: pointer to a unit allocated from a zone.
+ *
+ * returns:
+ *  integer indicating whether the unit is immutable (1) or not (0).
+ */
+int zone_is_locked (void *ptr) {
+  /* check the zone that owns the unit. */
+  return (ptr && ZONE_BLOCK(ptr)->zone->locked);
 }
 
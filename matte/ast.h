@@ -43,7 +43,9 @@ enum _ASTNodeType {
   AST_TYPE_FN_ANONY,
   AST_TYPE_FN_CALL,
   AST_TYPE_MD_CALL,
-  AST_TYPE_CTOR
+  AST_TYPE_CTOR,
+  AST_TYPE_BOX,       /* 1015 */
+  AST_TYPE_SUBSREF
 };
 
 /* AST: structure for holding an abstract syntax tree.
@@ -15,9 +15,391 @@
 #include <matte/complex-vector.h>
 #include <matte/complex-matrix.h>
 
-/* include the atlas blas header. */
+/* include the single-precision vector and matrix headers. */
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+
+/* include the cblas header, for its enumerations. */
 #include <cblas.h>
 
+/* BLAS_ENV: name of the environment variable that selects the blas
+ * backend. the value is either the name of a known backend ("generic",
+ * "openblas", "atlas" or "reference") or the path to a shared library
+ * that exports the cblas interface.
+ */
+#define BLAS_ENV "MATTE_BLAS"
+
+/* BlasBackend: pointer to a struct _BlasBackend. */
+typedef struct _BlasBackend *BlasBackend;
+
+/* struct _BlasBackend: table of the blas and lapack routines used by
+ * matte. each routine follows the signature of its cblas (or clapack)
+ * counterpart, and every backend supports column-major storage.
+ */
+struct _BlasBackend {
+  /* @name: name of the backend, or the library it was loaded from. */
+  const char *name;
+
+  /* level 1, double. */
+  void (*daxpy) (const int n, const double alpha, const double *x,
+                 const int incx, double *y, const int incy);
+  void (*dscal) (const int n, const double alpha, double *x,
+                 const int incx);
+  void (*dcopy) (const int n, const double *x, const int incx,
+                 double *y, const int incy);
+  void (*dswap) (const int n, double *x, const int incx,
+                 double *y, const int incy);
+  double (*ddot) (const int n, const double *x, const int incx,
+                  const double *y, const int incy);
+  double (*dnrm2) (const int n, const double *x, const int incx);
+
+  /* level 1, complex double. */
+  void (*zaxpy) (const int n, const void *alpha, const void *x,
+                 const int incx, void *y, const int incy);
+  void (*zscal) (const int n, const void *alpha, void *x,
+                 const int incx);
+  void (*zcopy) (const int n, const void *x, const int incx,
+                 void *y, const int incy);
+  void (*zswap) (const int n, void *x, const int incx,
+                 void *y, const int incy);
+  void (*zdotu_sub) (const int n, const void *x, const int incx,
+                     const void *y, const int incy, void *dotu);
+  void (*zdotc_sub) (const int n, const void *x, const int incx,
+                     const void *y, const int incy, void *dotc);
+  double (*dznrm2) (const int n, const void *x, const int incx);
+
+  /* level 1, single. */
+  void (*saxpy) (const int n, const float alpha, const float *x,
+                 const int incx, float *y, const int incy);
+  void (*sscal) (const int n, const float alpha, float *x,
+                 const int incx);
+  void (*scopy) (const int n, const float *x, const int incx,
+                 float *y, const int incy);
+  void (*sswap) (const int n, float *x, const int incx,
+                 float *y, const int incy);
+  float (*sdot) (const int n, const float *x, const int incx,
+                 const float *y, const int incy);
+  float (*snrm2) (const int n, const float *x, const int incx);
+
+  /* level 2, double. */
+  void (*dgemv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int m, const int n, const double alpha,
+                 const double *A, const int lda,
+                 const double *x, const int incx,
+                 const double beta, double *y, const int incy);
+  void (*dsymv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const double alpha,
+                 const double *A, const int lda,
+                 const double *x, const int incx,
+                 const double beta, double *y, const int incy);
+  void (*dtrmv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const enum CBLAS_DIAG diag, const int n,
+                 const double *A, const int lda,
+                 double *x, const int incx);
+  void (*dtrsv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const enum CBLAS_DIAG diag, const int n,
+                 const double *A, const int lda,
+                 double *x, const int incx);
+  void (*dger) (const enum CBLAS_ORDER order,
+                const int m, const int n, const double alpha,
+                const double *x, const int incx,
+                const double *y, const int incy,
+                double *A, const int lda);
+  void (*dsyr) (const enum CBLAS_ORDER order,
+                const enum CBLAS_UPLO uplo,
+                const int n, const double alpha,
+                const double *x, const int incx,
+                double *A, const int lda);
+  void (*dsyr2) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const double alpha,
+                 const double *x, const int incx,
+                 const double *y, const int incy,
+                 double *A, const int lda);
+
+  /* level 2, complex double. */
+  void (*zgemv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int m, const int n, const void *alpha,
+                 const void *A, const int lda,
+                 const void *x, const int incx,
+                 const void *beta, void *y, const int incy);
+  void (*zhemv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const void *alpha,
+                 const void *A, const int lda,
+                 const void *x, const int incx,
+                 const void *beta, void *y, const int incy);
+  void (*ztrmv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const enum CBLAS_DIAG diag, const int n,
+                 const void *A, const int lda,
+                 void *x, const int incx);
+  void (*ztrsv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const enum CBLAS_DIAG diag, const int n,
+                 const void *A, const int lda,
+                 void *x, const int incx);
+  void (*zgeru) (const enum CBLAS_ORDER order,
+                 const int m, const int n, const void *alpha,
+                 const void *x, const int incx,
+                 const void *y, const int incy,
+                 void *A, const int lda);
+  void (*zgerc) (const enum CBLAS_ORDER order,
+                 const int m, const int n, const void *alpha,
+                 const void *x, const int incx,
+                 const void *y, const int incy,
+                 void *A, const int lda);
+  void (*zher) (const enum CBLAS_ORDER order,
+                const enum CBLAS_UPLO uplo,
+                const int n, const double alpha,
+                const void *x, const int incx,
+                void *A, const int lda);
+  void (*zher2) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const void *alpha,
+                 const void *x, const int incx,
+                 const void *y, const int incy,
+                 void *A, const int lda);
+
+  /* level 2, single. */
+  void (*sgemv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int m, const int n, const float alpha,
+                 const float *A, const int lda,
+                 const float *x, const int incx,
+                 const float beta, float *y, const int incy);
+  void (*ssymv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const float alpha,
+                 const float *A, const int lda,
+                 const float *x, const int incx,
+                 const float beta, float *y, const int incy);
+  void (*strmv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const enum CBLAS_DIAG diag, const int n,
+                 const float *A, const int lda,
+                 float *x, const int incx);
+  void (*strsv) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const enum CBLAS_DIAG diag, const int n,
+                 const float *A, const int lda,
+                 float *x, const int incx);
+  void (*sger) (const enum CBLAS_ORDER order,
+                const int m, const int n, const float alpha,
+                const float *x, const int incx,
+                const float *y, const int incy,
+                float *A, const int lda);
+  void (*ssyr) (const enum CBLAS_ORDER order,
+                const enum CBLAS_UPLO uplo,
+                const int n, const float alpha,
+                const float *x, const int incx,
+                float *A, const int lda);
+  void (*ssyr2) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const float alpha,
+                 const float *x, const int incx,
+                 const float *y, const int incy,
+                 float *A, const int lda);
+
+  /* level 3, double. */
+  void (*dgemm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_TRANSPOSE transB,
+                 const int m, const int n, const int k,
+                 const double alpha, const double *A, const int lda,
+                 const double *B, const int ldb,
+                 const double beta, double *C, const int ldc);
+  void (*dsymm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const int m, const int n,
+                 const double alpha, const double *A, const int lda,
+                 const double *B, const int ldb,
+                 const double beta, double *C, const int ldc);
+  void (*dsyrk) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int n, const int k,
+                 const double alpha, const double *A, const int lda,
+                 const double beta, double *C, const int ldc);
+  void (*dsyr2k) (const enum CBLAS_ORDER order,
+                  const enum CBLAS_UPLO uplo,
+                  const enum CBLAS_TRANSPOSE trans,
+                  const int n, const int k,
+                  const double alpha, const double *A, const int lda,
+                  const double *B, const int ldb,
+                  const double beta, double *C, const int ldc);
+  void (*dtrmm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_DIAG diag,
+                 const int m, const int n,
+                 const double alpha, const double *A, const int lda,
+                 double *B, const int ldb);
+  void (*dtrsm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_DIAG diag,
+                 const int m, const int n,
+                 const double alpha, const double *A, const int lda,
+                 double *B, const int ldb);
+
+  /* level 3, complex double. */
+  void (*zgemm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_TRANSPOSE transB,
+                 const int m, const int n, const int k,
+                 const void *alpha, const void *A, const int lda,
+                 const void *B, const int ldb,
+                 const void *beta, void *C, const int ldc);
+  void (*zsymm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const int m, const int n,
+                 const void *alpha, const void *A, const int lda,
+                 const void *B, const int ldb,
+                 const void *beta, void *C, const int ldc);
+  void (*zhemm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const int m, const int n,
+                 const void *alpha, const void *A, const int lda,
+                 const void *B, const int ldb,
+                 const void *beta, void *C, const int ldc);
+  void (*zsyrk) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int n, const int k,
+                 const void *alpha, const void *A, const int lda,
+                 const void *beta, void *C, const int ldc);
+  void (*zherk) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int n, const int k,
+                 const double alpha, const void *A, const int lda,
+                 const double beta, void *C, const int ldc);
+  void (*zsyr2k) (const enum CBLAS_ORDER order,
+                  const enum CBLAS_UPLO uplo,
+                  const enum CBLAS_TRANSPOSE trans,
+                  const int n, const int k,
+                  const void *alpha, const void *A, const int lda,
+                  const void *B, const int ldb,
+                  const void *beta, void *C, const int ldc);
+  void (*zher2k) (const enum CBLAS_ORDER order,
+                  const enum CBLAS_UPLO uplo,
+                  const enum CBLAS_TRANSPOSE trans,
+                  const int n, const int k,
+                  const void *alpha, const void *A, const int lda,
+                  const void *B, const int ldb,
+                  const double beta, void *C, const int ldc);
+  void (*ztrmm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_DIAG diag,
+                 const int m, const int n,
+                 const void *alpha, const void *A, const int lda,
+                 void *B, const int ldb);
+  void (*ztrsm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_DIAG diag,
+                 const int m, const int n,
+                 const void *alpha, const void *A, const int lda,
+                 void *B, const int ldb);
+
+  /* level 3, single. */
+  void (*sgemm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_TRANSPOSE transB,
+                 const int m, const int n, const int k,
+                 const float alpha, const float *A, const int lda,
+                 const float *B, const int ldb,
+                 const float beta, float *C, const int ldc);
+  void (*ssymm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const int m, const int n,
+                 const float alpha, const float *A, const int lda,
+                 const float *B, const int ldb,
+                 const float beta, float *C, const int ldc);
+  void (*ssyrk) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int n, const int k,
+                 const float alpha, const float *A, const int lda,
+                 const float beta, float *C, const int ldc);
+  void (*ssyr2k) (const enum CBLAS_ORDER order,
+                  const enum CBLAS_UPLO uplo,
+                  const enum CBLAS_TRANSPOSE trans,
+                  const int n, const int k,
+                  const float alpha, const float *A, const int lda,
+                  const float *B, const int ldb,
+                  const float beta, float *C, const int ldc);
+  void (*strmm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_DIAG diag,
+                 const int m, const int n,
+                 const float alpha, const float *A, const int lda,
+                 float *B, const int ldb);
+  void (*strsm) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_SIDE side,
+                 const enum CBLAS_UPLO uplo,
+                 const enum CBLAS_TRANSPOSE transA,
+                 const enum CBLAS_DIAG diag,
+                 const int m, const int n,
+                 const float alpha, const float *A, const int lda,
+                 float *B, const int ldb);
+
+  /* lapack, double. pivot indices are zero-based. */
+  int (*dgetrf) (const enum CBLAS_ORDER order,
+                 const int m, const int n,
+                 double *A, const int lda, int *ipiv);
+  int (*dgetrs) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE trans,
+                 const int n, const int nrhs,
+                 const double *A, const int lda, const int *ipiv,
+                 double *B, const int ldb);
+  int (*dpotrf) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo, const int n,
+                 double *A, const int lda);
+  int (*dpotrs) (const enum CBLAS_ORDER order,
+                 const enum CBLAS_UPLO uplo,
+                 const int n, const int nrhs,
+                 const double *A, const int lda,
+                 double *B, const int ldb);
+};
+
+/* matte_blas: currently selected blas backend. */
+extern BlasBackend matte_blas;
+
+/* blas_generic: backend of portable kernels, used when no optimized
+ * library is available (blas-generic.c).
+ */
+extern struct _BlasBackend blas_generic;
+
+/* function declarations, backend selection (blas-backend.c): */
+
+int blas_backend_load (const char *name);
+
+const char *blas_backend_name (void);
+
 /* function declarations, level 1, double (blas.c): */
 
 int matte_daxpy (double alpha, Vector x, Vector y);
@@ -48,6 +430,20 @@ int matte_zdotc (ComplexVector x, ComplexVector y, complex double *out);
 
 int matte_znrm2 (ComplexVector x, double *out);
 
+/* function declarations, level 1, single (blas.c): */
+
+int matte_saxpy (float alpha, SingleVector x, SingleVector y);
+
+int matte_sscal (float alpha, SingleVector x);
+
+int matte_scopy (SingleVector x, SingleVector y);
+
+int matte_sswap (SingleVector x, SingleVector y);
+
+int matte_sdot (SingleVector x, SingleVector y, float *out);
+
+int matte_snrm2 (SingleVector x, float *out);
+
 /* function declarations, level 2, double (blas.c): */
 
 int matte_dgemv (MatteTranspose trans, double alpha, Matrix A, Vector x,
@@ -92,13 +488,53 @@ int matte_zher2 (MatteTriangle uplo, complex double alpha,
                  ComplexVector x, ComplexVector y,
                  ComplexMatrix A);
 
+/* function declarations, level 2, single (blas.c): */
+
+int matte_sgemv (MatteTranspose trans, float alpha, SingleMatrix A,
+                 SingleVector x, float beta, SingleVector y);
+
+int matte_ssymv (MatteTriangle uplo, float alpha, SingleMatrix A,
+                 SingleVector x, float beta, SingleVector y);
+
+int matte_strmv (MatteTriangle uplo, MatteTranspose trans,
+                 MatteDiagonal diag, SingleMatrix A, SingleVector x);
+
+int matte_strsv (MatteTriangle uplo, MatteTranspose trans,
+                 MatteDiagonal diag, SingleMatrix A, SingleVector x);
+
+int matte_sger (float alpha, SingleVector x, SingleVector y, SingleMatrix A);
+
+int matte_ssyr (MatteTriangle uplo, float alpha, SingleVector x,
+                SingleMatrix A);
+
+int matte_ssyr2 (MatteTriangle uplo, float alpha, SingleVector x,
+                 SingleVector y, SingleMatrix A);
+
 /* function declarations, level 3, double (blas.c): */
 
 int matte_dgemm (MatteTranspose transA, MatteTranspose transB,
                  double alpha, Matrix A, Matrix B,
                  double beta, Matrix C);
 
-/* FIXME */
+int matte_dsymm (MatteSide side, MatteTriangle uplo,
+                 double alpha, Matrix A, Matrix B,
+                 double beta, Matrix C);
+
+int matte_dsyrk (MatteTriangle uplo, MatteTranspose trans,
+                 double alpha, Matrix A,
+                 double beta, Matrix C);
+
+int matte_dsyr2k (MatteTriangle uplo, MatteTranspose trans,
+                  double alpha, Matrix A, Matrix B,
+                  double beta, Matrix C);
+
+int matte_dtrmm (MatteSide side, MatteTriangle uplo,
+                 MatteTranspose transA, MatteDiagonal diag,
+                 double alpha, Matrix A, Matrix B);
+
+int matte_dtrsm (MatteSide side, MatteTriangle uplo,
+                 MatteTranspose transA, MatteDiagonal diag,
+                 double alpha, Matrix A, Matrix B);
 
 /* function declarations, level 3, complex double (blas.c): */
 
@@ -106,7 +542,63 @@ int matte_zgemm (MatteTranspose transA, MatteTranspose transB,
                  complex double alpha, ComplexMatrix A, ComplexMatrix B,
                  complex double beta, ComplexMatrix C);
 
-/* FIXME */
+int matte_zsymm (MatteSide side, MatteTriangle uplo,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                 complex double beta, ComplexMatrix C);
+
+int matte_zhemm (MatteSide side, MatteTriangle uplo,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                 complex double beta, ComplexMatrix C);
+
+int matte_zsyrk (MatteTriangle uplo, MatteTranspose trans,
+                 complex double alpha, ComplexMatrix A,
+                 complex double beta, ComplexMatrix C);
+
+int matte_zherk (MatteTriangle uplo, MatteTranspose trans,
+                 double alpha, ComplexMatrix A,
+                 double beta, ComplexMatrix C);
+
+int matte_zsyr2k (MatteTriangle uplo, MatteTranspose trans,
+                  complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                  complex double beta, ComplexMatrix C);
+
+int matte_zher2k (MatteTriangle uplo, MatteTranspose trans,
+                  complex double alpha, ComplexMatrix A, ComplexMatrix B,
+                  double beta, ComplexMatrix C);
+
+int matte_ztrmm (MatteSide side, MatteTriangle uplo,
+                 MatteTranspose transA, MatteDiagonal diag,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B);
+
+int matte_ztrsm (MatteSide side, MatteTriangle uplo,
+                 MatteTranspose transA, MatteDiagonal diag,
+                 complex double alpha, ComplexMatrix A, ComplexMatrix B);
+
+/* function declarations, level 3, single (blas.c): */
+
+int matte_sgemm (MatteTranspose transA, MatteTranspose transB,
+                 float alpha, SingleMatrix A, SingleMatrix B,
+                 float beta, SingleMatrix C);
+
+int matte_ssymm (MatteSide side, MatteTriangle uplo,
+                 float alpha, SingleMatrix A, SingleMatrix B,
+                 float beta, SingleMatrix C);
+
+int matte_ssyrk (MatteTriangle uplo, MatteTranspose trans,
+                 float alpha, SingleMatrix A,
+                 float beta, SingleMatrix C);
+
+int matte_ssyr2k (MatteTriangle uplo, MatteTranspose trans,
+                  float alpha, SingleMatrix A, SingleMatrix B,
+                  float beta, SingleMatrix C);
+
+int matte_strmm (MatteSide side, MatteTriangle uplo,
+                 MatteTranspose transA, MatteDiagonal diag,
+                 float alpha, SingleMatrix A, SingleMatrix B);
+
+int matte_strsm (MatteSide side, MatteTriangle uplo,
+                 MatteTranspose transA, MatteDiagonal diag,
+                 float alpha, SingleMatrix A, SingleMatrix B);
 
 #endif /* !__MATTE_BLAS_H__ */
 
@@ -0,0 +1,64 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_BROADCAST_H__
+#define __MATTE_BROADCAST_H__
+
+/* include the object header. */
+#include <matte/object.h>
+
+/* broadcast_kernel: function pointer type of strided broadcasting
+ * kernels. each kernel computes @n elements of the form
+ * (a[i*sa] <op> b[i*sb]) into @c, where the increments @sa and @sb are
+ * either one for arrays or zero for scalars, and the element types of
+ * @a, @b and @c depend on the kernel.
+ */
+typedef void (*broadcast_kernel) (long n, const void *a, long sa,
+                                  const void *b, long sb, void *c);
+
+/* broadcast_split_kernel: function pointer type of strided broadcasting
+ * kernels over complex operands in split storage. each kernel computes
+ * the real and imaginary parts of @n result elements into @cr and @ci,
+ * from the parts of its operands. the imaginary parts @ai or @bi of a
+ * real operand are null, and are never accessed.
+ */
+typedef void (*broadcast_split_kernel) (long n,
+  const double *ar, const double *ai, long sa,
+  const double *br, const double *bi, long sb,
+  double *cr, double *ci);
+
+/* function declarations (broadcast.c): */
+
+Object broadcast_plus (Zone z, Object a, Object b);
+
+Object broadcast_minus (Zone z, Object a, Object b);
+
+Object broadcast_times (Zone z, Object a, Object b);
+
+Object broadcast_rdivide (Zone z, Object a, Object b);
+
+Object broadcast_ldivide (Zone z, Object a, Object b);
+
+Object broadcast_power (Zone z, Object a, Object b);
+
+Object broadcast_lt (Zone z, Object a, Object b);
+
+Object broadcast_gt (Zone z, Object a, Object b);
+
+Object broadcast_le (Zone z, Object a, Object b);
+
+Object broadcast_ge (Zone z, Object a, Object b);
+
+Object broadcast_ne (Zone z, Object a, Object b);
+
+Object broadcast_eq (Zone z, Object a, Object b);
+
+Object broadcast_and (Zone z, Object a, Object b);
+
+Object broadcast_or (Zone z, Object a, Object b);
+
+#endif /* !__MATTE_BROADCAST_H__ */
+
@@ -0,0 +1,61 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_BUFFER_H__
+#define __MATTE_BUFFER_H__
+
+/* include the standard library headers. */
+#include <stdlib.h>
+#include <string.h>
+
+/* BUFFER_HEADER: number of bytes reserved before the elements of each
+ * shared buffer for its header. must be at least the size of a buffer
+ * header structure, and a multiple of the largest element alignment.
+ */
+#define BUFFER_HEADER  16
+
+/* BUFFER(): macro to locate the header of a shared buffer from the
+ * address of its first element.
+ */
+#define BUFFER(ptr) \
+  ((Buffer) (((char*) (ptr)) - BUFFER_HEADER))
+
+/* BUFFER_DATA(): macro to get the address of the first element of
+ * a shared buffer from its header.
+ */
+#define BUFFER_DATA(buf) \
+  ((void*) (((char*) (buf)) + BUFFER_HEADER))
+
+/* Buffer: pointer to a struct _Buffer. */
+typedef struct _Buffer *Buffer;
+
+/* _Buffer: structure for holding the header of a reference-counted
+ * element array that may be shared by several numeric objects. the
+ * elements follow the header in memory, and objects hold a pointer
+ * directly to the first element.
+ */
+struct _Buffer {
+  /* @refs: number of objects holding the buffer. objects in zones of
+   * different threads may share a buffer, so the count is only accessed
+   * atomically.
+   */
+  long refs;
+};
+
+/* function declarations (buffer.c): */
+
+void *buffer_resize (void *data, long n, long nnew, size_t sz);
+
+void *buffer_share (void *data);
+
+void *buffer_unshare (void *data, long n, size_t sz);
+
+void buffer_release (void *data);
+
+int buffer_is_shared (void *data);
+
+#endif /* !__MATTE_BUFFER_H__ */
+
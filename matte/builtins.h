@@ -23,6 +23,30 @@ Object matte_disp (Zone z, Object argin);
 
 Object matte_sum (Zone z, Object argin);
 
+Object matte_prod (Zone z, Object argin);
+
+Object matte_single (Zone z, Object argin);
+
+Object matte_double (Zone z, Object argin);
+
+Object matte_int32 (Zone z, Object argin);
+
+Object matte_int64 (Zone z, Object argin);
+
+Object matte_any (Zone z, Object argin);
+
+Object matte_all (Zone z, Object argin);
+
+Object matte_nnz (Zone z, Object argin);
+
+Object matte_find (Zone z, Object argin);
+
+Object matte_logical (Zone z, Object argin);
+
+Object matte_sparse (Zone z, Object argin);
+
+Object matte_full (Zone z, Object argin);
+
 Object matte_sprintf (Zone z, Object argin);
 
 #endif /* !__MATTE_BUILTINS_H__ */
@@ -7,8 +7,10 @@
 #ifndef __MATTE_COMPLEX_MATRIX_H__
 #define __MATTE_COMPLEX_MATRIX_H__
 
-/* include the object header. */
+/* include the object, buffer and matrix headers. */
 #include <matte/object.h>
+#include <matte/buffer.h>
+#include <matte/matrix.h>
 
 /* IS_COMPLEX_MATRIX: macro to check that an object is a matte complex matrix.
  */
@@ -25,12 +27,22 @@ struct _ComplexMatrix {
   /* base object. */
   OBJECT_BASE;
 
-  /* @data: array of vector elements.
+  /* @data: shared buffer of matrix elements.
    * @m: number of matrix rows.
    * @n: number of matrix columns.
    */
   complex double *data;
   long m, n;
+
+  /* @tr: transposition status of the matrix. transposed matrices hold
+   * the transpose or conjugate transpose of their @m by @n elements.
+   */
+  MatteTranspose tr;
+
+  /* @split: whether the elements are held in split storage, with all
+   * real parts preceding all imaginary parts in @data.
+   */
+  int split;
 };
 
 /* function declarations (complex-matrix.c): */
@@ -41,6 +53,8 @@ ComplexMatrix complex_matrix_new (Zone z, Object args);
 
 ComplexMatrix complex_matrix_new_with_size (Zone z, long m, long n);
 
+ComplexMatrix complex_matrix_new_from_matrix (Zone z, Matrix A);
+
 ComplexMatrix complex_matrix_copy (Zone z, ComplexMatrix A);
 
 ComplexMatrix complex_matrix_copy_trans (Zone z, ComplexMatrix A);
@@ -63,6 +77,14 @@ int complex_matrix_set_cols (ComplexMatrix A, long n);
 
 int complex_matrix_set_size (ComplexMatrix A, long m, long n);
 
+int complex_matrix_unshare (ComplexMatrix A);
+
+int complex_matrix_untranspose (ComplexMatrix A);
+
+int complex_matrix_split (ComplexMatrix A);
+
+int complex_matrix_interleave (ComplexMatrix A);
+
 void complex_matrix_set (ComplexMatrix A, long i, long j,
                          complex double aij);
 
@@ -26,15 +26,17 @@ struct _ComplexVector {
   /* base object. */
   OBJECT_BASE;
 
-  /* @data: array of vector elements.
+  /* @data: shared buffer of vector elements.
    * @n: number of vector elements.
    */
   complex double *data;
   long n;
 
   /* @tr: transposition status of the vector.
+   * @split: whether the elements are held in split storage, with all
+   *         real parts preceding all imaginary parts in @data.
    */
-  int tr;
+  int tr, split;
 };
 
 /* function declarations (complex-vector.c): */
@@ -59,6 +61,12 @@ complex double complex_vector_get (ComplexVector x, long i);
 
 int complex_vector_set_length (ComplexVector x, long n);
 
+int complex_vector_unshare (ComplexVector x);
+
+int complex_vector_split (ComplexVector x);
+
+int complex_vector_interleave (ComplexVector x);
+
 void complex_vector_set (ComplexVector x, long i,
                          complex double xi);
 
@@ -74,5 +82,11 @@ int complex_vector_negate (ComplexVector x);
 
 int complex_vector_conj (ComplexVector x);
 
+ComplexVector complex_vector_fuse (Zone z, Object out, int n, Object *args,
+                                   const double **ptr,
+                                   const complex double **cptr,
+                                   long *inc, double *val,
+                                   complex double *cval);
+
 #endif /* !__MATTE_COMPLEX_VECTOR_H__ */
 
@@ -0,0 +1,68 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_DISPATCH_H__
+#define __MATTE_DISPATCH_H__
+
+/* include the object header. */
+#include <matte/object.h>
+
+/* DISPATCH_TYPES: maximum number of object types that may be held by
+ * the binary dispatch table. the first index is reserved for types that
+ * have not been registered.
+ */
+#define DISPATCH_TYPES  64
+
+/* DispatchOp: an enum _DispatchOp. */
+typedef enum _DispatchOp DispatchOp;
+
+/* _DispatchOp: enumeration that holds the binary operations that are
+ * routed through the dispatch table.
+ */
+enum _DispatchOp {
+  DISPATCH_PLUS = 0,
+  DISPATCH_MINUS,
+  DISPATCH_TIMES,
+  DISPATCH_MTIMES,
+  DISPATCH_RDIVIDE,
+  DISPATCH_LDIVIDE,
+  DISPATCH_MRDIVIDE,
+  DISPATCH_MLDIVIDE,
+  DISPATCH_POWER,
+  DISPATCH_MPOWER,
+  DISPATCH_LT,
+  DISPATCH_GT,
+  DISPATCH_LE,
+  DISPATCH_GE,
+  DISPATCH_NE,
+  DISPATCH_EQ,
+  DISPATCH_AND,
+  DISPATCH_OR,
+  DISPATCH_MAND,
+  DISPATCH_MOR,
+
+  DISPATCH_OPS
+};
+
+/* dispatch_table: binary kernels of every operation, indexed by the
+ * operation and the registered indices of the left and right operand
+ * types.
+ */
+extern obj_binary dispatch_table[DISPATCH_OPS][DISPATCH_TYPES][DISPATCH_TYPES];
+
+/* function declarations (dispatch.c): */
+
+int dispatch_register_type (ObjectType type);
+
+int dispatch_register (DispatchOp op, ObjectType ta, ObjectType tb,
+                       obj_binary fn);
+
+obj_binary dispatch_lookup (DispatchOp op, ObjectType ta, ObjectType tb);
+
+void dispatch_init (void);
+
+#endif /* !__MATTE_DISPATCH_H__ */
+
@@ -65,6 +65,10 @@
   ANSI_BOLD "..." ANSI_NORM ")" \
   " is unimplemented" 
 
+#define ERR_DISPATCH_FULL \
+  "matte:dispatch", \
+  "unable to register type '" ANSI_BOLD "%s" ANSI_NORM "' for dispatch"
+
 #define ERR_SIZE_MISMATCH \
   "matte:size-mismatch", "operand sizes do not match"
 
@@ -84,6 +88,14 @@
   (x)->tr == CblasNoTrans ? (x)->n : 1L, \
   (x)->tr == CblasNoTrans ? 1L : (x)->n
 
+#define ERR_SIZE_MISMATCH_VM(x,trA,A) \
+  "matte:size-mismatch", \
+  "operand sizes do not conform (%ldx%ld, %ldx%ld)", \
+  (x)->tr == CblasNoTrans ? (x)->n : 1L, \
+  (x)->tr == CblasNoTrans ? 1L : (x)->n, \
+  trA == CblasNoTrans ? (A)->m : (A)->n, \
+  trA == CblasNoTrans ? (A)->n : (A)->m
+
 #define ERR_SIZE_MISMATCH_MM(trA,trB,A,B) \
   "matte:size-mismatch", \
   "operand sizes do not conform (%ldx%ld, %ldx%ld)", \
@@ -92,13 +104,35 @@
   trB == CblasNoTrans ? (B)->m : (B)->n, \
   trB == CblasNoTrans ? (B)->n : (B)->m
 
+#define ERR_SIZE_MISMATCH_BC(x,y) \
+  "matte:size-mismatch", \
+  "operand sizes do not conform (%ldx%ld, %ldx%ld)", \
+  (x)->m, (x)->n, (y)->m, (y)->n
+
 #define ERR_SIZE_NONSQUARE(A) \
   "matte:size-mismatch", \
   "matrix operand is not square (%ldx%ld)", (A)->m, (A)->n
 
+#define ERR_MATRIX_SINGULAR \
+  "matte:singular-matrix", "matrix is singular to working precision"
+
+#define ERR_SOLVE_CONVERGENCE(res) \
+  "matte:no-convergence", \
+  "iterative solver did not converge (relative residual %lg)", (res)
+
+#define ERR_INDEX_INVALID \
+  "matte:bad-subscript", "subscript indices must be positive integers"
+
+#define ERR_INDEX_BOUNDS(i,n) \
+  "matte:index-out-of-bounds", \
+  "index %ld exceeds array bounds (%ld)", (long) (i), (long) (n)
+
 #define ERR_INVALID_ARGIN \
   "matte:invalid-input-arg", "one or more invalid arguments"
 
+#define ERR_INVALID_DIM \
+  "matte:invalid-dim", "dimension argument must be a positive integer"
+
 #define ERR_INVALID_TRY \
   "matte:compiler", \
   "found illegal " ANSI_BOLD "try" ANSI_NORM \
@@ -114,6 +148,10 @@
 #define ERR_UNDEFINED_SYMBOL \
   "matte:compiler", "symbol '" ANSI_BOLD "%s" ANSI_NORM "' is undefined"
 
+#define ERR_COMPILER_TEMP \
+  "matte:compiler", \
+  "temporary '" ANSI_BOLD "%s" ANSI_NORM "' has more than one consumer"
+
 #define ERR_COMPILER_GENERAL \
   "matte:compiler", "compilation errors occured"
 
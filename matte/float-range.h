@@ -0,0 +1,72 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_FLOAT_RANGE_H__
+#define __MATTE_FLOAT_RANGE_H__
+
+/* include the object header. */
+#include <matte/object.h>
+
+/* IS_FLOAT_RANGE: macro to check that an object is a matte float range.
+ */
+#define IS_FLOAT_RANGE(obj) \
+  MATTE_TYPE_CHECK(obj, float_range_type())
+
+/* FloatRange: pointer to a struct _FloatRange. */
+typedef struct _FloatRange *FloatRange;
+struct _ObjectType FloatRange_type;
+
+/* _FloatRange: structure for holding arithmetic sequences of floats.
+ * unlike integer ranges, float ranges store their length instead of
+ * their end value, so that rounding never changes the element count.
+ */
+struct _FloatRange {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @begin: first value of the range.
+   * @step: step value of the range.
+   * @n: number of elements in the range.
+   */
+  double begin, step;
+  long n;
+};
+
+/* function declarations (float-range.c): */
+
+ObjectType float_range_type (void);
+
+FloatRange float_range_new (Zone z, Object args);
+
+FloatRange float_range_new_with_values (Zone z, double begin, double step,
+                                        long n);
+
+FloatRange float_range_copy (Zone z, FloatRange r);
+
+double float_range_get_begin (FloatRange r);
+
+double float_range_get_step (FloatRange r);
+
+long float_range_get_length (FloatRange r);
+
+double float_range_get_element (FloatRange r, long i);
+
+double float_range_get_last (FloatRange r);
+
+int float_range_contains (FloatRange r, double value);
+
+double float_range_sum (FloatRange r);
+
+double float_range_prod (FloatRange r);
+
+long float_range_any (FloatRange r);
+
+long float_range_all (FloatRange r);
+
+void float_range_register (void);
+
+#endif /* !__MATTE_FLOAT_RANGE_H__ */
+
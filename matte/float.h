@@ -44,5 +44,7 @@ double float_get_value (Float f);
 
 void float_set_value (Float f, double value);
 
+void float_register (void);
+
 #endif /* !__MATTE_FLOAT_H__ */
 
@@ -0,0 +1,78 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_INT32_ARRAY_H__
+#define __MATTE_INT32_ARRAY_H__
+
+/* include the standard integer header. */
+#include <stdint.h>
+
+/* include the object and buffer headers. */
+#include <matte/object.h>
+#include <matte/buffer.h>
+
+/* IS_INT32_ARRAY: macro to check that an object is a matte 32-bit
+ * integer array.
+ */
+#define IS_INT32_ARRAY(obj) \
+  MATTE_TYPE_CHECK(obj, int32_array_type())
+
+/* Int32Array: pointer to a struct _Int32Array. */
+typedef struct _Int32Array *Int32Array;
+struct _ObjectType Int32Array_type;
+
+/* _Int32Array: structure for holding an array of 32-bit integers.
+ * arithmetic on the elements saturates at the limits of their range.
+ */
+struct _Int32Array {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @data: shared buffer of array elements, in column-major order.
+   * @m: number of array rows.
+   * @n: number of array columns.
+   */
+  int32_t *data;
+  long m, n;
+
+  /* @mat: whether the array has the shape of a matrix, rather than that
+   * of a vector.
+   */
+  int mat;
+};
+
+/* function declarations (int32-array.c): */
+
+ObjectType int32_array_type (void);
+
+Int32Array int32_array_new (Zone z, Object args);
+
+Int32Array int32_array_new_with_size (Zone z, long m, long n);
+
+Int32Array int32_array_new_from_object (Zone z, Object obj);
+
+Object int32_array_to_double (Zone z, Int32Array x);
+
+Int32Array int32_array_copy (Zone z, Int32Array x);
+
+void int32_array_delete (Zone z, Int32Array x);
+
+long int32_array_get_length (Int32Array x);
+
+int32_t int32_array_get (Int32Array x, long i);
+
+int int32_array_unshare (Int32Array x);
+
+void int32_array_set (Int32Array x, long i, int32_t xi);
+
+Int32Array int32_array_horzcat (Zone z, int n, va_list vl);
+
+Int32Array int32_array_vertcat (Zone z, int n, va_list vl);
+
+void int32_array_register (void);
+
+#endif /* !__MATTE_INT32_ARRAY_H__ */
+
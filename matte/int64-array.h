@@ -0,0 +1,78 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_INT64_ARRAY_H__
+#define __MATTE_INT64_ARRAY_H__
+
+/* include the standard integer header. */
+#include <stdint.h>
+
+/* include the object and buffer headers. */
+#include <matte/object.h>
+#include <matte/buffer.h>
+
+/* IS_INT64_ARRAY: macro to check that an object is a matte 64-bit
+ * integer array.
+ */
+#define IS_INT64_ARRAY(obj) \
+  MATTE_TYPE_CHECK(obj, int64_array_type())
+
+/* Int64Array: pointer to a struct _Int64Array. */
+typedef struct _Int64Array *Int64Array;
+struct _ObjectType Int64Array_type;
+
+/* _Int64Array: structure for holding an array of 64-bit integers.
+ * arithmetic on the elements saturates at the limits of their range.
+ */
+struct _Int64Array {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @data: shared buffer of array elements, in column-major order.
+   * @m: number of array rows.
+   * @n: number of array columns.
+   */
+  int64_t *data;
+  long m, n;
+
+  /* @mat: whether the array has the shape of a matrix, rather than that
+   * of a vector.
+   */
+  int mat;
+};
+
+/* function declarations (int64-array.c): */
+
+ObjectType int64_array_type (void);
+
+Int64Array int64_array_new (Zone z, Object args);
+
+Int64Array int64_array_new_with_size (Zone z, long m, long n);
+
+Int64Array int64_array_new_from_object (Zone z, Object obj);
+
+Object int64_array_to_double (Zone z, Int64Array x);
+
+Int64Array int64_array_copy (Zone z, Int64Array x);
+
+void int64_array_delete (Zone z, Int64Array x);
+
+long int64_array_get_length (Int64Array x);
+
+int64_t int64_array_get (Int64Array x, long i);
+
+int int64_array_unshare (Int64Array x);
+
+void int64_array_set (Int64Array x, long i, int64_t xi);
+
+Int64Array int64_array_horzcat (Zone z, int n, va_list vl);
+
+Int64Array int64_array_vertcat (Zone z, int n, va_list vl);
+
+void int64_array_register (void);
+
+#endif /* !__MATTE_INT64_ARRAY_H__ */
+
@@ -0,0 +1,77 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_LOGICAL_H__
+#define __MATTE_LOGICAL_H__
+
+/* include the object and buffer headers. */
+#include <matte/object.h>
+#include <matte/buffer.h>
+
+/* IS_LOGICAL: macro to check that an object is a matte logical array.
+ */
+#define IS_LOGICAL(obj) \
+  MATTE_TYPE_CHECK(obj, logical_type())
+
+/* Logical: pointer to a struct _Logical. */
+typedef struct _Logical *Logical;
+struct _ObjectType Logical_type;
+
+/* _Logical: structure for holding an array of truth values, such as the
+ * result of a comparison. each element is held in one byte, which is
+ * either one or zero.
+ */
+struct _Logical {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @data: shared buffer of array elements, in column-major order.
+   * @m: number of array rows.
+   * @n: number of array columns.
+   */
+  unsigned char *data;
+  long m, n;
+
+  /* @mat: whether the array has the shape of a matrix, rather than that
+   * of a vector, when converted to double precision.
+   */
+  int mat;
+};
+
+/* function declarations (logical.c): */
+
+ObjectType logical_type (void);
+
+Logical logical_new (Zone z, Object args);
+
+Logical logical_new_with_size (Zone z, long m, long n);
+
+Object logical_to_double (Zone z, Logical L);
+
+Logical logical_copy (Zone z, Logical L);
+
+void logical_delete (Zone z, Logical L);
+
+long logical_get_length (Logical L);
+
+int logical_get (Logical L, long i);
+
+int logical_unshare (Logical L);
+
+void logical_set (Logical L, long i, int li);
+
+long logical_nnz (Logical L);
+
+long logical_any (Logical L);
+
+long logical_all (Logical L);
+
+Logical logical_reduce (Zone z, Logical L, int all);
+
+Object logical_find (Zone z, Logical L);
+
+#endif /* !__MATTE_LOGICAL_H__ */
+
@@ -26,12 +26,17 @@ struct _Matrix {
   /* base object. */
   OBJECT_BASE;
 
-  /* @data: array of matrix elements.
+  /* @data: shared buffer of matrix elements.
    * @m: number of matrix rows.
    * @n: number of matrix columns.
    */
   double *data;
   long m, n;
+
+  /* @tr: transposition status of the matrix. transposed matrices hold
+   * the transpose of their @m by @n elements.
+   */
+  MatteTranspose tr;
 };
 
 /* function declarations (matrix.c): */
@@ -42,9 +47,6 @@ Matrix matrix_new (Zone z, Object args);
 
 Matrix matrix_new_with_size (Zone z, long m, long n);
 
-Matrix matrix_new_from_vector_sum (Zone z, double alpha,
-                                   Vector x, Vector y);
-
 Matrix matrix_copy (Zone z, Matrix A);
 
 Matrix matrix_copy_trans (Zone z, Matrix A);
@@ -67,6 +69,10 @@ int matrix_set_cols (Matrix A, long n);
 
 int matrix_set_size (Matrix A, long m, long n);
 
+int matrix_unshare (Matrix A);
+
+int matrix_untranspose (Matrix A);
+
 void matrix_set (Matrix A, long i, long j, double aij);
 
 void matrix_set_element (Matrix A, long i, double ai);
@@ -31,11 +31,18 @@
 #include <matte/int.h>
 #include <matte/range.h>
 #include <matte/float.h>
+#include <matte/float-range.h>
 #include <matte/complex.h>
 #include <matte/vector.h>
 #include <matte/matrix.h>
 #include <matte/complex-vector.h>
 #include <matte/complex-matrix.h>
+#include <matte/single-vector.h>
+#include <matte/single-matrix.h>
+#include <matte/logical.h>
+#include <matte/int32-array.h>
+#include <matte/int64-array.h>
+#include <matte/sparse-matrix.h>
 
 /* include the matte blas and lapack wrapper headers. */
 #include <matte/blas.h>
@@ -19,9 +19,8 @@
 #include <math.h>
 #include <complex.h>
 
-/* include the blas/lapack headers. */
+/* include the cblas header, for its enumerations. */
 #include <cblas.h>
-#include <clapack.h>
 
 /* include the required matte headers. */
 #include <matte/zone.h>
@@ -30,10 +29,12 @@
  *  MatteTranspose: transpose options.
  *  MatteTriangle: triangle options.
  *  MatteDiagonal: diagonal options.
+ *  MatteSide: side options.
  */
 typedef enum CBLAS_TRANSPOSE MatteTranspose;
 typedef enum CBLAS_UPLO MatteTriangle;
 typedef enum CBLAS_DIAG MatteDiagonal;
+typedef enum CBLAS_SIDE MatteSide;
 
 /* MATTE_TYPE: macro to obtain the type structure pointer of an object.
  */
@@ -76,6 +77,7 @@ typedef Object (*obj_binary)      (Zone, Object, Object);
 typedef Object (*obj_ternary)     (Zone, Object, Object, Object);
 typedef Object (*obj_variadic)    (Zone, int, va_list);
 typedef Object (*obj_method)      (Zone, Object, Object);
+typedef int    (*obj_inplace)     (Zone, Object, Object);
 
 /* _ObjectMethod: structure that holds information about a matte object
  * method.
@@ -142,9 +144,23 @@ struct _ObjectType {
   obj_ternary  fn_subsasgn;    /* a(s)=b   subscripted assignment.      */
   obj_unary    fn_subsindex;   /* b(a)     subscript index.             */
 
+  /* in-place numeric method table. each method overwrites its first
+   * operand with the result, and returns zero without modifying it
+   * when the result cannot be stored in the first operand.
+   */
+  obj_inplace  fn_plus_inplace;   /* a=a+b    in-place addition.        */
+  obj_inplace  fn_minus_inplace;  /* a=a-b    in-place subtraction.     */
+  obj_inplace  fn_times_inplace;  /* a=a.*b   in-place multiplication.  */
+
   /* general-purpose method table:
    */
   ObjectMethods methods;
+
+  /* dispatch information:
+   *  @index: position of the type in the binary dispatch table, assigned
+   *          when the type is registered, or zero if unregistered.
+   */
+  unsigned int index;
 };
 
 /* _Object: structure for type-casting between any number of matte objects.
@@ -165,6 +181,8 @@ Object object_alloc (Zone z, ObjectType type);
 
 Object object_copy (Zone z, Object obj);
 
+Object object_move (Zone z, Zone src, Object obj);
+
 void object_free (Zone z, void *ptr);
 
 void object_free_all (Zone z);
@@ -208,6 +226,12 @@ Object object_subsref    (Zone z, Object a, Object b);
 Object object_subsasgn   (Zone z, Object a, Object b, Object c);
 Object object_subsindex  (Zone z, Object a);
 
+/* in-place object method declarations (object.c): */
+
+Object object_plus_inplace  (Zone z, Object a, Object b);
+Object object_minus_inplace (Zone z, Object a, Object b);
+Object object_times_inplace (Zone z, Object a, Object b);
+
 /* utility function declarations: */
 
 char *strdup (const char *s);
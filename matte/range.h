@@ -50,6 +50,16 @@ void range_get (Range r, long *begin, long *step, long *end);
 
 long range_get_length (Range r);
 
+long range_get_element (Range r, long i);
+
+long range_get_last (Range r);
+
+int range_contains (Range r, long value);
+
+long range_sum (Range r);
+
+long range_prod (Range r);
+
 void range_set_begin (Range r, long value);
 
 void range_set_step (Range r, long value);
@@ -0,0 +1,67 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SIMD_H__
+#define __MATTE_SIMD_H__
+
+/* SIMD_X86: defined when vectorized kernels for x86 processors may be
+ * compiled into the library.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86
+#endif
+
+/* SimdOp: an enum _SimdOp. */
+typedef enum _SimdOp SimdOp;
+
+/* _SimdOp: enumeration that holds the element-wise comparison and
+ * logical operations that are computed by vectorized kernels.
+ */
+enum _SimdOp {
+  SIMD_LT = 0,
+  SIMD_GT,
+  SIMD_LE,
+  SIMD_GE,
+  SIMD_NE,
+  SIMD_EQ,
+  SIMD_AND,
+  SIMD_OR,
+
+  SIMD_OPS
+};
+
+/* simd_kernel: function pointer type of element-wise kernels. each
+ * kernel computes @n elements of the form (a[i*sa] <op> b[i*sb]) into
+ * @c as bytes holding ones and zeros, where the increments @sa and @sb
+ * are either one for arrays or zero for scalars.
+ */
+typedef void (*simd_kernel) (long n, const double *a, long sa,
+                             const double *b, long sb, unsigned char *c);
+
+/* SIMD_SUM_BLOCK: number of elements that are summed directly by the
+ * reduction kernels. longer arrays are summed pairwise, by halves, so
+ * that rounding errors grow with the logarithm of their length.
+ */
+#define SIMD_SUM_BLOCK 128
+
+/* simd_reducer: function pointer type of summation kernels. each kernel
+ * adds the @n elements of @x into the two partial sums in @s, where
+ * @s[0] receives the elements at even indices and @s[1] receives the
+ * elements at odd indices. @n must be even.
+ */
+typedef void (*simd_reducer) (long n, const double *x, double *s);
+
+/* function declarations (simd.c): */
+
+void simd_compare (SimdOp op, long n, const double *a, long sa,
+                   const double *b, long sb, unsigned char *c);
+
+void simd_sum (long n, const double *x, double *s);
+
+void simd_init (void);
+
+#endif /* !__MATTE_SIMD_H__ */
+
@@ -0,0 +1,80 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SINGLE_MATRIX_H__
+#define __MATTE_SINGLE_MATRIX_H__
+
+/* include the object, buffer and matrix headers. */
+#include <matte/object.h>
+#include <matte/buffer.h>
+#include <matte/matrix.h>
+
+/* IS_SINGLE_MATRIX: macro to check that an object is a matte
+ * single-precision matrix.
+ */
+#define IS_SINGLE_MATRIX(obj) \
+  MATTE_TYPE_CHECK(obj, single_matrix_type())
+
+/* SingleMatrix: pointer to a struct _SingleMatrix. */
+typedef struct _SingleMatrix *SingleMatrix;
+struct _ObjectType SingleMatrix_type;
+
+/* _SingleMatrix: structure for holding a matrix of real numbers in
+ * single precision.
+ */
+struct _SingleMatrix {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @data: shared buffer of matrix elements.
+   * @m: number of matrix rows.
+   * @n: number of matrix columns.
+   */
+  float *data;
+  long m, n;
+
+  /* @tr: transposition status of the matrix. transposed matrices hold
+   * the transpose of their @m by @n elements.
+   */
+  MatteTranspose tr;
+};
+
+/* function declarations (single-matrix.c): */
+
+ObjectType single_matrix_type (void);
+
+SingleMatrix single_matrix_new (Zone z, Object args);
+
+SingleMatrix single_matrix_new_with_size (Zone z, long m, long n);
+
+SingleMatrix single_matrix_new_from_matrix (Zone z, Matrix A);
+
+Matrix single_matrix_to_double (Zone z, SingleMatrix A);
+
+SingleMatrix single_matrix_copy (Zone z, SingleMatrix A);
+
+void single_matrix_delete (Zone z, SingleMatrix A);
+
+long single_matrix_get_rows (SingleMatrix A);
+
+long single_matrix_get_cols (SingleMatrix A);
+
+long single_matrix_get_length (SingleMatrix A);
+
+float single_matrix_get (SingleMatrix A, long i, long j);
+
+int single_matrix_set_size (SingleMatrix A, long m, long n);
+
+int single_matrix_unshare (SingleMatrix A);
+
+int single_matrix_untranspose (SingleMatrix A);
+
+void single_matrix_set (SingleMatrix A, long i, long j, float aij);
+
+Object single_matrix_mtimes (Zone z, Object a, Object b);
+
+#endif /* !__MATTE_SINGLE_MATRIX_H__ */
+
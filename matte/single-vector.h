@@ -0,0 +1,70 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SINGLE_VECTOR_H__
+#define __MATTE_SINGLE_VECTOR_H__
+
+/* include the object, buffer and vector headers. */
+#include <matte/object.h>
+#include <matte/buffer.h>
+#include <matte/vector.h>
+
+/* IS_SINGLE_VECTOR: macro to check that an object is a matte
+ * single-precision vector.
+ */
+#define IS_SINGLE_VECTOR(obj) \
+  MATTE_TYPE_CHECK(obj, single_vector_type())
+
+/* SingleVector: pointer to a struct _SingleVector. */
+typedef struct _SingleVector *SingleVector;
+struct _ObjectType SingleVector_type;
+
+/* _SingleVector: structure for holding a vector of real numbers in
+ * single precision.
+ */
+struct _SingleVector {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @data: shared buffer of vector elements.
+   * @n: number of vector elements.
+   */
+  float *data;
+  long n;
+
+  /* @tr: transposition status of the vector.
+   */
+  MatteTranspose tr;
+};
+
+/* function declarations (single-vector.c): */
+
+ObjectType single_vector_type (void);
+
+SingleVector single_vector_new (Zone z, Object args);
+
+SingleVector single_vector_new_with_length (Zone z, long n);
+
+SingleVector single_vector_new_from_vector (Zone z, Vector x);
+
+Vector single_vector_to_double (Zone z, SingleVector x);
+
+SingleVector single_vector_copy (Zone z, SingleVector x);
+
+void single_vector_delete (Zone z, SingleVector x);
+
+long single_vector_get_length (SingleVector x);
+
+float single_vector_get (SingleVector x, long i);
+
+int single_vector_set_length (SingleVector x, long n);
+
+int single_vector_unshare (SingleVector x);
+
+void single_vector_set (SingleVector x, long i, float xi);
+
+#endif /* !__MATTE_SINGLE_VECTOR_H__ */
+
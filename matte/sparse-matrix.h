@@ -0,0 +1,88 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SPARSE_MATRIX_H__
+#define __MATTE_SPARSE_MATRIX_H__
+
+/* include the object, buffer and matrix headers. */
+#include <matte/object.h>
+#include <matte/buffer.h>
+#include <matte/matrix.h>
+
+/* IS_SPARSE_MATRIX: macro to check that an object is a matte sparse
+ * matrix.
+ */
+#define IS_SPARSE_MATRIX(obj) \
+  MATTE_TYPE_CHECK(obj, sparse_matrix_type())
+
+/* SparseMatrix: pointer to a struct _SparseMatrix. */
+typedef struct _SparseMatrix *SparseMatrix;
+struct _ObjectType SparseMatrix_type;
+
+/* _SparseMatrix: structure for holding a sparse matrix of real numbers
+ * in compressed sparse column format. the nonzero elements of column j
+ * are held at offsets [colptr[j], colptr[j + 1]), in order of ascending
+ * row index.
+ */
+struct _SparseMatrix {
+  /* base object. */
+  OBJECT_BASE;
+
+  /* @m: number of matrix rows.
+   * @n: number of matrix columns.
+   * @nnz: number of stored (nonzero) elements.
+   */
+  long m, n, nnz;
+
+  /* @colptr: shared buffer of @n + 1 column offsets.
+   * @rowidx: shared buffer of the row index of each element.
+   * @data: shared buffer of element values.
+   */
+  long *colptr, *rowidx;
+  double *data;
+
+  /* @rowptr, @colidx, @rdata: shared buffers of the same elements in
+   * compressed sparse row format, which is the compressed sparse column
+   * format of the transpose. these are null until first required.
+   */
+  long *rowptr, *colidx;
+  double *rdata;
+};
+
+/* function declarations (sparse-matrix.c): */
+
+ObjectType sparse_matrix_type (void);
+
+SparseMatrix sparse_matrix_new (Zone z, Object args);
+
+SparseMatrix sparse_matrix_new_with_size (Zone z, long m, long n, long nnz);
+
+SparseMatrix sparse_matrix_new_from_triplets (Zone z, long m, long n,
+                                              long nnz, const long *i,
+                                              const long *j,
+                                              const double *v);
+
+SparseMatrix sparse_matrix_new_from_matrix (Zone z, Matrix A);
+
+Matrix sparse_matrix_to_matrix (Zone z, SparseMatrix S);
+
+SparseMatrix sparse_matrix_copy (Zone z, SparseMatrix S);
+
+void sparse_matrix_delete (Zone z, SparseMatrix S);
+
+long sparse_matrix_get_nnz (SparseMatrix S);
+
+double sparse_matrix_get (SparseMatrix S, long i, long j);
+
+int sparse_matrix_rows (SparseMatrix S);
+
+int sparse_matrix_is_symmetric (SparseMatrix S);
+
+int sparse_matrix_spmv (SparseMatrix S, long k, const double *X, long ldx,
+                        double *Y, long ldy);
+
+#endif /* !__MATTE_SPARSE_MATRIX_H__ */
+
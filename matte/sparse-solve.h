@@ -0,0 +1,29 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SPARSE_SOLVE_H__
+#define __MATTE_SPARSE_SOLVE_H__
+
+/* include the sparse matrix header. */
+#include <matte/sparse-matrix.h>
+
+/* SPARSE_SOLVE_TOL: relative residual norm at which the iterative
+ * solutions of sparse linear systems are considered converged.
+ */
+#define SPARSE_SOLVE_TOL 1.0e-10
+
+/* SPARSE_SOLVE_MIN_ITER: minimum limit on the number of iterations of
+ * the iterative solvers. the limit is otherwise twice the system size.
+ */
+#define SPARSE_SOLVE_MIN_ITER 100
+
+/* function declarations (sparse-solve.c): */
+
+int sparse_solve (SparseMatrix A, long k, const double *B, long ldb,
+                  double *X, long ldx);
+
+#endif /* !__MATTE_SPARSE_SOLVE_H__ */
+
@@ -0,0 +1,44 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SPLIT_H__
+#define __MATTE_SPLIT_H__
+
+/* include the complex math header. */
+#include <complex.h>
+
+/* SPLIT_RE(), SPLIT_IM(): macros to access the real and imaginary parts
+ * of the @len elements of a complex array in split storage. the buffer
+ * of a split array has the size of its interleaved counterpart, and
+ * holds all real parts followed by all imaginary parts.
+ */
+#define SPLIT_RE(data)     ((double*) (data))
+#define SPLIT_IM(data,len) ((double*) (data) + (len))
+
+/* function declarations (split.c): */
+
+complex double split_get (const complex double *data, long len, long i);
+
+void split_set (complex double *data, long len, long i, complex double x);
+
+void split_deinterleave (long n, const complex double *x,
+                         double *re, double *im);
+
+void split_interleave (long n, const double *re, const double *im,
+                       complex double *x);
+
+void split_shift (long n, complex double f, double *re, double *im);
+
+void split_scal (long n, complex double f, double *re, double *im);
+
+void split_axpy (long n, double alpha, const double *xr, const double *xi,
+                 double *yr, double *yi);
+
+void split_mul (long n, const double *xr, const double *xi,
+                double *yr, double *yi);
+
+#endif /* !__MATTE_SPLIT_H__ */
+
@@ -0,0 +1,18 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_SUBSCRIPT_H__
+#define __MATTE_SUBSCRIPT_H__
+
+/* include the object header. */
+#include <matte/object.h>
+
+/* function declarations (subscript.c): */
+
+Object subscript_ref (Zone z, Object a, Object s);
+
+#endif /* !__MATTE_SUBSCRIPT_H__ */
+
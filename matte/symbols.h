@@ -28,6 +28,7 @@
 #define SYMBOL_GLOBAL_STRING   (SYMBOL_GLOBAL | SYMBOL_VAR | SYMBOL_STRING)
 #define SYMBOL_LITERAL \
   (SYMBOL_INT | SYMBOL_FLOAT | SYMBOL_COMPLEX | SYMBOL_STRING)
+#define SYMBOL_SCALAR          (SYMBOL_LONG   | SYMBOL_DOUBLE)
 
 /* Symbols: pointer to a struct _Symbols. */
 typedef struct _Symbols *Symbols;
@@ -65,7 +66,11 @@ enum _SymbolType {
   /* class and function symbols. */
   SYMBOL_FUNC      = 0x1000,
   SYMBOL_METHOD    = 0x2000,
-  SYMBOL_CLASS     = 0x4000
+  SYMBOL_CLASS     = 0x4000,
+
+  /* unboxed scalar variables, inferred by the compiler. */
+  SYMBOL_LONG      = 0x10000,
+  SYMBOL_DOUBLE    = 0x20000
 };
 
 /* _SymbolData: union that holds any literal or identifier data value
@@ -116,6 +121,8 @@ const char *symbol_name (Symbols syms, long index);
 
 SymbolType symbol_type (Symbols syms, long index);
 
+void symbol_set_type (Symbols syms, long index, SymbolType stype);
+
 long symbol_int (Symbols syms, long index);
 
 double symbol_float (Symbols syms, long index);
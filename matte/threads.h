@@ -0,0 +1,39 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_THREADS_H__
+#define __MATTE_THREADS_H__
+
+/* THREADS_MAX: maximum number of threads, including the calling thread,
+ * that execute the loops submitted to the thread pool.
+ */
+#define THREADS_MAX 256
+
+/* THREADS_MIN_WORK: minimum number of elements that are processed by
+ * each thread of a parallel loop. smaller loops execute serially.
+ */
+#define THREADS_MIN_WORK 32768
+
+/* THREADS_ENV: name of the environment variable that holds the number
+ * of threads in the pool. when unset, one thread is used per online
+ * processor.
+ */
+#define THREADS_ENV "MATTE_NUM_THREADS"
+
+/* thread_fn: function pointer type of loops executed by the thread
+ * pool. each call processes the iterations [@start, @end) of a loop
+ * over the data in @arg, as the chunk with index @id.
+ */
+typedef void (*thread_fn) (void *arg, int id, long start, long end);
+
+/* function declarations (threads.c): */
+
+int threads_count (void);
+
+int threads_run (long n, long size, thread_fn fn, void *arg);
+
+#endif /* !__MATTE_THREADS_H__ */
+
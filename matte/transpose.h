@@ -0,0 +1,45 @@
+
+/* Copyright (c) 2017 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License
+ */
+
+/* ensure once-only inclusion. */
+#ifndef __MATTE_TRANSPOSE_H__
+#define __MATTE_TRANSPOSE_H__
+
+/* include the c library, string and complex math headers. */
+#include <stdlib.h>
+#include <string.h>
+#include <complex.h>
+
+/* TRANSPOSE_BLOCK: largest number of rows and columns of the tiles that
+ * are transposed directly. larger matrices are recursively split until
+ * their tiles reach this size, so that the source and destination of
+ * each tile remain in cache.
+ */
+#define TRANSPOSE_BLOCK 32
+
+/* TRANSPOSE_MICRO: number of rows and columns of the blocks that are
+ * transposed by the vectorized kernels.
+ */
+#define TRANSPOSE_MICRO 4
+
+/* function declarations (transpose.c): */
+
+void transpose_d (long m, long n, const double *a, double *b);
+
+void transpose_s (long m, long n, const float *a, float *b);
+
+void transpose_z (long m, long n, const complex double *a,
+                  complex double *b, int cj);
+
+void transpose_d_inplace (long n, double *a);
+
+void transpose_s_inplace (long n, float *a);
+
+void transpose_z_inplace (long n, complex double *a, int cj);
+
+void transpose_init (void);
+
+#endif /* !__MATTE_TRANSPOSE_H__ */
+
@@ -7,9 +7,11 @@
 #ifndef __MATTE_VECTOR_H__
 #define __MATTE_VECTOR_H__
 
-/* include the object and range headers. */
+/* include the object, range and buffer headers. */
 #include <matte/object.h>
 #include <matte/range.h>
+#include <matte/float-range.h>
+#include <matte/buffer.h>
 
 /* IS_VECTOR: macro to check that an object is a matte vector.
  */
@@ -26,7 +28,7 @@ struct _Vector {
   /* base object. */
   OBJECT_BASE;
 
-  /* @data: array of vector elements.
+  /* @data: shared buffer of vector elements.
    * @n: number of vector elements.
    */
   double *data;
@@ -47,6 +49,8 @@ Vector vector_new_with_length (Zone z, long n);
 
 Vector vector_new_from_range (Zone z, Range r);
 
+Vector vector_new_from_float_range (Zone z, FloatRange r);
+
 Vector vector_copy (Zone z, Vector x);
 
 void vector_free (Zone z, Vector x);
@@ -57,6 +61,8 @@ double vector_get (Vector x, long i);
 
 int vector_set_length (Vector x, long n);
 
+int vector_unshare (Vector x);
+
 void vector_set (Vector x, long i, double xi);
 
 long vector_any (Vector x);
@@ -73,5 +79,12 @@ int vector_const_pow (double f, Vector x);
 
 int vector_negate (Vector x);
 
+Vector vector_fuse (Zone z, Object out, int n, Object *args,
+                    const double **ptr, long *inc, double *val);
+
+Object vector_horzcat (Zone z, int n, va_list vl);
+
+Object vector_vertcat (Zone z, int n, va_list vl);
+
 #endif /* !__MATTE_VECTOR_H__ */
 
@@ -9,41 +9,176 @@
 
 /* include the standard library headers. */
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 
+/* ZONE_BLOCK_BITS, ZONE_BLOCK_SIZE: size of each slab block held by
+ * a zone allocator. blocks are aligned to their size, so the header
+ * of the block owning any unit may be located by masking the unit
+ * address.
+ */
+#define ZONE_BLOCK_BITS  14
+#define ZONE_BLOCK_SIZE  (1UL << ZONE_BLOCK_BITS)
+
+/* ZONE_HEADER: number of bytes reserved at the beginning of each block
+ * for its header. must be at least the size of a block header structure,
+ * and a multiple of the largest object alignment.
+ */
+#define ZONE_HEADER  64
+
+/* ZONE_CLASSES: number of unit size classes held by a zone allocator.
+ * ZONE_UNIT_MIN: number of bytes per unit in the smallest class.
+ * ZONE_UNIT_MAX: number of bytes per unit in the largest class.
+ *
+ * the unit size of each class is twice that of the previous class.
+ * requests larger than ZONE_UNIT_MAX are served by dedicated blocks.
+ */
+#define ZONE_CLASSES   4
+#define ZONE_UNIT_MIN  16
+#define ZONE_UNIT_MAX  (ZONE_UNIT_MIN << (ZONE_CLASSES - 1))
+
+/* ZONE_LARGE: class index of blocks holding a single large unit.
+ */
+#define ZONE_LARGE  ZONE_CLASSES
+
+/* ZONE_LARGE_TAG: offset of large units from the end of their block
+ * header. large units are held in unaligned blocks from malloc(), and
+ * the offset places them at odd multiples of ZONE_LARGE_TAG, whereas
+ * slab units always lie at even multiples. the owning block of a unit
+ * is therefore located from its address alone.
+ */
+#define ZONE_LARGE_TAG  8
+
+/* ZONE_BLOCK(): macro to locate the block header of a unit pointer.
+ */
+#define ZONE_BLOCK(ptr) \
+  ((uintptr_t) (ptr) & ZONE_LARGE_TAG ? \
+   (ZoneBlock) ((char*) (ptr) - ZONE_HEADER - ZONE_LARGE_TAG) : \
+   (ZoneBlock) ((uintptr_t) (ptr) & ~(uintptr_t) (ZONE_BLOCK_SIZE - 1)))
+
+/* ZONE_UNITS(): macro to get the first unit pointer of a slab block.
+ */
+#define ZONE_UNITS(b) \
+  (((char*) (b)) + ZONE_HEADER)
+
+/* ZONE_LARGE_UNIT(): macro to get the unit pointer of a large block.
+ */
+#define ZONE_LARGE_UNIT(b) \
+  (ZONE_UNITS(b) + ZONE_LARGE_TAG)
+
 /* Zone: pointer to a struct _Zone. */
 typedef struct _Zone *Zone;
 typedef struct _Zone ZoneData;
 
+/* ZoneBlock: pointer to a struct _ZoneBlock. */
+typedef struct _ZoneBlock *ZoneBlock;
+
+/* _ZoneBlock: structure for holding the header of a zone block.
+ */
+struct _ZoneBlock {
+  /* @next: next block in the list of the owning class.
+   * @prev: previous block in the list of the owning class.
+   */
+  ZoneBlock next, prev;
+
+  /* @zone: zone allocator that currently owns the block.
+   * @cls: size class index of the block, or ZONE_LARGE.
+   * @depth: mark depth of the zone when the block was added.
+   */
+  Zone zone;
+  unsigned int cls, depth;
+
+  /* @unit: number of bytes per unit in the block.
+   * @n: number of units held by the block.
+   * @used: number of units that have been handed out from the block.
+   */
+  unsigned long unit, n, used;
+};
+
+/* _ZoneClass: structure for holding the blocks of a single size class.
+ */
+struct _ZoneClass {
+  /* @head: first (oldest) block of the class.
+   * @tail: last (newest) block of the class.
+   */
+  ZoneBlock head, tail;
+
+  /* @avail: list of released units of the class.
+   */
+  void *avail;
+};
+
+/* _ZoneFrame: structure for holding the blocks of all size classes
+ * that were current when a zone mark was placed.
+ */
+struct _ZoneFrame {
+  /* @cls: saved blocks and released units of each size class.
+   */
+  struct _ZoneClass cls[ZONE_CLASSES];
+};
+
+/* ZoneMark: handle to a checkpoint placed within a zone allocator. */
+typedef unsigned int ZoneMark;
+
 /* _Zone: structure for holding a zone allocation context.
+ *
+ * zones are single-threaded: each zone must only be used by one thread
+ * at a time. the cache of released blocks that is shared between zones
+ * is locked internally.
  */
 struct _Zone {
-  /* @data: block of object struct data.
-   * @dend: end of the object data block.
-   * @n: number of objects in the zone.
+  /* @cls: slab blocks and released units of each size class.
    */
-  void *data, *dend;
-  unsigned long n;
+  struct _ZoneClass cls[ZONE_CLASSES];
 
-  /* @av: array of available zone positions.
-   * @nav: size of the availability array.
+  /* @large: list of blocks holding large units.
    */
-  unsigned long *av, nav;
+  ZoneBlock large;
 
-  /* @next: next block of the zone allocation context.
+  /* @frames: saved size classes of each placed mark.
+   * @depth: number of currently placed marks.
+   * @n_frames: number of allocated saved frames.
    */
-  Zone next;
+  struct _ZoneFrame *frames;
+  unsigned int depth, n_frames;
+
+  /* @stage: size classes holding units promoted past a mark.
+   * @stage_large: list of large blocks promoted past a mark.
+   */
+  struct _ZoneClass stage[ZONE_CLASSES];
+  ZoneBlock stage_large;
+
+  /* @locked: whether the units of the zone are immutable, and are never
+   * released before the zone is destroyed.
+   */
+  unsigned int locked;
 };
 
 /* function declarations (zone.c): */
 
 int zone_init (Zone z, unsigned long n);
 
-void *zone_alloc (Zone z);
+void *zone_alloc (Zone z, unsigned long sz);
 
 void zone_free (Zone z, void *ptr);
 
 void zone_destroy (Zone z);
 
+ZoneMark zone_mark (Zone z);
+
+void *zone_promote (Zone z, ZoneMark m, void *ptr);
+
+void zone_promote_vars (Zone z, ZoneMark m, int n, void *vars[]);
+
+void *zone_adopt (Zone z, void *ptr);
+
+void zone_release (Zone z, ZoneMark m);
+
+void zone_sweep (Zone z);
+
+void zone_lock (Zone z);
+
+int zone_is_locked (void *ptr);
+
 #endif /* !__MATTE_ZONE_H__ */
 
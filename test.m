@@ -82,10 +82,15 @@
 % === range ===
 % eq
 1 : 3 == 1 : 1 : 3 % (default step)
+% length
+sum(1 : 2 : 0) == 0
+prod(1 : 2 : 0) == 1
+sum(5 : -2 : 0) == 9
 % plus
 (1 : 3) + (2 : 4) == 3 : 2 : 7
 (1 : 3) + 2 == 3 : 5
 2 + (1 : 3) == 3 : 5
+[1, 2, 3] + (1 : 3) == [2, 4, 6]
 % minus
 (1 : 3) - (2 : 2 : 6) == -1 : -1 : -3
 (1 : 3) - 2 == -1 : 1
@@ -94,9 +99,14 @@
 % times
 (1 : 3) .* 2 == 2 : 2 : 6
 (1 : 3) .* -2 == -2 : -2 : -6
+(1 : 3) .* [1, 2, 3] == [1, 4, 9]
 % mtimes
 (1 : 3) * 2 == 2 : 2 : 6
 (1 : 3) * -2 == -2 : -2 : -6
+(1 : 3) * 0.5 == [0.5, 1, 1.5]
+% rdivide
+(1 : 3) / 0 == [1, 1, 1] ./ 0
+[(-2 : -1) ./ 0, 5] == [-1, -1, 5] ./ [0, 0, 1]
 % mand
 ((1 : 3) && 1) == 1
 ((1 : 3) && 0) == 0
@@ -109,6 +119,7 @@
 ((0 : 2) || 0) == 0
 % horzcat
 [1 : 3, -5, 7 : 9] == [1, 2, 3, -5, 7, 8, 9]
+[1 : 3, 4.5] == [1, 2, 3, 4.5]
 % vertcat
 [1 : 3] == [1 : 3]
 
@@ -296,10 +307,197 @@
 % mtimes
 
 % === vector ===
+% mrdivide
+[1, 2, 3] / 4 == [0.25, 0.5, 0.75]
+% fused element-wise chains
+[1, 2, 3] .* [1, 2, 3] + [1, 2, 3] == [2, 6, 12]
+% subsref
+a = [10, 20, 30, 40];
+a(2) == 20
+a(a > 15) == [20, 30, 40]
+a(2 : 3) == [20, 30]
+a([4, 1]) == [40, 10]
+% mtimes
+(1 : 3) * [1; 2; 3] == 14
+(1 : 3) * (1 : 3)' == 14
+[1, 2, 3] * 2 == [2, 4, 6]
 
 % === matrix ===
+% vertcat
+[1, 2; 3, 4] == [1, 2; 3, 4]
+% plus
+[1, 2; 3, 4] + [1, 1; 1, 1] == [2, 3; 4, 5]
+% uminus
+-[1, 2; 3, 4] == [-1, -2; -3, -4]
+% times
+[1, 2; 3, 4] .* [2, 2; 2, 2] == [2, 4; 6, 8]
+% mtimes
+[1, 2; 3, 4] * [5, 6; 7, 8] == [19, 22; 43, 50]
+[1, 2; 3, 4] * [1; 1] == [3; 7]
+[1, 1] * [1, 2; 3, 4] == [4, 6]
+[1, 2; 3, 4]' * [1, 2; 3, 4] == [10, 14; 14, 20]
+[1, 2; 3, 4] * [1, 0; 1, 1]' == [1, 3; 3, 7]
+[1, 2; 3, 4]' * [1; 1] == [4; 6]
+[1; 2] * [3, 4] == [3, 4; 6, 8]
+% mldivide (triangular)
+[2, 0; 1, 4] \ [2; 9] == [1; 2]
+[2, 1; 0, 4] \ [4; 8] == [1; 2]
+% mldivide (symmetric positive definite)
+[4, 1; 1, 3] \ [5; 4] == [1; 1]
+% mldivide (general)
+[0, 1; 1, 0] \ [3; 5] == [5; 3]
+% mrdivide
+[1, 2] / [2, 0; 1, 4] == [0.25, 0.5]
+[1, 2; 3, 4] / 2 == [0.5, 1; 1.5, 2]
+% power
+[1, 2; 3, 4] .^ 2 == [1, 4; 9, 16]
+% mpower
+[1, 2; 3, 4] ^ 2 == [7, 10; 15, 22]
+% sum
+sum([1, 2; 3, 4]) == [4, 6]
+sum([1, 2; 3, 4], 1) == [4, 6]
+sum([1, 2; 3, 4], 2) == [3; 7]
+sum([1, 2; 3, 4], 3) == [1, 2; 3, 4]
+sum([1, 2; 3, 4]') == [3, 7]
+sum([1, 2; 3, 4]', 2) == [4; 6]
+sum([1 : 100; 1 : 100]') == [5050, 5050]
+sum(1 : 1000) == 500500
+% prod
+prod([1, 2; 3, 4]) == [3, 8]
+prod([1, 2; 3, 4], 2) == [2; 12]
+prod([1, 2; 3, 4]') == [2, 12]
 
 % === complex vector ===
+% plus (split storage)
+[1, 2, 3] + 2i == [1 + 2i, 2 + 2i, 3 + 2i]
+% minus (split storage)
+1i - [1, 2, 3] == [-1 + 1i, -2 + 1i, -3 + 1i]
+% times (split storage)
+([1, 2, 3] + 2i) .* ([1, 2, 3] + 2i) == [-3 + 4i, 8i, 5 + 12i]
+([1, 2, 3] + 2i) .* [1, 0, -1] == [1 + 2i, 0, -3 - 2i]
+% rdivide (split storage)
+([1, 2, 3] + 2i) ./ 2 == [0.5 + 1i, 1 + 1i, 1.5 + 1i]
+% fused element-wise chains
+[1, 2] * 1i + [1, 2] .* [3, 4] - 1 == [2 + 1i, 7 + 2i]
 
 % === complex matrix ===
+% minus (split storage)
+(1i - [1, 2; 3, 4]) - 1i == -[1, 2; 3, 4]
+% times (split storage)
+([1, 2; 3, 4] * 1i) .* ([1, 2; 3, 4] * 1i) == -[1, 4; 9, 16]
+% mtimes
+([1, 2; 3, 4] * 1i) * ([1, 0; 0, 1] * 2) == [2, 4; 6, 8] * 1i
+([1, 2; 3, 4] * 1i) * ([1, 0; 0, 1] * 1i) == -[1, 2; 3, 4]
+% sum
+sum([1, 2; 3, 4] * 1i) == [4, 6] * 1i
+sum([1, 2; 3, 4] * 1i, 2) == [3; 7] * 1i
+sum(([1, 2; 3, 4] * 1i)') == -[3, 7] * 1i
+% prod
+prod([1, 2; 3, 4] * 1i) == -[3, 8]
+
+% === logical ===
+% uminus
+-([1, 2, 3] < 2) == [-1, 0, 0]
+% mtimes
+2 * ([1, 2, 3] < 2) == [2, 0, 0]
+([4, 5, 6] < 5) * 2 == [2, 0, 0]
+([1, 2, 3] < 2) * [1; 2; 3] == 1
+([1, 2, 3] < 2) * ([1, 2, 3] < 2)' == 1
+[1, 2; 3, 4] * ([1, 2] < 2)' == [1; 3]
+% mrdivide
+([1, 2, 3] < 3) / 2 == [0.5, 0.5, 0]
+% mldivide
+2 \ ([1, 2, 3] < 3) == [0.5, 0.5, 0]
+% horzcat
+[[1, 2, 3] < 2, 5] == [1, 0, 0, 5]
+% vertcat
+[[1, 2, 3] < 2; [1, 2, 3] > 2] == [1, 0, 0; 0, 0, 1]
+
+% === single ===
+% plus
+single([1, 2]) + 1 == single([2, 3])
+% times
+single([1, 2]) .* [3, 4] == [3, 8]
+% mtimes
+single([1, 2; 3, 4]) * single([5, 6; 7, 8]) == [19, 22; 43, 50]
+single([1, 2, 3]) * single([1; 2; 3]) == 14
+single([1; 2]) * single([3, 4]) == [3, 4; 6, 8]
+% sum
+sum(single([1, 2, 3])) == 6
+sum(single([1, 2; 3, 4])) == [4, 6]
+sum(single([1, 2; 3, 4]), 2) == [3; 7]
+% prod
+prod(single([1, 2, 3, 4])) == 24
+
+% === sparse ===
+% mtimes
+sparse([1, 0; 0, 2]) * [1; 1] == [1; 2]
+% sum
+sum(sparse([1, 0, 2; 0, 3, 0])) == [1, 3, 2]
+sum(sparse([1, 0, 2; 0, 3, 0]), 2) == [3; 3]
+% prod
+prod(sparse([1, 0, 2; 0, 3, 0])) == [0, 0, 0]
+prod(sparse([1, 2; 3, 4]), 2) == [2; 12]
+
+% === int32 array ===
+% plus
+int32([1, 2, 3]) + 0.5 == int32([2, 3, 4])
+int32([2147483647, 1]) + 10.0 == [2147483647, 11]
+% minus
+int32([1, 2, 3]) - [0.4, 0.6, 1.5] == int32([1, 1, 2])
+% mtimes
+int32([1, 2]) * 0.5 == int32([1, 1])
+0.5 * int32([1, 3]) == int32([1, 2])
+% rdivide
+int32([7, -7, 5, -5]) ./ 2 == int32([4, -4, 3, -3])
+int32([4, 6]) ./ 4.0 == int32([1, 2])
+% mrdivide
+int32([7, 8]) / int32(3) == int32([2, 3])
+% horzcat
+[int32([1, 2]), 2.5] == int32([1, 2, 3])
 
+% === loops ===
+% temporaries released per iteration
+s = [0, 0, 0];
+for i = 1 : 1000
+  s = s + [1, 2, 3] * i;
+end
+s == [500500, 1001000, 1501500]
+% break and continue
+t = [1, 1];
+k = 0;
+while k < 500
+  k = k + 1;
+  if k > 300
+    break;
+  end
+  if k > 10
+    continue;
+  end
+  t = t .* [2, 1];
+end
+t == [1024, 1]
+k == 301
+% nested loops
+m = [0, 0; 0, 0];
+for i = 1 : 20
+  for j = 1 : 20
+    m = m + [1, 0; 0, 1];
+  end
+  u = m;
+end
+u == [400, 0; 0, 400]
+% loop-carried scalars
+c = 1i;
+for i = 1 : 4
+  c = c * 1i;
+end
+c == 1i
+% aliased loop variables
+a = [1, 2];
+for i = 1 : 100
+  b = a;
+  a = a + 1;
+end
+a == [101, 102]
+b == [100, 101]